@@ -2,6 +2,12 @@
 
 import PackageDescription
 
+// ecliptix_testing_reset_server_key replaces the pinned trust anchor, so it
+// is compiled only when the package is built for its own tests (`make test`
+// sets ECLIPTIX_CLIENT_TESTING=1). App builds, debug or release, never
+// contain it, and the pinning tests that depend on it exist only then.
+let clientTesting = Context.environment["ECLIPTIX_CLIENT_TESTING"] == "1"
+
 let package = Package(
     name: "EcliptixWorkspace",
     platforms: [
@@ -51,25 +57,43 @@ let package = Package(
                 "EcliptixCore",
                 "EcliptixSecurity",
                 "EcliptixProto",
+                "CEcliptixNetworking",
                 "Clibsodium",
                 .product(name: "GRPCCore", package: "grpc-swift-2"),
                 .product(name: "GRPCNIOTransportHTTP2", package: "grpc-swift-nio-transport"),
                 .product(name: "SwiftProtobuf", package: "swift-protobuf"),
             ],
             path: "Packages/EcliptixNetworking/Sources"),
+        .testTarget(
+            name: "EcliptixNetworkingTests",
+            dependencies: ["EcliptixNetworking", "EcliptixSecurity"],
+            path: "Packages/EcliptixNetworking/Tests"),
+
+        // Networking runtime - native engines behind a pure C API for Swift interop
+        .target(
+            name: "CEcliptixNetworking",
+            dependencies: ["Clibsodium"],
+            path: "Packages/EcliptixNetworking/Native",
+            sources: ["src"],
+            publicHeadersPath: "include",
+            linkerSettings: [
+                .linkedLibrary("c++")
+            ]
+        ),
 
         .target(
             name: "EcliptixSecurity",
             dependencies: [
                 "EcliptixCore",
                 "EcliptixProto",
+                "EcliptixCertificatePinning",
                 "Clibsodium",
                 .product(name: "Crypto", package: "swift-crypto"),
             ],
             path: "Packages/EcliptixSecurity/Sources"),
         .testTarget(
             name: "EcliptixSecurityTests",
-            dependencies: ["EcliptixSecurity"],
+            dependencies: ["EcliptixSecurity", "EcliptixCertificatePinning"],
             path: "Packages/EcliptixSecurity/Tests"),
 
         .target(
@@ -115,6 +139,27 @@ let package = Package(
             ]
         ),
 
+        // OPAQUE responder extensions - test-only, no product or app target may depend on it.
+        // libopaque_client.a ships the initiator alone, so OpaqueResponder, responder::* and
+        // oblivious_prf come from Tests/Support/core_stand_in.cpp, a test stand-in for the core
+        .target(
+            name: "OpaqueResponder",
+            dependencies: ["Clibsodium"],
+            path: "Packages/EcliptixOPAQUE",
+            sources: ["src"],
+            publicHeadersPath: "include",
+            cxxSettings: [
+                .headerSearchPath("src")
+            ],
+            linkerSettings: [
+                .linkedLibrary("c++")
+            ]
+        ),
+        .testTarget(
+            name: "OpaqueResponderTests",
+            dependencies: ["OpaqueResponder", "Clibsodium"],
+            path: "Packages/EcliptixOPAQUE/Tests"),
+
         // Certificate Pinning C header - pure C API
         .target(
             name: "CCertificatePinning",
@@ -136,6 +181,23 @@ let package = Package(
                 ])
             ]
         ),
+
+        // Certificate pinning runtime - C sources over the ecliptix_client library,
+        // OpenSSL for RSA verification and SHA-256, libsodium
+        // (crypto_sign_verify_detached) for Ed25519 verification
+        .target(
+            name: "CEcliptixClient",
+            dependencies: ["ecliptix_client", "OpenSSLCrypto", "Clibsodium"],
+            path: "Packages/EcliptixCertificatePinning/Sources/CEcliptixClient",
+            publicHeadersPath: "include",
+            cSettings: clientTesting ? [.define("ECLIPTIX_CLIENT_TESTING")] : []
+        ),
+        .target(
+            name: "EcliptixCertificatePinning",
+            dependencies: ["EcliptixCore", "CEcliptixClient"],
+            path: "Packages/EcliptixCertificatePinning/Sources/EcliptixCertificatePinning"
+        ),
+
         .binaryTarget(
             name: "Clibsodium",
             path: "ThirdParty/xcframeworks/Clibsodium.xcframework"
@@ -161,5 +223,22 @@ let package = Package(
             path: "Packages/EcliptixOPAQUE/Sources/EcliptixOPAQUE"
         ),
 
-    ]
+    ],
+    cxxLanguageStandard: .cxx20
 )
+
+if clientTesting {
+    package.targets.append(
+        .testTarget(
+            name: "EcliptixCertificatePinningTests",
+            dependencies: [
+                "EcliptixCertificatePinning",
+                "CEcliptixClient",
+                .product(name: "Crypto", package: "swift-crypto"),
+            ],
+            path: "Packages/EcliptixCertificatePinning/Tests",
+            swiftSettings: [
+                .unsafeFlags(["-Xcc", "-DECLIPTIX_CLIENT_TESTING"])
+            ])
+    )
+}
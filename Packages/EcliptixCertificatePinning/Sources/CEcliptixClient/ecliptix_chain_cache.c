@@ -0,0 +1,233 @@
+#include "ecliptix_chain_cache.h"
+
+#include <OpenSSL/evp.h>
+#include <OpenSSL/x509.h>
+#include <stdatomic.h>
+#include <string.h>
+
+#include "ecliptix_pin_set.h"
+
+#define CHAIN_CACHE_SLOTS 64
+#define CHAIN_CACHE_MAX_TTL_SECONDS (24 * 60 * 60)
+#define CHAIN_CACHE_REJECT_TTL_SECONDS 60
+#define CHAIN_HASH_WORDS 4
+
+// One direct-mapped slot guarded by a sequence lock: a writer makes `seq`
+// odd while it fills the slot, and a reader that sees an odd or changed
+// `seq` treats the lookup as a miss instead of retrying. Fields are atomics
+// so the torn reads the sequence check discards are still well-defined.
+typedef struct {
+    atomic_uint seq;
+    atomic_uint_least64_t key[CHAIN_HASH_WORDS];
+    atomic_int_least64_t valid_from;
+    atomic_int_least64_t expires_at;
+    atomic_uint pin_version;
+    atomic_int accepted;
+} chain_cache_slot_t;
+
+static chain_cache_slot_t g_slots[CHAIN_CACHE_SLOTS];
+static atomic_uint_least64_t g_hits;
+static atomic_uint_least64_t g_misses;
+static atomic_uint_least64_t g_stores;
+
+static int hash_chain(const uint8_t* const* certs, const size_t* cert_lens, size_t count, uint64_t* key) {
+    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+    uint8_t digest[32];
+    int ok = ctx != NULL && EVP_DigestInit_ex(ctx, EVP_sha256(), NULL) == 1;
+    for (size_t i = 0; ok && i < count; ++i) {
+        const uint8_t length[4] = {
+            (uint8_t)(cert_lens[i] >> 24), (uint8_t)(cert_lens[i] >> 16),
+            (uint8_t)(cert_lens[i] >> 8), (uint8_t)cert_lens[i]
+        };
+        ok = EVP_DigestUpdate(ctx, length, sizeof(length)) == 1 &&
+             EVP_DigestUpdate(ctx, certs[i], cert_lens[i]) == 1;
+    }
+    ok = ok && EVP_DigestFinal_ex(ctx, digest, NULL) == 1;
+    EVP_MD_CTX_free(ctx);
+    if (ok) {
+        memcpy(key, digest, sizeof(digest));
+    }
+    return ok;
+}
+
+static int cache_lookup(const uint64_t* key, int64_t now_unix, uint32_t pin_version, int* accepted) {
+    chain_cache_slot_t* slot = &g_slots[key[0] % CHAIN_CACHE_SLOTS];
+    const unsigned before = atomic_load_explicit(&slot->seq, memory_order_acquire);
+    if (before & 1u) {
+        return 0;
+    }
+    int matches = 1;
+    for (int i = 0; i < CHAIN_HASH_WORDS; ++i) {
+        matches &= atomic_load_explicit(&slot->key[i], memory_order_relaxed) == key[i];
+    }
+    const int64_t valid_from = atomic_load_explicit(&slot->valid_from, memory_order_relaxed);
+    const int64_t expires_at = atomic_load_explicit(&slot->expires_at, memory_order_relaxed);
+    const unsigned version = atomic_load_explicit(&slot->pin_version, memory_order_relaxed);
+    const int decision = atomic_load_explicit(&slot->accepted, memory_order_relaxed);
+    atomic_thread_fence(memory_order_acquire);
+    if (atomic_load_explicit(&slot->seq, memory_order_relaxed) != before) {
+        return 0;
+    }
+    if (!matches || version != pin_version || now_unix < valid_from || now_unix >= expires_at) {
+        return 0;
+    }
+    *accepted = decision;
+    return 1;
+}
+
+static int slot_write(chain_cache_slot_t* slot, const uint64_t* key, int64_t valid_from,
+                      int64_t expires_at, uint32_t pin_version, int accepted) {
+    unsigned seq = atomic_load_explicit(&slot->seq, memory_order_relaxed);
+    // A concurrent writer already owns the slot; dropping this store only
+    // costs a future miss.
+    if ((seq & 1u) || !atomic_compare_exchange_strong_explicit(
+            &slot->seq, &seq, seq + 1, memory_order_acquire, memory_order_relaxed)) {
+        return 0;
+    }
+    atomic_thread_fence(memory_order_release);
+    for (int i = 0; i < CHAIN_HASH_WORDS; ++i) {
+        atomic_store_explicit(&slot->key[i], key[i], memory_order_relaxed);
+    }
+    atomic_store_explicit(&slot->valid_from, valid_from, memory_order_relaxed);
+    atomic_store_explicit(&slot->expires_at, expires_at, memory_order_relaxed);
+    atomic_store_explicit(&slot->pin_version, pin_version, memory_order_relaxed);
+    atomic_store_explicit(&slot->accepted, accepted, memory_order_relaxed);
+    atomic_store_explicit(&slot->seq, seq + 2, memory_order_release);
+    return 1;
+}
+
+static void cache_store(const uint64_t* key, int64_t valid_from, int64_t expires_at,
+                        uint32_t pin_version, int accepted) {
+    if (slot_write(&g_slots[key[0] % CHAIN_CACHE_SLOTS], key, valid_from, expires_at, pin_version, accepted)) {
+        atomic_fetch_add_explicit(&g_stores, 1, memory_order_relaxed);
+    }
+}
+
+static int spki_is_pinned(X509* cert) {
+    unsigned char* der = NULL;
+    const int der_len = i2d_X509_PUBKEY(X509_get_X509_PUBKEY(cert), &der);
+    uint8_t spki_sha256[ECLIPTIX_SPKI_HASH_LEN];
+    const int hashed = der_len > 0 &&
+        EVP_Digest(der, (size_t)der_len, spki_sha256, NULL, EVP_sha256(), NULL) == 1;
+    OPENSSL_free(der);
+    return hashed && ecliptix_pin_set_contains(spki_sha256) == ECLIPTIX_SUCCESS;
+}
+
+// Full evaluation on a miss. Returns the accept decision and, through
+// `not_before` / `not_after`, the window in which every certificate in
+// the chain is valid.
+static int evaluate_chain(const uint8_t* const* certs, const size_t* cert_lens, size_t count,
+                          int64_t now_unix, int64_t* not_before, int64_t* not_after) {
+    X509* parsed[ECLIPTIX_CHAIN_CACHE_MAX_CERTS] = {0};
+    int accepted = 1;
+    int pinned = 0;
+    *not_before = INT64_MIN;
+    *not_after = now_unix + CHAIN_CACHE_MAX_TTL_SECONDS;
+
+    ASN1_TIME* now = ASN1_TIME_set(NULL, (time_t)now_unix);
+    accepted = now != NULL;
+    for (size_t i = 0; accepted && i < count; ++i) {
+        const unsigned char* der = certs[i];
+        parsed[i] = d2i_X509(NULL, &der, (long)cert_lens[i]);
+        if (parsed[i] == NULL || der != certs[i] + cert_lens[i]) {
+            accepted = 0;
+            break;
+        }
+
+        int days_before = 0;
+        int seconds_before = 0;
+        int days_after = 0;
+        int seconds_after = 0;
+        if (ASN1_TIME_diff(&days_before, &seconds_before, now, X509_get0_notBefore(parsed[i])) != 1 ||
+            ASN1_TIME_diff(&days_after, &seconds_after, now, X509_get0_notAfter(parsed[i])) != 1 ||
+            days_before > 0 || seconds_before > 0 ||
+            days_after < 0 || seconds_after < 0 || (days_after == 0 && seconds_after == 0)) {
+            accepted = 0;
+            break;
+        }
+        const int64_t valid_from = now_unix + (int64_t)days_before * 86400 + seconds_before;
+        const int64_t expiry = now_unix + (int64_t)days_after * 86400 + seconds_after;
+        if (valid_from > *not_before) {
+            *not_before = valid_from;
+        }
+        if (expiry < *not_after) {
+            *not_after = expiry;
+        }
+
+        pinned |= spki_is_pinned(parsed[i]);
+    }
+
+    for (size_t i = 0; accepted && i + 1 < count; ++i) {
+        EVP_PKEY* issuer_key = X509_get0_pubkey(parsed[i + 1]);
+        accepted = issuer_key != NULL && X509_verify(parsed[i], issuer_key) == 1;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        X509_free(parsed[i]);
+    }
+    ASN1_TIME_free(now);
+    return accepted && pinned;
+}
+
+ecliptix_result_t ecliptix_chain_validate(
+    const uint8_t* const* certs,
+    const size_t* cert_lens,
+    size_t count,
+    int64_t now_unix,
+    int* cache_hit) {
+    if (cache_hit != NULL) {
+        *cache_hit = 0;
+    }
+    if (certs == NULL || cert_lens == NULL || count == 0 || count > ECLIPTIX_CHAIN_CACHE_MAX_CERTS) {
+        return ECLIPTIX_ERROR_INVALID_PARAMS;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (certs[i] == NULL || cert_lens[i] == 0 || cert_lens[i] > UINT32_MAX) {
+            return ECLIPTIX_ERROR_INVALID_PARAMS;
+        }
+    }
+
+    uint64_t key[CHAIN_HASH_WORDS];
+    if (!hash_chain(certs, cert_lens, count, key)) {
+        return ECLIPTIX_ERROR_CRYPTO_FAILURE;
+    }
+
+    // Read before evaluating: if the pin set changes mid-evaluation the
+    // stored entry carries the old version and is never served.
+    const uint32_t pin_version = ecliptix_pin_set_version();
+    int accepted = 0;
+    if (cache_lookup(key, now_unix, pin_version, &accepted)) {
+        atomic_fetch_add_explicit(&g_hits, 1, memory_order_relaxed);
+        if (cache_hit != NULL) {
+            *cache_hit = 1;
+        }
+        return accepted ? ECLIPTIX_SUCCESS : ECLIPTIX_ERROR_VERIFICATION_FAILED;
+    }
+    atomic_fetch_add_explicit(&g_misses, 1, memory_order_relaxed);
+
+    int64_t not_before = 0;
+    int64_t not_after = 0;
+    accepted = evaluate_chain(certs, cert_lens, count, now_unix, &not_before, &not_after);
+    if (accepted) {
+        cache_store(key, not_before, not_after, pin_version, 1);
+    } else {
+        cache_store(key, now_unix, now_unix + CHAIN_CACHE_REJECT_TTL_SECONDS, pin_version, 0);
+    }
+    return accepted ? ECLIPTIX_SUCCESS : ECLIPTIX_ERROR_VERIFICATION_FAILED;
+}
+
+void ecliptix_chain_cache_clear(void) {
+    static const uint64_t empty_key[CHAIN_HASH_WORDS] = {0};
+    for (size_t i = 0; i < CHAIN_CACHE_SLOTS; ++i) {
+        slot_write(&g_slots[i], empty_key, INT64_MAX, INT64_MIN, 0, 0);
+    }
+}
+
+void ecliptix_chain_cache_get_stats(ecliptix_chain_cache_stats_t* stats) {
+    if (stats == NULL) {
+        return;
+    }
+    stats->hits = atomic_load_explicit(&g_hits, memory_order_relaxed);
+    stats->misses = atomic_load_explicit(&g_misses, memory_order_relaxed);
+    stats->stores = atomic_load_explicit(&g_stores, memory_order_relaxed);
+}
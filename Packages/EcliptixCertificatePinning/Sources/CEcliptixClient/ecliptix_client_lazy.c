@@ -0,0 +1,98 @@
+#include "ecliptix_client_lazy.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <time.h>
+
+static pthread_mutex_t g_init_mutex = PTHREAD_MUTEX_INITIALIZER;
+static atomic_int g_initialized = 0;
+static ecliptix_result_t g_init_result = ECLIPTIX_ERROR_INIT_FAILED;
+static ecliptix_init_timings_t g_timings;
+static int g_first_use_recorded = 0;
+static uint64_t g_first_request_ns = 0;
+
+static uint64_t monotonic_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+static ecliptix_result_t ensure_init(int from_warm_up) {
+    if (atomic_load_explicit(&g_initialized, memory_order_acquire)) {
+        return ECLIPTIX_SUCCESS;
+    }
+
+    const uint64_t wait_started = monotonic_ns();
+    pthread_mutex_lock(&g_init_mutex);
+
+    if (g_first_request_ns == 0) {
+        g_first_request_ns = wait_started;
+    }
+
+    ecliptix_result_t result = ECLIPTIX_SUCCESS;
+    if (!atomic_load_explicit(&g_initialized, memory_order_relaxed)) {
+        const uint64_t init_started = monotonic_ns();
+        g_init_result = (ecliptix_result_t)ecliptix_client_init();
+        const uint64_t init_finished = monotonic_ns();
+
+        g_timings.stage_ns[ECLIPTIX_INIT_STAGE_KEY_LOADING] = init_finished - init_started;
+        g_timings.total_ns = init_finished - g_first_request_ns;
+        g_timings.warmed_up = from_warm_up;
+        if (g_init_result == ECLIPTIX_SUCCESS) {
+            g_timings.initialized = 1;
+            atomic_store_explicit(&g_initialized, 1, memory_order_release);
+        }
+        result = g_init_result;
+    }
+
+    if (!from_warm_up && !g_first_use_recorded) {
+        g_first_use_recorded = 1;
+        g_timings.stage_ns[ECLIPTIX_INIT_STAGE_FIRST_USE_WAIT] = monotonic_ns() - wait_started;
+    }
+
+    pthread_mutex_unlock(&g_init_mutex);
+    return result;
+}
+
+static void* warm_up_thread(void* unused) {
+    (void)unused;
+    (void)ensure_init(1);
+    return NULL;
+}
+
+ecliptix_result_t ecliptix_client_ensure_init(void) {
+    return ensure_init(0);
+}
+
+void ecliptix_client_warm_up(void) {
+    if (atomic_load_explicit(&g_initialized, memory_order_acquire)) {
+        return;
+    }
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, warm_up_thread, NULL) == 0) {
+        pthread_detach(thread);
+    }
+}
+
+void ecliptix_client_lazy_cleanup(void) {
+    pthread_mutex_lock(&g_init_mutex);
+    if (atomic_load_explicit(&g_initialized, memory_order_relaxed)) {
+        ecliptix_client_cleanup();
+        atomic_store_explicit(&g_initialized, 0, memory_order_release);
+    }
+    memset(&g_timings, 0, sizeof(g_timings));
+    g_first_use_recorded = 0;
+    g_first_request_ns = 0;
+    pthread_mutex_unlock(&g_init_mutex);
+}
+
+ecliptix_result_t ecliptix_client_get_init_timings(ecliptix_init_timings_t* timings) {
+    if (timings == NULL) {
+        return ECLIPTIX_ERROR_INVALID_PARAMS;
+    }
+    pthread_mutex_lock(&g_init_mutex);
+    *timings = g_timings;
+    pthread_mutex_unlock(&g_init_mutex);
+    return ECLIPTIX_SUCCESS;
+}
@@ -0,0 +1,468 @@
+#include "ecliptix_pin_set.h"
+
+#include <OpenSSL/crypto.h>
+#include <OpenSSL/evp.h>
+#include <OpenSSL/x509.h>
+#include <pthread.h>
+#include <sodium.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ecliptix_chain_cache.h"
+#include "ecliptix_client_testing.h"
+#include "ecliptix_server_key.h"
+#include "ecliptix_verify_batch_runner.h"
+
+#define PIN_LIST_MAGIC "EPL1"
+#define PIN_LIST_HEADER_LEN 10
+#define PIN_TABLE_SLOT_BITS 8
+#define PIN_TABLE_MAX_SLOTS (1 << PIN_TABLE_SLOT_BITS)
+#define PIN_TABLE_SEED_ATTEMPTS 4096
+
+typedef struct {
+    uint8_t spki_sha256[ECLIPTIX_SPKI_HASH_LEN];
+    ecliptix_key_type_t type;
+    EVP_PKEY* key;
+    EVP_MD_CTX* prepared;
+    uint8_t ed25519_public_key[crypto_sign_PUBLICKEYBYTES];
+    ecliptix_batch_verifier_fn verifier;
+    const void* verifier_context;
+} pin_entry_t;
+
+// Immutable once published. Slots form a perfect hash over the SPKI
+// hashes: every pinned key has its own slot, so a lookup is one probe and
+// one constant-time compare, whether or not the key is pinned.
+typedef struct {
+    atomic_int refs;
+    uint32_t version;
+    size_t count;
+    pin_entry_t entries[ECLIPTIX_PIN_SET_MAX_KEYS];
+    uint64_t seed;
+    int8_t slots[PIN_TABLE_MAX_SLOTS];
+} pin_set_t;
+
+static pthread_mutex_t g_active_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t g_active_once = PTHREAD_ONCE_INIT;
+static pin_set_t* g_active = NULL;
+// Mirrors g_active->version so callers that only need to detect a change
+// (the chain cache) can read it without taking the mutex.
+static atomic_uint g_active_version = 0;
+
+static uint64_t load_be64(const uint8_t* p) {
+    uint64_t value = 0;
+    for (int i = 0; i < 8; ++i) {
+        value = (value << 8) | p[i];
+    }
+    return value;
+}
+
+static size_t slot_for(const pin_set_t* set, const uint8_t* spki_sha256) {
+    uint64_t h = load_be64(spki_sha256) ^ (set->seed * 0x9e3779b97f4a7c15ULL);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return (size_t)(h >> (64 - PIN_TABLE_SLOT_BITS));
+}
+
+// Every set hashes into the whole table. With ECLIPTIX_PIN_SET_MAX_KEYS
+// keys in PIN_TABLE_MAX_SLOTS slots a seed is collision-free about one
+// time in eight, so running out of seeds happens with probability below
+// 1e-250; smaller sets fare better still.
+static int build_perfect_hash(pin_set_t* set) {
+    for (uint64_t seed = 0; seed < PIN_TABLE_SEED_ATTEMPTS; ++seed) {
+        set->seed = seed;
+        memset(set->slots, -1, sizeof(set->slots));
+        size_t placed = 0;
+        for (; placed < set->count; ++placed) {
+            const size_t slot = slot_for(set, set->entries[placed].spki_sha256);
+            if (set->slots[slot] >= 0) {
+                break;
+            }
+            set->slots[slot] = (int8_t)placed;
+        }
+        if (placed == set->count) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int verify_ed25519_item(const void* context, EVP_MD_CTX* scratch, const ecliptix_verify_item_t* item) {
+    (void)scratch;
+    if ((item->data == NULL && item->data_len != 0) || item->signature == NULL ||
+        item->sig_len != crypto_sign_BYTES) {
+        return 0;
+    }
+    return crypto_sign_verify_detached(item->signature, item->data, item->data_len, context) == 0;
+}
+
+static void pin_set_free(pin_set_t* set) {
+    if (set == NULL) {
+        return;
+    }
+    for (size_t i = 0; i < set->count; ++i) {
+        EVP_MD_CTX_free(set->entries[i].prepared);
+        EVP_PKEY_free(set->entries[i].key);
+    }
+    free(set);
+}
+
+static void pin_set_release(pin_set_t* set) {
+    if (set != NULL && atomic_fetch_sub_explicit(&set->refs, 1, memory_order_acq_rel) == 1) {
+        pin_set_free(set);
+    }
+}
+
+static int add_key(pin_set_t* set, EVP_PKEY* key) {
+    unsigned char* der = NULL;
+    const int der_len = i2d_PUBKEY(key, &der);
+    if (der_len <= 0) {
+        return 0;
+    }
+    pin_entry_t* entry = &set->entries[set->count];
+    const int hashed = EVP_Digest(der, (size_t)der_len, entry->spki_sha256, NULL, EVP_sha256(), NULL);
+    OPENSSL_free(der);
+    if (hashed != 1) {
+        return 0;
+    }
+
+    for (size_t i = 0; i < set->count; ++i) {
+        if (memcmp(set->entries[i].spki_sha256, entry->spki_sha256, ECLIPTIX_SPKI_HASH_LEN) == 0) {
+            return 0;
+        }
+    }
+
+    switch (EVP_PKEY_base_id(key)) {
+    case EVP_PKEY_RSA:
+        entry->prepared = EVP_MD_CTX_new();
+        if (entry->prepared == NULL ||
+            EVP_DigestVerifyInit(entry->prepared, NULL, EVP_sha256(), NULL, key) != 1) {
+            EVP_MD_CTX_free(entry->prepared);
+            entry->prepared = NULL;
+            return 0;
+        }
+        entry->type = ECLIPTIX_KEY_TYPE_RSA;
+        entry->verifier = ecliptix_verify_rsa_item;
+        entry->verifier_context = entry->prepared;
+        break;
+    case EVP_PKEY_ED25519: {
+        size_t key_len = sizeof(entry->ed25519_public_key);
+        if (EVP_PKEY_get_raw_public_key(key, entry->ed25519_public_key, &key_len) != 1 ||
+            key_len != sizeof(entry->ed25519_public_key)) {
+            return 0;
+        }
+        entry->type = ECLIPTIX_KEY_TYPE_ED25519;
+        entry->verifier = verify_ed25519_item;
+        entry->verifier_context = entry->ed25519_public_key;
+        break;
+    }
+    default:
+        return 0;
+    }
+    entry->key = key;
+    ++set->count;
+    return 1;
+}
+
+static pin_set_t* pin_set_new(uint32_t version) {
+    pin_set_t* set = calloc(1, sizeof(*set));
+    if (set != NULL) {
+        atomic_init(&set->refs, 1);
+        set->version = version;
+    }
+    return set;
+}
+
+static pin_set_t* builtin_set(void) {
+    EVP_PKEY* server_key = ecliptix_server_public_key();
+    pin_set_t* set = pin_set_new(0);
+    if (set == NULL || server_key == NULL || !EVP_PKEY_up_ref(server_key)) {
+        free(set);
+        return NULL;
+    }
+    if (!add_key(set, server_key) || !build_perfect_hash(set)) {
+        EVP_PKEY_free(server_key);
+        pin_set_free(set);
+        return NULL;
+    }
+    return set;
+}
+
+static void install_builtin(void) {
+    if (sodium_init() < 0) {
+        return;
+    }
+    g_active = builtin_set();
+}
+
+// The mutex only guards the pointer load and reference increment; all
+// verification work happens on the snapshot outside of it.
+static pin_set_t* pin_set_acquire(void) {
+    pthread_once(&g_active_once, install_builtin);
+    pthread_mutex_lock(&g_active_mutex);
+    pin_set_t* set = g_active;
+    if (set != NULL) {
+        atomic_fetch_add_explicit(&set->refs, 1, memory_order_relaxed);
+    }
+    pthread_mutex_unlock(&g_active_mutex);
+    return set;
+}
+
+static const pin_entry_t* pin_set_find(const pin_set_t* set, const uint8_t* spki_sha256) {
+    const int8_t index = set->slots[slot_for(set, spki_sha256)];
+    const pin_entry_t* entry = &set->entries[index >= 0 ? index : 0];
+    const int matches = CRYPTO_memcmp(entry->spki_sha256, spki_sha256, ECLIPTIX_SPKI_HASH_LEN) == 0;
+    return (index >= 0 && matches) ? entry : NULL;
+}
+
+static ecliptix_result_t verify_with(const pin_entry_t* entry, const uint8_t* data, size_t data_len,
+                                     const uint8_t* signature, size_t sig_len) {
+    const ecliptix_verify_item_t item = {
+        .data = data,
+        .data_len = data_len,
+        .signature = signature,
+        .sig_len = sig_len,
+    };
+    EVP_MD_CTX* scratch = NULL;
+    if (entry->type == ECLIPTIX_KEY_TYPE_RSA && (scratch = EVP_MD_CTX_new()) == NULL) {
+        return ECLIPTIX_ERROR_CRYPTO_FAILURE;
+    }
+    const int verified = entry->verifier(entry->verifier_context, scratch, &item);
+    EVP_MD_CTX_free(scratch);
+    if (verified < 0) {
+        return ECLIPTIX_ERROR_CRYPTO_FAILURE;
+    }
+    return verified ? ECLIPTIX_SUCCESS : ECLIPTIX_ERROR_VERIFICATION_FAILED;
+}
+
+static pin_set_t* parse_pin_list(const uint8_t* list, size_t len) {
+    if (len < PIN_LIST_HEADER_LEN || memcmp(list, PIN_LIST_MAGIC, 4) != 0) {
+        return NULL;
+    }
+    const uint32_t version = ((uint32_t)list[4] << 24) | ((uint32_t)list[5] << 16) |
+                             ((uint32_t)list[6] << 8) | (uint32_t)list[7];
+    const size_t key_count = ((size_t)list[8] << 8) | list[9];
+    if (key_count == 0 || key_count > ECLIPTIX_PIN_SET_MAX_KEYS) {
+        return NULL;
+    }
+
+    pin_set_t* set = pin_set_new(version);
+    if (set == NULL) {
+        return NULL;
+    }
+    size_t offset = PIN_LIST_HEADER_LEN;
+    for (size_t i = 0; i < key_count; ++i) {
+        if (len - offset < 2) {
+            pin_set_free(set);
+            return NULL;
+        }
+        const size_t der_len = ((size_t)list[offset] << 8) | list[offset + 1];
+        offset += 2;
+        if (der_len == 0 || len - offset < der_len) {
+            pin_set_free(set);
+            return NULL;
+        }
+        const unsigned char* der = list + offset;
+        EVP_PKEY* key = d2i_PUBKEY(NULL, &der, (long)der_len);
+        if (key == NULL || der != list + offset + der_len || !add_key(set, key)) {
+            EVP_PKEY_free(key);
+            pin_set_free(set);
+            return NULL;
+        }
+        offset += der_len;
+    }
+    if (offset != len || !build_perfect_hash(set)) {
+        pin_set_free(set);
+        return NULL;
+    }
+    return set;
+}
+
+ecliptix_result_t ecliptix_pin_set_install(
+    const uint8_t* pin_list,
+    size_t pin_list_len,
+    const uint8_t* signer_spki_sha256,
+    const uint8_t* signature,
+    size_t sig_len,
+    uint32_t min_version) {
+    if (pin_list == NULL || signer_spki_sha256 == NULL || signature == NULL || sig_len == 0) {
+        return ECLIPTIX_ERROR_INVALID_PARAMS;
+    }
+
+    pin_set_t* replacement = NULL;
+    for (;;) {
+        pin_set_t* current = pin_set_acquire();
+        if (current == NULL) {
+            pin_set_free(replacement);
+            return ECLIPTIX_ERROR_INIT_FAILED;
+        }
+        const pin_entry_t* signer = pin_set_find(current, signer_spki_sha256);
+        ecliptix_result_t result = signer == NULL
+            ? ECLIPTIX_ERROR_VERIFICATION_FAILED
+            : verify_with(signer, pin_list, pin_list_len, signature, sig_len);
+        if (result == ECLIPTIX_SUCCESS && replacement == NULL) {
+            replacement = parse_pin_list(pin_list, pin_list_len);
+            result = replacement == NULL ? ECLIPTIX_ERROR_INVALID_PARAMS : ECLIPTIX_SUCCESS;
+        }
+        if (result == ECLIPTIX_SUCCESS && replacement->version < min_version) {
+            result = ECLIPTIX_ERROR_VERIFICATION_FAILED;
+        }
+        if (result != ECLIPTIX_SUCCESS) {
+            pin_set_release(current);
+            pin_set_free(replacement);
+            return result;
+        }
+
+        // The signer was checked against `current`, so only replace that
+        // set. If another install got there first, check the signer again
+        // against the set it published. Holding a reference to `current`
+        // keeps its address from being reused by a newer set.
+        pthread_mutex_lock(&g_active_mutex);
+        if (g_active != current) {
+            pthread_mutex_unlock(&g_active_mutex);
+            pin_set_release(current);
+            continue;
+        }
+        if (replacement->version <= current->version) {
+            pthread_mutex_unlock(&g_active_mutex);
+            pin_set_release(current);
+            pin_set_free(replacement);
+            return ECLIPTIX_ERROR_VERIFICATION_FAILED;
+        }
+        g_active = replacement;
+        atomic_store_explicit(&g_active_version, replacement->version, memory_order_release);
+        pthread_mutex_unlock(&g_active_mutex);
+
+        // Once for this call's reference, once for the one g_active held.
+        pin_set_release(current);
+        pin_set_release(current);
+        return ECLIPTIX_SUCCESS;
+    }
+}
+
+ecliptix_result_t ecliptix_pin_set_contains(const uint8_t* spki_sha256) {
+    if (spki_sha256 == NULL) {
+        return ECLIPTIX_ERROR_INVALID_PARAMS;
+    }
+    pin_set_t* set = pin_set_acquire();
+    if (set == NULL) {
+        return ECLIPTIX_ERROR_INIT_FAILED;
+    }
+    const ecliptix_result_t result = pin_set_find(set, spki_sha256) != NULL
+        ? ECLIPTIX_SUCCESS
+        : ECLIPTIX_ERROR_VERIFICATION_FAILED;
+    pin_set_release(set);
+    return result;
+}
+
+ecliptix_result_t ecliptix_pin_set_verify(
+    const uint8_t* spki_sha256,
+    const uint8_t* data,
+    size_t data_len,
+    const uint8_t* signature,
+    size_t sig_len) {
+    if (spki_sha256 == NULL || (data == NULL && data_len != 0) || signature == NULL || sig_len == 0) {
+        return ECLIPTIX_ERROR_INVALID_PARAMS;
+    }
+    pin_set_t* set = pin_set_acquire();
+    if (set == NULL) {
+        return ECLIPTIX_ERROR_INIT_FAILED;
+    }
+    const pin_entry_t* entry = pin_set_find(set, spki_sha256);
+    const ecliptix_result_t result = entry == NULL
+        ? ECLIPTIX_ERROR_VERIFICATION_FAILED
+        : verify_with(entry, data, data_len, signature, sig_len);
+    pin_set_release(set);
+    return result;
+}
+
+ecliptix_result_t ecliptix_pin_set_key_type(const uint8_t* spki_sha256, ecliptix_key_type_t* type) {
+    if (spki_sha256 == NULL || type == NULL) {
+        return ECLIPTIX_ERROR_INVALID_PARAMS;
+    }
+    pin_set_t* set = pin_set_acquire();
+    if (set == NULL) {
+        return ECLIPTIX_ERROR_INIT_FAILED;
+    }
+    const pin_entry_t* entry = pin_set_find(set, spki_sha256);
+    if (entry != NULL) {
+        *type = entry->type;
+    }
+    pin_set_release(set);
+    return entry != NULL ? ECLIPTIX_SUCCESS : ECLIPTIX_ERROR_VERIFICATION_FAILED;
+}
+
+ecliptix_result_t ecliptix_pin_set_verify_batch(
+    const uint8_t* spki_sha256,
+    const ecliptix_verify_item_t* items,
+    size_t count,
+    uint8_t* result_bitmap,
+    size_t bitmap_len,
+    size_t max_threads) {
+    if (spki_sha256 == NULL) {
+        return ECLIPTIX_ERROR_INVALID_PARAMS;
+    }
+    if (count == 0) {
+        return ECLIPTIX_SUCCESS;
+    }
+    if (items == NULL || result_bitmap == NULL || bitmap_len < (count + 7) / 8) {
+        return ECLIPTIX_ERROR_INVALID_PARAMS;
+    }
+    pin_set_t* set = pin_set_acquire();
+    if (set == NULL) {
+        return ECLIPTIX_ERROR_INIT_FAILED;
+    }
+    const pin_entry_t* entry = pin_set_find(set, spki_sha256);
+    ecliptix_result_t result = ECLIPTIX_ERROR_VERIFICATION_FAILED;
+    if (entry != NULL) {
+        result = ecliptix_verify_batch_run(items, count, result_bitmap, max_threads,
+                                           entry->verifier, entry->verifier_context);
+    } else {
+        memset(result_bitmap, 0, (count + 7) / 8);
+    }
+    pin_set_release(set);
+    return result;
+}
+
+uint32_t ecliptix_pin_set_version(void) {
+    return atomic_load_explicit(&g_active_version, memory_order_acquire);
+}
+
+size_t ecliptix_pin_set_count(void) {
+    pin_set_t* set = pin_set_acquire();
+    const size_t count = set != NULL ? set->count : 0;
+    pin_set_release(set);
+    return count;
+}
+
+#ifdef ECLIPTIX_CLIENT_TESTING
+ecliptix_result_t ecliptix_testing_reset_server_key(const uint8_t* spki_der, size_t spki_der_len) {
+    if (spki_der == NULL || spki_der_len == 0) {
+        return ECLIPTIX_ERROR_INVALID_PARAMS;
+    }
+    const unsigned char* der = spki_der;
+    EVP_PKEY* key = d2i_PUBKEY(NULL, &der, (long)spki_der_len);
+    if (key == NULL || der != spki_der + spki_der_len || EVP_PKEY_base_id(key) != EVP_PKEY_RSA) {
+        EVP_PKEY_free(key);
+        return ECLIPTIX_ERROR_INVALID_PARAMS;
+    }
+
+    pthread_once(&g_active_once, install_builtin);
+    ecliptix_server_key_replace(key);
+    pin_set_t* set = builtin_set();
+    if (set == NULL) {
+        return ECLIPTIX_ERROR_INIT_FAILED;
+    }
+
+    pthread_mutex_lock(&g_active_mutex);
+    pin_set_t* previous = g_active;
+    g_active = set;
+    atomic_store_explicit(&g_active_version, 0, memory_order_release);
+    pthread_mutex_unlock(&g_active_mutex);
+    pin_set_release(previous);
+
+    ecliptix_chain_cache_clear();
+    return ECLIPTIX_SUCCESS;
+}
+#endif
@@ -0,0 +1,17 @@
+#ifndef ECLIPTIX_PINNED_KEYS_H
+#define ECLIPTIX_PINNED_KEYS_H
+
+// Server signing key pinned by libcertificate_pinning_client.a; keep in
+// sync with SERVER_PUBLIC_KEY_PEM in that library.
+static const char ECLIPTIX_SERVER_PUBLIC_KEY_PEM[] =
+    "-----BEGIN PUBLIC KEY-----\n"
+    "MIIBIjANBgkqhkiG9w0BAQEFAAOCAQ8AMIIBCgKCAQEAu6WxstNsGK6laz9cHiIb\n"
+    "Z2gjFxlyhRIDItUOeBHDoLuK7oPs4rzFPX8HGDq1cgg1nTS8y0zU0/mzbUXZszZ6\n"
+    "G+R3yI0N9LAFuCo94AZTyhPqtLuP3khc5ZSX8tGH5Rdf9PBthgQsv6olpFMs4lgt\n"
+    "W0vuDlw5A6d45VsxuNSKkoD1I/6otYvjnvMStvoZ5J20tjOkpXZaqykra/+poXEE\n"
+    "2twkc8yQC3XoE0SN/qSswYkXXumvfz7W70WEJLR8ZTtAKNqD2YaJ/e95ppCtmw2b\n"
+    "KQ+JWefiYfuCrEE+SP9tA7nDmDJRQ4CffBmjpK3DpLSTtoxnElcr4u1H+fnQkyz5\n"
+    "PwIDAQAB\n"
+    "-----END PUBLIC KEY-----\n";
+
+#endif /* ECLIPTIX_PINNED_KEYS_H */
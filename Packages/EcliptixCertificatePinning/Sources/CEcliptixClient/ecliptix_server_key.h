@@ -0,0 +1,15 @@
+#ifndef ECLIPTIX_SERVER_KEY_H
+#define ECLIPTIX_SERVER_KEY_H
+
+#include <OpenSSL/evp.h>
+
+// Pinned server signing key, parsed once on first use and shared
+// read-only by every verifier; NULL if parsing failed.
+__attribute__((visibility("hidden"))) EVP_PKEY* ecliptix_server_public_key(void);
+
+#ifdef ECLIPTIX_CLIENT_TESTING
+// Takes ownership of `key` and serves it in place of the pinned key.
+__attribute__((visibility("hidden"))) void ecliptix_server_key_replace(EVP_PKEY* key);
+#endif
+
+#endif /* ECLIPTIX_SERVER_KEY_H */
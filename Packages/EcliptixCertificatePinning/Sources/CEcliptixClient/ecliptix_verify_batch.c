@@ -0,0 +1,162 @@
+#include "ecliptix_verify_batch.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "ecliptix_server_key.h"
+#include "ecliptix_verify_batch_runner.h"
+
+// Below this many items per worker, thread start-up costs more than it saves.
+#define ECLIPTIX_BATCH_MIN_ITEMS_PER_THREAD 4
+#define ECLIPTIX_BATCH_MAX_THREADS 16
+
+typedef struct {
+    const ecliptix_verify_item_t* items;
+    size_t count;
+    ecliptix_batch_verifier_fn verifier;
+    const void* context;
+    uint8_t* verified;
+    atomic_size_t next;
+    atomic_int failed;
+} batch_job_t;
+
+int ecliptix_verify_rsa_item(const void* context, EVP_MD_CTX* scratch, const ecliptix_verify_item_t* item) {
+    if ((item->data == NULL && item->data_len != 0) || item->signature == NULL || item->sig_len == 0) {
+        return 0;
+    }
+    if (EVP_MD_CTX_copy_ex(scratch, context) != 1) {
+        return -1;
+    }
+    if (item->data_len != 0 && EVP_DigestVerifyUpdate(scratch, item->data, item->data_len) != 1) {
+        return -1;
+    }
+    return EVP_DigestVerifyFinal(scratch, item->signature, item->sig_len) == 1;
+}
+
+static void* batch_worker(void* arg) {
+    batch_job_t* job = arg;
+    EVP_MD_CTX* scratch = EVP_MD_CTX_new();
+    if (scratch == NULL) {
+        atomic_store_explicit(&job->failed, 1, memory_order_relaxed);
+        return NULL;
+    }
+    while (!atomic_load_explicit(&job->failed, memory_order_relaxed)) {
+        const size_t index = atomic_fetch_add_explicit(&job->next, 1, memory_order_relaxed);
+        if (index >= job->count) {
+            break;
+        }
+        const int verified = job->verifier(job->context, scratch, &job->items[index]);
+        if (verified < 0) {
+            atomic_store_explicit(&job->failed, 1, memory_order_relaxed);
+            break;
+        }
+        job->verified[index] = (uint8_t)verified;
+    }
+    EVP_MD_CTX_free(scratch);
+    return NULL;
+}
+
+static size_t worker_count(size_t count, size_t max_threads) {
+    size_t threads = max_threads;
+    if (threads == 0) {
+        const long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = online > 0 ? (size_t)online : 1;
+    }
+    const size_t useful = (count + ECLIPTIX_BATCH_MIN_ITEMS_PER_THREAD - 1) / ECLIPTIX_BATCH_MIN_ITEMS_PER_THREAD;
+    if (threads > useful) {
+        threads = useful;
+    }
+    if (threads > ECLIPTIX_BATCH_MAX_THREADS) {
+        threads = ECLIPTIX_BATCH_MAX_THREADS;
+    }
+    return threads == 0 ? 1 : threads;
+}
+
+ecliptix_result_t ecliptix_verify_batch_run(
+    const ecliptix_verify_item_t* items,
+    size_t count,
+    uint8_t* result_bitmap,
+    size_t max_threads,
+    ecliptix_batch_verifier_fn verifier,
+    const void* context) {
+    uint8_t* verified = calloc(count, 1);
+    if (verified == NULL) {
+        return ECLIPTIX_ERROR_CRYPTO_FAILURE;
+    }
+    memset(result_bitmap, 0, (count + 7) / 8);
+
+    batch_job_t job = {
+        .items = items,
+        .count = count,
+        .verifier = verifier,
+        .context = context,
+        .verified = verified,
+    };
+    atomic_init(&job.next, 0);
+    atomic_init(&job.failed, 0);
+
+    const size_t threads = worker_count(count, max_threads);
+    pthread_t workers[ECLIPTIX_BATCH_MAX_THREADS];
+    size_t started = 0;
+    for (size_t i = 1; i < threads; ++i) {
+        if (pthread_create(&workers[started], NULL, batch_worker, &job) != 0) {
+            break;
+        }
+        ++started;
+    }
+    batch_worker(&job);
+    for (size_t i = 0; i < started; ++i) {
+        pthread_join(workers[i], NULL);
+    }
+
+    // Joining the workers orders their writes before these reads.
+    if (atomic_load_explicit(&job.failed, memory_order_relaxed)) {
+        free(verified);
+        return ECLIPTIX_ERROR_CRYPTO_FAILURE;
+    }
+
+    ecliptix_result_t result = ECLIPTIX_SUCCESS;
+    for (size_t i = 0; i < count; ++i) {
+        if (verified[i]) {
+            result_bitmap[i / 8] |= (uint8_t)(1u << (i % 8));
+        } else {
+            result = ECLIPTIX_ERROR_VERIFICATION_FAILED;
+        }
+    }
+
+    free(verified);
+    return result;
+}
+
+ecliptix_result_t ecliptix_client_verify_batch(
+    const ecliptix_verify_item_t* items,
+    size_t count,
+    uint8_t* result_bitmap,
+    size_t bitmap_len,
+    size_t max_threads) {
+    if (count == 0) {
+        return ECLIPTIX_SUCCESS;
+    }
+    if (items == NULL || result_bitmap == NULL || bitmap_len < (count + 7) / 8) {
+        return ECLIPTIX_ERROR_INVALID_PARAMS;
+    }
+
+    EVP_PKEY* key = ecliptix_server_public_key();
+    if (key == NULL) {
+        return ECLIPTIX_ERROR_INIT_FAILED;
+    }
+
+    EVP_MD_CTX* prepared = EVP_MD_CTX_new();
+    if (prepared == NULL || EVP_DigestVerifyInit(prepared, NULL, EVP_sha256(), NULL, key) != 1) {
+        EVP_MD_CTX_free(prepared);
+        return ECLIPTIX_ERROR_CRYPTO_FAILURE;
+    }
+
+    const ecliptix_result_t result = ecliptix_verify_batch_run(
+        items, count, result_bitmap, max_threads, ecliptix_verify_rsa_item, prepared);
+    EVP_MD_CTX_free(prepared);
+    return result;
+}
@@ -0,0 +1,32 @@
+#ifndef ECLIPTIX_VERIFY_BATCH_RUNNER_H
+#define ECLIPTIX_VERIFY_BATCH_RUNNER_H
+
+#include <OpenSSL/evp.h>
+
+#include "ecliptix_verify_batch.h"
+
+// Checks one item against `context`: 1 if it verified, 0 if it did not,
+// negative if the check itself failed. `scratch` is a per-worker digest
+// context that verifiers without a digest state may ignore.
+typedef int (*ecliptix_batch_verifier_fn)(const void* context, EVP_MD_CTX* scratch,
+                                          const ecliptix_verify_item_t* item);
+
+// Shared worker pool behind every batch entry point; same result contract
+// as ecliptix_client_verify_batch, plus ECLIPTIX_ERROR_CRYPTO_FAILURE
+// (with an all-zero bitmap) when any item could not be checked. Callers
+// validate the arguments, and `count` must be non-zero.
+__attribute__((visibility("hidden"))) ecliptix_result_t ecliptix_verify_batch_run(
+    const ecliptix_verify_item_t* items,
+    size_t count,
+    uint8_t* result_bitmap,
+    size_t max_threads,
+    ecliptix_batch_verifier_fn verifier,
+    const void* context
+);
+
+// RSA/SHA-256 verifier; `context` is an EVP_MD_CTX already passed
+// through EVP_DigestVerifyInit.
+__attribute__((visibility("hidden"))) int ecliptix_verify_rsa_item(
+    const void* context, EVP_MD_CTX* scratch, const ecliptix_verify_item_t* item);
+
+#endif /* ECLIPTIX_VERIFY_BATCH_RUNNER_H */
@@ -0,0 +1,99 @@
+#include "ecliptix_verify_stream.h"
+
+#include <OpenSSL/bio.h>
+#include <OpenSSL/evp.h>
+#include <OpenSSL/pem.h>
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "ecliptix_pinned_keys.h"
+#include "ecliptix_server_key.h"
+
+struct ecliptix_verify_ctx {
+    EVP_MD_CTX* md_ctx;
+    int finished;
+};
+
+static pthread_once_t g_server_key_once = PTHREAD_ONCE_INIT;
+static EVP_PKEY* g_server_key = NULL;
+
+static void load_server_key(void) {
+    BIO* bio = BIO_new_mem_buf(ECLIPTIX_SERVER_PUBLIC_KEY_PEM, -1);
+    if (bio == NULL) {
+        return;
+    }
+    g_server_key = PEM_read_bio_PUBKEY(bio, NULL, NULL, NULL);
+    BIO_free(bio);
+}
+
+EVP_PKEY* ecliptix_server_public_key(void) {
+    pthread_once(&g_server_key_once, load_server_key);
+    return g_server_key;
+}
+
+#ifdef ECLIPTIX_CLIENT_TESTING
+void ecliptix_server_key_replace(EVP_PKEY* key) {
+    pthread_once(&g_server_key_once, load_server_key);
+    EVP_PKEY_free(g_server_key);
+    g_server_key = key;
+}
+#endif
+
+ecliptix_result_t ecliptix_verify_init(ecliptix_verify_ctx_t** ctx) {
+    if (ctx == NULL) {
+        return ECLIPTIX_ERROR_INVALID_PARAMS;
+    }
+    *ctx = NULL;
+
+    EVP_PKEY* key = ecliptix_server_public_key();
+    if (key == NULL) {
+        return ECLIPTIX_ERROR_INIT_FAILED;
+    }
+
+    ecliptix_verify_ctx_t* verify = calloc(1, sizeof(*verify));
+    if (verify == NULL) {
+        return ECLIPTIX_ERROR_CRYPTO_FAILURE;
+    }
+    verify->md_ctx = EVP_MD_CTX_new();
+    if (verify->md_ctx == NULL ||
+        EVP_DigestVerifyInit(verify->md_ctx, NULL, EVP_sha256(), NULL, key) != 1) {
+        ecliptix_verify_free(verify);
+        return ECLIPTIX_ERROR_CRYPTO_FAILURE;
+    }
+
+    *ctx = verify;
+    return ECLIPTIX_SUCCESS;
+}
+
+ecliptix_result_t ecliptix_verify_update(ecliptix_verify_ctx_t* ctx, const uint8_t* data, size_t data_len) {
+    if (ctx == NULL || ctx->finished || (data == NULL && data_len != 0)) {
+        return ECLIPTIX_ERROR_INVALID_PARAMS;
+    }
+    if (data_len == 0) {
+        return ECLIPTIX_SUCCESS;
+    }
+    if (EVP_DigestVerifyUpdate(ctx->md_ctx, data, data_len) != 1) {
+        return ECLIPTIX_ERROR_CRYPTO_FAILURE;
+    }
+    return ECLIPTIX_SUCCESS;
+}
+
+ecliptix_result_t ecliptix_verify_final(ecliptix_verify_ctx_t* ctx, const uint8_t* signature, size_t sig_len) {
+    if (ctx == NULL || ctx->finished || signature == NULL || sig_len == 0) {
+        return ECLIPTIX_ERROR_INVALID_PARAMS;
+    }
+    ctx->finished = 1;
+
+    if (EVP_DigestVerifyFinal(ctx->md_ctx, signature, sig_len) != 1) {
+        return ECLIPTIX_ERROR_VERIFICATION_FAILED;
+    }
+    return ECLIPTIX_SUCCESS;
+}
+
+void ecliptix_verify_free(ecliptix_verify_ctx_t* ctx) {
+    if (ctx == NULL) {
+        return;
+    }
+    EVP_MD_CTX_free(ctx->md_ctx);
+    free(ctx);
+}
@@ -4,4 +4,19 @@
 // Re-export the ecliptix_client XCFramework functions
 #include "ecliptix_client.h"
 
+// Lazy, once-only initialization on top of ecliptix_client_init
+#include "ecliptix_client_lazy.h"
+
+// Incremental signature verification against the pinned server key
+#include "ecliptix_verify_stream.h"
+
+// Multi-threaded verification of many (data, signature) pairs
+#include "ecliptix_verify_batch.h"
+
+// Several pinned keys indexed by SPKI hash, replaceable by a signed pin list
+#include "ecliptix_pin_set.h"
+
+// Cached pin decisions for presented TLS certificate chains
+#include "ecliptix_chain_cache.h"
+
 #endif /* CEcliptixClient_h */
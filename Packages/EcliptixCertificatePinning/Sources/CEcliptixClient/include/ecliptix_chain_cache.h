@@ -0,0 +1,49 @@
+#ifndef ECLIPTIX_CHAIN_CACHE_H
+#define ECLIPTIX_CHAIN_CACHE_H
+
+#include "ecliptix_client.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ECLIPTIX_CHAIN_CACHE_MAX_CERTS 8
+
+typedef struct {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t stores;
+} ecliptix_chain_cache_stats_t;
+
+/*
+ * Pin decision for a presented TLS chain (DER certificates, leaf first).
+ * A chain is accepted when every certificate is within its validity
+ * period at `now_unix`, each certificate is signed by the next one, and
+ * at least one certificate's SPKI is in the active pin set.
+ *
+ * Decisions are cached under the SHA-256 of the chain. Accepted chains
+ * stay cached until the earliest notAfter in the chain (capped at 24h),
+ * rejected ones for 60s, and every entry is dropped as soon as the pin
+ * set version changes. A hit costs one hash of the chain bytes and takes
+ * no lock; `cache_hit` (optional) reports which path was taken.
+ *
+ * This is the pin decision only; hostname and trust-store evaluation
+ * remain with the TLS stack.
+ */
+ECLIPTIX_CLIENT_API ecliptix_result_t ecliptix_chain_validate(
+    const uint8_t* const* certs,
+    const size_t* cert_lens,
+    size_t count,
+    int64_t now_unix,
+    int* cache_hit
+);
+
+ECLIPTIX_CLIENT_API void ecliptix_chain_cache_clear(void);
+
+ECLIPTIX_CLIENT_API void ecliptix_chain_cache_get_stats(ecliptix_chain_cache_stats_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECLIPTIX_CHAIN_CACHE_H */
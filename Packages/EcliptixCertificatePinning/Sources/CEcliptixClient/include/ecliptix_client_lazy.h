@@ -0,0 +1,53 @@
+#ifndef ECLIPTIX_CLIENT_LAZY_H
+#define ECLIPTIX_CLIENT_LAZY_H
+
+#include "ecliptix_client.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    ECLIPTIX_INIT_STAGE_KEY_LOADING = 0,
+    ECLIPTIX_INIT_STAGE_FIRST_USE_WAIT = 1,
+    ECLIPTIX_INIT_STAGE_COUNT = 2
+} ecliptix_init_stage_t;
+
+typedef struct {
+    uint64_t stage_ns[ECLIPTIX_INIT_STAGE_COUNT];
+    uint64_t total_ns;
+    int32_t initialized;
+    int32_t warmed_up;
+} ecliptix_init_timings_t;
+
+/*
+ * Runs ecliptix_client_init() (PEM key parsing and key object setup) exactly
+ * once, on whichever thread gets here first; concurrent callers block until
+ * it finishes and all see the same result. Cheap after the first call.
+ */
+ECLIPTIX_CLIENT_API ecliptix_result_t ecliptix_client_ensure_init(void);
+
+/*
+ * Starts ecliptix_client_ensure_init() on a detached background thread so
+ * that the first verify/encrypt finds the keys already loaded. Returns
+ * immediately.
+ */
+ECLIPTIX_CLIENT_API void ecliptix_client_warm_up(void);
+
+/* Releases the native keys; the next ensure_init() loads them again. */
+ECLIPTIX_CLIENT_API void ecliptix_client_lazy_cleanup(void);
+
+/*
+ * Reports how long each initialization stage took, in nanoseconds.
+ * KEY_LOADING is the native init itself; FIRST_USE_WAIT is how long the
+ * first caller of ensure_init() was blocked, which is zero when a warm-up
+ * finished beforehand. total_ns runs from the first warm-up or
+ * ensure_init() request until the keys were ready.
+ */
+ECLIPTIX_CLIENT_API ecliptix_result_t ecliptix_client_get_init_timings(ecliptix_init_timings_t* timings);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECLIPTIX_CLIENT_LAZY_H */
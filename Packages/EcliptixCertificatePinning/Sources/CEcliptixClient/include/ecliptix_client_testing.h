@@ -0,0 +1,31 @@
+#ifndef ECLIPTIX_CLIENT_TESTING_H
+#define ECLIPTIX_CLIENT_TESTING_H
+
+#include "ecliptix_client.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef ECLIPTIX_CLIENT_TESTING
+
+/*
+ * Test support, compiled only when ECLIPTIX_CLIENT_TESTING is defined,
+ * which the package sets for its own test runs only. Replaces the pinned server key with the RSA key in
+ * `spki_der` (DER SubjectPublicKeyInfo), resets the pin set to that key
+ * alone at version 0 and clears the chain cache, so tests can produce
+ * signatures the verifiers accept. Must not run concurrently with
+ * verification.
+ */
+ECLIPTIX_CLIENT_API ecliptix_result_t ecliptix_testing_reset_server_key(
+    const uint8_t* spki_der,
+    size_t spki_der_len
+);
+
+#endif /* ECLIPTIX_CLIENT_TESTING */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECLIPTIX_CLIENT_TESTING_H */
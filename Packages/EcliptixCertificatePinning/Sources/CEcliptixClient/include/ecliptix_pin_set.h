@@ -0,0 +1,93 @@
+#ifndef ECLIPTIX_PIN_SET_H
+#define ECLIPTIX_PIN_SET_H
+
+#include "ecliptix_client.h"
+#include "ecliptix_verify_batch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ECLIPTIX_SPKI_HASH_LEN 32
+#define ECLIPTIX_PIN_SET_MAX_KEYS 32
+
+/*
+ * RSA keys verify RSA/SHA-256 (PKCS#1 v1.5) signatures; Ed25519 keys
+ * verify 64-byte detached Ed25519 signatures over the raw message.
+ */
+typedef enum {
+    ECLIPTIX_KEY_TYPE_RSA = 0,
+    ECLIPTIX_KEY_TYPE_ED25519 = 1
+} ecliptix_key_type_t;
+
+/*
+ * Signed pin list wire format (all integers big-endian):
+ *   "EPL1" | version u32 | key_count u16 | key_count * (der_len u16 | SPKI DER)
+ * Keys may be RSA or Ed25519. The signature covers the whole list and is
+ * made with a key that is already in the active pin set, in that key's
+ * signature format.
+ */
+
+/*
+ * Replaces the active pin set with the keys in `pin_list`. Readers that are
+ * mid-verification keep using the set they started with; it is released
+ * when the last of them finishes.
+ *
+ * The list's version must be greater than the active version and at least
+ * `min_version`, otherwise ECLIPTIX_ERROR_VERIFICATION_FAILED. The active
+ * version is only kept in memory and starts at 0 on every launch, so to
+ * stop a captured older list from rolling back a rotation across
+ * restarts, callers persist the version of each list they install and
+ * pass the highest one as `min_version`; reinstalling that list itself
+ * is still accepted.
+ */
+ECLIPTIX_CLIENT_API ecliptix_result_t ecliptix_pin_set_install(
+    const uint8_t* pin_list,
+    size_t pin_list_len,
+    const uint8_t* signer_spki_sha256,
+    const uint8_t* signature,
+    size_t sig_len,
+    uint32_t min_version
+);
+
+/* ECLIPTIX_SUCCESS if the key is pinned, ECLIPTIX_ERROR_VERIFICATION_FAILED if not. */
+ECLIPTIX_CLIENT_API ecliptix_result_t ecliptix_pin_set_contains(const uint8_t* spki_sha256);
+
+/* Verifies a signature with the pinned key named by its SPKI hash. */
+ECLIPTIX_CLIENT_API ecliptix_result_t ecliptix_pin_set_verify(
+    const uint8_t* spki_sha256,
+    const uint8_t* data,
+    size_t data_len,
+    const uint8_t* signature,
+    size_t sig_len
+);
+
+/* ECLIPTIX_ERROR_VERIFICATION_FAILED if the key is not pinned. */
+ECLIPTIX_CLIENT_API ecliptix_result_t ecliptix_pin_set_key_type(
+    const uint8_t* spki_sha256,
+    ecliptix_key_type_t* type
+);
+
+/*
+ * ecliptix_client_verify_batch against the pinned key named by its SPKI
+ * hash, in that key's signature format.
+ */
+ECLIPTIX_CLIENT_API ecliptix_result_t ecliptix_pin_set_verify_batch(
+    const uint8_t* spki_sha256,
+    const ecliptix_verify_item_t* items,
+    size_t count,
+    uint8_t* result_bitmap,
+    size_t bitmap_len,
+    size_t max_threads
+);
+
+/* Version of the active list; 0 while only the built-in server key is pinned. Lock-free. */
+ECLIPTIX_CLIENT_API uint32_t ecliptix_pin_set_version(void);
+
+ECLIPTIX_CLIENT_API size_t ecliptix_pin_set_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECLIPTIX_PIN_SET_H */
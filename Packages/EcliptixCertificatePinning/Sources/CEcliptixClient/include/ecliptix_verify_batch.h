@@ -0,0 +1,39 @@
+#ifndef ECLIPTIX_VERIFY_BATCH_H
+#define ECLIPTIX_VERIFY_BATCH_H
+
+#include "ecliptix_client.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    const uint8_t* data;
+    size_t data_len;
+    const uint8_t* signature;
+    size_t sig_len;
+} ecliptix_verify_item_t;
+
+/*
+ * Verifies `count` independently signed payloads against the pinned server
+ * key in one call. Bit i of `result_bitmap` (LSB first within each byte) is
+ * set when item i verified; the bitmap must hold (count + 7) / 8 bytes.
+ * Work is spread over up to `max_threads` workers (0 = one per online CPU).
+ * Returns ECLIPTIX_SUCCESS when every item verified,
+ * ECLIPTIX_ERROR_VERIFICATION_FAILED when any did not, and
+ * ECLIPTIX_ERROR_CRYPTO_FAILURE (bitmap all zero) when an item could not
+ * be checked at all.
+ */
+ECLIPTIX_CLIENT_API ecliptix_result_t ecliptix_client_verify_batch(
+    const ecliptix_verify_item_t* items,
+    size_t count,
+    uint8_t* result_bitmap,
+    size_t bitmap_len,
+    size_t max_threads
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECLIPTIX_VERIFY_BATCH_H */
@@ -0,0 +1,39 @@
+#ifndef ECLIPTIX_VERIFY_STREAM_H
+#define ECLIPTIX_VERIFY_STREAM_H
+
+#include "ecliptix_client.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct ecliptix_verify_ctx ecliptix_verify_ctx_t;
+
+/*
+ * Incremental form of ecliptix_client_verify: the payload is hashed as it
+ * is fed to update(), so it never has to be held in one buffer. final()
+ * checks the signature against the pinned server key and returns
+ * ECLIPTIX_ERROR_VERIFICATION_FAILED on mismatch; the context cannot be
+ * updated afterwards and must be released with ecliptix_verify_free().
+ */
+ECLIPTIX_CLIENT_API ecliptix_result_t ecliptix_verify_init(ecliptix_verify_ctx_t** ctx);
+
+ECLIPTIX_CLIENT_API ecliptix_result_t ecliptix_verify_update(
+    ecliptix_verify_ctx_t* ctx,
+    const uint8_t* data,
+    size_t data_len
+);
+
+ECLIPTIX_CLIENT_API ecliptix_result_t ecliptix_verify_final(
+    ecliptix_verify_ctx_t* ctx,
+    const uint8_t* signature,
+    size_t sig_len
+);
+
+ECLIPTIX_CLIENT_API void ecliptix_verify_free(ecliptix_verify_ctx_t* ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECLIPTIX_VERIFY_STREAM_H */
@@ -16,40 +16,42 @@ public final class CertificatePinningClient {
     }
 
     public func initialize() -> Result<Void, CertificatePinningError> {
-        initializationLock.lock()
-        defer { initializationLock.unlock() }
-
-        guard !isInitialized else {
-            return .success(())
-        }
-
-        let result = ecliptix_client_init()
-
-        guard result == 0 else {
-            let errorMessage = getErrorMessage()
-            Log.error("[CertificatePinning] Initialization failed: \(errorMessage)")
-            return .failure(.initializationFailed(errorMessage))
+        if let error = ensureInitialized() {
+            return .failure(error)
         }
-
-        isInitialized = true
-        Log.info("[CertificatePinning] [OK] Initialized successfully")
         return .success(())
     }
 
+    public func warmUp() {
+        ecliptix_client_warm_up()
+    }
+
     public func cleanup() {
         initializationLock.lock()
         defer { initializationLock.unlock() }
 
         guard isInitialized else { return }
 
-        ecliptix_client_cleanup()
+        ecliptix_client_lazy_cleanup()
         isInitialized = false
         Log.info("[CertificatePinning] Cleaned up")
     }
 
+    public func initializationTimings() -> CertificatePinningInitTimings {
+        var timings = ecliptix_init_timings_t()
+        _ = ecliptix_client_get_init_timings(&timings)
+        return CertificatePinningInitTimings(
+            keyLoadingNanoseconds: timings.stage_ns.0,
+            firstUseWaitNanoseconds: timings.stage_ns.1,
+            totalNanoseconds: timings.total_ns,
+            isInitialized: timings.initialized != 0,
+            wasWarmedUp: timings.warmed_up != 0
+        )
+    }
+
     public func verifySignature(data: Data, signature: Data) -> Result<Bool, CertificatePinningError> {
-        guard isInitialized else {
-            return .failure(.notInitialized)
+        if let error = ensureInitialized() {
+            return .failure(error)
         }
 
         guard !data.isEmpty else {
@@ -85,9 +87,19 @@ public final class CertificatePinningClient {
         }
     }
 
+    public func verifySignatures(_ items: [(data: Data, signature: Data)]) -> Result<[Bool], CertificatePinningError> {
+        if let error = ensureInitialized() {
+            return .failure(error)
+        }
+
+        return SignatureBatch.verify(items, logTag: "CertificatePinning") { batch, count, bitmap, bitmapLength in
+            ecliptix_client_verify_batch(batch, count, bitmap, bitmapLength, 0)
+        }
+    }
+
     public func encrypt(plaintext: Data) -> Result<Data, CertificatePinningError> {
-        guard isInitialized else {
-            return .failure(.notInitialized)
+        if let error = ensureInitialized() {
+            return .failure(error)
         }
 
         guard !plaintext.isEmpty else {
@@ -121,8 +133,8 @@ public final class CertificatePinningClient {
     }
 
     public func decrypt(ciphertext: Data) -> Result<Data, CertificatePinningError> {
-        guard isInitialized else {
-            return .failure(.notInitialized)
+        if let error = ensureInitialized() {
+            return .failure(error)
         }
 
         guard !ciphertext.isEmpty else {
@@ -156,8 +168,8 @@ public final class CertificatePinningClient {
     }
 
     public func getPublicKey() -> Result<Data, CertificatePinningError> {
-        guard isInitialized else {
-            return .failure(.notInitialized)
+        if let error = ensureInitialized() {
+            return .failure(error)
         }
 
         var publicKey = Data(count: 512)
@@ -182,6 +194,27 @@ public final class CertificatePinningClient {
         return .success(publicKey)
     }
 
+    private func ensureInitialized() -> CertificatePinningError? {
+        initializationLock.lock()
+        defer { initializationLock.unlock() }
+
+        guard !isInitialized else {
+            return nil
+        }
+
+        let result = ecliptix_client_ensure_init()
+
+        guard result.rawValue == 0 else {
+            let errorMessage = getErrorMessage()
+            Log.error("[CertificatePinning] Initialization failed: \(errorMessage)")
+            return .initializationFailed(errorMessage)
+        }
+
+        isInitialized = true
+        Log.info("[CertificatePinning] [OK] Initialized successfully")
+        return nil
+    }
+
     private func getErrorMessage() -> String {
         guard let errorPtr = ecliptix_client_get_error() else {
             return "Unknown error"
@@ -219,6 +252,14 @@ public enum CertificatePinningError: Error, CustomStringConvertible {
     }
 }
 
+public struct CertificatePinningInitTimings: Sendable {
+    public let keyLoadingNanoseconds: UInt64
+    public let firstUseWaitNanoseconds: UInt64
+    public let totalNanoseconds: UInt64
+    public let isInitialized: Bool
+    public let wasWarmedUp: Bool
+}
+
 public enum CertificatePinningConstants {
 
     public static let rsaMaxPlaintextSize = 120
@@ -0,0 +1,157 @@
+import CEcliptixClient
+import EcliptixCore
+import Foundation
+
+public enum PinnedKeyType: Sendable {
+    case rsa
+    case ed25519
+}
+
+public enum PinnedKeySet {
+
+    public static let spkiHashLength = Int(ECLIPTIX_SPKI_HASH_LEN)
+
+    public static var version: UInt32 {
+        ecliptix_pin_set_version()
+    }
+
+    public static var count: Int {
+        ecliptix_pin_set_count()
+    }
+
+    public static func install(
+        pinList: Data,
+        signerKeyHash: Data,
+        signature: Data,
+        minimumVersion: UInt32
+    ) -> Result<Void, CertificatePinningError> {
+        guard signerKeyHash.count == spkiHashLength else {
+            return .failure(.invalidInput("Signer key hash must be \(spkiHashLength) bytes"))
+        }
+
+        guard !pinList.isEmpty, !signature.isEmpty else {
+            return .failure(.invalidInput("Pin list and signature cannot be empty"))
+        }
+
+        let result: ecliptix_result_t = pinList.withUnsafeBytes { pinListBytes in
+            signerKeyHash.withUnsafeBytes { signerBytes in
+                signature.withUnsafeBytes { signatureBytes in
+                    ecliptix_pin_set_install(
+                        pinListBytes.bindMemory(to: UInt8.self).baseAddress,
+                        pinList.count,
+                        signerBytes.bindMemory(to: UInt8.self).baseAddress,
+                        signatureBytes.bindMemory(to: UInt8.self).baseAddress,
+                        signature.count,
+                        minimumVersion
+                    )
+                }
+            }
+        }
+
+        switch result.rawValue {
+        case 0:
+            Log.info("[PinnedKeySet] Installed pin list v\(version) with \(count) keys")
+            return .success(())
+        case -3:
+            Log.warning("[PinnedKeySet] Pin list rejected: bad signature, unknown signer or stale version")
+            return .failure(.verificationError("Pin list rejected"))
+        case -2:
+            Log.error("[PinnedKeySet] Pin list signature check failed: \(result.rawValue)")
+            return .failure(.verificationError("Pin list signature check failed (\(result.rawValue))"))
+        case -4:
+            Log.error("[PinnedKeySet] Built-in pin set unavailable: \(result.rawValue)")
+            return .failure(.initializationFailed("Built-in pin set unavailable (\(result.rawValue))"))
+        default:
+            Log.error("[PinnedKeySet] Pin list install failed: \(result.rawValue)")
+            return .failure(.invalidInput("Malformed pin list (\(result.rawValue))"))
+        }
+    }
+
+    public static func contains(keyHash: Data) -> Bool {
+        guard keyHash.count == spkiHashLength else {
+            return false
+        }
+
+        let result: ecliptix_result_t = keyHash.withUnsafeBytes { keyHashBytes in
+            ecliptix_pin_set_contains(keyHashBytes.bindMemory(to: UInt8.self).baseAddress)
+        }
+        return result.rawValue == 0
+    }
+
+    public static func verify(
+        keyHash: Data,
+        data: Data,
+        signature: Data
+    ) -> Result<Bool, CertificatePinningError> {
+        guard keyHash.count == spkiHashLength else {
+            return .failure(.invalidInput("Key hash must be \(spkiHashLength) bytes"))
+        }
+
+        guard !signature.isEmpty else {
+            return .failure(.invalidInput("Signature cannot be empty"))
+        }
+
+        let result: ecliptix_result_t = keyHash.withUnsafeBytes { keyHashBytes in
+            data.withUnsafeBytes { dataBytes in
+                signature.withUnsafeBytes { signatureBytes in
+                    ecliptix_pin_set_verify(
+                        keyHashBytes.bindMemory(to: UInt8.self).baseAddress,
+                        dataBytes.bindMemory(to: UInt8.self).baseAddress,
+                        data.count,
+                        signatureBytes.bindMemory(to: UInt8.self).baseAddress,
+                        signature.count
+                    )
+                }
+            }
+        }
+
+        switch result.rawValue {
+        case 0:
+            return .success(true)
+        case -3:
+            Log.warning("[PinnedKeySet] Signature verification failed or key not pinned")
+            return .success(false)
+        default:
+            Log.error("[PinnedKeySet] Verification error: \(result.rawValue)")
+            return .failure(.verificationError("Pin set verification failed (\(result.rawValue))"))
+        }
+    }
+
+    public static func keyType(for keyHash: Data) -> PinnedKeyType? {
+        guard keyHash.count == spkiHashLength else {
+            return nil
+        }
+
+        var type = ECLIPTIX_KEY_TYPE_RSA
+        let result: ecliptix_result_t = keyHash.withUnsafeBytes { keyHashBytes in
+            ecliptix_pin_set_key_type(keyHashBytes.bindMemory(to: UInt8.self).baseAddress, &type)
+        }
+
+        guard result.rawValue == 0 else {
+            return nil
+        }
+        return type == ECLIPTIX_KEY_TYPE_ED25519 ? .ed25519 : .rsa
+    }
+
+    public static func verifyBatch(
+        keyHash: Data,
+        items: [(data: Data, signature: Data)]
+    ) -> Result<[Bool], CertificatePinningError> {
+        guard keyHash.count == spkiHashLength else {
+            return .failure(.invalidInput("Key hash must be \(spkiHashLength) bytes"))
+        }
+
+        return keyHash.withUnsafeBytes { keyHashBytes in
+            SignatureBatch.verify(items, logTag: "PinnedKeySet") { batch, count, bitmap, bitmapLength in
+                ecliptix_pin_set_verify_batch(
+                    keyHashBytes.bindMemory(to: UInt8.self).baseAddress,
+                    batch,
+                    count,
+                    bitmap,
+                    bitmapLength,
+                    0
+                )
+            }
+        }
+    }
+}
@@ -0,0 +1,70 @@
+import CEcliptixClient
+import EcliptixCore
+import Foundation
+
+enum SignatureBatch {
+
+    typealias NativeVerifier = (
+        _ items: UnsafePointer<ecliptix_verify_item_t>?,
+        _ count: Int,
+        _ bitmap: UnsafeMutablePointer<UInt8>?,
+        _ bitmapLength: Int
+    ) -> ecliptix_result_t
+
+    static func verify(
+        _ items: [(data: Data, signature: Data)],
+        logTag: String,
+        using nativeVerify: NativeVerifier
+    ) -> Result<[Bool], CertificatePinningError> {
+        guard !items.isEmpty else {
+            return .success([])
+        }
+
+        var arena = Data(capacity: items.reduce(0) { $0 + $1.data.count + $1.signature.count })
+        var spans: [(dataOffset: Int, dataCount: Int, signatureOffset: Int, signatureCount: Int)] = []
+        spans.reserveCapacity(items.count)
+        for item in items {
+            let dataOffset = arena.count
+            arena.append(item.data)
+            let signatureOffset = arena.count
+            arena.append(item.signature)
+            spans.append((dataOffset, item.data.count, signatureOffset, item.signature.count))
+        }
+
+        var bitmap = [UInt8](repeating: 0, count: (items.count + 7) / 8)
+
+        let result: ecliptix_result_t = arena.withUnsafeBytes { arenaBytes in
+            let base = arenaBytes.bindMemory(to: UInt8.self).baseAddress
+            let batch = spans.map { span in
+                ecliptix_verify_item_t(
+                    data: base.map { $0 + span.dataOffset },
+                    data_len: span.dataCount,
+                    signature: base.map { $0 + span.signatureOffset },
+                    sig_len: span.signatureCount
+                )
+            }
+            return batch.withUnsafeBufferPointer { batchBuffer in
+                bitmap.withUnsafeMutableBufferPointer { bitmapBuffer in
+                    nativeVerify(batchBuffer.baseAddress, batchBuffer.count, bitmapBuffer.baseAddress, bitmapBuffer.count)
+                }
+            }
+        }
+
+        switch result.rawValue {
+        case 0, -3:
+            let verified = (0..<items.count).map { index in
+                bitmap[index / 8] & (1 << UInt8(index % 8)) != 0
+            }
+            let failedCount = verified.filter { !$0 }.count
+            if failedCount > 0 {
+                Log.warning("[\(logTag)] Batch verification: \(failedCount) of \(items.count) signatures failed")
+            } else {
+                Log.debug("[\(logTag)] Batch verification succeeded for \(items.count) signatures")
+            }
+            return .success(verified)
+        default:
+            Log.error("[\(logTag)] Batch verification error: \(result.rawValue)")
+            return .failure(.verificationError("Batch verification failed (\(result.rawValue))"))
+        }
+    }
+}
@@ -0,0 +1,96 @@
+import CEcliptixClient
+import EcliptixCore
+import Foundation
+
+public final class StreamingSignatureVerifier {
+
+    private var context: OpaquePointer?
+    private var bytesProcessed: Int = 0
+
+    public init() throws {
+        var newContext: OpaquePointer?
+        let result = ecliptix_verify_init(&newContext)
+
+        guard result.rawValue == 0, let newContext else {
+            Log.error("[StreamingVerifier] Failed to create verify context: \(result.rawValue)")
+            throw CertificatePinningError.initializationFailed("Verify context creation failed (\(result.rawValue))")
+        }
+
+        context = newContext
+    }
+
+    deinit {
+        ecliptix_verify_free(context)
+    }
+
+    public func update(_ chunk: Data) -> Result<Void, CertificatePinningError> {
+        guard let context else {
+            return .failure(.verificationError("Verifier already finalized"))
+        }
+
+        guard !chunk.isEmpty else {
+            return .success(())
+        }
+
+        let result: ecliptix_result_t = chunk.withUnsafeBytes { chunkBytes in
+            ecliptix_verify_update(
+                context,
+                chunkBytes.bindMemory(to: UInt8.self).baseAddress,
+                chunk.count
+            )
+        }
+
+        guard result.rawValue == 0 else {
+            Log.error("[StreamingVerifier] Update failed after \(bytesProcessed) bytes: \(result.rawValue)")
+            return .failure(.verificationError("Digest update failed (\(result.rawValue))"))
+        }
+
+        bytesProcessed += chunk.count
+        return .success(())
+    }
+
+    public func finalize(signature: Data) -> Result<Bool, CertificatePinningError> {
+        guard let context else {
+            return .failure(.verificationError("Verifier already finalized"))
+        }
+
+        guard !signature.isEmpty else {
+            return .failure(.invalidInput("Signature cannot be empty"))
+        }
+
+        let result: ecliptix_result_t = signature.withUnsafeBytes { sigBytes in
+            ecliptix_verify_final(
+                context,
+                sigBytes.bindMemory(to: UInt8.self).baseAddress,
+                signature.count
+            )
+        }
+
+        ecliptix_verify_free(context)
+        self.context = nil
+
+        switch result.rawValue {
+        case 0:
+            Log.debug("[StreamingVerifier] Signature verified over \(bytesProcessed) bytes")
+            return .success(true)
+        case -3:
+            Log.warning("[StreamingVerifier] Signature verification failed over \(bytesProcessed) bytes")
+            return .success(false)
+        default:
+            return .failure(.verificationError("Signature verification error (\(result.rawValue))"))
+        }
+    }
+
+    public static func verify<S: AsyncSequence>(
+        chunks: S,
+        signature: Data
+    ) async throws -> Result<Bool, CertificatePinningError> where S.Element == Data {
+        let verifier = try StreamingSignatureVerifier()
+        for try await chunk in chunks {
+            if case .failure(let error) = verifier.update(chunk) {
+                return .failure(error)
+            }
+        }
+        return verifier.finalize(signature: signature)
+    }
+}
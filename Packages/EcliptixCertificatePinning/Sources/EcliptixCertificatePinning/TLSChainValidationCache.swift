@@ -0,0 +1,79 @@
+import CEcliptixClient
+import EcliptixCore
+import Foundation
+
+public struct TLSChainValidationStats: Sendable {
+    public let hits: UInt64
+    public let misses: UInt64
+    public let stores: UInt64
+}
+
+public enum TLSChainValidationCache {
+
+    public static let maxChainLength = Int(ECLIPTIX_CHAIN_CACHE_MAX_CERTS)
+
+    public static func validate(
+        chain: [Data],
+        at date: Date = Date()
+    ) -> Result<Bool, CertificatePinningError> {
+        guard !chain.isEmpty, chain.count <= maxChainLength else {
+            return .failure(.invalidInput("Certificate chain must hold 1-\(maxChainLength) certificates"))
+        }
+
+        guard chain.allSatisfy({ !$0.isEmpty }) else {
+            return .failure(.invalidInput("Certificates cannot be empty"))
+        }
+
+        var arena = Data(capacity: chain.reduce(0) { $0 + $1.count })
+        var offsets: [Int] = []
+        offsets.reserveCapacity(chain.count)
+        for certificate in chain {
+            offsets.append(arena.count)
+            arena.append(certificate)
+        }
+        let lengths = chain.map(\.count)
+        let now = Int64(date.timeIntervalSince1970)
+        var cacheHit: Int32 = 0
+
+        let result: ecliptix_result_t = arena.withUnsafeBytes { arenaBytes in
+            let base = arenaBytes.bindMemory(to: UInt8.self).baseAddress
+            let certificates: [UnsafePointer<UInt8>?] = offsets.map { offset in
+                base.map { UnsafePointer($0 + offset) }
+            }
+            return certificates.withUnsafeBufferPointer { certificatesBuffer in
+                lengths.withUnsafeBufferPointer { lengthsBuffer in
+                    ecliptix_chain_validate(
+                        certificatesBuffer.baseAddress,
+                        lengthsBuffer.baseAddress,
+                        chain.count,
+                        now,
+                        &cacheHit
+                    )
+                }
+            }
+        }
+
+        switch result.rawValue {
+        case 0:
+            Log.debug("[TLSChainCache] Chain accepted (\(cacheHit != 0 ? "cached" : "evaluated"))")
+            return .success(true)
+        case -3:
+            Log.warning("[TLSChainCache] Chain rejected (\(cacheHit != 0 ? "cached" : "evaluated"))")
+            return .success(false)
+        default:
+            Log.error("[TLSChainCache] Chain validation error: \(result.rawValue)")
+            return .failure(.verificationError("Chain validation failed (\(result.rawValue))"))
+        }
+    }
+
+    public static func clear() {
+        ecliptix_chain_cache_clear()
+        Log.debug("[TLSChainCache] Cleared")
+    }
+
+    public static var statistics: TLSChainValidationStats {
+        var stats = ecliptix_chain_cache_stats_t()
+        ecliptix_chain_cache_get_stats(&stats)
+        return TLSChainValidationStats(hits: stats.hits, misses: stats.misses, stores: stats.stores)
+    }
+}
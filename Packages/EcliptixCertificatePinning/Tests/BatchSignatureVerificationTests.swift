@@ -0,0 +1,105 @@
+import CEcliptixClient
+import XCTest
+
+@testable import EcliptixCertificatePinning
+
+final class BatchSignatureVerificationTests: XCTestCase {
+    override func setUp() {
+        super.setUp()
+        XCTAssertEqual(TestSigningKey.server.pinAsServerKey(), ECLIPTIX_SUCCESS)
+    }
+    func testBitmapMarksEachItemAcrossByteBoundaries() {
+        let items = signedItems(count: 21, tamperedWhere: { $0 % 3 == 0 })
+
+        for maxThreads in 0...4 {
+            var bitmap = [UInt8](repeating: 0xff, count: 3)
+            let result = verifyBatch(items, bitmap: &bitmap, maxThreads: maxThreads)
+
+            XCTAssertEqual(result, ECLIPTIX_ERROR_VERIFICATION_FAILED, "threads \(maxThreads)")
+            for index in items.indices {
+                let verified = bitmap[index / 8] & (1 << UInt8(index % 8)) != 0
+                XCTAssertEqual(verified, index % 3 != 0, "item \(index), threads \(maxThreads)")
+            }
+        }
+    }
+    func testAllValidItemsReportSuccess() {
+        let items = signedItems(count: 9, tamperedWhere: { _ in false })
+        var bitmap = [UInt8](repeating: 0, count: 2)
+
+        XCTAssertEqual(verifyBatch(items, bitmap: &bitmap, maxThreads: 0), ECLIPTIX_SUCCESS)
+        XCTAssertEqual(bitmap, [0xff, 0x01])
+    }
+    func testShortBitmapIsRejected() {
+        let items = signedItems(count: 9, tamperedWhere: { _ in false })
+        var bitmap = [UInt8](repeating: 0, count: 1)
+
+        XCTAssertEqual(verifyBatch(items, bitmap: &bitmap, maxThreads: 0), ECLIPTIX_ERROR_INVALID_PARAMS)
+    }
+    func testClientUnpacksMixedResultsInOrder() {
+        let items = signedItems(count: 12, tamperedWhere: { [1, 8, 11].contains($0) })
+        let client = CertificatePinningClient()
+
+        XCTAssertEqual(
+            try client.verifySignatures(items).get(),
+            (0..<12).map { ![1, 8, 11].contains($0) })
+        XCTAssertEqual(try client.verifySignatures([]).get(), [])
+    }
+
+    private func signedItems(count: Int, tamperedWhere isTampered: (Int) -> Bool) -> [(data: Data, signature: Data)] {
+        (0..<count).map { index in
+            let data = randomData(count: 16 + index)
+            let signature = TestSigningKey.server.sign(data)
+            return (data, isTampered(index) ? tampered(signature, at: index) : signature)
+        }
+    }
+
+    private func verifyBatch(
+        _ items: [(data: Data, signature: Data)],
+        bitmap: inout [UInt8],
+        maxThreads: Int
+    ) -> ecliptix_result_t {
+        let data = items.map { [UInt8]($0.data) }
+        let signatures = items.map { [UInt8]($0.signature) }
+        return withBatch(data: data, signatures: signatures) { batch in
+            bitmap.withUnsafeMutableBufferPointer { bitmapBuffer in
+                ecliptix_client_verify_batch(
+                    batch.baseAddress,
+                    batch.count,
+                    bitmapBuffer.baseAddress,
+                    bitmapBuffer.count,
+                    maxThreads
+                )
+            }
+        }
+    }
+
+    private func withBatch<R>(
+        data: [[UInt8]],
+        signatures: [[UInt8]],
+        _ body: (UnsafeBufferPointer<ecliptix_verify_item_t>) -> R
+    ) -> R {
+        let dataPointers = data.map { bytes -> UnsafeMutablePointer<UInt8> in
+            let pointer = UnsafeMutablePointer<UInt8>.allocate(capacity: bytes.count)
+            pointer.initialize(from: bytes, count: bytes.count)
+            return pointer
+        }
+        let signaturePointers = signatures.map { bytes -> UnsafeMutablePointer<UInt8> in
+            let pointer = UnsafeMutablePointer<UInt8>.allocate(capacity: bytes.count)
+            pointer.initialize(from: bytes, count: bytes.count)
+            return pointer
+        }
+        defer {
+            dataPointers.forEach { $0.deallocate() }
+            signaturePointers.forEach { $0.deallocate() }
+        }
+        let batch = data.indices.map { index in
+            ecliptix_verify_item_t(
+                data: dataPointers[index],
+                data_len: data[index].count,
+                signature: signaturePointers[index],
+                sig_len: signatures[index].count
+            )
+        }
+        return batch.withUnsafeBufferPointer(body)
+    }
+}
@@ -0,0 +1,116 @@
+import CEcliptixClient
+import Crypto
+import XCTest
+
+@testable import EcliptixCertificatePinning
+
+final class PinnedKeySetTests: XCTestCase {
+    private let server = TestSigningKey.server
+
+    override func setUp() {
+        super.setUp()
+        XCTAssertEqual(server.pinAsServerKey(), ECLIPTIX_SUCCESS)
+    }
+    func testBuiltInSetPinsOnlyTheServerKey() {
+        XCTAssertEqual(PinnedKeySet.version, 0)
+        XCTAssertEqual(PinnedKeySet.count, 1)
+        XCTAssertTrue(PinnedKeySet.contains(keyHash: server.spkiHash))
+        XCTAssertEqual(PinnedKeySet.keyType(for: server.spkiHash), .rsa)
+        XCTAssertFalse(PinnedKeySet.contains(keyHash: Curve25519.Signing.PrivateKey().publicKey.spkiHash))
+    }
+    func testThirtyTwoKeyListInstallsWithEveryKeyPinned() {
+        let edKeys = (0..<31).map { _ in Curve25519.Signing.PrivateKey().publicKey }
+        let list = pinList(version: 1, keys: [server.subjectPublicKeyInfo] + edKeys.map(\.subjectPublicKeyInfo))
+
+        XCTAssertNoThrow(try install(list, signedBy: server, minimumVersion: 0).get())
+        XCTAssertEqual(PinnedKeySet.version, 1)
+        XCTAssertEqual(PinnedKeySet.count, Int(ECLIPTIX_PIN_SET_MAX_KEYS))
+        XCTAssertEqual(PinnedKeySet.keyType(for: server.spkiHash), .rsa)
+        for key in edKeys {
+            XCTAssertTrue(PinnedKeySet.contains(keyHash: key.spkiHash))
+            XCTAssertEqual(PinnedKeySet.keyType(for: key.spkiHash), .ed25519)
+        }
+    }
+    func testOlderOrEqualVersionCannotRollBack() {
+        let current = pinList(version: 2, keys: [server.subjectPublicKeyInfo])
+        let older = pinList(version: 1, keys: [server.subjectPublicKeyInfo])
+
+        XCTAssertNoThrow(try install(current, signedBy: server, minimumVersion: 0).get())
+        assertRejected(install(older, signedBy: server, minimumVersion: 0))
+        assertRejected(install(current, signedBy: server, minimumVersion: 0))
+        XCTAssertEqual(PinnedKeySet.version, 2)
+    }
+    func testMinimumVersionBlocksRollbackAfterRestart() {
+        let stale = pinList(version: 2, keys: [server.subjectPublicKeyInfo])
+        let persisted = pinList(version: 3, keys: [server.subjectPublicKeyInfo])
+
+        assertRejected(install(stale, signedBy: server, minimumVersion: 3))
+        XCTAssertEqual(PinnedKeySet.version, 0)
+        XCTAssertNoThrow(try install(persisted, signedBy: server, minimumVersion: 3).get())
+        XCTAssertEqual(PinnedKeySet.version, 3)
+    }
+    func testUnknownSignerAndBadSignatureAreRejected() throws {
+        let stranger = Curve25519.Signing.PrivateKey()
+        let list = pinList(version: 1, keys: [stranger.publicKey.subjectPublicKeyInfo])
+
+        assertRejected(PinnedKeySet.install(
+            pinList: list,
+            signerKeyHash: stranger.publicKey.spkiHash,
+            signature: try stranger.signature(for: list),
+            minimumVersion: 0))
+        assertRejected(PinnedKeySet.install(
+            pinList: list,
+            signerKeyHash: server.spkiHash,
+            signature: tampered(server.sign(list), at: 3),
+            minimumVersion: 0))
+        XCTAssertEqual(PinnedKeySet.version, 0)
+        XCTAssertFalse(PinnedKeySet.contains(keyHash: stranger.publicKey.spkiHash))
+    }
+    func testRotatedKeySignsTheNextList() throws {
+        let rotated = Curve25519.Signing.PrivateKey()
+        let handover = pinList(
+            version: 1,
+            keys: [server.subjectPublicKeyInfo, rotated.publicKey.subjectPublicKeyInfo])
+        let rotatedOnly = pinList(version: 2, keys: [rotated.publicKey.subjectPublicKeyInfo])
+        let revoked = pinList(version: 3, keys: [server.subjectPublicKeyInfo])
+
+        XCTAssertNoThrow(try install(handover, signedBy: server, minimumVersion: 0).get())
+        XCTAssertNoThrow(try PinnedKeySet.install(
+            pinList: rotatedOnly,
+            signerKeyHash: rotated.publicKey.spkiHash,
+            signature: try rotated.signature(for: rotatedOnly),
+            minimumVersion: 0).get())
+        XCTAssertFalse(PinnedKeySet.contains(keyHash: server.spkiHash))
+        assertRejected(install(revoked, signedBy: server, minimumVersion: 0))
+    }
+    func testSignedMalformedListIsRejected() {
+        let truncated = pinList(version: 1, keys: [server.subjectPublicKeyInfo]).dropLast()
+
+        guard case .failure(.invalidInput) = install(Data(truncated), signedBy: server, minimumVersion: 0) else {
+            return XCTFail("A truncated list must be reported as malformed")
+        }
+        XCTAssertEqual(PinnedKeySet.version, 0)
+    }
+
+    private func install(
+        _ list: Data,
+        signedBy signer: TestSigningKey,
+        minimumVersion: UInt32
+    ) -> Result<Void, CertificatePinningError> {
+        PinnedKeySet.install(
+            pinList: list,
+            signerKeyHash: signer.spkiHash,
+            signature: signer.sign(list),
+            minimumVersion: minimumVersion)
+    }
+
+    private func assertRejected(
+        _ result: Result<Void, CertificatePinningError>,
+        file: StaticString = #filePath,
+        line: UInt = #line
+    ) {
+        guard case .failure(.verificationError) = result else {
+            return XCTFail("Expected the pin list to be rejected, got \(result)", file: file, line: line)
+        }
+    }
+}
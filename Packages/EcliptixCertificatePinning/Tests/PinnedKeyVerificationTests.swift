@@ -0,0 +1,93 @@
+import CEcliptixClient
+import Crypto
+import XCTest
+
+@testable import EcliptixCertificatePinning
+
+final class PinnedKeyVerificationTests: XCTestCase {
+    private let server = TestSigningKey.server
+    private let edKey = Curve25519.Signing.PrivateKey()
+
+    override func setUp() {
+        super.setUp()
+        XCTAssertEqual(server.pinAsServerKey(), ECLIPTIX_SUCCESS)
+        let list = pinList(
+            version: 1,
+            keys: [server.subjectPublicKeyInfo, edKey.publicKey.subjectPublicKeyInfo])
+        XCTAssertNoThrow(try PinnedKeySet.install(
+            pinList: list,
+            signerKeyHash: server.spkiHash,
+            signature: server.sign(list),
+            minimumVersion: 0).get())
+    }
+    func testEd25519SignatureVerifiesWithPinnedKey() throws {
+        let data = randomData(count: 300)
+        let signature = try edKey.signature(for: data)
+        let keyHash = edKey.publicKey.spkiHash
+
+        XCTAssertEqual(PinnedKeySet.keyType(for: keyHash), .ed25519)
+        XCTAssertEqual(try PinnedKeySet.verify(keyHash: keyHash, data: data, signature: signature).get(), true)
+        XCTAssertEqual(
+            try PinnedKeySet.verify(keyHash: keyHash, data: tampered(data, at: 7), signature: signature).get(),
+            false)
+        XCTAssertEqual(
+            try PinnedKeySet.verify(keyHash: keyHash, data: data, signature: tampered(signature, at: 40)).get(),
+            false)
+        XCTAssertEqual(
+            try PinnedKeySet.verify(keyHash: keyHash, data: data, signature: signature.dropLast()).get(),
+            false)
+    }
+    func testEd25519BatchReportsEachItem() throws {
+        let tamperedIndices: Set<Int> = [0, 4, 9]
+        let items = try (0..<10).map { index -> (data: Data, signature: Data) in
+            let data = randomData(count: 32 + index)
+            let signature = try edKey.signature(for: data)
+            return (data, tamperedIndices.contains(index) ? tampered(signature, at: index) : signature)
+        }
+
+        XCTAssertEqual(
+            try PinnedKeySet.verifyBatch(keyHash: edKey.publicKey.spkiHash, items: items).get(),
+            (0..<10).map { !tamperedIndices.contains($0) })
+        XCTAssertEqual(
+            try PinnedKeySet.verifyBatch(keyHash: edKey.publicKey.spkiHash, items: []).get(),
+            [])
+    }
+    func testSignatureFromOtherKeyTypeIsRejected() throws {
+        let data = randomData(count: 64)
+
+        XCTAssertEqual(
+            try PinnedKeySet.verify(keyHash: edKey.publicKey.spkiHash, data: data, signature: server.sign(data)).get(),
+            false)
+        XCTAssertEqual(
+            try PinnedKeySet.verify(keyHash: server.spkiHash, data: data, signature: edKey.signature(for: data)).get(),
+            false)
+        XCTAssertEqual(try PinnedKeySet.verify(keyHash: server.spkiHash, data: data, signature: server.sign(data)).get(), true)
+    }
+    func testUnpinnedKeyVerifiesNothing() throws {
+        let stranger = Curve25519.Signing.PrivateKey()
+        let data = randomData(count: 64)
+        let signature = try stranger.signature(for: data)
+
+        XCTAssertNil(PinnedKeySet.keyType(for: stranger.publicKey.spkiHash))
+        XCTAssertEqual(
+            try PinnedKeySet.verify(keyHash: stranger.publicKey.spkiHash, data: data, signature: signature).get(),
+            false)
+        XCTAssertEqual(
+            try PinnedKeySet.verifyBatch(
+                keyHash: stranger.publicKey.spkiHash,
+                items: [(data, signature), (data, signature)]
+            ).get(),
+            [false, false])
+    }
+    func testRsaBatchThroughPinSetMatchesClientBatch() {
+        let items = (0..<9).map { index -> (data: Data, signature: Data) in
+            let data = randomData(count: 20)
+            let signature = server.sign(data)
+            return (data, index == 2 ? tampered(signature) : signature)
+        }
+        let expected = (0..<9).map { $0 != 2 }
+
+        XCTAssertEqual(try PinnedKeySet.verifyBatch(keyHash: server.spkiHash, items: items).get(), expected)
+        XCTAssertEqual(try CertificatePinningClient().verifySignatures(items).get(), expected)
+    }
+}
@@ -0,0 +1,82 @@
+import CEcliptixClient
+import XCTest
+
+@testable import EcliptixCertificatePinning
+
+final class StreamingSignatureVerifierTests: XCTestCase {
+    override func setUp() {
+        super.setUp()
+        XCTAssertEqual(TestSigningKey.server.pinAsServerKey(), ECLIPTIX_SUCCESS)
+    }
+    func testPayloadFedInSeveralChunksVerifies() throws {
+        let payload = randomData(count: 70_000)
+        let signature = TestSigningKey.server.sign(payload)
+
+        let verifier = try StreamingSignatureVerifier()
+        for range in chunkRanges(of: payload, cuts: [1, 8, 4096, 65_536]) {
+            XCTAssertNoThrow(try verifier.update(payload.subdata(in: range)).get())
+        }
+        XCTAssertEqual(try verifier.finalize(signature: signature).get(), true)
+    }
+    func testChunkBoundariesDoNotChangeTheResult() throws {
+        let payload = randomData(count: 10_000)
+        let signature = TestSigningKey.server.sign(payload)
+
+        for cuts in [[], [5_000], [1, 2, 3], [9_999]] {
+            let verifier = try StreamingSignatureVerifier()
+            for range in chunkRanges(of: payload, cuts: cuts) {
+                XCTAssertNoThrow(try verifier.update(payload.subdata(in: range)).get())
+            }
+            XCTAssertEqual(try verifier.finalize(signature: signature).get(), true, "cuts \(cuts)")
+        }
+    }
+    func testTamperedSignatureIsRejected() throws {
+        let payload = randomData(count: 20_000)
+        let signature = TestSigningKey.server.sign(payload)
+
+        let verifier = try StreamingSignatureVerifier()
+        for range in chunkRanges(of: payload, cuts: [7_000, 14_000]) {
+            XCTAssertNoThrow(try verifier.update(payload.subdata(in: range)).get())
+        }
+        XCTAssertEqual(try verifier.finalize(signature: tampered(signature, at: 100)).get(), false)
+    }
+    func testTamperedChunkIsRejected() throws {
+        let payload = randomData(count: 20_000)
+        let signature = TestSigningKey.server.sign(payload)
+
+        let verifier = try StreamingSignatureVerifier()
+        XCTAssertNoThrow(try verifier.update(payload.prefix(10_000)).get())
+        XCTAssertNoThrow(try verifier.update(tampered(payload.suffix(10_000), at: 42)).get())
+        XCTAssertEqual(try verifier.finalize(signature: signature).get(), false)
+    }
+    func testFinalizedVerifierRejectsFurtherUse() throws {
+        let payload = randomData(count: 64)
+        let signature = TestSigningKey.server.sign(payload)
+
+        let verifier = try StreamingSignatureVerifier()
+        XCTAssertNoThrow(try verifier.update(payload).get())
+        XCTAssertEqual(try verifier.finalize(signature: signature).get(), true)
+
+        guard case .failure = verifier.update(payload), case .failure = verifier.finalize(signature: signature) else {
+            return XCTFail("A finalized verifier must not accept more input")
+        }
+    }
+    func testAsyncSequenceOfChunksVerifies() async throws {
+        let payload = randomData(count: 30_000)
+        let signature = TestSigningKey.server.sign(payload)
+        let chunks = AsyncStream<Data> { continuation in
+            for range in chunkRanges(of: payload, cuts: [10_000, 20_000]) {
+                continuation.yield(payload.subdata(in: range))
+            }
+            continuation.finish()
+        }
+
+        let verified = try await StreamingSignatureVerifier.verify(chunks: chunks, signature: signature)
+        XCTAssertEqual(try verified.get(), true)
+    }
+
+    private func chunkRanges(of payload: Data, cuts: [Int]) -> [Range<Int>] {
+        let bounds = [0] + cuts + [payload.count]
+        return zip(bounds, bounds.dropFirst()).map { $0..<$1 }
+    }
+}
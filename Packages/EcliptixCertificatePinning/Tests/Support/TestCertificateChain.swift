@@ -0,0 +1,31 @@
+import Foundation
+
+enum TestCertificateChain {
+
+    // Ed25519 CA (2025-01-01 to 2035-01-01) and a leaf it signed (2025-06-01 to 2026-06-01).
+    static let leaf = Data(base64Encoded:
+        "MIHnMIGaoAMCAQICAQIwBQYDK2VwMBsxGTAXBgNVBAMMEEVjbGlwdGl4IFRlc3QgQ0EwHhcNMjUw"
+        + "NjAxMDAwMDAwWhcNMjYwNjAxMDAwMDAwWjAgMR4wHAYDVQQDDBVwaW5uaW5nLnRlc3QuZWNsaXB0"
+        + "aXgwKjAFBgMrZXADIQAO3uegET/Bt47PPl+p95TivjQKGauLSsAcgFwdywjQzDAFBgMrZXADQQBF"
+        + "twiVmJjtdjU299tafc+9fwasNJzJ5m/Ioy6SW+4OHaXiBvO3ZQOEeuj3NfiUKVWUNOQruFh6qgc0"
+        + "fu/QfAIM"
+    )!
+
+    static let certificateAuthority = Data(base64Encoded:
+        "MIHiMIGVoAMCAQICAQEwBQYDK2VwMBsxGTAXBgNVBAMMEEVjbGlwdGl4IFRlc3QgQ0EwHhcNMjUw"
+        + "MTAxMDAwMDAwWhcNMzUwMTAxMDAwMDAwWjAbMRkwFwYDVQQDDBBFY2xpcHRpeCBUZXN0IENBMCow"
+        + "BQYDK2VwAyEA87T//J525fLhLlcISqEAPgfstskKxDz7lk6xjetr6OcwBQYDK2VwA0EA4JVmpP42"
+        + "qmtSReCv6YlfekbueEwcU7aMgWCLfJImffAmaNb07DMc/FhTgKvRJG4rfAnmSHjB5X3y+EcAQAeJ"
+        + "Ag=="
+    )!
+
+    static let certificateAuthorityKey = Data(base64Encoded: "MCowBQYDK2VwAyEA87T//J525fLhLlcISqEAPgfstskKxDz7lk6xjetr6Oc=")!
+
+    static let leafNotBefore = Date(timeIntervalSince1970: 1_748_736_000)
+    static let leafNotAfter = Date(timeIntervalSince1970: 1_780_272_000)
+    static let withinValidity = Date(timeIntervalSince1970: 1_767_225_600)
+
+    static var chain: [Data] {
+        [leaf, certificateAuthority]
+    }
+}
@@ -0,0 +1,91 @@
+import CEcliptixClient
+import CEcliptixClient.Testing
+import Crypto
+import Foundation
+import Security
+
+final class TestSigningKey: @unchecked Sendable {
+
+    static let server = TestSigningKey()
+
+    let privateKey: SecKey
+    let subjectPublicKeyInfo: Data
+
+    init() {
+        let attributes: [String: Any] = [
+            kSecAttrKeyType as String: kSecAttrKeyTypeRSA,
+            kSecAttrKeySizeInBits as String: 2048,
+        ]
+        var error: Unmanaged<CFError>?
+        guard let privateKey = SecKeyCreateRandomKey(attributes as CFDictionary, &error),
+              let publicKey = SecKeyCopyPublicKey(privateKey),
+              let rsaPublicKey = SecKeyCopyExternalRepresentation(publicKey, &error) as Data?
+        else {
+            fatalError("RSA test key generation failed: \(String(describing: error?.takeRetainedValue()))")
+        }
+        self.privateKey = privateKey
+        self.subjectPublicKeyInfo = Self.rsa2048SpkiPrefix + rsaPublicKey
+    }
+
+    var spkiHash: Data {
+        Data(SHA256.hash(data: subjectPublicKeyInfo))
+    }
+
+    func sign(_ data: Data) -> Data {
+        var error: Unmanaged<CFError>?
+        guard let signature = SecKeyCreateSignature(
+            privateKey,
+            .rsaSignatureMessagePKCS1v15SHA256,
+            data as CFData,
+            &error
+        ) as Data? else {
+            fatalError("RSA test signature failed: \(String(describing: error?.takeRetainedValue()))")
+        }
+        return signature
+    }
+
+    func pinAsServerKey() -> ecliptix_result_t {
+        subjectPublicKeyInfo.withUnsafeBytes { spkiBytes in
+            ecliptix_testing_reset_server_key(
+                spkiBytes.bindMemory(to: UInt8.self).baseAddress,
+                subjectPublicKeyInfo.count
+            )
+        }
+    }
+
+    private static let rsa2048SpkiPrefix = Data([
+        0x30, 0x82, 0x01, 0x22, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86,
+        0xf7, 0x0d, 0x01, 0x01, 0x01, 0x05, 0x00, 0x03, 0x82, 0x01, 0x0f, 0x00,
+    ])
+}
+
+extension Curve25519.Signing.PublicKey {
+    var subjectPublicKeyInfo: Data {
+        Data([0x30, 0x2a, 0x30, 0x05, 0x06, 0x03, 0x2b, 0x65, 0x70, 0x03, 0x21, 0x00]) + rawRepresentation
+    }
+
+    var spkiHash: Data {
+        Data(SHA256.hash(data: subjectPublicKeyInfo))
+    }
+}
+
+func pinList(version: UInt32, keys: [Data]) -> Data {
+    var list = Data("EPL1".utf8)
+    list.append(contentsOf: withUnsafeBytes(of: version.bigEndian) { Array($0) })
+    list.append(contentsOf: withUnsafeBytes(of: UInt16(keys.count).bigEndian) { Array($0) })
+    for key in keys {
+        list.append(contentsOf: withUnsafeBytes(of: UInt16(key.count).bigEndian) { Array($0) })
+        list.append(key)
+    }
+    return list
+}
+
+func randomData(count: Int) -> Data {
+    Data((0..<count).map { _ in UInt8.random(in: 0...255) })
+}
+
+func tampered(_ data: Data, at index: Int = 0) -> Data {
+    var copy = data
+    copy[copy.startIndex + index] ^= 0x01
+    return copy
+}
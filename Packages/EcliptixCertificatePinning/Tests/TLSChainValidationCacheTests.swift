@@ -0,0 +1,101 @@
+import CEcliptixClient
+import XCTest
+
+@testable import EcliptixCertificatePinning
+
+final class TLSChainValidationCacheTests: XCTestCase {
+    private let server = TestSigningKey.server
+
+    override func setUp() {
+        super.setUp()
+        XCTAssertEqual(server.pinAsServerKey(), ECLIPTIX_SUCCESS)
+    }
+    func testPinnedChainIsEvaluatedOnceThenServedFromCache() {
+        pinCertificateAuthority(version: 1)
+        let before = TLSChainValidationCache.statistics
+
+        XCTAssertEqual(validate(at: TestCertificateChain.withinValidity), true)
+        XCTAssertEqual(validate(at: TestCertificateChain.withinValidity.addingTimeInterval(3600)), true)
+
+        let after = TLSChainValidationCache.statistics
+        XCTAssertEqual(after.misses - before.misses, 1)
+        XCTAssertEqual(after.stores - before.stores, 1)
+        XCTAssertEqual(after.hits - before.hits, 1)
+    }
+    func testUnpinnedChainIsRejectedAndTheRejectionCached() {
+        let before = TLSChainValidationCache.statistics
+
+        XCTAssertEqual(validate(at: TestCertificateChain.withinValidity), false)
+        XCTAssertEqual(validate(at: TestCertificateChain.withinValidity), false)
+
+        let after = TLSChainValidationCache.statistics
+        XCTAssertEqual(after.misses - before.misses, 1)
+        XCTAssertEqual(after.hits - before.hits, 1)
+    }
+    func testCachedDecisionExpiresWithTheLeaf() {
+        pinCertificateAuthority(version: 1)
+        let lastSecond = TestCertificateChain.leafNotAfter.addingTimeInterval(-1)
+
+        XCTAssertEqual(validate(at: lastSecond.addingTimeInterval(-10)), true)
+        let before = TLSChainValidationCache.statistics
+        XCTAssertEqual(validate(at: lastSecond), true)
+        XCTAssertEqual(validate(at: TestCertificateChain.leafNotAfter), false)
+
+        let after = TLSChainValidationCache.statistics
+        XCTAssertEqual(after.hits - before.hits, 1)
+        XCTAssertEqual(after.misses - before.misses, 1)
+        XCTAssertEqual(validate(at: TestCertificateChain.leafNotBefore.addingTimeInterval(-1)), false)
+    }
+    func testPinSetChangeInvalidatesCachedDecision() {
+        pinCertificateAuthority(version: 1)
+        XCTAssertEqual(validate(at: TestCertificateChain.withinValidity), true)
+        XCTAssertEqual(validate(at: TestCertificateChain.withinValidity), true)
+
+        XCTAssertNoThrow(try install(pinList(version: 2, keys: [server.subjectPublicKeyInfo])).get())
+        let before = TLSChainValidationCache.statistics
+        XCTAssertEqual(validate(at: TestCertificateChain.withinValidity), false)
+
+        let after = TLSChainValidationCache.statistics
+        XCTAssertEqual(after.hits, before.hits)
+        XCTAssertEqual(after.misses - before.misses, 1)
+    }
+    func testLeafWithBrokenSignatureIsRejected() {
+        pinCertificateAuthority(version: 1)
+        let forgedLeaf = tampered(TestCertificateChain.leaf, at: TestCertificateChain.leaf.count - 1)
+
+        XCTAssertEqual(
+            try TLSChainValidationCache.validate(
+                chain: [forgedLeaf, TestCertificateChain.certificateAuthority],
+                at: TestCertificateChain.withinValidity
+            ).get(),
+            false)
+        XCTAssertEqual(validate(at: TestCertificateChain.withinValidity), true)
+    }
+    func testChainLengthIsChecked() {
+        guard case .failure(.invalidInput) = TLSChainValidationCache.validate(chain: []),
+              case .failure(.invalidInput) = TLSChainValidationCache.validate(
+                  chain: Array(repeating: TestCertificateChain.leaf, count: TLSChainValidationCache.maxChainLength + 1))
+        else {
+            return XCTFail("Empty and over-long chains must be rejected as invalid input")
+        }
+    }
+
+    private func pinCertificateAuthority(version: UInt32) {
+        let list = pinList(
+            version: version,
+            keys: [server.subjectPublicKeyInfo, TestCertificateChain.certificateAuthorityKey])
+        XCTAssertNoThrow(try install(list).get())
+    }
+
+    private func install(_ list: Data) -> Result<Void, CertificatePinningError> {
+        PinnedKeySet.install(
+            pinList: list,
+            signerKeyHash: server.spkiHash,
+            signature: server.sign(list),
+            minimumVersion: 0)
+    }
+
+    private func validate(at date: Date) -> Bool? {
+        try? TLSChainValidationCache.validate(chain: TestCertificateChain.chain, at: date).get()
+    }
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "ecliptix_net_common.h"
+
+ECLIPTIX_NET_EXTERN_C_BEGIN
+
+/*
+ * Per-connection circuit breakers in a fixed-size, open-addressed table.
+ *
+ * Each circuit is a single 64-bit word (state, consecutive failures,
+ * consecutive successes and the last transition time packed together), so
+ * admission is one atomic load on the hot path and every transition is a CAS.
+ * Slots are claimed once and never freed; resetting a circuit rewrites its
+ * word. When the table is full, unknown connections are admitted untracked.
+ */
+
+typedef struct ecliptix_circuit_table ecliptix_circuit_table_t;
+
+typedef enum {
+    ECLIPTIX_CIRCUIT_CLOSED = 0,
+    ECLIPTIX_CIRCUIT_OPEN = 1,
+    ECLIPTIX_CIRCUIT_HALF_OPEN = 2
+} ecliptix_circuit_state_t;
+
+typedef enum {
+    ECLIPTIX_CIRCUIT_ALLOW = 0,
+    ECLIPTIX_CIRCUIT_REJECT = 1,
+    ECLIPTIX_CIRCUIT_ALLOW_TRIAL = 2  /* this call moved the circuit from open to half-open */
+} ecliptix_circuit_decision_t;
+
+typedef enum {
+    ECLIPTIX_CIRCUIT_TRANSITION_NONE = 0,
+    ECLIPTIX_CIRCUIT_TRANSITION_OPENED = 1,
+    ECLIPTIX_CIRCUIT_TRANSITION_REOPENED = 2,
+    ECLIPTIX_CIRCUIT_TRANSITION_CLOSED = 3
+} ecliptix_circuit_transition_t;
+
+/* Counters are packed into the circuit word, so thresholds above these can never be reached. */
+#define ECLIPTIX_CIRCUIT_MAX_FAILURE_THRESHOLD 2047
+#define ECLIPTIX_CIRCUIT_MAX_SUCCESS_THRESHOLD 255
+
+typedef struct {
+    uint32_t failure_threshold;   /* consecutive failures that open a closed circuit, 0 selects 5 */
+    uint32_t success_threshold;   /* half-open successes that close it again, 0 selects 2 */
+    uint64_t open_duration_ms;    /* time spent open before a trial is allowed, 0 selects 30s */
+    uint32_t capacity;            /* rounded up to a power of two, 0 selects 1024 */
+} ecliptix_circuit_table_config_t;
+
+typedef struct {
+    ecliptix_circuit_state_t state;
+    uint32_t consecutive_failures;
+    uint32_t consecutive_successes;
+    uint64_t ms_since_transition;
+    uint64_t ms_since_failure;    /* UINT64_MAX when no failure was recorded */
+} ecliptix_circuit_snapshot_t;
+
+/* Returns NULL when a threshold exceeds its maximum or the capacity is above 2^20. */
+ECLIPTIX_NET_API ecliptix_circuit_table_t* ecliptix_circuit_table_create(
+    const ecliptix_circuit_table_config_t* config
+);
+
+ECLIPTIX_NET_API void ecliptix_circuit_table_destroy(ecliptix_circuit_table_t* table);
+
+ECLIPTIX_NET_API ecliptix_circuit_decision_t ecliptix_circuit_table_acquire(
+    ecliptix_circuit_table_t* table,
+    uint32_t connect_id
+);
+
+ECLIPTIX_NET_API ecliptix_circuit_transition_t ecliptix_circuit_table_record_success(
+    ecliptix_circuit_table_t* table,
+    uint32_t connect_id
+);
+
+ECLIPTIX_NET_API ecliptix_circuit_transition_t ecliptix_circuit_table_record_failure(
+    ecliptix_circuit_table_t* table,
+    uint32_t connect_id
+);
+
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_circuit_table_reset(
+    ecliptix_circuit_table_t* table,
+    uint32_t connect_id
+);
+
+ECLIPTIX_NET_API void ecliptix_circuit_table_reset_all(ecliptix_circuit_table_t* table);
+
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_circuit_table_get(
+    const ecliptix_circuit_table_t* table,
+    uint32_t connect_id,
+    ecliptix_circuit_snapshot_t* out_snapshot
+);
+
+/* Connections admitted untracked because the table was full. */
+ECLIPTIX_NET_API uint64_t ecliptix_circuit_table_overflow_count(const ecliptix_circuit_table_t* table);
+
+ECLIPTIX_NET_EXTERN_C_END
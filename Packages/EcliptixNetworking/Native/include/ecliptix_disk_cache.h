@@ -0,0 +1,123 @@
+#pragma once
+
+#include "ecliptix_net_common.h"
+
+ECLIPTIX_NET_EXTERN_C_BEGIN
+
+/*
+ * Persistent, encrypted second tier for the response cache.
+ *
+ * Records are sealed (XChaCha20-Poly1305) and appended to a single log that is
+ * mmap'd for reads. Keys never reach the disk in clear: the index holds a keyed
+ * digest, offset, length, expiry and recency for every live record, and is the
+ * only thing read at startup. Each sealed record carries its key and tags, so
+ * prefix, tag and substring removal decrypt a record at most once per session
+ * to match it. Removals persist the index before returning; writes are queued
+ * and applied by a background writer. When the live set exceeds its budget the
+ * least recently used records are dropped, and the log is compacted once dead
+ * records dominate it.
+ */
+
+typedef struct ecliptix_disk_cache ecliptix_disk_cache_t;
+
+#define ECLIPTIX_DISK_CACHE_KEY_BYTES 32
+
+typedef struct {
+    const char* directory;        /* created if missing */
+    const uint8_t* key;           /* ECLIPTIX_DISK_CACHE_KEY_BYTES of secret key material */
+    size_t key_len;
+    uint64_t max_bytes;           /* live record budget, 0 selects 32 MiB */
+    uint32_t max_pending_writes;  /* write-behind queue bound, 0 selects 256 */
+} ecliptix_disk_cache_config_t;
+
+typedef struct {
+    uint64_t entries;
+    uint64_t live_bytes;
+    uint64_t file_bytes;
+    uint64_t pending_writes;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t writes;
+    uint64_t dropped_writes;
+    uint64_t evictions;
+    uint64_t compactions;
+    uint64_t corrupt_records;
+} ecliptix_disk_cache_stats_t;
+
+/* Invoked outside the cache lock with the decrypted record. */
+typedef void (*ecliptix_disk_cache_sink_fn)(
+    const uint8_t* value,
+    size_t value_len,
+    const uint8_t* etag,
+    size_t etag_len,
+    const uint8_t* tags,          /* NUL-separated, as passed to put */
+    size_t tags_len,
+    uint64_t remaining_ttl_ms,
+    void* context
+);
+
+/* Returns NULL if the directory cannot be opened or the key is malformed. */
+ECLIPTIX_NET_API ecliptix_disk_cache_t* ecliptix_disk_cache_create(const ecliptix_disk_cache_config_t* config);
+
+/* Drains pending writes, persists the index and releases the mapping. */
+ECLIPTIX_NET_API void ecliptix_disk_cache_destroy(ecliptix_disk_cache_t* cache);
+
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_disk_cache_get(
+    ecliptix_disk_cache_t* cache,
+    const uint8_t* key,
+    size_t key_len,
+    ecliptix_disk_cache_sink_fn sink,
+    void* context
+);
+
+/* Queues the record; ECLIPTIX_NET_ERROR_CAPACITY when the write-behind queue is full. */
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_disk_cache_put(
+    ecliptix_disk_cache_t* cache,
+    const uint8_t* key,
+    size_t key_len,
+    const uint8_t* value,
+    size_t value_len,
+    const uint8_t* etag,
+    size_t etag_len,
+    uint64_t ttl_ms,
+    const uint8_t* tags,          /* NUL-separated tag names, may be NULL */
+    size_t tags_len
+);
+
+/* ECLIPTIX_NET_ERROR_IO when the record is gone but the index could not be persisted. */
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_disk_cache_remove(
+    ecliptix_disk_cache_t* cache,
+    const uint8_t* key,
+    size_t key_len
+);
+
+/* Bulk removals mirror the response cache invalidations and return the number of records dropped. */
+ECLIPTIX_NET_API size_t ecliptix_disk_cache_remove_prefix(
+    ecliptix_disk_cache_t* cache,
+    const uint8_t* prefix,
+    size_t prefix_len
+);
+
+ECLIPTIX_NET_API size_t ecliptix_disk_cache_remove_tag(
+    ecliptix_disk_cache_t* cache,
+    const uint8_t* tag,
+    size_t tag_len
+);
+
+ECLIPTIX_NET_API size_t ecliptix_disk_cache_remove_matching(
+    ecliptix_disk_cache_t* cache,
+    const uint8_t* pattern,
+    size_t pattern_len
+);
+
+ECLIPTIX_NET_API void ecliptix_disk_cache_clear(ecliptix_disk_cache_t* cache);
+
+/* Blocks until queued writes are on disk and the index is persisted. */
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_disk_cache_flush(ecliptix_disk_cache_t* cache);
+
+ECLIPTIX_NET_API void ecliptix_disk_cache_get_stats(
+    const ecliptix_disk_cache_t* cache,
+    ecliptix_disk_cache_stats_t* out_stats
+);
+
+ECLIPTIX_NET_EXTERN_C_END
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <sys/uio.h>
+
+#include "ecliptix_net_common.h"
+
+ECLIPTIX_NET_EXTERN_C_BEGIN
+
+/*
+ * gRPC length-prefixed message framing over pooled slabs.
+ *
+ * Every message on the wire is a 1-byte compressed flag, a 4-byte big-endian
+ * length and the message bytes. Outbound frames are plain structs that borrow
+ * their segments (envelope header, metadata, payload) and hand them to
+ * writev() unchanged, so nothing is concatenated. Inbound bytes are read
+ * straight into refcounted slabs; each deframed message is a view into its
+ * slab that keeps the slab alive until released. Released slabs go back to
+ * the pool, so steady-state traffic performs no allocations.
+ */
+
+#define ECLIPTIX_GRPC_PREFIX_SIZE 5
+#define ECLIPTIX_GRPC_MAX_SEGMENTS 8
+
+typedef struct ecliptix_slab_pool ecliptix_slab_pool_t;
+typedef struct ecliptix_grpc_deframer ecliptix_grpc_deframer_t;
+
+typedef struct {
+    size_t slab_size;             /* bytes per pooled slab, 0 selects 64 KiB */
+    uint32_t max_cached_slabs;    /* idle slabs kept for reuse, 0 selects 32 */
+} ecliptix_slab_pool_config_t;
+
+typedef struct {
+    uint64_t slab_allocations;
+    uint64_t slab_reuses;
+    uint64_t oversize_allocations;  /* slabs larger than slab_size, never cached */
+    size_t cached_slabs;
+    size_t outstanding_slabs;
+} ecliptix_slab_pool_stats_t;
+
+/* Writable pooled buffer, e.g. for serialising an envelope before framing it. */
+typedef struct {
+    uint8_t* data;
+    size_t capacity;
+    void* slab;                   /* owned reference, release with ecliptix_slab_buffer_release */
+} ecliptix_slab_buffer_t;
+
+typedef struct {
+    const uint8_t* data;
+    size_t length;
+} ecliptix_grpc_segment_t;
+
+/* Outbound frame; segments are borrowed and must outlive the write. */
+typedef struct {
+    uint8_t prefix[ECLIPTIX_GRPC_PREFIX_SIZE];
+    ecliptix_grpc_segment_t segments[ECLIPTIX_GRPC_MAX_SEGMENTS];
+    size_t segment_count;
+    size_t total_length;          /* prefix included */
+    size_t written;               /* progress of ecliptix_grpc_frame_write */
+} ecliptix_grpc_frame_t;
+
+/* Inbound message; a view into a pooled slab. */
+typedef struct {
+    const uint8_t* data;
+    size_t length;
+    uint8_t compressed;
+    void* slab;                   /* owned reference, release with ecliptix_grpc_message_release */
+} ecliptix_grpc_message_t;
+
+/* The pool is refcounted internally and may be destroyed while buffers and messages are still alive. */
+ECLIPTIX_NET_API ecliptix_slab_pool_t* ecliptix_slab_pool_create(const ecliptix_slab_pool_config_t* config);
+
+ECLIPTIX_NET_API void ecliptix_slab_pool_destroy(ecliptix_slab_pool_t* pool);
+
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_slab_pool_acquire(
+    ecliptix_slab_pool_t* pool,
+    size_t min_capacity,
+    ecliptix_slab_buffer_t* out_buffer
+);
+
+ECLIPTIX_NET_API void ecliptix_slab_buffer_release(ecliptix_slab_buffer_t* buffer);
+
+ECLIPTIX_NET_API void ecliptix_slab_pool_get_stats(
+    const ecliptix_slab_pool_t* pool,
+    ecliptix_slab_pool_stats_t* out_stats
+);
+
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_grpc_frame_init(
+    ecliptix_grpc_frame_t* frame,
+    uint8_t compressed,
+    const ecliptix_grpc_segment_t* segments,
+    size_t segment_count
+);
+
+/* Fills up to capacity iovecs covering the unwritten part of the frame. Returns the count. */
+ECLIPTIX_NET_API size_t ecliptix_grpc_frame_iovecs(
+    const ecliptix_grpc_frame_t* frame,
+    struct iovec* out_iovecs,
+    size_t capacity
+);
+
+/*
+ * writev()s the unwritten part of the frame. Returns SUCCESS once the whole
+ * frame is out, ECLIPTIX_NET_ERROR_CAPACITY when a non-blocking descriptor
+ * would block (call again when writable) and ECLIPTIX_NET_ERROR_IO otherwise.
+ */
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_grpc_frame_write(ecliptix_grpc_frame_t* frame, int fd);
+
+ECLIPTIX_NET_API ecliptix_grpc_deframer_t* ecliptix_grpc_deframer_create(
+    ecliptix_slab_pool_t* pool,
+    size_t max_message_size       /* 0 selects 4 MiB */
+);
+
+ECLIPTIX_NET_API void ecliptix_grpc_deframer_destroy(ecliptix_grpc_deframer_t* deframer);
+
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_grpc_deframer_feed(
+    ecliptix_grpc_deframer_t* deframer,
+    const uint8_t* data,
+    size_t length
+);
+
+/*
+ * read()s once into the current slab. *out_read is 0 at end of stream.
+ * Returns ECLIPTIX_NET_ERROR_CAPACITY when a non-blocking descriptor would block.
+ */
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_grpc_deframer_read(
+    ecliptix_grpc_deframer_t* deframer,
+    int fd,
+    size_t* out_read
+);
+
+/*
+ * Returns SUCCESS with the next complete message, NOT_FOUND when more bytes
+ * are needed, and ECLIPTIX_NET_ERROR_IO for a malformed prefix or a message
+ * above max_message_size; the stream is unusable after an error.
+ */
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_grpc_deframer_next(
+    ecliptix_grpc_deframer_t* deframer,
+    ecliptix_grpc_message_t* out_message
+);
+
+/* Bytes received but not yet returned as messages. */
+ECLIPTIX_NET_API size_t ecliptix_grpc_deframer_buffered(const ecliptix_grpc_deframer_t* deframer);
+
+/* Copies the reference; both copies must be released. */
+ECLIPTIX_NET_API void ecliptix_grpc_message_retain(const ecliptix_grpc_message_t* message);
+
+ECLIPTIX_NET_API void ecliptix_grpc_message_release(ecliptix_grpc_message_t* message);
+
+ECLIPTIX_NET_EXTERN_C_END
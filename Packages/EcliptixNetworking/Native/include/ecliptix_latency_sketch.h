@@ -0,0 +1,65 @@
+#pragma once
+
+#include "ecliptix_net_common.h"
+
+ECLIPTIX_NET_EXTERN_C_BEGIN
+
+/*
+ * Streaming latency quantiles (DDSketch).
+ *
+ * Samples land in logarithmically spaced buckets so every quantile is within
+ * the configured relative error of the true value. Recording is a handful of
+ * relaxed atomic operations and never blocks; snapshots copy the buckets and
+ * can be merged, so per-connection sketches roll up into one aggregate.
+ */
+
+typedef struct ecliptix_latency_sketch ecliptix_latency_sketch_t;
+
+typedef struct {
+    double relative_accuracy;   /* quantile error bound, 0 selects 0.01 */
+    uint64_t max_latency_us;    /* larger samples are clamped, 0 selects one hour */
+    double ewma_weight;         /* weight of each new sample, 0 selects 0.1 */
+} ecliptix_latency_sketch_config_t;
+
+typedef struct {
+    uint64_t count;
+    uint64_t min_us;
+    uint64_t max_us;
+    uint64_t p50_us;
+    uint64_t p95_us;
+    uint64_t p99_us;
+    double mean_us;
+    double ewma_us;
+} ecliptix_latency_summary_t;
+
+ECLIPTIX_NET_API ecliptix_latency_sketch_t* ecliptix_latency_sketch_create(
+    const ecliptix_latency_sketch_config_t* config
+);
+
+ECLIPTIX_NET_API void ecliptix_latency_sketch_destroy(ecliptix_latency_sketch_t* sketch);
+
+ECLIPTIX_NET_API void ecliptix_latency_sketch_record(ecliptix_latency_sketch_t* sketch, uint64_t latency_us);
+
+ECLIPTIX_NET_API void ecliptix_latency_sketch_reset(ecliptix_latency_sketch_t* sketch);
+
+/* Independent copy with the same configuration; release it with destroy. */
+ECLIPTIX_NET_API ecliptix_latency_sketch_t* ecliptix_latency_sketch_snapshot(const ecliptix_latency_sketch_t* sketch);
+
+/* Adds source into target; both must share a configuration. */
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_latency_sketch_merge(
+    ecliptix_latency_sketch_t* target,
+    const ecliptix_latency_sketch_t* source
+);
+
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_latency_sketch_quantile(
+    const ecliptix_latency_sketch_t* sketch,
+    double quantile,
+    uint64_t* out_latency_us
+);
+
+ECLIPTIX_NET_API void ecliptix_latency_sketch_get_summary(
+    const ecliptix_latency_sketch_t* sketch,
+    ecliptix_latency_summary_t* out_summary
+);
+
+ECLIPTIX_NET_EXTERN_C_END
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef _WIN32
+  #ifdef ECLIPTIX_NET_STATIC
+    #define ECLIPTIX_NET_API
+  #else
+    #ifdef ECLIPTIX_NET_EXPORTS
+      #define ECLIPTIX_NET_API __declspec(dllexport)
+    #else
+      #define ECLIPTIX_NET_API __declspec(dllimport)
+    #endif
+  #endif
+#else
+  #define ECLIPTIX_NET_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+  #define ECLIPTIX_NET_EXTERN_C_BEGIN extern "C" {
+  #define ECLIPTIX_NET_EXTERN_C_END }
+#else
+  #define ECLIPTIX_NET_EXTERN_C_BEGIN
+  #define ECLIPTIX_NET_EXTERN_C_END
+#endif
+
+ECLIPTIX_NET_EXTERN_C_BEGIN
+
+typedef enum {
+    ECLIPTIX_NET_SUCCESS = 0,
+    ECLIPTIX_NET_ERROR_INVALID_PARAMS = -1,
+    ECLIPTIX_NET_ERROR_NOT_FOUND = -2,
+    ECLIPTIX_NET_ERROR_CAPACITY = -3,
+    ECLIPTIX_NET_ERROR_OUT_OF_MEMORY = -4,
+    ECLIPTIX_NET_ERROR_IO = -5,
+    ECLIPTIX_NET_ERROR_CRYPTO = -6
+} ecliptix_net_result_t;
+
+ECLIPTIX_NET_EXTERN_C_END
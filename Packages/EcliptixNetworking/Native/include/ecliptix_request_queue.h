@@ -0,0 +1,105 @@
+#pragma once
+
+#include "ecliptix_net_common.h"
+
+ECLIPTIX_NET_EXTERN_C_BEGIN
+
+/*
+ * Pending-request scheduler.
+ *
+ * Queued requests live in two indexed 4-ary heaps over one slab: a dispatch
+ * heap (highest priority, then earliest deadline, then FIFO) and an eviction
+ * heap (lowest priority, then earliest deadline), so dispatch, eviction and
+ * cancellation by handle are all logarithmic with no scans. Dispatch is
+ * bounded by an in-flight limit and paced by a token bucket, which lets a
+ * reconnect drain the backlog in priority order instead of all at once.
+ */
+
+typedef struct ecliptix_request_queue ecliptix_request_queue_t;
+
+/* Slab index plus generation; 0 is never a valid handle. */
+typedef uint64_t ecliptix_request_handle_t;
+
+typedef enum {
+    ECLIPTIX_REQUEST_READY = 0,       /* handle is now in flight, call complete when done */
+    ECLIPTIX_REQUEST_EMPTY = 1,
+    ECLIPTIX_REQUEST_SATURATED = 2,   /* in-flight limit reached, complete something first */
+    ECLIPTIX_REQUEST_THROTTLED = 3,   /* pacer is empty, retry after the reported wait */
+    ECLIPTIX_REQUEST_EXPIRED = 4      /* handle passed its deadline and has been released */
+} ecliptix_request_dispatch_t;
+
+typedef struct {
+    uint32_t capacity;            /* queued requests before eviction, 0 selects 100 */
+    uint32_t max_in_flight;       /* concurrent dispatches, 0 selects 4 */
+    double refill_per_second;     /* pacer rate, 0 selects 10 */
+    uint32_t burst;               /* pacer bucket size, 0 selects max_in_flight */
+} ecliptix_request_queue_config_t;
+
+typedef struct {
+    size_t queued;
+    size_t in_flight;
+    uint64_t enqueued;
+    uint64_t dispatched;
+    uint64_t completed;
+    uint64_t cancelled;
+    uint64_t evicted;
+    uint64_t expired;
+    uint64_t throttled;
+} ecliptix_request_queue_stats_t;
+
+typedef void (*ecliptix_request_handle_sink_t)(ecliptix_request_handle_t handle, void* context);
+
+ECLIPTIX_NET_API ecliptix_request_queue_t* ecliptix_request_queue_create(
+    const ecliptix_request_queue_config_t* config
+);
+
+ECLIPTIX_NET_API void ecliptix_request_queue_destroy(ecliptix_request_queue_t* queue);
+
+/*
+ * Queues a request. ttl_ms of 0 means no deadline. When the queue is full the
+ * lowest-ranked queued request is evicted and reported through out_evicted
+ * (0 otherwise); a request ranked below everything already queued is refused
+ * with ECLIPTIX_NET_ERROR_CAPACITY.
+ */
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_request_queue_enqueue(
+    ecliptix_request_queue_t* queue,
+    uint8_t priority,
+    uint64_t ttl_ms,
+    ecliptix_request_handle_t* out_handle,
+    ecliptix_request_handle_t* out_evicted
+);
+
+/* Removes a queued request; in-flight requests are released with complete. */
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_request_queue_cancel(
+    ecliptix_request_queue_t* queue,
+    ecliptix_request_handle_t handle
+);
+
+/* out_wait_ms is only set for ECLIPTIX_REQUEST_THROTTLED. */
+ECLIPTIX_NET_API ecliptix_request_dispatch_t ecliptix_request_queue_next(
+    ecliptix_request_queue_t* queue,
+    ecliptix_request_handle_t* out_handle,
+    uint64_t* out_wait_ms
+);
+
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_request_queue_complete(
+    ecliptix_request_queue_t* queue,
+    ecliptix_request_handle_t handle
+);
+
+/* Releases every queued request whose deadline has passed. Returns the count. */
+ECLIPTIX_NET_API size_t ecliptix_request_queue_purge_expired(
+    ecliptix_request_queue_t* queue,
+    ecliptix_request_handle_sink_t sink,
+    void* context
+);
+
+/* Drops every queued request; in-flight requests are left to complete. */
+ECLIPTIX_NET_API void ecliptix_request_queue_clear(ecliptix_request_queue_t* queue);
+
+ECLIPTIX_NET_API void ecliptix_request_queue_get_stats(
+    const ecliptix_request_queue_t* queue,
+    ecliptix_request_queue_stats_t* out_stats
+);
+
+ECLIPTIX_NET_EXTERN_C_END
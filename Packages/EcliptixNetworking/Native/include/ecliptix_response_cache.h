@@ -0,0 +1,112 @@
+#pragma once
+
+#include "ecliptix_net_common.h"
+
+ECLIPTIX_NET_EXTERN_C_BEGIN
+
+/*
+ * Sharded, byte-budgeted response cache.
+ *
+ * Keys are hashed once; the hash picks the shard and indexes the shard map.
+ * Each shard has its own lock and a segmented LRU (probation + protected), so
+ * one-off responses cannot flush the entries that are actually reused.
+ * Expiry is tracked in a per-shard deadline index and invalidation goes
+ * through prefix and tag indexes instead of scanning every key.
+ */
+
+typedef struct ecliptix_response_cache ecliptix_response_cache_t;
+
+typedef struct {
+    uint64_t max_total_bytes;     /* 0 selects 8 MiB */
+    uint64_t max_entry_bytes;     /* 0 selects 1 MiB */
+    uint32_t shard_count;         /* rounded up to a power of two, 0 selects 16 */
+    uint32_t protected_percent;   /* protected segment share of a shard, 0 selects 80 */
+    char prefix_delimiter;        /* keys are prefix-indexed after each delimiter, 0 disables */
+} ecliptix_response_cache_config_t;
+
+typedef struct {
+    uint64_t entries;
+    uint64_t total_bytes;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    uint64_t expirations;
+    uint64_t rejected;
+} ecliptix_response_cache_stats_t;
+
+/* Invoked under the shard lock; copy what you need and return promptly. */
+typedef void (*ecliptix_cache_value_sink_fn)(
+    const uint8_t* value,
+    size_t value_len,
+    const uint8_t* etag,
+    size_t etag_len,
+    uint64_t age_ms,
+    void* context
+);
+
+ECLIPTIX_NET_API ecliptix_response_cache_t* ecliptix_response_cache_create(
+    const ecliptix_response_cache_config_t* config
+);
+
+ECLIPTIX_NET_API void ecliptix_response_cache_destroy(ecliptix_response_cache_t* cache);
+
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_response_cache_get(
+    ecliptix_response_cache_t* cache,
+    const uint8_t* key,
+    size_t key_len,
+    ecliptix_cache_value_sink_fn sink,
+    void* context
+);
+
+/* tags: NUL-separated list of tag names, may be NULL. */
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_response_cache_put(
+    ecliptix_response_cache_t* cache,
+    const uint8_t* key,
+    size_t key_len,
+    const uint8_t* value,
+    size_t value_len,
+    const uint8_t* etag,
+    size_t etag_len,
+    uint64_t ttl_ms,
+    const uint8_t* tags,
+    size_t tags_len
+);
+
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_response_cache_invalidate(
+    ecliptix_response_cache_t* cache,
+    const uint8_t* key,
+    size_t key_len
+);
+
+/* Returns the number of removed entries. */
+ECLIPTIX_NET_API size_t ecliptix_response_cache_invalidate_prefix(
+    ecliptix_response_cache_t* cache,
+    const uint8_t* prefix,
+    size_t prefix_len
+);
+
+ECLIPTIX_NET_API size_t ecliptix_response_cache_invalidate_tag(
+    ecliptix_response_cache_t* cache,
+    const uint8_t* tag,
+    size_t tag_len
+);
+
+/* Substring match over every key; kept for callers that cannot express a prefix or tag. */
+ECLIPTIX_NET_API size_t ecliptix_response_cache_invalidate_matching(
+    ecliptix_response_cache_t* cache,
+    const uint8_t* pattern,
+    size_t pattern_len
+);
+
+ECLIPTIX_NET_API size_t ecliptix_response_cache_purge_expired(ecliptix_response_cache_t* cache);
+
+ECLIPTIX_NET_API size_t ecliptix_response_cache_clear(ecliptix_response_cache_t* cache);
+
+ECLIPTIX_NET_API void ecliptix_response_cache_get_stats(
+    const ecliptix_response_cache_t* cache,
+    ecliptix_response_cache_stats_t* out_stats
+);
+
+ECLIPTIX_NET_API void ecliptix_response_cache_reset_stats(ecliptix_response_cache_t* cache);
+
+ECLIPTIX_NET_EXTERN_C_END
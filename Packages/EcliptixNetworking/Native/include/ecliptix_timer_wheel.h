@@ -0,0 +1,78 @@
+#pragma once
+
+#include "ecliptix_net_common.h"
+
+ECLIPTIX_NET_EXTERN_C_BEGIN
+
+/*
+ * Hierarchical timing wheel for request deadlines.
+ *
+ * Start, stop and extend are O(1). A dedicated timer thread sleeps until the
+ * next occupied slot (found through per-level occupancy bitmaps) instead of
+ * scanning on a fixed tick. Expiry callbacks run on that thread, outside the
+ * wheel lock, so they may call back into the wheel - except for destroy.
+ */
+
+typedef struct ecliptix_timer_wheel ecliptix_timer_wheel_t;
+
+/* Compact handle: slot index in the low 20 bits, generation in the high 12. */
+typedef uint32_t ecliptix_timer_id_t;
+
+#define ECLIPTIX_TIMER_INVALID_ID 0u
+
+typedef void (*ecliptix_timer_expired_fn)(ecliptix_timer_id_t timer_id, uint64_t tag, void* context);
+
+typedef struct {
+    uint32_t tick_us;   /* wheel resolution, 0 selects 100us */
+    uint32_t capacity;  /* max concurrent timers, 0 selects 65536 */
+} ecliptix_timer_wheel_config_t;
+
+typedef struct {
+    uint64_t active;
+    uint64_t started;
+    uint64_t stopped;
+    uint64_t expired;
+    uint64_t wakeups;
+} ecliptix_timer_wheel_stats_t;
+
+ECLIPTIX_NET_API ecliptix_timer_wheel_t* ecliptix_timer_wheel_create(
+    const ecliptix_timer_wheel_config_t* config,
+    ecliptix_timer_expired_fn on_expired,
+    void* context
+);
+
+/* Joins the timer thread; no callback runs after this returns. */
+ECLIPTIX_NET_API void ecliptix_timer_wheel_destroy(ecliptix_timer_wheel_t* wheel);
+
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_timer_wheel_start(
+    ecliptix_timer_wheel_t* wheel,
+    uint64_t timeout_us,
+    uint64_t tag,
+    ecliptix_timer_id_t* out_timer_id
+);
+
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_timer_wheel_stop(
+    ecliptix_timer_wheel_t* wheel,
+    ecliptix_timer_id_t timer_id
+);
+
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_timer_wheel_extend(
+    ecliptix_timer_wheel_t* wheel,
+    ecliptix_timer_id_t timer_id,
+    uint64_t additional_us
+);
+
+ECLIPTIX_NET_API ecliptix_net_result_t ecliptix_timer_wheel_remaining(
+    const ecliptix_timer_wheel_t* wheel,
+    ecliptix_timer_id_t timer_id,
+    uint64_t* out_remaining_us
+);
+
+ECLIPTIX_NET_API void ecliptix_timer_wheel_stop_all(ecliptix_timer_wheel_t* wheel);
+
+ECLIPTIX_NET_API void ecliptix_timer_wheel_get_stats(
+    const ecliptix_timer_wheel_t* wheel,
+    ecliptix_timer_wheel_stats_t* out_stats
+);
+
+ECLIPTIX_NET_EXTERN_C_END
@@ -0,0 +1,321 @@
+#include "circuit_table.h"
+
+#include <algorithm>
+#include <bit>
+#include <new>
+
+namespace ecliptix::networking {
+
+    namespace {
+        constexpr unsigned STATE_SHIFT = 0;
+        constexpr unsigned FAILURES_SHIFT = 2;
+        constexpr unsigned SUCCESSES_SHIFT = 13;
+        constexpr unsigned TIME_SHIFT = 24;
+        constexpr uint64_t STATE_MASK = 0x3;
+        constexpr uint64_t FAILURES_MASK = (1u << 11) - 1;
+        constexpr uint64_t SUCCESSES_MASK = (1u << 8) - 1;
+
+        static_assert(FAILURES_MASK == ECLIPTIX_CIRCUIT_MAX_FAILURE_THRESHOLD);
+        static_assert(SUCCESSES_MASK == ECLIPTIX_CIRCUIT_MAX_SUCCESS_THRESHOLD);
+        constexpr uint64_t TIME_MASK = (uint64_t{1} << 40) - 1;
+        constexpr uint32_t MAX_PROBES = 32;
+        constexpr uint64_t OCCUPIED = uint64_t{1} << 32;
+
+        struct Word {
+            ecliptix_circuit_state_t state;
+            uint64_t failures;
+            uint64_t successes;
+            uint64_t transition_ms;
+        };
+
+        constexpr uint64_t pack(ecliptix_circuit_state_t state, uint64_t failures, uint64_t successes,
+                                uint64_t transition_ms) {
+            return (static_cast<uint64_t>(state) << STATE_SHIFT) |
+                   (std::min(failures, FAILURES_MASK) << FAILURES_SHIFT) |
+                   (std::min(successes, SUCCESSES_MASK) << SUCCESSES_SHIFT) |
+                   ((transition_ms & TIME_MASK) << TIME_SHIFT);
+        }
+
+        constexpr Word unpack(uint64_t word) {
+            return {
+                static_cast<ecliptix_circuit_state_t>((word >> STATE_SHIFT) & STATE_MASK),
+                (word >> FAILURES_SHIFT) & FAILURES_MASK,
+                (word >> SUCCESSES_SHIFT) & SUCCESSES_MASK,
+                (word >> TIME_SHIFT) & TIME_MASK
+            };
+        }
+
+        constexpr uint32_t home_slot(uint32_t connect_id) {
+            return static_cast<uint32_t>((uint64_t{connect_id} * 0x9e3779b97f4a7c15ull) >> 32);
+        }
+    }
+
+    CircuitTable::CircuitTable(uint32_t failure_threshold, uint32_t success_threshold, uint64_t open_duration_ms,
+                               uint32_t capacity)
+        : failure_threshold_(failure_threshold),
+          success_threshold_(success_threshold),
+          open_duration_ms_(open_duration_ms),
+          mask_(std::bit_ceil(capacity) - 1),
+          epoch_(std::chrono::steady_clock::now()),
+          slots_(std::make_unique<Slot[]>(mask_ + 1)) {
+    }
+
+    uint64_t CircuitTable::now_ms() const {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - epoch_).count()) + 1;
+    }
+
+    CircuitTable::Slot *CircuitTable::find(uint32_t connect_id) const {
+        const uint64_t tag = OCCUPIED | connect_id;
+        uint32_t index = home_slot(connect_id) & mask_;
+        const uint32_t probes = std::min(MAX_PROBES, mask_ + 1);
+        for (uint32_t i = 0; i < probes; ++i, index = (index + 1) & mask_) {
+            const uint64_t current = slots_[index].tag.load(std::memory_order_acquire);
+            if (current == tag) {
+                return &slots_[index];
+            }
+            if (current == EMPTY_TAG) {
+                return nullptr;
+            }
+        }
+        return nullptr;
+    }
+
+    CircuitTable::Slot *CircuitTable::find_or_insert(uint32_t connect_id) {
+        const uint64_t tag = OCCUPIED | connect_id;
+        uint32_t index = home_slot(connect_id) & mask_;
+        const uint32_t probes = std::min(MAX_PROBES, mask_ + 1);
+        for (uint32_t i = 0; i < probes; ++i, index = (index + 1) & mask_) {
+            Slot &slot = slots_[index];
+            uint64_t current = slot.tag.load(std::memory_order_acquire);
+            if (current == EMPTY_TAG) {
+                if (slot.tag.compare_exchange_strong(current, tag, std::memory_order_acq_rel)) {
+                    uint64_t fresh = 0;
+                    slot.word.compare_exchange_strong(fresh, pack(ECLIPTIX_CIRCUIT_CLOSED, 0, 0, now_ms()),
+                                                      std::memory_order_release, std::memory_order_relaxed);
+                    return &slot;
+                }
+            }
+            if (current == tag) {
+                return &slot;
+            }
+        }
+        overflow_.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    ecliptix_circuit_decision_t CircuitTable::acquire(uint32_t connect_id) {
+        Slot *slot = find(connect_id);
+        if (slot == nullptr) {
+            return ECLIPTIX_CIRCUIT_ALLOW;
+        }
+
+        uint64_t word = slot->word.load(std::memory_order_acquire);
+        while (true) {
+            const Word current = unpack(word);
+            if (current.state != ECLIPTIX_CIRCUIT_OPEN) {
+                return ECLIPTIX_CIRCUIT_ALLOW;
+            }
+
+            const uint64_t now = now_ms();
+            if (now - current.transition_ms < open_duration_ms_) {
+                return ECLIPTIX_CIRCUIT_REJECT;
+            }
+            const uint64_t desired = pack(ECLIPTIX_CIRCUIT_HALF_OPEN, current.failures, 0, now);
+            if (slot->word.compare_exchange_weak(word, desired, std::memory_order_acq_rel,
+                                                 std::memory_order_acquire)) {
+                return ECLIPTIX_CIRCUIT_ALLOW_TRIAL;
+            }
+        }
+    }
+
+    ecliptix_circuit_transition_t CircuitTable::record_success(uint32_t connect_id) {
+        Slot *slot = find(connect_id);
+        if (slot == nullptr) {
+            return ECLIPTIX_CIRCUIT_TRANSITION_NONE;
+        }
+
+        uint64_t word = slot->word.load(std::memory_order_acquire);
+        while (true) {
+            const Word current = unpack(word);
+            uint64_t desired;
+            ecliptix_circuit_transition_t transition = ECLIPTIX_CIRCUIT_TRANSITION_NONE;
+            switch (current.state) {
+                case ECLIPTIX_CIRCUIT_CLOSED:
+                    if (current.failures == 0) {
+                        return ECLIPTIX_CIRCUIT_TRANSITION_NONE;
+                    }
+                    desired = pack(ECLIPTIX_CIRCUIT_CLOSED, 0, 0, current.transition_ms);
+                    break;
+                case ECLIPTIX_CIRCUIT_HALF_OPEN:
+                    if (current.successes + 1 >= success_threshold_) {
+                        desired = pack(ECLIPTIX_CIRCUIT_CLOSED, 0, 0, now_ms());
+                        transition = ECLIPTIX_CIRCUIT_TRANSITION_CLOSED;
+                    } else {
+                        desired = pack(ECLIPTIX_CIRCUIT_HALF_OPEN, current.failures, current.successes + 1,
+                                       current.transition_ms);
+                    }
+                    break;
+                default:
+                    return ECLIPTIX_CIRCUIT_TRANSITION_NONE;
+            }
+            if (slot->word.compare_exchange_weak(word, desired, std::memory_order_acq_rel,
+                                                 std::memory_order_acquire)) {
+                return transition;
+            }
+        }
+    }
+
+    ecliptix_circuit_transition_t CircuitTable::record_failure(uint32_t connect_id) {
+        Slot *slot = find_or_insert(connect_id);
+        if (slot == nullptr) {
+            return ECLIPTIX_CIRCUIT_TRANSITION_NONE;
+        }
+
+        const uint64_t now = now_ms();
+        slot->last_failure_ms.store(now, std::memory_order_relaxed);
+
+        uint64_t word = slot->word.load(std::memory_order_acquire);
+        while (true) {
+            const Word current = unpack(word);
+            const uint64_t failures = current.failures + 1;
+            uint64_t desired;
+            ecliptix_circuit_transition_t transition = ECLIPTIX_CIRCUIT_TRANSITION_NONE;
+            switch (current.state) {
+                case ECLIPTIX_CIRCUIT_CLOSED:
+                    if (failures >= failure_threshold_) {
+                        desired = pack(ECLIPTIX_CIRCUIT_OPEN, failures, 0, now);
+                        transition = ECLIPTIX_CIRCUIT_TRANSITION_OPENED;
+                    } else {
+                        desired = pack(ECLIPTIX_CIRCUIT_CLOSED, failures, 0, current.transition_ms);
+                    }
+                    break;
+                case ECLIPTIX_CIRCUIT_HALF_OPEN:
+                    desired = pack(ECLIPTIX_CIRCUIT_OPEN, failures, 0, now);
+                    transition = ECLIPTIX_CIRCUIT_TRANSITION_REOPENED;
+                    break;
+                default:
+                    desired = pack(ECLIPTIX_CIRCUIT_OPEN, failures, 0, current.transition_ms);
+                    break;
+            }
+            if (slot->word.compare_exchange_weak(word, desired, std::memory_order_acq_rel,
+                                                 std::memory_order_acquire)) {
+                return transition;
+            }
+        }
+    }
+
+    bool CircuitTable::reset(uint32_t connect_id) {
+        Slot *slot = find(connect_id);
+        if (slot == nullptr) {
+            return false;
+        }
+        slot->word.store(pack(ECLIPTIX_CIRCUIT_CLOSED, 0, 0, now_ms()), std::memory_order_release);
+        slot->last_failure_ms.store(NO_FAILURE, std::memory_order_relaxed);
+        return true;
+    }
+
+    void CircuitTable::reset_all() {
+        const uint64_t closed = pack(ECLIPTIX_CIRCUIT_CLOSED, 0, 0, now_ms());
+        for (uint32_t i = 0; i <= mask_; ++i) {
+            if (slots_[i].tag.load(std::memory_order_acquire) != EMPTY_TAG) {
+                slots_[i].word.store(closed, std::memory_order_release);
+                slots_[i].last_failure_ms.store(NO_FAILURE, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool CircuitTable::get(uint32_t connect_id, ecliptix_circuit_snapshot_t &snapshot) const {
+        const Slot *slot = find(connect_id);
+        if (slot == nullptr) {
+            return false;
+        }
+
+        const Word current = unpack(slot->word.load(std::memory_order_acquire));
+        const uint64_t last_failure = slot->last_failure_ms.load(std::memory_order_relaxed);
+        const uint64_t now = now_ms();
+        snapshot.state = current.state;
+        snapshot.consecutive_failures = static_cast<uint32_t>(current.failures);
+        snapshot.consecutive_successes = static_cast<uint32_t>(current.successes);
+        snapshot.ms_since_transition = now - std::min(now, current.transition_ms);
+        snapshot.ms_since_failure = last_failure == NO_FAILURE ? UINT64_MAX : now - std::min(now, last_failure);
+        return true;
+    }
+
+    uint64_t CircuitTable::overflow_count() const {
+        return overflow_.load(std::memory_order_relaxed);
+    }
+
+} // namespace ecliptix::networking
+
+struct ecliptix_circuit_table : ecliptix::networking::CircuitTable {
+    using CircuitTable::CircuitTable;
+};
+
+using ecliptix::networking::CircuitTable;
+
+extern "C" {
+
+ecliptix_circuit_table_t *ecliptix_circuit_table_create(const ecliptix_circuit_table_config_t *config) {
+    const ecliptix_circuit_table_config_t effective = config != nullptr ? *config : ecliptix_circuit_table_config_t{};
+    const uint32_t capacity = effective.capacity != 0 ? effective.capacity : CircuitTable::DEFAULT_CAPACITY;
+    if (capacity > CircuitTable::MAX_CAPACITY ||
+        effective.failure_threshold > ECLIPTIX_CIRCUIT_MAX_FAILURE_THRESHOLD ||
+        effective.success_threshold > ECLIPTIX_CIRCUIT_MAX_SUCCESS_THRESHOLD) {
+        return nullptr;
+    }
+    try {
+        return new ecliptix_circuit_table(
+            effective.failure_threshold != 0 ? effective.failure_threshold : CircuitTable::DEFAULT_FAILURE_THRESHOLD,
+            effective.success_threshold != 0 ? effective.success_threshold : CircuitTable::DEFAULT_SUCCESS_THRESHOLD,
+            effective.open_duration_ms != 0 ? effective.open_duration_ms : CircuitTable::DEFAULT_OPEN_DURATION_MS,
+            capacity);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void ecliptix_circuit_table_destroy(ecliptix_circuit_table_t *table) {
+    delete table;
+}
+
+ecliptix_circuit_decision_t ecliptix_circuit_table_acquire(ecliptix_circuit_table_t *table, uint32_t connect_id) {
+    return table != nullptr ? table->acquire(connect_id) : ECLIPTIX_CIRCUIT_ALLOW;
+}
+
+ecliptix_circuit_transition_t ecliptix_circuit_table_record_success(ecliptix_circuit_table_t *table,
+                                                                    uint32_t connect_id) {
+    return table != nullptr ? table->record_success(connect_id) : ECLIPTIX_CIRCUIT_TRANSITION_NONE;
+}
+
+ecliptix_circuit_transition_t ecliptix_circuit_table_record_failure(ecliptix_circuit_table_t *table,
+                                                                    uint32_t connect_id) {
+    return table != nullptr ? table->record_failure(connect_id) : ECLIPTIX_CIRCUIT_TRANSITION_NONE;
+}
+
+ecliptix_net_result_t ecliptix_circuit_table_reset(ecliptix_circuit_table_t *table, uint32_t connect_id) {
+    if (table == nullptr) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    return table->reset(connect_id) ? ECLIPTIX_NET_SUCCESS : ECLIPTIX_NET_ERROR_NOT_FOUND;
+}
+
+void ecliptix_circuit_table_reset_all(ecliptix_circuit_table_t *table) {
+    if (table != nullptr) {
+        table->reset_all();
+    }
+}
+
+ecliptix_net_result_t ecliptix_circuit_table_get(const ecliptix_circuit_table_t *table, uint32_t connect_id,
+                                                 ecliptix_circuit_snapshot_t *out_snapshot) {
+    if (table == nullptr || out_snapshot == nullptr) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    return table->get(connect_id, *out_snapshot) ? ECLIPTIX_NET_SUCCESS : ECLIPTIX_NET_ERROR_NOT_FOUND;
+}
+
+uint64_t ecliptix_circuit_table_overflow_count(const ecliptix_circuit_table_t *table) {
+    return table != nullptr ? table->overflow_count() : 0;
+}
+
+}
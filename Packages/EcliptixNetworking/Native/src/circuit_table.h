@@ -0,0 +1,65 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include "ecliptix_circuit_table.h"
+
+namespace ecliptix::networking {
+
+    class CircuitTable {
+    public:
+        static constexpr uint32_t DEFAULT_FAILURE_THRESHOLD = 5;
+        static constexpr uint32_t DEFAULT_SUCCESS_THRESHOLD = 2;
+        static constexpr uint64_t DEFAULT_OPEN_DURATION_MS = 30'000;
+        static constexpr uint32_t DEFAULT_CAPACITY = 1024;
+        static constexpr uint32_t MAX_CAPACITY = 1u << 20;
+
+        CircuitTable(uint32_t failure_threshold, uint32_t success_threshold, uint64_t open_duration_ms,
+                     uint32_t capacity);
+
+        CircuitTable(const CircuitTable &) = delete;
+
+        CircuitTable &operator=(const CircuitTable &) = delete;
+
+        [[nodiscard]] ecliptix_circuit_decision_t acquire(uint32_t connect_id);
+
+        ecliptix_circuit_transition_t record_success(uint32_t connect_id);
+
+        ecliptix_circuit_transition_t record_failure(uint32_t connect_id);
+
+        [[nodiscard]] bool reset(uint32_t connect_id);
+
+        void reset_all();
+
+        [[nodiscard]] bool get(uint32_t connect_id, ecliptix_circuit_snapshot_t &snapshot) const;
+
+        [[nodiscard]] uint64_t overflow_count() const;
+
+    private:
+        static constexpr uint64_t EMPTY_TAG = 0;
+        static constexpr uint64_t NO_FAILURE = 0;
+
+        struct alignas(64) Slot {
+            std::atomic<uint64_t> tag{EMPTY_TAG};
+            std::atomic<uint64_t> word{0};
+            std::atomic<uint64_t> last_failure_ms{NO_FAILURE};
+        };
+
+        [[nodiscard]] uint64_t now_ms() const;
+
+        [[nodiscard]] Slot *find(uint32_t connect_id) const;
+
+        [[nodiscard]] Slot *find_or_insert(uint32_t connect_id);
+
+        const uint32_t failure_threshold_;
+        const uint32_t success_threshold_;
+        const uint64_t open_duration_ms_;
+        const uint32_t mask_;
+        const std::chrono::steady_clock::time_point epoch_;
+        std::unique_ptr<Slot[]> slots_;
+        std::atomic<uint64_t> overflow_{0};
+    };
+
+} // namespace ecliptix::networking
@@ -0,0 +1,1126 @@
+#include "disk_cache.h"
+
+#include <sodium.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ecliptix::networking {
+
+    namespace {
+        constexpr uint32_t LOG_MAGIC = 0x4c444345;    // "ECDL"
+        constexpr uint32_t RECORD_MAGIC = 0x52444345; // "ECDR"
+        constexpr uint32_t INDEX_MAGIC = 0x49444345;  // "ECDI"
+        constexpr uint32_t FORMAT_VERSION = 2;
+
+        constexpr size_t LOG_HEADER_BYTES = 32;
+        constexpr size_t RECORD_HEADER_BYTES = 72;
+        constexpr size_t RECORD_AD_BYTES = 48;
+        constexpr size_t RECORD_NONCE_OFFSET = RECORD_AD_BYTES;
+        constexpr size_t PAYLOAD_PREFIX_BYTES = 12;
+        constexpr size_t INDEX_HEADER_BYTES = 32;
+        constexpr size_t INDEX_ENTRY_BYTES = 48;
+        constexpr size_t INDEX_MAC_BYTES = crypto_generichash_BYTES;
+
+        constexpr uint64_t MAP_GRANULE = 4ull * 1024 * 1024;
+        constexpr uint64_t MIN_COMPACTION_BYTES = 1024ull * 1024;
+        constexpr size_t MAX_WRITE_BATCH = 32;
+        constexpr size_t COPY_CHUNK_BYTES = 1024 * 1024;
+        constexpr auto INDEX_PERSIST_INTERVAL = std::chrono::seconds(2);
+
+        constexpr uint64_t KDF_RECORD_KEY = 1;
+        constexpr uint64_t KDF_KEY_ID_KEY = 2;
+        constexpr uint64_t KDF_INDEX_KEY = 3;
+        constexpr char KDF_CONTEXT[crypto_kdf_CONTEXTBYTES + 1] = "EcxDisk1";
+
+        constexpr char LOG_FILE[] = "records.log";
+        constexpr char COMPACT_FILE[] = "records.log.compact";
+        constexpr char INDEX_FILE[] = "records.idx";
+        constexpr char INDEX_TEMP_FILE[] = "records.idx.tmp";
+
+        static_assert(crypto_aead_xchacha20poly1305_ietf_NPUBBYTES == RECORD_HEADER_BYTES - RECORD_NONCE_OFFSET);
+        static_assert(crypto_aead_xchacha20poly1305_ietf_KEYBYTES == DiskCache::KEY_BYTES);
+
+        template<typename T>
+        void store(uint8_t *out, T value) {
+            std::memcpy(out, &value, sizeof(T));
+        }
+
+        template<typename T>
+        T load(const uint8_t *in) {
+            T value;
+            std::memcpy(&value, in, sizeof(T));
+            return value;
+        }
+
+        bool write_all(int fd, const uint8_t *data, size_t length, uint64_t offset) {
+            while (length > 0) {
+                const ssize_t written = ::pwrite(fd, data, length, static_cast<off_t>(offset));
+                if (written < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    return false;
+                }
+                data += written;
+                length -= static_cast<size_t>(written);
+                offset += static_cast<uint64_t>(written);
+            }
+            return true;
+        }
+
+        bool read_all(int fd, uint8_t *data, size_t length, uint64_t offset) {
+            while (length > 0) {
+                const ssize_t read = ::pread(fd, data, length, static_cast<off_t>(offset));
+                if (read <= 0) {
+                    if (read < 0 && errno == EINTR) {
+                        continue;
+                    }
+                    return false;
+                }
+                data += read;
+                length -= static_cast<size_t>(read);
+                offset += static_cast<uint64_t>(read);
+            }
+            return true;
+        }
+
+        uint64_t new_log_id() {
+            uint64_t id = 0;
+            randombytes_buf(&id, sizeof(id));
+            return id;
+        }
+
+        bool write_log_header(int fd, uint64_t log_id) {
+            uint8_t header[LOG_HEADER_BYTES] = {};
+            store<uint32_t>(header, LOG_MAGIC);
+            store<uint32_t>(header + 4, FORMAT_VERSION);
+            store<uint64_t>(header + 8, log_id);
+            return write_all(fd, header, sizeof(header), 0);
+        }
+    }
+
+    size_t DiskCache::KeyIdHash::operator()(const KeyId &id) const noexcept {
+        return static_cast<size_t>(load<uint64_t>(id.data()));
+    }
+
+    DiskCache::DiskCache(std::string directory, std::span<const uint8_t, KEY_BYTES> key, uint64_t max_bytes,
+                         uint32_t max_pending_writes)
+        : directory_(std::move(directory)),
+          max_bytes_(max_bytes),
+          max_pending_writes_(max_pending_writes) {
+        crypto_kdf_derive_from_key(record_key_.data(), record_key_.size(), KDF_RECORD_KEY, KDF_CONTEXT, key.data());
+        crypto_kdf_derive_from_key(key_id_key_.data(), key_id_key_.size(), KDF_KEY_ID_KEY, KDF_CONTEXT, key.data());
+        crypto_kdf_derive_from_key(index_key_.data(), index_key_.size(), KDF_INDEX_KEY, KDF_CONTEXT, key.data());
+    }
+
+    DiskCache::~DiskCache() {
+        {
+            std::lock_guard lock(mutex_);
+            stopping_ = true;
+        }
+        writer_wakeup_.notify_one();
+        if (writer_.joinable()) {
+            writer_.join();
+        }
+
+        std::lock_guard lock(mutex_);
+        unmap_locked();
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+        sodium_memzero(record_key_.data(), record_key_.size());
+        sodium_memzero(key_id_key_.data(), key_id_key_.size());
+        sodium_memzero(index_key_.data(), index_key_.size());
+    }
+
+    bool DiskCache::open() {
+        if (sodium_init() < 0) {
+            return false;
+        }
+        if (::mkdir(directory_.c_str(), 0700) != 0 && errno != EEXIST) {
+            return false;
+        }
+
+        {
+            std::lock_guard lock(mutex_);
+            if (!open_log()) {
+                return false;
+            }
+            if (!load_index()) {
+                slots_.clear();
+                head_ = tail_ = nullptr;
+                live_bytes_ = 0;
+                recover_tail(LOG_HEADER_BYTES);
+                index_dirty_ = true;
+            }
+            if (!remap_locked()) {
+                return false;
+            }
+        }
+
+        writer_ = std::thread(&DiskCache::run, this);
+        return true;
+    }
+
+    DiskCache::KeyId DiskCache::key_id(std::string_view key) const {
+        KeyId id{};
+        crypto_generichash(id.data(), id.size(), reinterpret_cast<const uint8_t *>(key.data()), key.size(),
+                           key_id_key_.data(), key_id_key_.size());
+        return id;
+    }
+
+    uint64_t DiskCache::now_ms() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+    }
+
+    std::string DiskCache::path(const char *name) const {
+        return directory_ + "/" + name;
+    }
+
+    bool DiskCache::open_log() {
+        fd_ = ::open(path(LOG_FILE).c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+        if (fd_ < 0) {
+            return false;
+        }
+
+        struct stat info{};
+        if (::fstat(fd_, &info) != 0) {
+            return false;
+        }
+
+        uint8_t header[LOG_HEADER_BYTES];
+        if (static_cast<uint64_t>(info.st_size) >= LOG_HEADER_BYTES &&
+            read_all(fd_, header, sizeof(header), 0) &&
+            load<uint32_t>(header) == LOG_MAGIC &&
+            load<uint32_t>(header + 4) == FORMAT_VERSION) {
+            log_id_ = load<uint64_t>(header + 8);
+            file_bytes_ = static_cast<uint64_t>(info.st_size);
+            return true;
+        }
+        return reset_log_locked();
+    }
+
+    bool DiskCache::reset_log_locked() {
+        unmap_locked();
+        slots_.clear();
+        head_ = tail_ = nullptr;
+        live_bytes_ = 0;
+        index_dirty_ = true;
+
+        log_id_ = new_log_id();
+        if (::ftruncate(fd_, 0) != 0 || !write_log_header(fd_, log_id_)) {
+            file_bytes_ = 0;
+            return false;
+        }
+        file_bytes_ = LOG_HEADER_BYTES;
+        return remap_locked();
+    }
+
+    bool DiskCache::remap_locked() {
+        if (mapping_ != nullptr && file_bytes_ <= mapped_bytes_) {
+            return true;
+        }
+        unmap_locked();
+
+        const uint64_t length = (file_bytes_ / MAP_GRANULE + 1) * MAP_GRANULE;
+        void *mapping = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd_, 0);
+        if (mapping == MAP_FAILED) {
+            return false;
+        }
+        mapping_ = static_cast<uint8_t *>(mapping);
+        mapped_bytes_ = length;
+        return true;
+    }
+
+    void DiskCache::unmap_locked() {
+        if (mapping_ != nullptr) {
+            ::munmap(mapping_, mapped_bytes_);
+            mapping_ = nullptr;
+            mapped_bytes_ = 0;
+        }
+    }
+
+    bool DiskCache::load_index() {
+        const int fd = ::open(path(INDEX_FILE).c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return false;
+        }
+
+        struct stat info{};
+        std::vector<uint8_t> bytes;
+        if (::fstat(fd, &info) == 0 && static_cast<uint64_t>(info.st_size) >= INDEX_HEADER_BYTES + INDEX_MAC_BYTES) {
+            bytes.resize(static_cast<size_t>(info.st_size));
+            if (!read_all(fd, bytes.data(), bytes.size(), 0)) {
+                bytes.clear();
+            }
+        }
+        ::close(fd);
+        if (bytes.empty()) {
+            return false;
+        }
+
+        const size_t body_bytes = bytes.size() - INDEX_MAC_BYTES;
+        uint8_t mac[INDEX_MAC_BYTES];
+        crypto_generichash(mac, sizeof(mac), bytes.data(), body_bytes, index_key_.data(), index_key_.size());
+        if (sodium_memcmp(mac, bytes.data() + body_bytes, sizeof(mac)) != 0) {
+            return false;
+        }
+
+        const uint8_t *header = bytes.data();
+        const uint64_t count = load<uint64_t>(header + 8);
+        const uint64_t log_bytes = load<uint64_t>(header + 16);
+        if (load<uint32_t>(header) != INDEX_MAGIC ||
+            load<uint32_t>(header + 4) != FORMAT_VERSION ||
+            load<uint64_t>(header + 24) != log_id_ ||
+            count != (body_bytes - INDEX_HEADER_BYTES) / INDEX_ENTRY_BYTES ||
+            body_bytes != INDEX_HEADER_BYTES + count * INDEX_ENTRY_BYTES ||
+            log_bytes < LOG_HEADER_BYTES || log_bytes > file_bytes_) {
+            return false;
+        }
+
+        struct Loaded {
+            KeyId id;
+            uint64_t offset;
+            uint32_t length;
+            uint64_t expires_ms;
+            uint64_t last_access_ms;
+        };
+        std::vector<Loaded> loaded;
+        loaded.reserve(count);
+        const uint64_t now = now_ms();
+        for (uint64_t i = 0; i < count; ++i) {
+            const uint8_t *entry = header + INDEX_HEADER_BYTES + i * INDEX_ENTRY_BYTES;
+            Loaded item{};
+            std::memcpy(item.id.data(), entry, KEY_ID_BYTES);
+            item.offset = load<uint64_t>(entry + 16);
+            item.length = load<uint32_t>(entry + 24);
+            item.expires_ms = load<uint64_t>(entry + 32);
+            item.last_access_ms = load<uint64_t>(entry + 40);
+            if (item.expires_ms > now && item.offset >= LOG_HEADER_BYTES && item.offset + item.length <= log_bytes) {
+                loaded.push_back(item);
+            }
+        }
+
+        std::sort(loaded.begin(), loaded.end(), [](const Loaded &a, const Loaded &b) {
+            return a.last_access_ms < b.last_access_ms;
+        });
+        for (const auto &item: loaded) {
+            index_locked(item.id, item.offset, item.length, item.expires_ms, item.last_access_ms);
+        }
+        if (loaded.size() != count) {
+            index_dirty_ = true;
+        }
+
+        recover_tail(log_bytes);
+        return true;
+    }
+
+    void DiskCache::recover_tail(uint64_t from_offset) {
+        const uint64_t now = now_ms();
+        uint64_t offset = from_offset;
+        uint8_t header[RECORD_HEADER_BYTES];
+
+        while (offset + RECORD_HEADER_BYTES <= file_bytes_) {
+            if (!read_all(fd_, header, sizeof(header), offset) || load<uint32_t>(header) != RECORD_MAGIC) {
+                break;
+            }
+            const uint64_t length = RECORD_HEADER_BYTES + load<uint32_t>(header + 40);
+            if (offset + length > file_bytes_) {
+                break;
+            }
+
+            KeyId id{};
+            std::memcpy(id.data(), header + 8, KEY_ID_BYTES);
+            const uint64_t expires_ms = load<uint64_t>(header + 24);
+            if (expires_ms > now) {
+                index_locked(id, offset, static_cast<uint32_t>(length), expires_ms, load<uint64_t>(header + 32));
+            } else {
+                erase_locked(id);
+            }
+            offset += length;
+        }
+
+        if (offset < file_bytes_ && ::ftruncate(fd_, static_cast<off_t>(offset)) == 0) {
+            file_bytes_ = offset;
+        }
+        if (offset != from_offset) {
+            index_dirty_ = true;
+        }
+    }
+
+    bool DiskCache::persist_index() {
+        std::lock_guard persist_lock(persist_mutex_);
+        std::vector<uint8_t> bytes;
+        {
+            std::lock_guard lock(mutex_);
+            bytes.resize(INDEX_HEADER_BYTES + slots_.size() * INDEX_ENTRY_BYTES + INDEX_MAC_BYTES);
+            store<uint32_t>(bytes.data(), INDEX_MAGIC);
+            store<uint32_t>(bytes.data() + 4, FORMAT_VERSION);
+            store<uint64_t>(bytes.data() + 8, slots_.size());
+            store<uint64_t>(bytes.data() + 16, file_bytes_);
+            store<uint64_t>(bytes.data() + 24, log_id_);
+
+            uint8_t *entry = bytes.data() + INDEX_HEADER_BYTES;
+            for (const Slot *slot = head_; slot != nullptr; slot = slot->next, entry += INDEX_ENTRY_BYTES) {
+                std::memcpy(entry, slot->id.data(), KEY_ID_BYTES);
+                store<uint64_t>(entry + 16, slot->offset);
+                store<uint32_t>(entry + 24, slot->length);
+                store<uint32_t>(entry + 28, 0);
+                store<uint64_t>(entry + 32, slot->expires_ms);
+                store<uint64_t>(entry + 40, slot->last_access_ms);
+            }
+            index_dirty_ = false;
+            persist_requested_ = false;
+        }
+
+        const size_t body_bytes = bytes.size() - INDEX_MAC_BYTES;
+        crypto_generichash(bytes.data() + body_bytes, INDEX_MAC_BYTES, bytes.data(), body_bytes,
+                           index_key_.data(), index_key_.size());
+
+        const std::string temp = path(INDEX_TEMP_FILE);
+        const int fd = ::open(temp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+        bool persisted = fd >= 0 && write_all(fd, bytes.data(), bytes.size(), 0);
+        if (fd >= 0) {
+            ::close(fd);
+        }
+        persisted = persisted && ::rename(temp.c_str(), path(INDEX_FILE).c_str()) == 0;
+
+        if (!persisted) {
+            ::unlink(temp.c_str());
+            std::lock_guard lock(mutex_);
+            index_dirty_ = true;
+        }
+        return persisted;
+    }
+
+    void DiskCache::seal(const PendingWrite &write, std::vector<uint8_t> &out) const {
+        const size_t plaintext_bytes = PAYLOAD_PREFIX_BYTES + write.key.size() + write.etag.size() +
+                                       write.packed_tags.size() + write.value.size();
+        const size_t sealed_bytes = plaintext_bytes + crypto_aead_xchacha20poly1305_ietf_ABYTES;
+
+        std::vector<uint8_t> plaintext(plaintext_bytes);
+        store<uint32_t>(plaintext.data(), static_cast<uint32_t>(write.key.size()));
+        store<uint32_t>(plaintext.data() + 4, static_cast<uint32_t>(write.etag.size()));
+        store<uint32_t>(plaintext.data() + 8, static_cast<uint32_t>(write.packed_tags.size()));
+        uint8_t *cursor = plaintext.data() + PAYLOAD_PREFIX_BYTES;
+        cursor = std::copy(write.key.begin(), write.key.end(), cursor);
+        cursor = std::copy(write.etag.begin(), write.etag.end(), cursor);
+        cursor = std::copy(write.packed_tags.begin(), write.packed_tags.end(), cursor);
+        std::copy(write.value.begin(), write.value.end(), cursor);
+
+        const size_t start = out.size();
+        out.resize(start + RECORD_HEADER_BYTES + sealed_bytes);
+        uint8_t *record = out.data() + start;
+        store<uint32_t>(record, RECORD_MAGIC);
+        store<uint16_t>(record + 4, static_cast<uint16_t>(FORMAT_VERSION));
+        store<uint16_t>(record + 6, 0);
+        std::memcpy(record + 8, write.id.data(), KEY_ID_BYTES);
+        store<uint64_t>(record + 24, write.expires_ms);
+        store<uint64_t>(record + 32, now_ms());
+        store<uint32_t>(record + 40, static_cast<uint32_t>(sealed_bytes));
+        store<uint32_t>(record + 44, 0);
+        randombytes_buf(record + RECORD_NONCE_OFFSET, crypto_aead_xchacha20poly1305_ietf_NPUBBYTES);
+
+        crypto_aead_xchacha20poly1305_ietf_encrypt(record + RECORD_HEADER_BYTES, nullptr,
+                                                   plaintext.data(), plaintext.size(),
+                                                   record, RECORD_AD_BYTES, nullptr,
+                                                   record + RECORD_NONCE_OFFSET, record_key_.data());
+        sodium_memzero(plaintext.data(), plaintext.size());
+    }
+
+    bool DiskCache::open_record(std::span<const uint8_t> record, const KeyId &id, std::vector<uint8_t> &plaintext,
+                                Payload &payload) const {
+        if (record.size() < RECORD_HEADER_BYTES + crypto_aead_xchacha20poly1305_ietf_ABYTES ||
+            load<uint32_t>(record.data()) != RECORD_MAGIC ||
+            load<uint32_t>(record.data() + 40) != record.size() - RECORD_HEADER_BYTES ||
+            std::memcmp(record.data() + 8, id.data(), KEY_ID_BYTES) != 0) {
+            return false;
+        }
+
+        const size_t sealed_bytes = record.size() - RECORD_HEADER_BYTES;
+        plaintext.resize(sealed_bytes - crypto_aead_xchacha20poly1305_ietf_ABYTES);
+        if (crypto_aead_xchacha20poly1305_ietf_decrypt(plaintext.data(), nullptr, nullptr,
+                                                       record.data() + RECORD_HEADER_BYTES, sealed_bytes,
+                                                       record.data(), RECORD_AD_BYTES,
+                                                       record.data() + RECORD_NONCE_OFFSET,
+                                                       record_key_.data()) != 0) {
+            return false;
+        }
+
+        if (plaintext.size() < PAYLOAD_PREFIX_BYTES) {
+            return false;
+        }
+        const uint64_t key_bytes = load<uint32_t>(plaintext.data());
+        const uint64_t etag_bytes = load<uint32_t>(plaintext.data() + 4);
+        const uint64_t tags_bytes = load<uint32_t>(plaintext.data() + 8);
+        if (PAYLOAD_PREFIX_BYTES + key_bytes + etag_bytes + tags_bytes > plaintext.size()) {
+            return false;
+        }
+
+        const auto *text = reinterpret_cast<const char *>(plaintext.data() + PAYLOAD_PREFIX_BYTES);
+        payload.key = std::string_view(text, key_bytes);
+        payload.etag = std::string_view(text + key_bytes, etag_bytes);
+        payload.packed_tags = std::string_view(text + key_bytes + etag_bytes, tags_bytes);
+        const size_t value_offset = PAYLOAD_PREFIX_BYTES + key_bytes + etag_bytes + tags_bytes;
+        payload.value = std::span<const uint8_t>(plaintext).subspan(value_offset);
+        return true;
+    }
+
+    bool DiskCache::describe_locked(Slot &slot) {
+        if (slot.described) {
+            return true;
+        }
+        if (mapping_ == nullptr || slot.offset + slot.length > file_bytes_) {
+            return false;
+        }
+
+        std::vector<uint8_t> plaintext;
+        Payload payload;
+        if (!open_record(std::span(mapping_ + slot.offset, slot.length), slot.id, plaintext, payload)) {
+            return false;
+        }
+        slot.key.assign(payload.key);
+        slot.packed_tags.assign(payload.packed_tags);
+        slot.described = true;
+        sodium_memzero(plaintext.data(), plaintext.size());
+        return true;
+    }
+
+    void DiskCache::link_front(Slot *slot) {
+        slot->prev = nullptr;
+        slot->next = head_;
+        if (head_ != nullptr) {
+            head_->prev = slot;
+        } else {
+            tail_ = slot;
+        }
+        head_ = slot;
+    }
+
+    void DiskCache::unlink(Slot *slot) {
+        if (slot->prev != nullptr) {
+            slot->prev->next = slot->next;
+        } else {
+            head_ = slot->next;
+        }
+        if (slot->next != nullptr) {
+            slot->next->prev = slot->prev;
+        } else {
+            tail_ = slot->prev;
+        }
+        slot->prev = slot->next = nullptr;
+    }
+
+    DiskCache::Slot *DiskCache::index_locked(const KeyId &id, uint64_t offset, uint32_t length,
+                                             uint64_t expires_ms, uint64_t last_access_ms) {
+        auto [it, inserted] = slots_.try_emplace(id);
+        if (inserted) {
+            it->second = std::make_unique<Slot>();
+            it->second->id = id;
+        } else {
+            unlink(it->second.get());
+            live_bytes_ -= it->second->length;
+        }
+
+        Slot *slot = it->second.get();
+        slot->offset = offset;
+        slot->length = length;
+        slot->expires_ms = expires_ms;
+        slot->last_access_ms = last_access_ms;
+        slot->described = false;
+        slot->key.clear();
+        slot->packed_tags.clear();
+        link_front(slot);
+        live_bytes_ += length;
+        return slot;
+    }
+
+    void DiskCache::erase_locked(KeyId id) {
+        const auto it = slots_.find(id);
+        if (it == slots_.end()) {
+            return;
+        }
+        unlink(it->second.get());
+        live_bytes_ -= it->second->length;
+        slots_.erase(it);
+    }
+
+    void DiskCache::evict_locked() {
+        while (live_bytes_ > max_bytes_ && tail_ != nullptr) {
+            erase_locked(tail_->id);
+            ++evictions_;
+        }
+    }
+
+    bool DiskCache::should_compact_locked() const {
+        const uint64_t dead_bytes = file_bytes_ - LOG_HEADER_BYTES - live_bytes_;
+        return file_bytes_ >= LOG_HEADER_BYTES + live_bytes_ &&
+               dead_bytes > live_bytes_ &&
+               dead_bytes >= std::max(MIN_COMPACTION_BYTES, max_bytes_ / 4);
+    }
+
+    ecliptix_net_result_t DiskCache::get(std::string_view key, ecliptix_disk_cache_sink_fn sink, void *context) {
+        const KeyId id = key_id(key);
+        const uint64_t now = now_ms();
+        std::shared_ptr<const PendingWrite> pending;
+        std::vector<uint8_t> record;
+        uint64_t expires_ms = 0;
+        uint64_t offset = 0;
+        {
+            std::lock_guard lock(mutex_);
+            if (const auto it = pending_.find(id); it != pending_.end() && it->second->key == key) {
+                pending = it->second;
+                expires_ms = pending->expires_ms;
+            } else {
+                const auto slot_it = slots_.find(id);
+                if (slot_it == slots_.end()) {
+                    misses_.fetch_add(1, std::memory_order_relaxed);
+                    return ECLIPTIX_NET_ERROR_NOT_FOUND;
+                }
+
+                Slot *slot = slot_it->second.get();
+                if (slot->expires_ms <= now || mapping_ == nullptr || slot->offset + slot->length > file_bytes_) {
+                    erase_locked(id);
+                    index_dirty_ = true;
+                    misses_.fetch_add(1, std::memory_order_relaxed);
+                    return ECLIPTIX_NET_ERROR_NOT_FOUND;
+                }
+
+                record.assign(mapping_ + slot->offset, mapping_ + slot->offset + slot->length);
+                offset = slot->offset;
+                expires_ms = slot->expires_ms;
+                slot->last_access_ms = now;
+                unlink(slot);
+                link_front(slot);
+            }
+        }
+
+        if (expires_ms <= now) {
+            misses_.fetch_add(1, std::memory_order_relaxed);
+            return ECLIPTIX_NET_ERROR_NOT_FOUND;
+        }
+
+        if (pending) {
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            if (sink != nullptr) {
+                sink(pending->value.data(), pending->value.size(),
+                     reinterpret_cast<const uint8_t *>(pending->etag.data()), pending->etag.size(),
+                     reinterpret_cast<const uint8_t *>(pending->packed_tags.data()), pending->packed_tags.size(),
+                     expires_ms - now, context);
+            }
+            return ECLIPTIX_NET_SUCCESS;
+        }
+
+        std::vector<uint8_t> plaintext;
+        Payload payload;
+        if (!open_record(record, id, plaintext, payload) || payload.key != key) {
+            std::lock_guard lock(mutex_);
+            if (const auto it = slots_.find(id); it != slots_.end() && it->second->offset == offset) {
+                erase_locked(id);
+                index_dirty_ = true;
+            }
+            ++corrupt_records_;
+            misses_.fetch_add(1, std::memory_order_relaxed);
+            return ECLIPTIX_NET_ERROR_NOT_FOUND;
+        }
+
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        if (sink != nullptr) {
+            sink(payload.value.data(), payload.value.size(),
+                 reinterpret_cast<const uint8_t *>(payload.etag.data()), payload.etag.size(),
+                 reinterpret_cast<const uint8_t *>(payload.packed_tags.data()), payload.packed_tags.size(),
+                 expires_ms - now, context);
+        }
+        sodium_memzero(plaintext.data(), plaintext.size());
+        return ECLIPTIX_NET_SUCCESS;
+    }
+
+    ecliptix_net_result_t DiskCache::put(std::string_view key, std::span<const uint8_t> value,
+                                         std::string_view etag, uint64_t ttl_ms, std::string_view packed_tags) {
+        const uint64_t record_bytes = RECORD_HEADER_BYTES + PAYLOAD_PREFIX_BYTES + key.size() + etag.size() +
+                                      packed_tags.size() + value.size() + crypto_aead_xchacha20poly1305_ietf_ABYTES;
+        if (record_bytes > max_bytes_ || record_bytes > UINT32_MAX) {
+            return ECLIPTIX_NET_ERROR_CAPACITY;
+        }
+
+        auto write = std::make_shared<PendingWrite>();
+        write->id = key_id(key);
+        write->key.assign(key);
+        write->value.assign(value.begin(), value.end());
+        write->etag.assign(etag);
+        write->packed_tags.assign(packed_tags);
+        const uint64_t now = now_ms();
+        write->expires_ms = ttl_ms == 0 || ttl_ms > UINT64_MAX - now ? UINT64_MAX : now + ttl_ms;
+
+        {
+            std::lock_guard lock(mutex_);
+            if (const auto it = pending_.find(write->id); it != pending_.end()) {
+                it->second = std::move(write);
+            } else {
+                if (pending_.size() >= max_pending_writes_) {
+                    ++dropped_writes_;
+                    return ECLIPTIX_NET_ERROR_CAPACITY;
+                }
+                queue_.push_back(write->id);
+                pending_.emplace(write->id, std::move(write));
+            }
+        }
+        writer_wakeup_.notify_one();
+        return ECLIPTIX_NET_SUCCESS;
+    }
+
+    // Removals persist the index before returning: a record that is only dropped in memory would be picked up
+    // again from the log by the next open.
+    ecliptix_net_result_t DiskCache::remove(std::string_view key) {
+        const KeyId id = key_id(key);
+        bool removed;
+        {
+            std::lock_guard lock(mutex_);
+            removed = pending_.erase(id) != 0;
+            if (slots_.contains(id)) {
+                erase_locked(id);
+                index_dirty_ = true;
+                removed = true;
+            }
+        }
+        if (!removed) {
+            return ECLIPTIX_NET_ERROR_NOT_FOUND;
+        }
+        return persist_index() ? ECLIPTIX_NET_SUCCESS : ECLIPTIX_NET_ERROR_IO;
+    }
+
+    // Slots loaded from the index only carry the key digest, so the first bulk removal decrypts them once to
+    // learn their key and tags; records written in this session are described when they are indexed.
+    template<typename Predicate>
+    size_t DiskCache::remove_if(Predicate predicate) {
+        size_t removed = 0;
+        {
+            std::lock_guard lock(mutex_);
+            for (auto it = pending_.begin(); it != pending_.end();) {
+                if (predicate(it->second->key, it->second->packed_tags)) {
+                    it = pending_.erase(it);
+                    ++removed;
+                } else {
+                    ++it;
+                }
+            }
+
+            std::vector<KeyId> victims;
+            std::vector<KeyId> corrupt;
+            for (const auto &[id, slot]: slots_) {
+                if (!describe_locked(*slot)) {
+                    corrupt.push_back(id);
+                } else if (predicate(slot->key, slot->packed_tags)) {
+                    victims.push_back(id);
+                }
+            }
+            for (const KeyId &id: corrupt) {
+                erase_locked(id);
+                ++corrupt_records_;
+            }
+            for (const KeyId &id: victims) {
+                erase_locked(id);
+            }
+            removed += victims.size();
+            if (removed == 0 && corrupt.empty()) {
+                return 0;
+            }
+            index_dirty_ = true;
+        }
+        (void) persist_index();
+        return removed;
+    }
+
+    size_t DiskCache::remove_prefix(std::string_view prefix) {
+        return remove_if([prefix](std::string_view key, std::string_view) { return key.starts_with(prefix); });
+    }
+
+    size_t DiskCache::remove_tag(std::string_view tag) {
+        return remove_if([tag](std::string_view, std::string_view packed_tags) {
+            for (size_t start = 0; start < packed_tags.size();) {
+                const size_t end = std::min(packed_tags.find('\0', start), packed_tags.size());
+                if (packed_tags.substr(start, end - start) == tag) {
+                    return true;
+                }
+                start = end + 1;
+            }
+            return false;
+        });
+    }
+
+    size_t DiskCache::remove_matching(std::string_view pattern) {
+        return remove_if([pattern](std::string_view key, std::string_view) {
+            return key.find(pattern) != std::string_view::npos;
+        });
+    }
+
+    // The empty index is persisted against the current log right away; the writer truncates the log afterwards.
+    void DiskCache::clear() {
+        {
+            std::lock_guard lock(mutex_);
+            pending_.clear();
+            queue_.clear();
+            slots_.clear();
+            head_ = tail_ = nullptr;
+            live_bytes_ = 0;
+            reset_requested_ = true;
+            index_dirty_ = true;
+        }
+        (void) persist_index();
+        writer_wakeup_.notify_one();
+    }
+
+    ecliptix_net_result_t DiskCache::flush() {
+        std::unique_lock lock(mutex_);
+        const uint64_t ticket = ++flush_requested_;
+        writer_wakeup_.notify_one();
+        flushed_.wait(lock, [&] { return flush_completed_ >= ticket; });
+        return index_dirty_ ? ECLIPTIX_NET_ERROR_IO : ECLIPTIX_NET_SUCCESS;
+    }
+
+    void DiskCache::get_stats(ecliptix_disk_cache_stats_t &stats) const {
+        std::lock_guard lock(mutex_);
+        stats.entries = slots_.size();
+        stats.live_bytes = live_bytes_;
+        stats.file_bytes = file_bytes_;
+        stats.pending_writes = pending_.size();
+        stats.hits = hits_.load(std::memory_order_relaxed);
+        stats.misses = misses_.load(std::memory_order_relaxed);
+        stats.writes = writes_;
+        stats.dropped_writes = dropped_writes_;
+        stats.evictions = evictions_;
+        stats.compactions = compactions_;
+        stats.corrupt_records = corrupt_records_;
+    }
+
+    void DiskCache::write_batch(std::vector<std::shared_ptr<const PendingWrite>> &batch) {
+        std::vector<SealedRecord> sealed;
+        std::vector<uint8_t> buffer;
+        sealed.reserve(batch.size());
+
+        const uint64_t base = file_bytes_;
+        for (auto &write: batch) {
+            const size_t start = buffer.size();
+            seal(*write, buffer);
+            sealed.push_back({std::move(write), base + start, static_cast<uint32_t>(buffer.size() - start)});
+        }
+        const bool written = write_all(fd_, buffer.data(), buffer.size(), base);
+        sodium_memzero(buffer.data(), buffer.size());
+
+        std::lock_guard lock(mutex_);
+        if (!written) {
+            if (::ftruncate(fd_, static_cast<off_t>(base)) != 0) {
+                reset_requested_ = true;
+            }
+        } else {
+            file_bytes_ = base + buffer.size();
+            if (!remap_locked()) {
+                reset_requested_ = true;
+            }
+        }
+
+        const uint64_t now = now_ms();
+        for (const auto &record: sealed) {
+            const KeyId &id = record.write->id;
+            const auto it = pending_.find(id);
+            if (it == pending_.end()) {
+                // Removed while being written: the record is now in the log, so the index must say otherwise
+                // before the next open replays the tail.
+                persist_requested_ = true;
+                continue;
+            }
+            if (it->second != record.write) {
+                queue_.push_back(id);
+                continue;
+            }
+            pending_.erase(it);
+            if (!written || reset_requested_) {
+                ++dropped_writes_;
+                continue;
+            }
+            Slot *slot = index_locked(id, record.offset, record.length, record.write->expires_ms, now);
+            slot->key = record.write->key;
+            slot->packed_tags = record.write->packed_tags;
+            slot->described = true;
+            ++writes_;
+        }
+        evict_locked();
+        index_dirty_ = true;
+    }
+
+    void DiskCache::compact() {
+        struct Move {
+            KeyId id;
+            uint64_t from;
+            uint32_t length;
+            uint64_t to;
+        };
+        std::vector<Move> moves;
+        {
+            std::lock_guard lock(mutex_);
+            moves.reserve(slots_.size());
+            for (const Slot *slot = tail_; slot != nullptr; slot = slot->prev) {
+                moves.push_back({slot->id, slot->offset, slot->length, 0});
+            }
+        }
+
+        const std::string target = path(COMPACT_FILE);
+        const uint64_t log_id = new_log_id();
+        const int fd = ::open(target.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+        bool copied = fd >= 0 && write_log_header(fd, log_id);
+
+        uint64_t offset = LOG_HEADER_BYTES;
+        std::vector<uint8_t> chunk;
+        chunk.reserve(COPY_CHUNK_BYTES);
+        for (auto &move: moves) {
+            if (!copied) {
+                break;
+            }
+            move.to = offset + chunk.size();
+            chunk.insert(chunk.end(), mapping_ + move.from, mapping_ + move.from + move.length);
+            if (chunk.size() >= COPY_CHUNK_BYTES) {
+                copied = write_all(fd, chunk.data(), chunk.size(), offset);
+                offset += chunk.size();
+                chunk.clear();
+            }
+        }
+        if (copied && !chunk.empty()) {
+            copied = write_all(fd, chunk.data(), chunk.size(), offset);
+            offset += chunk.size();
+        }
+        copied = copied && ::fsync(fd) == 0 && ::rename(target.c_str(), path(LOG_FILE).c_str()) == 0;
+
+        {
+            std::lock_guard lock(mutex_);
+            if (!copied) {
+                if (fd >= 0) {
+                    ::close(fd);
+                }
+                ::unlink(target.c_str());
+                reset_requested_ = true;
+                return;
+            }
+
+            unmap_locked();
+            ::close(fd_);
+            fd_ = fd;
+            file_bytes_ = offset;
+            log_id_ = log_id;
+            for (const auto &move: moves) {
+                if (const auto it = slots_.find(move.id); it != slots_.end() && it->second->offset == move.from) {
+                    it->second->offset = move.to;
+                }
+            }
+            if (!remap_locked()) {
+                reset_requested_ = true;
+            }
+            index_dirty_ = true;
+            ++compactions_;
+        }
+        (void) persist_index();
+    }
+
+    void DiskCache::run() {
+        std::vector<std::shared_ptr<const PendingWrite>> batch;
+        auto last_persist = std::chrono::steady_clock::now();
+
+        std::unique_lock lock(mutex_);
+        while (true) {
+            if (reset_requested_) {
+                reset_requested_ = false;
+                (void) reset_log_locked();
+                continue;
+            }
+
+            if (!queue_.empty()) {
+                batch.clear();
+                while (!queue_.empty() && batch.size() < MAX_WRITE_BATCH) {
+                    const auto it = pending_.find(queue_.front());
+                    if (it != pending_.end()) {
+                        batch.push_back(it->second);
+                    }
+                    queue_.pop_front();
+                }
+                lock.unlock();
+                write_batch(batch);
+                batch.clear();
+                lock.lock();
+                continue;
+            }
+
+            if (!stopping_ && should_compact_locked()) {
+                lock.unlock();
+                compact();
+                lock.lock();
+                continue;
+            }
+
+            const bool flush_pending = flush_requested_ > flush_completed_;
+            const auto now = std::chrono::steady_clock::now();
+            if (index_dirty_ && (stopping_ || flush_pending || persist_requested_ ||
+                                 now - last_persist >= INDEX_PERSIST_INTERVAL)) {
+                lock.unlock();
+                (void) persist_index();
+                last_persist = now;
+                lock.lock();
+            }
+
+            if (flush_pending) {
+                flush_completed_ = flush_requested_;
+                flushed_.notify_all();
+            }
+            if (stopping_) {
+                break;
+            }
+
+            if (index_dirty_) {
+                writer_wakeup_.wait_until(lock, last_persist + INDEX_PERSIST_INTERVAL);
+            } else {
+                writer_wakeup_.wait(lock);
+            }
+        }
+    }
+
+} // namespace ecliptix::networking
+
+struct ecliptix_disk_cache : ecliptix::networking::DiskCache {
+    using DiskCache::DiskCache;
+};
+
+using ecliptix::networking::DiskCache;
+
+namespace {
+    std::string_view as_view(const uint8_t *data, size_t len) {
+        return {reinterpret_cast<const char *>(data), len};
+    }
+}
+
+extern "C" {
+
+ecliptix_disk_cache_t *ecliptix_disk_cache_create(const ecliptix_disk_cache_config_t *config) {
+    if (config == nullptr || config->directory == nullptr || config->key == nullptr ||
+        config->key_len != DiskCache::KEY_BYTES) {
+        return nullptr;
+    }
+    try {
+        auto *cache = new ecliptix_disk_cache(
+            config->directory,
+            std::span<const uint8_t, DiskCache::KEY_BYTES>(config->key, DiskCache::KEY_BYTES),
+            config->max_bytes != 0 ? config->max_bytes : DiskCache::DEFAULT_MAX_BYTES,
+            config->max_pending_writes != 0 ? config->max_pending_writes : DiskCache::DEFAULT_MAX_PENDING_WRITES);
+        if (!cache->open()) {
+            delete cache;
+            return nullptr;
+        }
+        return cache;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void ecliptix_disk_cache_destroy(ecliptix_disk_cache_t *cache) {
+    delete cache;
+}
+
+ecliptix_net_result_t ecliptix_disk_cache_get(ecliptix_disk_cache_t *cache, const uint8_t *key, size_t key_len,
+                                              ecliptix_disk_cache_sink_fn sink, void *context) {
+    if (cache == nullptr || (key == nullptr && key_len != 0)) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    try {
+        return cache->get(as_view(key, key_len), sink, context);
+    } catch (const std::bad_alloc &) {
+        return ECLIPTIX_NET_ERROR_OUT_OF_MEMORY;
+    }
+}
+
+ecliptix_net_result_t ecliptix_disk_cache_put(ecliptix_disk_cache_t *cache, const uint8_t *key, size_t key_len,
+                                              const uint8_t *value, size_t value_len, const uint8_t *etag,
+                                              size_t etag_len, uint64_t ttl_ms, const uint8_t *tags, size_t tags_len) {
+    if (cache == nullptr || (key == nullptr && key_len != 0) || (value == nullptr && value_len != 0) ||
+        (etag == nullptr && etag_len != 0) || (tags == nullptr && tags_len != 0)) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    try {
+        return cache->put(as_view(key, key_len), std::span(value, value_len), as_view(etag, etag_len), ttl_ms,
+                          as_view(tags, tags_len));
+    } catch (const std::bad_alloc &) {
+        return ECLIPTIX_NET_ERROR_OUT_OF_MEMORY;
+    }
+}
+
+ecliptix_net_result_t ecliptix_disk_cache_remove(ecliptix_disk_cache_t *cache, const uint8_t *key,
+                                                 size_t key_len) {
+    if (cache == nullptr || (key == nullptr && key_len != 0)) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    try {
+        return cache->remove(as_view(key, key_len));
+    } catch (const std::bad_alloc &) {
+        return ECLIPTIX_NET_ERROR_OUT_OF_MEMORY;
+    }
+}
+
+size_t ecliptix_disk_cache_remove_prefix(ecliptix_disk_cache_t *cache, const uint8_t *prefix, size_t prefix_len) {
+    if (cache == nullptr || (prefix == nullptr && prefix_len != 0)) {
+        return 0;
+    }
+    try {
+        return cache->remove_prefix(as_view(prefix, prefix_len));
+    } catch (const std::bad_alloc &) {
+        return 0;
+    }
+}
+
+size_t ecliptix_disk_cache_remove_tag(ecliptix_disk_cache_t *cache, const uint8_t *tag, size_t tag_len) {
+    if (cache == nullptr || tag == nullptr || tag_len == 0) {
+        return 0;
+    }
+    try {
+        return cache->remove_tag(as_view(tag, tag_len));
+    } catch (const std::bad_alloc &) {
+        return 0;
+    }
+}
+
+size_t ecliptix_disk_cache_remove_matching(ecliptix_disk_cache_t *cache, const uint8_t *pattern,
+                                           size_t pattern_len) {
+    if (cache == nullptr || (pattern == nullptr && pattern_len != 0)) {
+        return 0;
+    }
+    try {
+        return cache->remove_matching(as_view(pattern, pattern_len));
+    } catch (const std::bad_alloc &) {
+        return 0;
+    }
+}
+
+void ecliptix_disk_cache_clear(ecliptix_disk_cache_t *cache) {
+    if (cache != nullptr) {
+        cache->clear();
+    }
+}
+
+ecliptix_net_result_t ecliptix_disk_cache_flush(ecliptix_disk_cache_t *cache) {
+    if (cache == nullptr) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    return cache->flush();
+}
+
+void ecliptix_disk_cache_get_stats(const ecliptix_disk_cache_t *cache, ecliptix_disk_cache_stats_t *out_stats) {
+    if (cache == nullptr || out_stats == nullptr) {
+        return;
+    }
+    cache->get_stats(*out_stats);
+}
+
+}
@@ -0,0 +1,193 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "ecliptix_disk_cache.h"
+
+namespace ecliptix::networking {
+
+    class DiskCache {
+    public:
+        static constexpr size_t KEY_BYTES = ECLIPTIX_DISK_CACHE_KEY_BYTES;
+        static constexpr uint64_t DEFAULT_MAX_BYTES = 32ull * 1024 * 1024;
+        static constexpr uint32_t DEFAULT_MAX_PENDING_WRITES = 256;
+
+        DiskCache(std::string directory, std::span<const uint8_t, KEY_BYTES> key, uint64_t max_bytes,
+                  uint32_t max_pending_writes);
+
+        ~DiskCache();
+
+        DiskCache(const DiskCache &) = delete;
+
+        DiskCache &operator=(const DiskCache &) = delete;
+
+        [[nodiscard]] bool open();
+
+        [[nodiscard]] ecliptix_net_result_t get(std::string_view key, ecliptix_disk_cache_sink_fn sink,
+                                                void *context);
+
+        [[nodiscard]] ecliptix_net_result_t put(std::string_view key, std::span<const uint8_t> value,
+                                                std::string_view etag, uint64_t ttl_ms,
+                                                std::string_view packed_tags);
+
+        [[nodiscard]] ecliptix_net_result_t remove(std::string_view key);
+
+        size_t remove_prefix(std::string_view prefix);
+
+        size_t remove_tag(std::string_view tag);
+
+        size_t remove_matching(std::string_view pattern);
+
+        void clear();
+
+        [[nodiscard]] ecliptix_net_result_t flush();
+
+        void get_stats(ecliptix_disk_cache_stats_t &stats) const;
+
+    private:
+        static constexpr size_t KEY_ID_BYTES = 16;
+
+        using KeyId = std::array<uint8_t, KEY_ID_BYTES>;
+
+        struct KeyIdHash {
+            size_t operator()(const KeyId &id) const noexcept;
+        };
+
+        struct Slot {
+            KeyId id{};
+            uint64_t offset = 0;
+            uint32_t length = 0;
+            uint64_t expires_ms = 0;
+            uint64_t last_access_ms = 0;
+            bool described = false;
+            std::string key;
+            std::string packed_tags;
+            Slot *prev = nullptr;
+            Slot *next = nullptr;
+        };
+
+        struct PendingWrite {
+            KeyId id{};
+            std::string key;
+            std::vector<uint8_t> value;
+            std::string etag;
+            std::string packed_tags;
+            uint64_t expires_ms = 0;
+        };
+
+        struct Payload {
+            std::string_view key;
+            std::string_view etag;
+            std::string_view packed_tags;
+            std::span<const uint8_t> value;
+        };
+
+        struct SealedRecord {
+            std::shared_ptr<const PendingWrite> write;
+            uint64_t offset = 0;
+            uint32_t length = 0;
+        };
+
+        [[nodiscard]] KeyId key_id(std::string_view key) const;
+
+        [[nodiscard]] static uint64_t now_ms();
+
+        [[nodiscard]] std::string path(const char *name) const;
+
+        [[nodiscard]] bool open_log();
+
+        [[nodiscard]] bool reset_log_locked();
+
+        [[nodiscard]] bool remap_locked();
+
+        void unmap_locked();
+
+        [[nodiscard]] bool load_index();
+
+        void recover_tail(uint64_t from_offset);
+
+        [[nodiscard]] bool persist_index();
+
+        void seal(const PendingWrite &write, std::vector<uint8_t> &out) const;
+
+        [[nodiscard]] bool open_record(std::span<const uint8_t> record, const KeyId &id,
+                                       std::vector<uint8_t> &plaintext, Payload &payload) const;
+
+        [[nodiscard]] bool describe_locked(Slot &slot);
+
+        template<typename Predicate>
+        size_t remove_if(Predicate predicate);
+
+        void link_front(Slot *slot);
+
+        void unlink(Slot *slot);
+
+        Slot *index_locked(const KeyId &id, uint64_t offset, uint32_t length, uint64_t expires_ms,
+                          uint64_t last_access_ms);
+
+        void erase_locked(KeyId id);
+
+        void evict_locked();
+
+        [[nodiscard]] bool should_compact_locked() const;
+
+        void compact();
+
+        void write_batch(std::vector<std::shared_ptr<const PendingWrite>> &batch);
+
+        void run();
+
+        const std::string directory_;
+        const uint64_t max_bytes_;
+        const uint32_t max_pending_writes_;
+        std::array<uint8_t, KEY_BYTES> record_key_{};
+        std::array<uint8_t, KEY_BYTES> key_id_key_{};
+        std::array<uint8_t, KEY_BYTES> index_key_{};
+
+        mutable std::mutex mutex_;
+        std::mutex persist_mutex_;
+        std::condition_variable writer_wakeup_;
+        std::condition_variable flushed_;
+        std::thread writer_;
+        bool stopping_ = false;
+        bool reset_requested_ = false;
+        bool index_dirty_ = false;
+        bool persist_requested_ = false;
+        uint64_t flush_requested_ = 0;
+        uint64_t flush_completed_ = 0;
+
+        int fd_ = -1;
+        uint8_t *mapping_ = nullptr;
+        uint64_t mapped_bytes_ = 0;
+        uint64_t file_bytes_ = 0;
+        uint64_t log_id_ = 0;
+
+        std::unordered_map<KeyId, std::unique_ptr<Slot>, KeyIdHash> slots_;
+        Slot *head_ = nullptr;
+        Slot *tail_ = nullptr;
+        uint64_t live_bytes_ = 0;
+
+        std::unordered_map<KeyId, std::shared_ptr<const PendingWrite>, KeyIdHash> pending_;
+        std::deque<KeyId> queue_;
+
+        std::atomic<uint64_t> hits_{0};
+        std::atomic<uint64_t> misses_{0};
+        uint64_t writes_ = 0;
+        uint64_t dropped_writes_ = 0;
+        uint64_t evictions_ = 0;
+        uint64_t compactions_ = 0;
+        uint64_t corrupt_records_ = 0;
+    };
+
+} // namespace ecliptix::networking
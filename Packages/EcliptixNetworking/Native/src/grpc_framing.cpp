@@ -0,0 +1,444 @@
+#include "grpc_framing.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <unistd.h>
+
+namespace ecliptix::networking {
+
+    namespace {
+        constexpr uint8_t FLAG_COMPRESSED = 1;
+        constexpr size_t MAX_IOVECS = ECLIPTIX_GRPC_MAX_SEGMENTS + 1;
+
+        uint32_t load_be32(const uint8_t *bytes) {
+            return (uint32_t{bytes[0]} << 24) | (uint32_t{bytes[1]} << 16) | (uint32_t{bytes[2]} << 8) |
+                   uint32_t{bytes[3]};
+        }
+
+        void store_be32(uint8_t *bytes, uint32_t value) {
+            bytes[0] = static_cast<uint8_t>(value >> 24);
+            bytes[1] = static_cast<uint8_t>(value >> 16);
+            bytes[2] = static_cast<uint8_t>(value >> 8);
+            bytes[3] = static_cast<uint8_t>(value);
+        }
+    }
+
+    SlabPool::SlabPool(size_t slab_size, uint32_t max_cached_slabs)
+        : slab_size_(slab_size),
+          max_cached_slabs_(max_cached_slabs) {
+        cached_.reserve(max_cached_slabs);
+    }
+
+    SlabPool::~SlabPool() {
+        for (Slab *slab : cached_) {
+            free_slab(slab);
+        }
+    }
+
+    void SlabPool::free_slab(Slab *slab) {
+        slab->~Slab();
+        ::operator delete(slab);
+    }
+
+    Slab *SlabPool::acquire(size_t min_capacity) {
+        Slab *slab = nullptr;
+        if (min_capacity <= slab_size_) {
+            std::lock_guard lock(mutex_);
+            if (!cached_.empty()) {
+                slab = cached_.back();
+                cached_.pop_back();
+            }
+        }
+
+        if (slab != nullptr) {
+            slab->refs.store(1, std::memory_order_relaxed);
+            reuses_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            const size_t capacity = std::max(min_capacity, slab_size_);
+            if (capacity > SIZE_MAX - sizeof(Slab)) {
+                throw std::bad_alloc();
+            }
+            void *memory = ::operator new(sizeof(Slab) + capacity);
+            slab = new (memory) Slab{{1}, capacity, this};
+            allocations_.fetch_add(1, std::memory_order_relaxed);
+            if (capacity > slab_size_) {
+                oversize_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        retain_pool();
+        outstanding_.fetch_add(1, std::memory_order_relaxed);
+        return slab;
+    }
+
+    void SlabPool::retain(Slab *slab) {
+        slab->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void SlabPool::release(Slab *slab) {
+        if (slab->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            slab->pool->recycle(slab);
+        }
+    }
+
+    void SlabPool::recycle(Slab *slab) {
+        outstanding_.fetch_sub(1, std::memory_order_relaxed);
+        bool cached = false;
+        if (slab->capacity == slab_size_) {
+            std::lock_guard lock(mutex_);
+            if (cached_.size() < max_cached_slabs_) {
+                cached_.push_back(slab);
+                cached = true;
+            }
+        }
+        if (!cached) {
+            free_slab(slab);
+        }
+        release_pool();
+    }
+
+    void SlabPool::retain_pool() {
+        refs_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void SlabPool::release_pool() {
+        if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete this;
+        }
+    }
+
+    void SlabPool::get_stats(ecliptix_slab_pool_stats_t &stats) const {
+        stats.slab_allocations = allocations_.load(std::memory_order_relaxed);
+        stats.slab_reuses = reuses_.load(std::memory_order_relaxed);
+        stats.oversize_allocations = oversize_.load(std::memory_order_relaxed);
+        stats.outstanding_slabs = outstanding_.load(std::memory_order_relaxed);
+        std::lock_guard lock(mutex_);
+        stats.cached_slabs = cached_.size();
+    }
+
+    GrpcDeframer::GrpcDeframer(SlabPool &pool, size_t max_message_size)
+        : pool_(pool),
+          max_message_size_(max_message_size) {
+        pool_.retain_pool();
+    }
+
+    GrpcDeframer::~GrpcDeframer() {
+        if (slab_ != nullptr) {
+            SlabPool::release(slab_);
+        }
+        pool_.release_pool();
+    }
+
+    size_t GrpcDeframer::pending_frame_size() const {
+        if (buffered() < ECLIPTIX_GRPC_PREFIX_SIZE) {
+            return 0;
+        }
+        const uint32_t length = load_be32(slab_->bytes() + read_pos_ + 1);
+        return length <= max_message_size_ ? ECLIPTIX_GRPC_PREFIX_SIZE + size_t{length} : 0;
+    }
+
+    void GrpcDeframer::make_room() {
+        const size_t frame = pending_frame_size();
+        if (slab_ != nullptr && write_pos_ < slab_->capacity &&
+            (frame == 0 || read_pos_ + frame <= slab_->capacity)) {
+            return;
+        }
+
+        const size_t pending = buffered();
+        const size_t needed = std::max(pending + 1, frame);
+        // Messages handed out earlier point into the slab, so it is only compacted in place once they are gone.
+        if (slab_ != nullptr && slab_->capacity >= needed && slab_->refs.load(std::memory_order_acquire) == 1) {
+            std::memmove(slab_->bytes(), slab_->bytes() + read_pos_, pending);
+            read_pos_ = 0;
+            write_pos_ = pending;
+            return;
+        }
+
+        Slab *fresh = pool_.acquire(needed);
+        if (slab_ != nullptr) {
+            std::memcpy(fresh->bytes(), slab_->bytes() + read_pos_, pending);
+            SlabPool::release(slab_);
+        }
+        slab_ = fresh;
+        read_pos_ = 0;
+        write_pos_ = pending;
+    }
+
+    void GrpcDeframer::feed(const uint8_t *data, size_t length) {
+        while (length > 0) {
+            make_room();
+            const size_t chunk = std::min(length, slab_->capacity - write_pos_);
+            std::memcpy(slab_->bytes() + write_pos_, data, chunk);
+            write_pos_ += chunk;
+            data += chunk;
+            length -= chunk;
+        }
+    }
+
+    ecliptix_net_result_t GrpcDeframer::read(int fd, size_t &bytes_read) {
+        make_room();
+        for (;;) {
+            const ssize_t result = ::read(fd, slab_->bytes() + write_pos_, slab_->capacity - write_pos_);
+            if (result >= 0) {
+                write_pos_ += static_cast<size_t>(result);
+                bytes_read = static_cast<size_t>(result);
+                return ECLIPTIX_NET_SUCCESS;
+            }
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno == EAGAIN || errno == EWOULDBLOCK ? ECLIPTIX_NET_ERROR_CAPACITY : ECLIPTIX_NET_ERROR_IO;
+        }
+    }
+
+    ecliptix_net_result_t GrpcDeframer::next(ecliptix_grpc_message_t &message) {
+        if (failed_) {
+            return ECLIPTIX_NET_ERROR_IO;
+        }
+        if (buffered() < ECLIPTIX_GRPC_PREFIX_SIZE) {
+            return ECLIPTIX_NET_ERROR_NOT_FOUND;
+        }
+
+        const uint8_t *prefix = slab_->bytes() + read_pos_;
+        const uint32_t length = load_be32(prefix + 1);
+        if (prefix[0] > FLAG_COMPRESSED || length > max_message_size_) {
+            failed_ = true;
+            return ECLIPTIX_NET_ERROR_IO;
+        }
+        if (buffered() - ECLIPTIX_GRPC_PREFIX_SIZE < length) {
+            return ECLIPTIX_NET_ERROR_NOT_FOUND;
+        }
+
+        SlabPool::retain(slab_);
+        message.data = prefix + ECLIPTIX_GRPC_PREFIX_SIZE;
+        message.length = length;
+        message.compressed = prefix[0];
+        message.slab = slab_;
+        read_pos_ += ECLIPTIX_GRPC_PREFIX_SIZE + length;
+        return ECLIPTIX_NET_SUCCESS;
+    }
+
+    ecliptix_net_result_t frame_init(ecliptix_grpc_frame_t &frame, uint8_t compressed,
+                                     const ecliptix_grpc_segment_t *segments, size_t segment_count) {
+        if (compressed > FLAG_COMPRESSED || segment_count > ECLIPTIX_GRPC_MAX_SEGMENTS ||
+            (segment_count > 0 && segments == nullptr)) {
+            return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+        }
+        uint64_t body = 0;
+        for (size_t i = 0; i < segment_count; ++i) {
+            if (segments[i].data == nullptr && segments[i].length > 0) {
+                return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+            }
+            body += segments[i].length;
+            if (body > UINT32_MAX) {
+                return ECLIPTIX_NET_ERROR_CAPACITY;
+            }
+        }
+
+        frame.prefix[0] = compressed;
+        store_be32(frame.prefix + 1, static_cast<uint32_t>(body));
+        std::copy_n(segments, segment_count, frame.segments);
+        frame.segment_count = segment_count;
+        frame.total_length = ECLIPTIX_GRPC_PREFIX_SIZE + static_cast<size_t>(body);
+        frame.written = 0;
+        return ECLIPTIX_NET_SUCCESS;
+    }
+
+    size_t frame_iovecs(const ecliptix_grpc_frame_t &frame, struct iovec *iovecs, size_t capacity) {
+        size_t skip = frame.written;
+        size_t count = 0;
+        const auto append = [&](const uint8_t *data, size_t length) {
+            if (skip >= length) {
+                skip -= length;
+                return;
+            }
+            if (count < capacity) {
+                iovecs[count].iov_base = const_cast<uint8_t *>(data + skip);
+                iovecs[count].iov_len = length - skip;
+                ++count;
+            }
+            skip = 0;
+        };
+
+        append(frame.prefix, ECLIPTIX_GRPC_PREFIX_SIZE);
+        for (size_t i = 0; i < frame.segment_count; ++i) {
+            append(frame.segments[i].data, frame.segments[i].length);
+        }
+        return count;
+    }
+
+    ecliptix_net_result_t frame_write(ecliptix_grpc_frame_t &frame, int fd) {
+        struct iovec iovecs[MAX_IOVECS];
+        while (frame.written < frame.total_length) {
+            const size_t count = frame_iovecs(frame, iovecs, MAX_IOVECS);
+            const ssize_t result = ::writev(fd, iovecs, static_cast<int>(count));
+            if (result < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return errno == EAGAIN || errno == EWOULDBLOCK ? ECLIPTIX_NET_ERROR_CAPACITY : ECLIPTIX_NET_ERROR_IO;
+            }
+            frame.written += static_cast<size_t>(result);
+        }
+        return ECLIPTIX_NET_SUCCESS;
+    }
+
+} // namespace ecliptix::networking
+
+struct ecliptix_slab_pool : ecliptix::networking::SlabPool {
+    using SlabPool::SlabPool;
+};
+
+struct ecliptix_grpc_deframer : ecliptix::networking::GrpcDeframer {
+    using GrpcDeframer::GrpcDeframer;
+};
+
+using ecliptix::networking::GrpcDeframer;
+using ecliptix::networking::Slab;
+using ecliptix::networking::SlabPool;
+
+extern "C" {
+
+ecliptix_slab_pool_t *ecliptix_slab_pool_create(const ecliptix_slab_pool_config_t *config) {
+    const ecliptix_slab_pool_config_t effective = config != nullptr ? *config : ecliptix_slab_pool_config_t{};
+    const size_t slab_size = effective.slab_size != 0 ? effective.slab_size : SlabPool::DEFAULT_SLAB_SIZE;
+    const uint32_t max_cached = effective.max_cached_slabs != 0 ? effective.max_cached_slabs
+                                                                : SlabPool::DEFAULT_MAX_CACHED_SLABS;
+    if (slab_size < ECLIPTIX_GRPC_PREFIX_SIZE) {
+        return nullptr;
+    }
+    try {
+        return new ecliptix_slab_pool(slab_size, max_cached);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void ecliptix_slab_pool_destroy(ecliptix_slab_pool_t *pool) {
+    if (pool != nullptr) {
+        pool->release_pool();
+    }
+}
+
+ecliptix_net_result_t ecliptix_slab_pool_acquire(ecliptix_slab_pool_t *pool, size_t min_capacity,
+                                                 ecliptix_slab_buffer_t *out_buffer) {
+    if (pool == nullptr || out_buffer == nullptr) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    try {
+        Slab *slab = pool->acquire(min_capacity);
+        out_buffer->data = slab->bytes();
+        out_buffer->capacity = slab->capacity;
+        out_buffer->slab = slab;
+        return ECLIPTIX_NET_SUCCESS;
+    } catch (const std::bad_alloc &) {
+        return ECLIPTIX_NET_ERROR_OUT_OF_MEMORY;
+    }
+}
+
+void ecliptix_slab_buffer_release(ecliptix_slab_buffer_t *buffer) {
+    if (buffer == nullptr || buffer->slab == nullptr) {
+        return;
+    }
+    SlabPool::release(static_cast<Slab *>(buffer->slab));
+    *buffer = ecliptix_slab_buffer_t{};
+}
+
+void ecliptix_slab_pool_get_stats(const ecliptix_slab_pool_t *pool, ecliptix_slab_pool_stats_t *out_stats) {
+    if (pool == nullptr || out_stats == nullptr) {
+        return;
+    }
+    pool->get_stats(*out_stats);
+}
+
+ecliptix_net_result_t ecliptix_grpc_frame_init(ecliptix_grpc_frame_t *frame, uint8_t compressed,
+                                               const ecliptix_grpc_segment_t *segments, size_t segment_count) {
+    if (frame == nullptr) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    return ecliptix::networking::frame_init(*frame, compressed, segments, segment_count);
+}
+
+size_t ecliptix_grpc_frame_iovecs(const ecliptix_grpc_frame_t *frame, struct iovec *out_iovecs, size_t capacity) {
+    if (frame == nullptr || out_iovecs == nullptr) {
+        return 0;
+    }
+    return ecliptix::networking::frame_iovecs(*frame, out_iovecs, capacity);
+}
+
+ecliptix_net_result_t ecliptix_grpc_frame_write(ecliptix_grpc_frame_t *frame, int fd) {
+    if (frame == nullptr || fd < 0) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    return ecliptix::networking::frame_write(*frame, fd);
+}
+
+ecliptix_grpc_deframer_t *ecliptix_grpc_deframer_create(ecliptix_slab_pool_t *pool, size_t max_message_size) {
+    if (pool == nullptr) {
+        return nullptr;
+    }
+    try {
+        return new ecliptix_grpc_deframer(
+            *pool, max_message_size != 0 ? max_message_size : GrpcDeframer::DEFAULT_MAX_MESSAGE_SIZE);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void ecliptix_grpc_deframer_destroy(ecliptix_grpc_deframer_t *deframer) {
+    delete deframer;
+}
+
+ecliptix_net_result_t ecliptix_grpc_deframer_feed(ecliptix_grpc_deframer_t *deframer, const uint8_t *data,
+                                                  size_t length) {
+    if (deframer == nullptr || (data == nullptr && length > 0)) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    try {
+        deframer->feed(data, length);
+        return ECLIPTIX_NET_SUCCESS;
+    } catch (const std::bad_alloc &) {
+        return ECLIPTIX_NET_ERROR_OUT_OF_MEMORY;
+    }
+}
+
+ecliptix_net_result_t ecliptix_grpc_deframer_read(ecliptix_grpc_deframer_t *deframer, int fd, size_t *out_read) {
+    if (deframer == nullptr || fd < 0 || out_read == nullptr) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    try {
+        return deframer->read(fd, *out_read);
+    } catch (const std::bad_alloc &) {
+        return ECLIPTIX_NET_ERROR_OUT_OF_MEMORY;
+    }
+}
+
+ecliptix_net_result_t ecliptix_grpc_deframer_next(ecliptix_grpc_deframer_t *deframer,
+                                                  ecliptix_grpc_message_t *out_message) {
+    if (deframer == nullptr || out_message == nullptr) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    return deframer->next(*out_message);
+}
+
+size_t ecliptix_grpc_deframer_buffered(const ecliptix_grpc_deframer_t *deframer) {
+    return deframer != nullptr ? deframer->buffered() : 0;
+}
+
+void ecliptix_grpc_message_retain(const ecliptix_grpc_message_t *message) {
+    if (message != nullptr && message->slab != nullptr) {
+        SlabPool::retain(static_cast<Slab *>(message->slab));
+    }
+}
+
+void ecliptix_grpc_message_release(ecliptix_grpc_message_t *message) {
+    if (message == nullptr || message->slab == nullptr) {
+        return;
+    }
+    SlabPool::release(static_cast<Slab *>(message->slab));
+    *message = ecliptix_grpc_message_t{};
+}
+
+}
@@ -0,0 +1,108 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "ecliptix_grpc_framing.h"
+
+namespace ecliptix::networking {
+
+    class SlabPool;
+
+    struct Slab {
+        std::atomic<uint32_t> refs;
+        const size_t capacity;
+        SlabPool *const pool;
+
+        [[nodiscard]] uint8_t *bytes() {
+            return reinterpret_cast<uint8_t *>(this + 1);
+        }
+    };
+
+    class SlabPool {
+    public:
+        static constexpr size_t DEFAULT_SLAB_SIZE = 64 * 1024;
+        static constexpr uint32_t DEFAULT_MAX_CACHED_SLABS = 32;
+
+        SlabPool(size_t slab_size, uint32_t max_cached_slabs);
+
+        virtual ~SlabPool();
+
+        SlabPool(const SlabPool &) = delete;
+
+        SlabPool &operator=(const SlabPool &) = delete;
+
+        [[nodiscard]] Slab *acquire(size_t min_capacity);
+
+        static void retain(Slab *slab);
+
+        static void release(Slab *slab);
+
+        void retain_pool();
+
+        void release_pool();
+
+        [[nodiscard]] size_t slab_size() const { return slab_size_; }
+
+        void get_stats(ecliptix_slab_pool_stats_t &stats) const;
+
+    private:
+        void recycle(Slab *slab);
+
+        static void free_slab(Slab *slab);
+
+        const size_t slab_size_;
+        const uint32_t max_cached_slabs_;
+        std::atomic<uint32_t> refs_{1};
+
+        mutable std::mutex mutex_;
+        std::vector<Slab *> cached_;
+
+        std::atomic<uint64_t> allocations_{0};
+        std::atomic<uint64_t> reuses_{0};
+        std::atomic<uint64_t> oversize_{0};
+        std::atomic<size_t> outstanding_{0};
+    };
+
+    class GrpcDeframer {
+    public:
+        static constexpr size_t DEFAULT_MAX_MESSAGE_SIZE = 4 * 1024 * 1024;
+
+        GrpcDeframer(SlabPool &pool, size_t max_message_size);
+
+        ~GrpcDeframer();
+
+        GrpcDeframer(const GrpcDeframer &) = delete;
+
+        GrpcDeframer &operator=(const GrpcDeframer &) = delete;
+
+        void feed(const uint8_t *data, size_t length);
+
+        [[nodiscard]] ecliptix_net_result_t read(int fd, size_t &bytes_read);
+
+        [[nodiscard]] ecliptix_net_result_t next(ecliptix_grpc_message_t &message);
+
+        [[nodiscard]] size_t buffered() const { return write_pos_ - read_pos_; }
+
+    private:
+        [[nodiscard]] size_t pending_frame_size() const;
+
+        void make_room();
+
+        SlabPool &pool_;
+        const size_t max_message_size_;
+        Slab *slab_ = nullptr;
+        size_t read_pos_ = 0;
+        size_t write_pos_ = 0;
+        bool failed_ = false;
+    };
+
+    [[nodiscard]] ecliptix_net_result_t frame_init(ecliptix_grpc_frame_t &frame, uint8_t compressed,
+                                                   const ecliptix_grpc_segment_t *segments, size_t segment_count);
+
+    [[nodiscard]] size_t frame_iovecs(const ecliptix_grpc_frame_t &frame, struct iovec *iovecs, size_t capacity);
+
+    [[nodiscard]] ecliptix_net_result_t frame_write(ecliptix_grpc_frame_t &frame, int fd);
+
+} // namespace ecliptix::networking
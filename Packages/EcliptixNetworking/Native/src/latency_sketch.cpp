@@ -0,0 +1,250 @@
+#include "latency_sketch.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <new>
+
+namespace ecliptix::networking {
+
+    namespace {
+        constexpr uint64_t EMPTY_EWMA = 0x7ff8000000000000ull;
+
+        uint32_t buckets_for(double gamma, uint64_t max_latency_us) {
+            return static_cast<uint32_t>(std::ceil(std::log(static_cast<double>(max_latency_us)) / std::log(gamma))) + 1;
+        }
+
+        void store_min(std::atomic<uint64_t> &target, uint64_t value) {
+            uint64_t current = target.load(std::memory_order_relaxed);
+            while (value < current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+            }
+        }
+
+        void store_max(std::atomic<uint64_t> &target, uint64_t value) {
+            uint64_t current = target.load(std::memory_order_relaxed);
+            while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+            }
+        }
+    }
+
+    LatencySketch::LatencySketch(double relative_accuracy, uint64_t max_latency_us, double ewma_weight)
+        : relative_accuracy_(relative_accuracy),
+          max_latency_us_(max_latency_us),
+          ewma_weight_(ewma_weight),
+          gamma_((1.0 + relative_accuracy) / (1.0 - relative_accuracy)),
+          inverse_log_gamma_(1.0 / std::log(gamma_)),
+          bucket_count_(buckets_for(gamma_, max_latency_us)),
+          buckets_(std::make_unique<std::atomic<uint64_t>[]>(bucket_count_)),
+          ewma_bits_(EMPTY_EWMA) {
+        for (uint32_t i = 0; i < bucket_count_; ++i) {
+            buckets_[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    LatencySketch::LatencySketch(const LatencySketch &other)
+        : LatencySketch(other.relative_accuracy_, other.max_latency_us_, other.ewma_weight_) {
+        (void) merge(other);
+    }
+
+    uint32_t LatencySketch::bucket_index(uint64_t latency_us) const {
+        if (latency_us <= 1) {
+            return 0;
+        }
+        const double clamped = static_cast<double>(std::min(latency_us, max_latency_us_));
+        const auto index = static_cast<uint32_t>(std::ceil(std::log(clamped) * inverse_log_gamma_));
+        return std::min(index, bucket_count_ - 1);
+    }
+
+    uint64_t LatencySketch::bucket_value(uint32_t index) const {
+        if (index == 0) {
+            return 1;
+        }
+        return static_cast<uint64_t>(std::llround(2.0 * std::pow(gamma_, index) / (gamma_ + 1.0)));
+    }
+
+    void LatencySketch::record(uint64_t latency_us) {
+        buckets_[bucket_index(latency_us)].fetch_add(1, std::memory_order_relaxed);
+        sum_us_.fetch_add(latency_us, std::memory_order_relaxed);
+        store_min(min_us_, latency_us);
+        store_max(max_us_, latency_us);
+
+        const double sample = static_cast<double>(latency_us);
+        uint64_t current = ewma_bits_.load(std::memory_order_relaxed);
+        while (true) {
+            const double previous = std::bit_cast<double>(current);
+            const double next = std::isnan(previous) ? sample : previous + ewma_weight_ * (sample - previous);
+            if (ewma_bits_.compare_exchange_weak(current, std::bit_cast<uint64_t>(next), std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        count_.fetch_add(1, std::memory_order_release);
+    }
+
+    void LatencySketch::reset() {
+        for (uint32_t i = 0; i < bucket_count_; ++i) {
+            buckets_[i].store(0, std::memory_order_relaxed);
+        }
+        sum_us_.store(0, std::memory_order_relaxed);
+        min_us_.store(UINT64_MAX, std::memory_order_relaxed);
+        max_us_.store(0, std::memory_order_relaxed);
+        ewma_bits_.store(EMPTY_EWMA, std::memory_order_relaxed);
+        count_.store(0, std::memory_order_release);
+    }
+
+    bool LatencySketch::merge(const LatencySketch &other) {
+        if (other.bucket_count_ != bucket_count_ || other.relative_accuracy_ != relative_accuracy_) {
+            return false;
+        }
+
+        const uint64_t other_count = other.count_.load(std::memory_order_acquire);
+        if (other_count == 0) {
+            return true;
+        }
+        for (uint32_t i = 0; i < bucket_count_; ++i) {
+            const uint64_t value = other.buckets_[i].load(std::memory_order_relaxed);
+            if (value != 0) {
+                buckets_[i].fetch_add(value, std::memory_order_relaxed);
+            }
+        }
+        sum_us_.fetch_add(other.sum_us_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        store_min(min_us_, other.min_us_.load(std::memory_order_relaxed));
+        store_max(max_us_, other.max_us_.load(std::memory_order_relaxed));
+
+        const double other_ewma = std::bit_cast<double>(other.ewma_bits_.load(std::memory_order_relaxed));
+        const uint64_t own_count = count_.load(std::memory_order_relaxed);
+        uint64_t current = ewma_bits_.load(std::memory_order_relaxed);
+        while (!std::isnan(other_ewma)) {
+            const double own = std::bit_cast<double>(current);
+            const double next = std::isnan(own)
+                                    ? other_ewma
+                                    : (own * static_cast<double>(own_count) + other_ewma * static_cast<double>(other_count)) /
+                                      static_cast<double>(own_count + other_count);
+            if (ewma_bits_.compare_exchange_weak(current, std::bit_cast<uint64_t>(next), std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        count_.fetch_add(other_count, std::memory_order_release);
+        return true;
+    }
+
+    uint64_t LatencySketch::quantile_at(double q, uint64_t count) const {
+        const auto rank = static_cast<uint64_t>(q * static_cast<double>(count - 1));
+        uint64_t seen = 0;
+        uint32_t index = bucket_count_ - 1;
+        for (uint32_t i = 0; i < bucket_count_; ++i) {
+            seen += buckets_[i].load(std::memory_order_relaxed);
+            if (seen > rank) {
+                index = i;
+                break;
+            }
+        }
+        const uint64_t low = min_us_.load(std::memory_order_relaxed);
+        const uint64_t high = max_us_.load(std::memory_order_relaxed);
+        return std::clamp(bucket_value(index), std::min(low, high), high);
+    }
+
+    bool LatencySketch::quantile(double q, uint64_t &out_latency_us) const {
+        const uint64_t count = count_.load(std::memory_order_acquire);
+        if (count == 0 || !(q >= 0.0 && q <= 1.0)) {
+            return false;
+        }
+        out_latency_us = quantile_at(q, count);
+        return true;
+    }
+
+    void LatencySketch::get_summary(ecliptix_latency_summary_t &summary) const {
+        summary = {};
+        const uint64_t count = count_.load(std::memory_order_acquire);
+        if (count == 0) {
+            return;
+        }
+        summary.count = count;
+        summary.min_us = min_us_.load(std::memory_order_relaxed);
+        summary.max_us = max_us_.load(std::memory_order_relaxed);
+        summary.p50_us = quantile_at(0.50, count);
+        summary.p95_us = quantile_at(0.95, count);
+        summary.p99_us = quantile_at(0.99, count);
+        summary.mean_us = static_cast<double>(sum_us_.load(std::memory_order_relaxed)) / static_cast<double>(count);
+        summary.ewma_us = std::bit_cast<double>(ewma_bits_.load(std::memory_order_relaxed));
+    }
+
+} // namespace ecliptix::networking
+
+struct ecliptix_latency_sketch : ecliptix::networking::LatencySketch {
+    using LatencySketch::LatencySketch;
+};
+
+using ecliptix::networking::LatencySketch;
+
+extern "C" {
+
+ecliptix_latency_sketch_t *ecliptix_latency_sketch_create(const ecliptix_latency_sketch_config_t *config) {
+    const ecliptix_latency_sketch_config_t effective = config != nullptr ? *config : ecliptix_latency_sketch_config_t{};
+    const double accuracy = effective.relative_accuracy != 0 ? effective.relative_accuracy
+                                                             : LatencySketch::DEFAULT_RELATIVE_ACCURACY;
+    const double weight = effective.ewma_weight != 0 ? effective.ewma_weight : LatencySketch::DEFAULT_EWMA_WEIGHT;
+    const uint64_t max_latency = effective.max_latency_us != 0 ? effective.max_latency_us
+                                                               : LatencySketch::DEFAULT_MAX_LATENCY_US;
+    if (!(accuracy > 0.0 && accuracy < 0.5) || !(weight > 0.0 && weight <= 1.0) || max_latency < 2) {
+        return nullptr;
+    }
+    try {
+        return new ecliptix_latency_sketch(accuracy, max_latency, weight);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void ecliptix_latency_sketch_destroy(ecliptix_latency_sketch_t *sketch) {
+    delete sketch;
+}
+
+void ecliptix_latency_sketch_record(ecliptix_latency_sketch_t *sketch, uint64_t latency_us) {
+    if (sketch != nullptr) {
+        sketch->record(latency_us);
+    }
+}
+
+void ecliptix_latency_sketch_reset(ecliptix_latency_sketch_t *sketch) {
+    if (sketch != nullptr) {
+        sketch->reset();
+    }
+}
+
+ecliptix_latency_sketch_t *ecliptix_latency_sketch_snapshot(const ecliptix_latency_sketch_t *sketch) {
+    if (sketch == nullptr) {
+        return nullptr;
+    }
+    try {
+        return new ecliptix_latency_sketch(*sketch);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+ecliptix_net_result_t ecliptix_latency_sketch_merge(ecliptix_latency_sketch_t *target,
+                                                    const ecliptix_latency_sketch_t *source) {
+    if (target == nullptr || source == nullptr || target == source) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    return target->merge(*source) ? ECLIPTIX_NET_SUCCESS : ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+}
+
+ecliptix_net_result_t ecliptix_latency_sketch_quantile(const ecliptix_latency_sketch_t *sketch, double quantile,
+                                                       uint64_t *out_latency_us) {
+    if (sketch == nullptr || out_latency_us == nullptr) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    return sketch->quantile(quantile, *out_latency_us) ? ECLIPTIX_NET_SUCCESS : ECLIPTIX_NET_ERROR_NOT_FOUND;
+}
+
+void ecliptix_latency_sketch_get_summary(const ecliptix_latency_sketch_t *sketch,
+                                         ecliptix_latency_summary_t *out_summary) {
+    if (sketch == nullptr || out_summary == nullptr) {
+        return;
+    }
+    sketch->get_summary(*out_summary);
+}
+
+}
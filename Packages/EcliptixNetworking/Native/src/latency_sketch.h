@@ -0,0 +1,54 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "ecliptix_latency_sketch.h"
+
+namespace ecliptix::networking {
+
+    class LatencySketch {
+    public:
+        static constexpr double DEFAULT_RELATIVE_ACCURACY = 0.01;
+        static constexpr uint64_t DEFAULT_MAX_LATENCY_US = 3'600'000'000ull;
+        static constexpr double DEFAULT_EWMA_WEIGHT = 0.1;
+
+        LatencySketch(double relative_accuracy, uint64_t max_latency_us, double ewma_weight);
+
+        LatencySketch(const LatencySketch &other);
+
+        LatencySketch &operator=(const LatencySketch &) = delete;
+
+        void record(uint64_t latency_us);
+
+        void reset();
+
+        [[nodiscard]] bool merge(const LatencySketch &other);
+
+        [[nodiscard]] bool quantile(double q, uint64_t &out_latency_us) const;
+
+        void get_summary(ecliptix_latency_summary_t &summary) const;
+
+    private:
+        [[nodiscard]] uint32_t bucket_index(uint64_t latency_us) const;
+
+        [[nodiscard]] uint64_t bucket_value(uint32_t index) const;
+
+        [[nodiscard]] uint64_t quantile_at(double q, uint64_t count) const;
+
+        const double relative_accuracy_;
+        const uint64_t max_latency_us_;
+        const double ewma_weight_;
+        const double gamma_;
+        const double inverse_log_gamma_;
+        const uint32_t bucket_count_;
+        std::unique_ptr<std::atomic<uint64_t>[]> buckets_;
+
+        std::atomic<uint64_t> count_{0};
+        std::atomic<uint64_t> sum_us_{0};
+        std::atomic<uint64_t> min_us_{UINT64_MAX};
+        std::atomic<uint64_t> max_us_{0};
+        std::atomic<uint64_t> ewma_bits_;
+    };
+
+} // namespace ecliptix::networking
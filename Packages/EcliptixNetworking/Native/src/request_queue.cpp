@@ -0,0 +1,415 @@
+#include "request_queue.h"
+
+#include <algorithm>
+#include <cmath>
+#include <new>
+
+namespace ecliptix::networking {
+
+    namespace {
+        constexpr uint32_t ARITY = 4;
+        constexpr uint64_t NO_DEADLINE = UINT64_MAX;
+        constexpr unsigned GENERATION_SHIFT = 32;
+        constexpr uint64_t INDEX_MASK = (uint64_t{1} << GENERATION_SHIFT) - 1;
+    }
+
+    RequestQueue::RequestQueue(uint32_t capacity, uint32_t max_in_flight, double refill_per_second, uint32_t burst)
+        : capacity_(capacity),
+          max_in_flight_(max_in_flight),
+          refill_per_ms_(refill_per_second / 1000.0),
+          burst_(static_cast<double>(burst)),
+          epoch_(std::chrono::steady_clock::now()),
+          tokens_(static_cast<double>(burst)) {
+        heaps_[DISPATCH].reserve(capacity);
+        heaps_[EVICTION].reserve(capacity);
+    }
+
+    uint64_t RequestQueue::now_ms() const {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - epoch_).count());
+    }
+
+    uint64_t RequestQueue::handle_of(uint32_t index) const {
+        return (static_cast<uint64_t>(slots_[index].generation) << GENERATION_SHIFT) | index;
+    }
+
+    RequestQueue::Slot *RequestQueue::resolve(uint64_t handle, SlotState expected) {
+        const uint64_t index = handle & INDEX_MASK;
+        if (index >= slots_.size()) {
+            return nullptr;
+        }
+        Slot &slot = slots_[index];
+        if (slot.state != expected || slot.generation != static_cast<uint32_t>(handle >> GENERATION_SHIFT)) {
+            return nullptr;
+        }
+        return &slot;
+    }
+
+    bool RequestQueue::ranks_before(Heap heap, uint32_t a, uint32_t b) const {
+        const Slot &left = slots_[a];
+        const Slot &right = slots_[b];
+        if (left.priority != right.priority) {
+            return heap == DISPATCH ? left.priority > right.priority : left.priority < right.priority;
+        }
+        if (left.deadline_ms != right.deadline_ms) {
+            return left.deadline_ms < right.deadline_ms;
+        }
+        return left.sequence < right.sequence;
+    }
+
+    void RequestQueue::place(Heap heap, uint32_t position, uint32_t index) {
+        heaps_[heap][position] = index;
+        slots_[index].heap_position[heap] = position;
+    }
+
+    void RequestQueue::sift_up(Heap heap, uint32_t position) {
+        const uint32_t index = heaps_[heap][position];
+        while (position > 0) {
+            const uint32_t parent = (position - 1) / ARITY;
+            if (!ranks_before(heap, index, heaps_[heap][parent])) {
+                break;
+            }
+            place(heap, position, heaps_[heap][parent]);
+            position = parent;
+        }
+        place(heap, position, index);
+    }
+
+    void RequestQueue::sift_down(Heap heap, uint32_t position) {
+        std::vector<uint32_t> &entries = heaps_[heap];
+        const uint32_t size = static_cast<uint32_t>(entries.size());
+        const uint32_t index = entries[position];
+        for (;;) {
+            const uint32_t first_child = position * ARITY + 1;
+            if (first_child >= size) {
+                break;
+            }
+            uint32_t best = first_child;
+            const uint32_t last_child = std::min(first_child + ARITY, size);
+            for (uint32_t child = first_child + 1; child < last_child; ++child) {
+                if (ranks_before(heap, entries[child], entries[best])) {
+                    best = child;
+                }
+            }
+            if (!ranks_before(heap, entries[best], index)) {
+                break;
+            }
+            place(heap, position, entries[best]);
+            position = best;
+        }
+        place(heap, position, index);
+    }
+
+    void RequestQueue::heap_push(Heap heap, uint32_t index) {
+        heaps_[heap].push_back(index);
+        sift_up(heap, static_cast<uint32_t>(heaps_[heap].size() - 1));
+    }
+
+    void RequestQueue::heap_remove(Heap heap, uint32_t index) {
+        std::vector<uint32_t> &entries = heaps_[heap];
+        const uint32_t position = slots_[index].heap_position[heap];
+        const uint32_t last = entries.back();
+        entries.pop_back();
+        if (last == index) {
+            return;
+        }
+        place(heap, position, last);
+        sift_up(heap, position);
+        sift_down(heap, slots_[last].heap_position[heap]);
+    }
+
+    void RequestQueue::unlink(uint32_t index) {
+        heap_remove(DISPATCH, index);
+        heap_remove(EVICTION, index);
+    }
+
+    void RequestQueue::release(uint32_t index) {
+        Slot &slot = slots_[index];
+        slot.state = SlotState::FREE;
+        if (++slot.generation == 0) {
+            slot.generation = 1;
+        }
+        free_slots_.push_back(index);
+    }
+
+    void RequestQueue::refill(uint64_t now) {
+        if (now > last_refill_ms_) {
+            tokens_ = std::min(burst_, tokens_ + static_cast<double>(now - last_refill_ms_) * refill_per_ms_);
+            last_refill_ms_ = now;
+        }
+    }
+
+    ecliptix_net_result_t RequestQueue::enqueue(uint8_t priority, uint64_t ttl_ms, uint64_t &handle,
+                                                uint64_t &evicted) {
+        std::lock_guard lock(mutex_);
+        const uint64_t now = now_ms();
+        const uint64_t deadline = ttl_ms == 0 || ttl_ms > NO_DEADLINE - 1 - now ? NO_DEADLINE : now + ttl_ms;
+        evicted = 0;
+
+        if (heaps_[DISPATCH].size() >= capacity_) {
+            const uint32_t worst = heaps_[EVICTION].front();
+            if (priority < slots_[worst].priority) {
+                return ECLIPTIX_NET_ERROR_CAPACITY;
+            }
+            evicted = handle_of(worst);
+            unlink(worst);
+            release(worst);
+            ++evicted_;
+        }
+
+        if (free_slots_.empty()) {
+            if (slots_.size() > INDEX_MASK) {
+                return ECLIPTIX_NET_ERROR_CAPACITY;
+            }
+            slots_.emplace_back();
+            slots_.back().generation = 1;
+            // release() must never allocate, so the free list always has room for every slot.
+            free_slots_.reserve(slots_.capacity());
+            free_slots_.push_back(static_cast<uint32_t>(slots_.size() - 1));
+        }
+
+        const uint32_t index = free_slots_.back();
+        free_slots_.pop_back();
+        Slot &slot = slots_[index];
+        slot.deadline_ms = deadline;
+        slot.sequence = next_sequence_++;
+        slot.priority = priority;
+        slot.state = SlotState::QUEUED;
+        heap_push(DISPATCH, index);
+        heap_push(EVICTION, index);
+
+        handle = handle_of(index);
+        ++enqueued_;
+        return ECLIPTIX_NET_SUCCESS;
+    }
+
+    bool RequestQueue::cancel(uint64_t handle) {
+        std::lock_guard lock(mutex_);
+        const Slot *slot = resolve(handle, SlotState::QUEUED);
+        if (slot == nullptr) {
+            return false;
+        }
+        const auto index = static_cast<uint32_t>(handle & INDEX_MASK);
+        unlink(index);
+        release(index);
+        ++cancelled_;
+        return true;
+    }
+
+    ecliptix_request_dispatch_t RequestQueue::next(uint64_t &handle, uint64_t &wait_ms) {
+        std::lock_guard lock(mutex_);
+        if (heaps_[DISPATCH].empty()) {
+            return ECLIPTIX_REQUEST_EMPTY;
+        }
+
+        const uint64_t now = now_ms();
+        const uint32_t top = heaps_[DISPATCH].front();
+        if (slots_[top].deadline_ms <= now) {
+            handle = handle_of(top);
+            unlink(top);
+            release(top);
+            ++expired_;
+            return ECLIPTIX_REQUEST_EXPIRED;
+        }
+
+        if (in_flight_ >= max_in_flight_) {
+            return ECLIPTIX_REQUEST_SATURATED;
+        }
+
+        refill(now);
+        if (tokens_ < 1.0) {
+            wait_ms = static_cast<uint64_t>(std::ceil((1.0 - tokens_) / refill_per_ms_));
+            ++throttled_;
+            return ECLIPTIX_REQUEST_THROTTLED;
+        }
+        tokens_ -= 1.0;
+
+        handle = handle_of(top);
+        unlink(top);
+        slots_[top].state = SlotState::IN_FLIGHT;
+        ++in_flight_;
+        ++dispatched_;
+        return ECLIPTIX_REQUEST_READY;
+    }
+
+    bool RequestQueue::complete(uint64_t handle) {
+        std::lock_guard lock(mutex_);
+        if (resolve(handle, SlotState::IN_FLIGHT) == nullptr) {
+            return false;
+        }
+        release(static_cast<uint32_t>(handle & INDEX_MASK));
+        --in_flight_;
+        ++completed_;
+        return true;
+    }
+
+    size_t RequestQueue::purge_expired(ecliptix_request_handle_sink_t sink, void *context) {
+        std::vector<uint64_t> purged;
+        {
+            std::lock_guard lock(mutex_);
+            const uint64_t now = now_ms();
+            std::vector<uint32_t> &dispatch = heaps_[DISPATCH];
+            const auto live_end = std::partition(dispatch.begin(), dispatch.end(), [&](uint32_t index) {
+                return slots_[index].deadline_ms > now;
+            });
+            if (live_end == dispatch.end()) {
+                return 0;
+            }
+            purged.reserve(static_cast<size_t>(dispatch.end() - live_end));
+            for (auto it = live_end; it != dispatch.end(); ++it) {
+                purged.push_back(handle_of(*it));
+                release(*it);
+            }
+            dispatch.erase(live_end, dispatch.end());
+            heaps_[EVICTION].assign(dispatch.begin(), dispatch.end());
+            for (const Heap heap : {DISPATCH, EVICTION}) {
+                const auto size = static_cast<uint32_t>(heaps_[heap].size());
+                for (uint32_t position = 0; position < size; ++position) {
+                    slots_[heaps_[heap][position]].heap_position[heap] = position;
+                }
+                for (uint32_t position = size / ARITY + 1; position-- > 0;) {
+                    if (position < size) {
+                        sift_down(heap, position);
+                    }
+                }
+            }
+            expired_ += purged.size();
+        }
+        if (sink != nullptr) {
+            for (const uint64_t handle : purged) {
+                sink(handle, context);
+            }
+        }
+        return purged.size();
+    }
+
+    void RequestQueue::clear() {
+        std::lock_guard lock(mutex_);
+        for (const uint32_t index : heaps_[DISPATCH]) {
+            release(index);
+        }
+        cancelled_ += heaps_[DISPATCH].size();
+        heaps_[DISPATCH].clear();
+        heaps_[EVICTION].clear();
+    }
+
+    void RequestQueue::get_stats(ecliptix_request_queue_stats_t &stats) const {
+        std::lock_guard lock(mutex_);
+        stats.queued = heaps_[DISPATCH].size();
+        stats.in_flight = in_flight_;
+        stats.enqueued = enqueued_;
+        stats.dispatched = dispatched_;
+        stats.completed = completed_;
+        stats.cancelled = cancelled_;
+        stats.evicted = evicted_;
+        stats.expired = expired_;
+        stats.throttled = throttled_;
+    }
+
+} // namespace ecliptix::networking
+
+struct ecliptix_request_queue : ecliptix::networking::RequestQueue {
+    using RequestQueue::RequestQueue;
+};
+
+using ecliptix::networking::RequestQueue;
+
+extern "C" {
+
+ecliptix_request_queue_t *ecliptix_request_queue_create(const ecliptix_request_queue_config_t *config) {
+    const ecliptix_request_queue_config_t effective = config != nullptr ? *config : ecliptix_request_queue_config_t{};
+    const uint32_t capacity = effective.capacity != 0 ? effective.capacity : RequestQueue::DEFAULT_CAPACITY;
+    const uint32_t max_in_flight = effective.max_in_flight != 0 ? effective.max_in_flight
+                                                                : RequestQueue::DEFAULT_MAX_IN_FLIGHT;
+    const double rate = effective.refill_per_second != 0 ? effective.refill_per_second
+                                                         : RequestQueue::DEFAULT_REFILL_PER_SECOND;
+    const uint32_t burst = effective.burst != 0 ? effective.burst : max_in_flight;
+    if (capacity > RequestQueue::MAX_CAPACITY || !(rate > 0.0) || !std::isfinite(rate)) {
+        return nullptr;
+    }
+    try {
+        return new ecliptix_request_queue(capacity, max_in_flight, rate, burst);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void ecliptix_request_queue_destroy(ecliptix_request_queue_t *queue) {
+    delete queue;
+}
+
+ecliptix_net_result_t ecliptix_request_queue_enqueue(ecliptix_request_queue_t *queue, uint8_t priority,
+                                                     uint64_t ttl_ms, ecliptix_request_handle_t *out_handle,
+                                                     ecliptix_request_handle_t *out_evicted) {
+    if (queue == nullptr || out_handle == nullptr) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    try {
+        uint64_t evicted = 0;
+        const ecliptix_net_result_t result = queue->enqueue(priority, ttl_ms, *out_handle, evicted);
+        if (out_evicted != nullptr) {
+            *out_evicted = evicted;
+        }
+        return result;
+    } catch (const std::bad_alloc &) {
+        return ECLIPTIX_NET_ERROR_OUT_OF_MEMORY;
+    }
+}
+
+ecliptix_net_result_t ecliptix_request_queue_cancel(ecliptix_request_queue_t *queue,
+                                                    ecliptix_request_handle_t handle) {
+    if (queue == nullptr) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    return queue->cancel(handle) ? ECLIPTIX_NET_SUCCESS : ECLIPTIX_NET_ERROR_NOT_FOUND;
+}
+
+ecliptix_request_dispatch_t ecliptix_request_queue_next(ecliptix_request_queue_t *queue,
+                                                        ecliptix_request_handle_t *out_handle,
+                                                        uint64_t *out_wait_ms) {
+    if (queue == nullptr || out_handle == nullptr) {
+        return ECLIPTIX_REQUEST_EMPTY;
+    }
+    uint64_t wait_ms = 0;
+    const ecliptix_request_dispatch_t dispatch = queue->next(*out_handle, wait_ms);
+    if (out_wait_ms != nullptr) {
+        *out_wait_ms = wait_ms;
+    }
+    return dispatch;
+}
+
+ecliptix_net_result_t ecliptix_request_queue_complete(ecliptix_request_queue_t *queue,
+                                                      ecliptix_request_handle_t handle) {
+    if (queue == nullptr) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    return queue->complete(handle) ? ECLIPTIX_NET_SUCCESS : ECLIPTIX_NET_ERROR_NOT_FOUND;
+}
+
+size_t ecliptix_request_queue_purge_expired(ecliptix_request_queue_t *queue, ecliptix_request_handle_sink_t sink,
+                                            void *context) {
+    if (queue == nullptr) {
+        return 0;
+    }
+    try {
+        return queue->purge_expired(sink, context);
+    } catch (const std::bad_alloc &) {
+        return 0;
+    }
+}
+
+void ecliptix_request_queue_clear(ecliptix_request_queue_t *queue) {
+    if (queue != nullptr) {
+        queue->clear();
+    }
+}
+
+void ecliptix_request_queue_get_stats(const ecliptix_request_queue_t *queue,
+                                      ecliptix_request_queue_stats_t *out_stats) {
+    if (queue == nullptr || out_stats == nullptr) {
+        return;
+    }
+    queue->get_stats(*out_stats);
+}
+
+}
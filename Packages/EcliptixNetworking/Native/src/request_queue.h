@@ -0,0 +1,101 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "ecliptix_request_queue.h"
+
+namespace ecliptix::networking {
+
+    class RequestQueue {
+    public:
+        static constexpr uint32_t DEFAULT_CAPACITY = 100;
+        static constexpr uint32_t DEFAULT_MAX_IN_FLIGHT = 4;
+        static constexpr double DEFAULT_REFILL_PER_SECOND = 10.0;
+        static constexpr uint32_t MAX_CAPACITY = 1u << 20;
+
+        RequestQueue(uint32_t capacity, uint32_t max_in_flight, double refill_per_second, uint32_t burst);
+
+        RequestQueue(const RequestQueue &) = delete;
+
+        RequestQueue &operator=(const RequestQueue &) = delete;
+
+        [[nodiscard]] ecliptix_net_result_t enqueue(uint8_t priority, uint64_t ttl_ms, uint64_t &handle,
+                                                    uint64_t &evicted);
+
+        [[nodiscard]] bool cancel(uint64_t handle);
+
+        [[nodiscard]] ecliptix_request_dispatch_t next(uint64_t &handle, uint64_t &wait_ms);
+
+        [[nodiscard]] bool complete(uint64_t handle);
+
+        size_t purge_expired(ecliptix_request_handle_sink_t sink, void *context);
+
+        void clear();
+
+        void get_stats(ecliptix_request_queue_stats_t &stats) const;
+
+    private:
+        enum class SlotState : uint8_t { FREE, QUEUED, IN_FLIGHT };
+
+        enum Heap : size_t { DISPATCH = 0, EVICTION = 1 };
+
+        struct Slot {
+            uint64_t deadline_ms = 0;
+            uint64_t sequence = 0;
+            uint32_t generation = 0;
+            uint32_t heap_position[2] = {0, 0};
+            uint8_t priority = 0;
+            SlotState state = SlotState::FREE;
+        };
+
+        [[nodiscard]] uint64_t now_ms() const;
+
+        [[nodiscard]] Slot *resolve(uint64_t handle, SlotState expected);
+
+        [[nodiscard]] uint64_t handle_of(uint32_t index) const;
+
+        [[nodiscard]] bool ranks_before(Heap heap, uint32_t a, uint32_t b) const;
+
+        void heap_push(Heap heap, uint32_t index);
+
+        void heap_remove(Heap heap, uint32_t index);
+
+        void sift_up(Heap heap, uint32_t position);
+
+        void sift_down(Heap heap, uint32_t position);
+
+        void place(Heap heap, uint32_t position, uint32_t index);
+
+        void unlink(uint32_t index);
+
+        void release(uint32_t index);
+
+        void refill(uint64_t now);
+
+        const uint32_t capacity_;
+        const uint32_t max_in_flight_;
+        const double refill_per_ms_;
+        const double burst_;
+        const std::chrono::steady_clock::time_point epoch_;
+
+        mutable std::mutex mutex_;
+        std::vector<Slot> slots_;
+        std::vector<uint32_t> free_slots_;
+        std::vector<uint32_t> heaps_[2];
+        uint64_t next_sequence_ = 0;
+        uint32_t in_flight_ = 0;
+        double tokens_;
+        uint64_t last_refill_ms_ = 0;
+
+        uint64_t enqueued_ = 0;
+        uint64_t dispatched_ = 0;
+        uint64_t completed_ = 0;
+        uint64_t cancelled_ = 0;
+        uint64_t evicted_ = 0;
+        uint64_t expired_ = 0;
+        uint64_t throttled_ = 0;
+    };
+
+} // namespace ecliptix::networking
@@ -0,0 +1,466 @@
+#include "response_cache.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace ecliptix::networking {
+
+    namespace {
+        constexpr uint64_t FNV_OFFSET = 0xcbf29ce484222325ull;
+        constexpr uint64_t FNV_PRIME = 0x100000001b3ull;
+        constexpr uint64_t NEVER_EXPIRES = UINT64_MAX;
+        constexpr uint32_t MAX_SHARD_COUNT = 1024;
+
+        uint32_t normalize_shards(uint32_t requested) {
+            const uint32_t count = requested == 0 ? ResponseCache::DEFAULT_SHARD_COUNT : requested;
+            return std::bit_ceil(std::min(count, MAX_SHARD_COUNT));
+        }
+
+        uint64_t charge_of(std::string_view key, size_t value_len, std::string_view etag,
+                           std::string_view packed_tags) {
+            return key.size() + value_len + etag.size() + packed_tags.size() + 128;
+        }
+    }
+
+    uint64_t hash_key(std::string_view key) noexcept {
+        uint64_t hash = FNV_OFFSET;
+        for (const char c: key) {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= FNV_PRIME;
+        }
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdull;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    void ResponseCache::LruList::push_front(Entry *entry) {
+        entry->prev = nullptr;
+        entry->next = head;
+        if (head != nullptr) {
+            head->prev = entry;
+        } else {
+            tail = entry;
+        }
+        head = entry;
+        bytes += entry->charge;
+    }
+
+    void ResponseCache::LruList::remove(Entry *entry) {
+        if (entry->prev != nullptr) {
+            entry->prev->next = entry->next;
+        } else {
+            head = entry->next;
+        }
+        if (entry->next != nullptr) {
+            entry->next->prev = entry->prev;
+        } else {
+            tail = entry->prev;
+        }
+        entry->prev = entry->next = nullptr;
+        bytes -= entry->charge;
+    }
+
+    ResponseCache::ResponseCache(const ecliptix_response_cache_config_t &config)
+        : epoch_(std::chrono::steady_clock::now()),
+          max_entry_bytes_(config.max_entry_bytes != 0 ? config.max_entry_bytes : DEFAULT_MAX_ENTRY_BYTES),
+          shard_mask_(normalize_shards(config.shard_count) - 1),
+          shard_budget_((config.max_total_bytes != 0 ? config.max_total_bytes : DEFAULT_MAX_TOTAL_BYTES) /
+                        (shard_mask_ + 1)),
+          protected_budget_(shard_budget_ *
+                            std::min<uint32_t>(config.protected_percent != 0
+                                                   ? config.protected_percent
+                                                   : DEFAULT_PROTECTED_PERCENT, 100) / 100),
+          delimiter_(config.prefix_delimiter),
+          shards_(std::make_unique<Shard[]>(shard_mask_ + 1)) {
+    }
+
+    ResponseCache::Shard &ResponseCache::shard_for(uint64_t hash) const {
+        return shards_[hash & shard_mask_];
+    }
+
+    uint64_t ResponseCache::now_ms() const {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - epoch_).count());
+    }
+
+    bool ResponseCache::get(std::string_view key, ecliptix_cache_value_sink_fn sink, void *context) {
+        const uint64_t hash = hash_key(key);
+        Shard &shard = shard_for(hash);
+        std::lock_guard lock(shard.mutex);
+
+        const auto it = shard.entries.find(KeyRef{hash, key});
+        if (it == shard.entries.end()) {
+            misses_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        Entry *entry = it->second.get();
+        const uint64_t now = now_ms();
+        if (now >= entry->expires_ms) {
+            remove_locked(shard, entry);
+            expirations_.fetch_add(1, std::memory_order_relaxed);
+            misses_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        promote_locked(shard, entry);
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        if (sink != nullptr) {
+            sink(entry->value.data(), entry->value.size(),
+                 reinterpret_cast<const uint8_t *>(entry->etag.data()), entry->etag.size(),
+                 now - entry->cached_ms, context);
+        }
+        return true;
+    }
+
+    ecliptix_net_result_t ResponseCache::put(std::string_view key, std::span<const uint8_t> value,
+                                             std::string_view etag, uint64_t ttl_ms,
+                                             std::string_view packed_tags) {
+        const uint64_t charge = charge_of(key, value.size(), etag, packed_tags);
+        if (value.size() > max_entry_bytes_ || charge > shard_budget_) {
+            rejected_.fetch_add(1, std::memory_order_relaxed);
+            return ECLIPTIX_NET_ERROR_CAPACITY;
+        }
+
+        auto entry = std::make_unique<Entry>();
+        entry->key.assign(key);
+        entry->hash = hash_key(key);
+        entry->value.assign(value.begin(), value.end());
+        entry->etag.assign(etag);
+        for (size_t start = 0; start < packed_tags.size();) {
+            size_t end = packed_tags.find('\0', start);
+            if (end == std::string_view::npos) {
+                end = packed_tags.size();
+            }
+            if (end > start) {
+                entry->tags.emplace_back(packed_tags.substr(start, end - start));
+            }
+            start = end + 1;
+        }
+        entry->charge = charge;
+
+        Shard &shard = shard_for(entry->hash);
+        std::lock_guard lock(shard.mutex);
+
+        if (const auto it = shard.entries.find(KeyRef{entry->hash, key}); it != shard.entries.end()) {
+            remove_locked(shard, it->second.get());
+        }
+
+        const uint64_t now = now_ms();
+        entry->cached_ms = now;
+        entry->expires_ms = ttl_ms == 0 || ttl_ms > NEVER_EXPIRES - now ? NEVER_EXPIRES : now + ttl_ms;
+
+        Entry *raw = entry.get();
+        shard.entries.emplace(KeyRef{raw->hash, raw->key}, std::move(entry));
+        index_locked(shard, raw);
+        evict_locked(shard);
+        return ECLIPTIX_NET_SUCCESS;
+    }
+
+    void ResponseCache::index_locked(Shard &shard, Entry *entry) {
+        entry->segment = Segment::Probation;
+        shard.probation.push_front(entry);
+        entry->expiry = shard.expiry_index.emplace(entry->expires_ms, entry);
+        if (delimiter_ != '\0') {
+            for (size_t pos = entry->key.find(delimiter_); pos != std::string::npos;
+                 pos = entry->key.find(delimiter_, pos + 1)) {
+                shard.prefix_index[entry->key.substr(0, pos + 1)].insert(entry);
+            }
+        }
+        for (const auto &tag: entry->tags) {
+            shard.tag_index[tag].insert(entry);
+        }
+    }
+
+    void ResponseCache::remove_locked(Shard &shard, Entry *entry) {
+        (entry->segment == Segment::Protected ? shard.protected_segment : shard.probation).remove(entry);
+        shard.expiry_index.erase(entry->expiry);
+        if (delimiter_ != '\0') {
+            for (size_t pos = entry->key.find(delimiter_); pos != std::string::npos;
+                 pos = entry->key.find(delimiter_, pos + 1)) {
+                const auto it = shard.prefix_index.find(entry->key.substr(0, pos + 1));
+                if (it != shard.prefix_index.end() && it->second.erase(entry) != 0 && it->second.empty()) {
+                    shard.prefix_index.erase(it);
+                }
+            }
+        }
+        for (const auto &tag: entry->tags) {
+            const auto it = shard.tag_index.find(tag);
+            if (it != shard.tag_index.end() && it->second.erase(entry) != 0 && it->second.empty()) {
+                shard.tag_index.erase(it);
+            }
+        }
+        shard.entries.erase(shard.entries.find(KeyRef{entry->hash, entry->key}));
+    }
+
+    void ResponseCache::promote_locked(Shard &shard, Entry *entry) {
+        if (entry->segment == Segment::Protected) {
+            shard.protected_segment.remove(entry);
+            shard.protected_segment.push_front(entry);
+            return;
+        }
+
+        shard.probation.remove(entry);
+        entry->segment = Segment::Protected;
+        shard.protected_segment.push_front(entry);
+
+        while (shard.protected_segment.bytes > protected_budget_ && shard.protected_segment.tail != entry) {
+            Entry *demoted = shard.protected_segment.tail;
+            shard.protected_segment.remove(demoted);
+            demoted->segment = Segment::Probation;
+            shard.probation.push_front(demoted);
+        }
+    }
+
+    void ResponseCache::evict_locked(Shard &shard) {
+        while (shard.probation.bytes + shard.protected_segment.bytes > shard_budget_) {
+            Entry *victim = shard.probation.tail != nullptr ? shard.probation.tail : shard.protected_segment.tail;
+            if (victim == nullptr) {
+                return;
+            }
+            remove_locked(shard, victim);
+            evictions_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    bool ResponseCache::invalidate(std::string_view key) {
+        const uint64_t hash = hash_key(key);
+        Shard &shard = shard_for(hash);
+        std::lock_guard lock(shard.mutex);
+
+        const auto it = shard.entries.find(KeyRef{hash, key});
+        if (it == shard.entries.end()) {
+            return false;
+        }
+        remove_locked(shard, it->second.get());
+        return true;
+    }
+
+    size_t ResponseCache::invalidate_indexed(std::string_view name, bool by_tag) {
+        const std::string lookup(name);
+        std::vector<Entry *> victims;
+        size_t removed = 0;
+        for (uint32_t i = 0; i <= shard_mask_; ++i) {
+            Shard &shard = shards_[i];
+            std::lock_guard lock(shard.mutex);
+
+            auto &index = by_tag ? shard.tag_index : shard.prefix_index;
+            const auto it = index.find(lookup);
+            if (it == index.end()) {
+                continue;
+            }
+            victims.assign(it->second.begin(), it->second.end());
+            for (Entry *entry: victims) {
+                remove_locked(shard, entry);
+            }
+            removed += victims.size();
+        }
+        return removed;
+    }
+
+    template<typename Predicate>
+    size_t ResponseCache::remove_if(Predicate predicate) {
+        std::vector<Entry *> victims;
+        size_t removed = 0;
+        for (uint32_t i = 0; i <= shard_mask_; ++i) {
+            Shard &shard = shards_[i];
+            std::lock_guard lock(shard.mutex);
+
+            victims.clear();
+            for (const auto &[ref, entry]: shard.entries) {
+                if (predicate(*entry)) {
+                    victims.push_back(entry.get());
+                }
+            }
+            for (Entry *entry: victims) {
+                remove_locked(shard, entry);
+            }
+            removed += victims.size();
+        }
+        return removed;
+    }
+
+    size_t ResponseCache::invalidate_prefix(std::string_view prefix) {
+        if (prefix.empty()) {
+            return clear();
+        }
+        if (delimiter_ != '\0' && prefix.back() == delimiter_) {
+            return invalidate_indexed(prefix, false);
+        }
+        return remove_if([prefix](const Entry &entry) { return entry.key.starts_with(prefix); });
+    }
+
+    size_t ResponseCache::invalidate_tag(std::string_view tag) {
+        return invalidate_indexed(tag, true);
+    }
+
+    size_t ResponseCache::invalidate_matching(std::string_view pattern) {
+        return remove_if([pattern](const Entry &entry) {
+            return entry.key.find(pattern) != std::string::npos;
+        });
+    }
+
+    size_t ResponseCache::purge_expired() {
+        const uint64_t now = now_ms();
+        size_t removed = 0;
+        for (uint32_t i = 0; i <= shard_mask_; ++i) {
+            Shard &shard = shards_[i];
+            std::lock_guard lock(shard.mutex);
+
+            while (!shard.expiry_index.empty() && shard.expiry_index.begin()->first <= now) {
+                remove_locked(shard, shard.expiry_index.begin()->second);
+                ++removed;
+            }
+        }
+        expirations_.fetch_add(removed, std::memory_order_relaxed);
+        return removed;
+    }
+
+    size_t ResponseCache::clear() {
+        size_t removed = 0;
+        for (uint32_t i = 0; i <= shard_mask_; ++i) {
+            Shard &shard = shards_[i];
+            std::lock_guard lock(shard.mutex);
+
+            removed += shard.entries.size();
+            shard.prefix_index.clear();
+            shard.tag_index.clear();
+            shard.expiry_index.clear();
+            shard.probation = {};
+            shard.protected_segment = {};
+            shard.entries.clear();
+        }
+        return removed;
+    }
+
+    void ResponseCache::get_stats(ecliptix_response_cache_stats_t &stats) const {
+        stats = {};
+        for (uint32_t i = 0; i <= shard_mask_; ++i) {
+            Shard &shard = shards_[i];
+            std::lock_guard lock(shard.mutex);
+
+            stats.entries += shard.entries.size();
+            stats.total_bytes += shard.probation.bytes + shard.protected_segment.bytes;
+        }
+        stats.hits = hits_.load(std::memory_order_relaxed);
+        stats.misses = misses_.load(std::memory_order_relaxed);
+        stats.evictions = evictions_.load(std::memory_order_relaxed);
+        stats.expirations = expirations_.load(std::memory_order_relaxed);
+        stats.rejected = rejected_.load(std::memory_order_relaxed);
+    }
+
+    void ResponseCache::reset_stats() {
+        hits_.store(0, std::memory_order_relaxed);
+        misses_.store(0, std::memory_order_relaxed);
+        evictions_.store(0, std::memory_order_relaxed);
+        expirations_.store(0, std::memory_order_relaxed);
+        rejected_.store(0, std::memory_order_relaxed);
+    }
+
+} // namespace ecliptix::networking
+
+struct ecliptix_response_cache : ecliptix::networking::ResponseCache {
+    using ResponseCache::ResponseCache;
+};
+
+namespace {
+    std::string_view as_view(const uint8_t *data, size_t len) {
+        return {reinterpret_cast<const char *>(data), len};
+    }
+}
+
+extern "C" {
+
+ecliptix_response_cache_t *ecliptix_response_cache_create(const ecliptix_response_cache_config_t *config) {
+    const ecliptix_response_cache_config_t effective = config != nullptr ? *config : ecliptix_response_cache_config_t{};
+    try {
+        return new ecliptix_response_cache(effective);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void ecliptix_response_cache_destroy(ecliptix_response_cache_t *cache) {
+    delete cache;
+}
+
+ecliptix_net_result_t ecliptix_response_cache_get(ecliptix_response_cache_t *cache, const uint8_t *key,
+                                                  size_t key_len, ecliptix_cache_value_sink_fn sink,
+                                                  void *context) {
+    if (cache == nullptr || (key == nullptr && key_len != 0)) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    return cache->get(as_view(key, key_len), sink, context) ? ECLIPTIX_NET_SUCCESS : ECLIPTIX_NET_ERROR_NOT_FOUND;
+}
+
+ecliptix_net_result_t ecliptix_response_cache_put(ecliptix_response_cache_t *cache, const uint8_t *key,
+                                                  size_t key_len, const uint8_t *value, size_t value_len,
+                                                  const uint8_t *etag, size_t etag_len, uint64_t ttl_ms,
+                                                  const uint8_t *tags, size_t tags_len) {
+    if (cache == nullptr || (key == nullptr && key_len != 0) || (value == nullptr && value_len != 0) ||
+        (etag == nullptr && etag_len != 0) || (tags == nullptr && tags_len != 0)) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    try {
+        return cache->put(as_view(key, key_len), std::span(value, value_len), as_view(etag, etag_len), ttl_ms,
+                          as_view(tags, tags_len));
+    } catch (const std::bad_alloc &) {
+        return ECLIPTIX_NET_ERROR_OUT_OF_MEMORY;
+    }
+}
+
+ecliptix_net_result_t ecliptix_response_cache_invalidate(ecliptix_response_cache_t *cache, const uint8_t *key,
+                                                         size_t key_len) {
+    if (cache == nullptr || (key == nullptr && key_len != 0)) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    return cache->invalidate(as_view(key, key_len)) ? ECLIPTIX_NET_SUCCESS : ECLIPTIX_NET_ERROR_NOT_FOUND;
+}
+
+size_t ecliptix_response_cache_invalidate_prefix(ecliptix_response_cache_t *cache, const uint8_t *prefix,
+                                                 size_t prefix_len) {
+    if (cache == nullptr || (prefix == nullptr && prefix_len != 0)) {
+        return 0;
+    }
+    return cache->invalidate_prefix(as_view(prefix, prefix_len));
+}
+
+size_t ecliptix_response_cache_invalidate_tag(ecliptix_response_cache_t *cache, const uint8_t *tag,
+                                              size_t tag_len) {
+    if (cache == nullptr || tag == nullptr || tag_len == 0) {
+        return 0;
+    }
+    return cache->invalidate_tag(as_view(tag, tag_len));
+}
+
+size_t ecliptix_response_cache_invalidate_matching(ecliptix_response_cache_t *cache, const uint8_t *pattern,
+                                                   size_t pattern_len) {
+    if (cache == nullptr || (pattern == nullptr && pattern_len != 0)) {
+        return 0;
+    }
+    return cache->invalidate_matching(as_view(pattern, pattern_len));
+}
+
+size_t ecliptix_response_cache_purge_expired(ecliptix_response_cache_t *cache) {
+    return cache != nullptr ? cache->purge_expired() : 0;
+}
+
+size_t ecliptix_response_cache_clear(ecliptix_response_cache_t *cache) {
+    return cache != nullptr ? cache->clear() : 0;
+}
+
+void ecliptix_response_cache_get_stats(const ecliptix_response_cache_t *cache,
+                                       ecliptix_response_cache_stats_t *out_stats) {
+    if (cache == nullptr || out_stats == nullptr) {
+        return;
+    }
+    cache->get_stats(*out_stats);
+}
+
+void ecliptix_response_cache_reset_stats(ecliptix_response_cache_t *cache) {
+    if (cache != nullptr) {
+        cache->reset_stats();
+    }
+}
+
+}
@@ -0,0 +1,142 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ecliptix_response_cache.h"
+
+namespace ecliptix::networking {
+
+    [[nodiscard]] uint64_t hash_key(std::string_view key) noexcept;
+
+    class ResponseCache {
+    public:
+        static constexpr uint64_t DEFAULT_MAX_TOTAL_BYTES = 8ull * 1024 * 1024;
+        static constexpr uint64_t DEFAULT_MAX_ENTRY_BYTES = 1024ull * 1024;
+        static constexpr uint32_t DEFAULT_SHARD_COUNT = 16;
+        static constexpr uint32_t DEFAULT_PROTECTED_PERCENT = 80;
+
+        explicit ResponseCache(const ecliptix_response_cache_config_t &config);
+
+        ResponseCache(const ResponseCache &) = delete;
+
+        ResponseCache &operator=(const ResponseCache &) = delete;
+
+        [[nodiscard]] bool get(std::string_view key, ecliptix_cache_value_sink_fn sink, void *context);
+
+        [[nodiscard]] ecliptix_net_result_t put(std::string_view key, std::span<const uint8_t> value,
+                                                std::string_view etag, uint64_t ttl_ms,
+                                                std::string_view packed_tags);
+
+        bool invalidate(std::string_view key);
+
+        size_t invalidate_prefix(std::string_view prefix);
+
+        size_t invalidate_tag(std::string_view tag);
+
+        size_t invalidate_matching(std::string_view pattern);
+
+        size_t purge_expired();
+
+        size_t clear();
+
+        void get_stats(ecliptix_response_cache_stats_t &stats) const;
+
+        void reset_stats();
+
+    private:
+        enum class Segment : uint8_t {
+            Probation,
+            Protected
+        };
+
+        struct Entry {
+            std::string key;
+            uint64_t hash = 0;
+            std::vector<uint8_t> value;
+            std::string etag;
+            std::vector<std::string> tags;
+            uint64_t cached_ms = 0;
+            uint64_t expires_ms = 0;
+            uint64_t charge = 0;
+            Segment segment = Segment::Probation;
+            Entry *prev = nullptr;
+            Entry *next = nullptr;
+            std::multimap<uint64_t, Entry *>::iterator expiry;
+        };
+
+        struct KeyRef {
+            uint64_t hash;
+            std::string_view key;
+
+            bool operator==(const KeyRef &other) const noexcept {
+                return hash == other.hash && key == other.key;
+            }
+        };
+
+        struct KeyRefHash {
+            size_t operator()(const KeyRef &ref) const noexcept { return static_cast<size_t>(ref.hash); }
+        };
+
+        struct LruList {
+            Entry *head = nullptr;
+            Entry *tail = nullptr;
+            uint64_t bytes = 0;
+
+            void push_front(Entry *entry);
+
+            void remove(Entry *entry);
+        };
+
+        struct Shard {
+            std::mutex mutex;
+            std::unordered_map<KeyRef, std::unique_ptr<Entry>, KeyRefHash> entries;
+            LruList probation;
+            LruList protected_segment;
+            std::multimap<uint64_t, Entry *> expiry_index;
+            std::unordered_map<std::string, std::unordered_set<Entry *>> prefix_index;
+            std::unordered_map<std::string, std::unordered_set<Entry *>> tag_index;
+        };
+
+        [[nodiscard]] Shard &shard_for(uint64_t hash) const;
+
+        [[nodiscard]] uint64_t now_ms() const;
+
+        void index_locked(Shard &shard, Entry *entry);
+
+        void remove_locked(Shard &shard, Entry *entry);
+
+        void promote_locked(Shard &shard, Entry *entry);
+
+        void evict_locked(Shard &shard);
+
+        size_t invalidate_indexed(std::string_view name, bool by_tag);
+
+        template<typename Predicate>
+        size_t remove_if(Predicate predicate);
+
+        const std::chrono::steady_clock::time_point epoch_;
+        const uint64_t max_entry_bytes_;
+        const uint32_t shard_mask_;
+        const uint64_t shard_budget_;
+        const uint64_t protected_budget_;
+        const char delimiter_;
+        std::unique_ptr<Shard[]> shards_;
+
+        std::atomic<uint64_t> hits_{0};
+        std::atomic<uint64_t> misses_{0};
+        std::atomic<uint64_t> evictions_{0};
+        std::atomic<uint64_t> expirations_{0};
+        std::atomic<uint64_t> rejected_{0};
+    };
+
+} // namespace ecliptix::networking
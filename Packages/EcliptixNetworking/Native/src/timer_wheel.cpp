@@ -0,0 +1,406 @@
+#include "timer_wheel.h"
+
+#include <algorithm>
+#include <bit>
+#include <new>
+
+namespace ecliptix::networking {
+
+    namespace {
+        constexpr uint64_t MAX_TIMEOUT_US = uint64_t{1} << 40;
+        constexpr uint32_t INDEX_MASK = TimerWheel::MAX_CAPACITY;
+        constexpr uint32_t GENERATION_MASK = (1u << (32 - TimerWheel::INDEX_BITS)) - 1;
+        constexpr uint64_t SLOT_MASK = TimerWheel::WHEEL_SLOTS - 1;
+        constexpr unsigned WHEEL_SPAN_BITS = TimerWheel::WHEEL_COUNT * TimerWheel::WHEEL_BITS;
+    }
+
+    TimerWheel::TimerWheel(uint32_t tick_us, uint32_t capacity, ecliptix_timer_expired_fn on_expired,
+                           void *context)
+        : tick_ns_(uint64_t{tick_us} * 1000),
+          on_expired_(on_expired),
+          context_(context),
+          epoch_(Clock::now()) {
+        nodes_.resize(capacity);
+        for (uint32_t i = 0; i < capacity; ++i) {
+            nodes_[i].next = i + 1 < capacity ? i + 1 : NIL;
+        }
+        free_head_ = capacity > 0 ? 0 : NIL;
+        heads_.fill(NIL);
+        cascade_scratch_.reserve(256);
+
+        thread_ = std::thread(&TimerWheel::run, this);
+    }
+
+    TimerWheel::~TimerWheel() {
+        {
+            std::lock_guard lock(mutex_);
+            stopping_ = true;
+        }
+        wakeup_.notify_one();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    uint64_t TimerWheel::now_ns() const {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - epoch_).count());
+    }
+
+    uint64_t TimerWheel::now_tick() const {
+        return now_ns() / tick_ns_;
+    }
+
+    uint64_t TimerWheel::deadline_tick(uint64_t from_ns, uint64_t duration_us) const {
+        const uint64_t deadline_ns = from_ns + std::min(duration_us, MAX_TIMEOUT_US) * 1000;
+        return (deadline_ns + tick_ns_ - 1) / tick_ns_;
+    }
+
+    ecliptix_timer_id_t TimerWheel::make_id(uint32_t index) const {
+        return (static_cast<uint32_t>(nodes_[index].generation) << INDEX_BITS) | (index + 1);
+    }
+
+    TimerWheel::Node *TimerWheel::resolve(ecliptix_timer_id_t id) {
+        return const_cast<Node *>(static_cast<const TimerWheel *>(this)->resolve(id));
+    }
+
+    const TimerWheel::Node *TimerWheel::resolve(ecliptix_timer_id_t id) const {
+        const uint32_t slot = id & INDEX_MASK;
+        if (slot == 0 || slot > nodes_.size()) {
+            return nullptr;
+        }
+        const Node &node = nodes_[slot - 1];
+        if (!node.active || node.generation != (id >> INDEX_BITS)) {
+            return nullptr;
+        }
+        return &node;
+    }
+
+    void TimerWheel::link(uint32_t index, unsigned bucket) {
+        Node &node = nodes_[index];
+        node.bucket = static_cast<uint16_t>(bucket);
+        node.prev = NIL;
+        node.next = heads_[bucket];
+        if (node.next != NIL) {
+            nodes_[node.next].prev = index;
+        }
+        heads_[bucket] = index;
+        if (bucket < OVERFLOW_BUCKET) {
+            occupied_[bucket / WHEEL_SLOTS] |= uint64_t{1} << (bucket % WHEEL_SLOTS);
+        }
+    }
+
+    void TimerWheel::unlink(uint32_t index) {
+        Node &node = nodes_[index];
+        const unsigned bucket = node.bucket;
+        if (node.prev != NIL) {
+            nodes_[node.prev].next = node.next;
+        } else {
+            heads_[bucket] = node.next;
+        }
+        if (node.next != NIL) {
+            nodes_[node.next].prev = node.prev;
+        }
+        node.prev = NIL;
+        node.next = NIL;
+        if (bucket < OVERFLOW_BUCKET && heads_[bucket] == NIL) {
+            occupied_[bucket / WHEEL_SLOTS] &= ~(uint64_t{1} << (bucket % WHEEL_SLOTS));
+        }
+    }
+
+    // A timer lives on the level of the highest bit in which its deadline differs from the
+    // current tick, so it is revisited exactly when the wheel reaches the start of its slot.
+    void TimerWheel::schedule(uint32_t index) {
+        const uint64_t expires = nodes_[index].expires;
+        if (expires <= current_tick_) {
+            link(index, EXPIRED_BUCKET);
+            return;
+        }
+        const unsigned level = (63 - std::countl_zero(expires ^ current_tick_)) / WHEEL_BITS;
+        if (level >= WHEEL_COUNT) {
+            link(index, OVERFLOW_BUCKET);
+            return;
+        }
+        const auto slot = static_cast<unsigned>((expires >> (level * WHEEL_BITS)) & SLOT_MASK);
+        link(index, level * WHEEL_SLOTS + slot);
+    }
+
+    void TimerWheel::release(uint32_t index) {
+        unlink(index);
+        Node &node = nodes_[index];
+        node.active = false;
+        node.generation = static_cast<uint16_t>((node.generation + 1) & GENERATION_MASK);
+        node.next = free_head_;
+        free_head_ = index;
+        --active_;
+    }
+
+    // Only slots the clock actually passed are visited: per level, the elapsed slot range is
+    // turned into a rotated mask and intersected with the occupancy bitmap.
+    void TimerWheel::advance(uint64_t target_tick) {
+        if (target_tick <= current_tick_) {
+            return;
+        }
+
+        cascade_scratch_.clear();
+        const auto drain = [this](unsigned bucket) {
+            while (heads_[bucket] != NIL) {
+                const uint32_t index = heads_[bucket];
+                unlink(index);
+                cascade_scratch_.push_back(index);
+            }
+        };
+
+        for (unsigned level = 0; level < WHEEL_COUNT; ++level) {
+            const unsigned shift = level * WHEEL_BITS;
+            const uint64_t old_position = current_tick_ >> shift;
+            const uint64_t new_position = target_tick >> shift;
+            if (old_position == new_position) {
+                break;
+            }
+
+            const uint64_t elapsed = new_position - old_position;
+            uint64_t mask = ~uint64_t{0};
+            if (elapsed < WHEEL_SLOTS) {
+                const auto first_slot = static_cast<int>((old_position + 1) & SLOT_MASK);
+                mask = std::rotl((uint64_t{1} << elapsed) - 1, first_slot);
+            }
+
+            uint64_t pending = occupied_[level] & mask;
+            while (pending != 0) {
+                const auto slot = static_cast<unsigned>(std::countr_zero(pending));
+                pending &= pending - 1;
+                drain(level * WHEEL_SLOTS + slot);
+            }
+        }
+
+        if ((current_tick_ >> WHEEL_SPAN_BITS) != (target_tick >> WHEEL_SPAN_BITS)) {
+            drain(OVERFLOW_BUCKET);
+        }
+
+        current_tick_ = target_tick;
+        for (const uint32_t index: cascade_scratch_) {
+            schedule(index);
+        }
+    }
+
+    uint64_t TimerWheel::next_event_tick() const {
+        if (heads_[EXPIRED_BUCKET] != NIL) {
+            return current_tick_;
+        }
+
+        uint64_t next = NEVER;
+        for (unsigned level = 0; level < WHEEL_COUNT; ++level) {
+            if (occupied_[level] == 0) {
+                continue;
+            }
+            const unsigned shift = level * WHEEL_BITS;
+            const uint64_t position = current_tick_ >> shift;
+            const auto after_current = static_cast<int>((position + 1) & SLOT_MASK);
+            const uint64_t distance = std::countr_zero(std::rotr(occupied_[level], after_current)) + 1;
+            next = std::min(next, (position + distance) << shift);
+        }
+
+        if (heads_[OVERFLOW_BUCKET] != NIL) {
+            next = std::min(next, ((current_tick_ >> WHEEL_SPAN_BITS) + 1) << WHEEL_SPAN_BITS);
+        }
+        return next;
+    }
+
+    void TimerWheel::run() {
+        std::vector<Fired> fired;
+        std::unique_lock lock(mutex_);
+
+        while (!stopping_) {
+            advance(now_tick());
+
+            if (heads_[EXPIRED_BUCKET] != NIL) {
+                fired.clear();
+                while (heads_[EXPIRED_BUCKET] != NIL) {
+                    const uint32_t index = heads_[EXPIRED_BUCKET];
+                    fired.push_back({make_id(index), nodes_[index].tag});
+                    release(index);
+                    ++expired_;
+                }
+
+                lock.unlock();
+                for (const Fired &timer: fired) {
+                    on_expired_(timer.id, timer.tag, context_);
+                }
+                lock.lock();
+                continue;
+            }
+
+            scheduled_wake_tick_ = next_event_tick();
+            if (scheduled_wake_tick_ == NEVER) {
+                wakeup_.wait(lock);
+            } else {
+                wakeup_.wait_until(lock, epoch_ + std::chrono::nanoseconds(scheduled_wake_tick_ * tick_ns_));
+            }
+            scheduled_wake_tick_ = 0;
+            ++wakeups_;
+        }
+    }
+
+    ecliptix_net_result_t TimerWheel::start(uint64_t timeout_us, uint64_t tag, ecliptix_timer_id_t *out_id) {
+        bool should_wake = false;
+        {
+            std::lock_guard lock(mutex_);
+            if (free_head_ == NIL) {
+                return ECLIPTIX_NET_ERROR_CAPACITY;
+            }
+
+            const uint32_t index = free_head_;
+            Node &node = nodes_[index];
+            free_head_ = node.next;
+
+            node.expires = deadline_tick(now_ns(), timeout_us);
+            node.tag = tag;
+            node.active = true;
+            schedule(index);
+
+            ++active_;
+            ++started_;
+            *out_id = make_id(index);
+
+            if (node.expires < scheduled_wake_tick_) {
+                scheduled_wake_tick_ = node.expires;
+                should_wake = true;
+            }
+        }
+        if (should_wake) {
+            wakeup_.notify_one();
+        }
+        return ECLIPTIX_NET_SUCCESS;
+    }
+
+    ecliptix_net_result_t TimerWheel::stop(ecliptix_timer_id_t id) {
+        std::lock_guard lock(mutex_);
+        if (resolve(id) == nullptr) {
+            return ECLIPTIX_NET_ERROR_NOT_FOUND;
+        }
+        release((id & INDEX_MASK) - 1);
+        ++stopped_;
+        return ECLIPTIX_NET_SUCCESS;
+    }
+
+    ecliptix_net_result_t TimerWheel::extend(ecliptix_timer_id_t id, uint64_t additional_us) {
+        std::lock_guard lock(mutex_);
+        Node *node = resolve(id);
+        if (node == nullptr) {
+            return ECLIPTIX_NET_ERROR_NOT_FOUND;
+        }
+        const uint32_t index = (id & INDEX_MASK) - 1;
+        unlink(index);
+        node->expires = deadline_tick(node->expires * tick_ns_, additional_us);
+        schedule(index);
+        return ECLIPTIX_NET_SUCCESS;
+    }
+
+    ecliptix_net_result_t TimerWheel::remaining(ecliptix_timer_id_t id, uint64_t *out_remaining_us) const {
+        std::lock_guard lock(mutex_);
+        const Node *node = resolve(id);
+        if (node == nullptr) {
+            return ECLIPTIX_NET_ERROR_NOT_FOUND;
+        }
+        const uint64_t now = now_tick();
+        const uint64_t remaining_ticks = node->expires > now ? node->expires - now : 0;
+        *out_remaining_us = remaining_ticks * tick_ns_ / 1000;
+        return ECLIPTIX_NET_SUCCESS;
+    }
+
+    void TimerWheel::stop_all() {
+        std::lock_guard lock(mutex_);
+        for (unsigned bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+            while (heads_[bucket] != NIL) {
+                release(heads_[bucket]);
+                ++stopped_;
+            }
+        }
+    }
+
+    void TimerWheel::get_stats(ecliptix_timer_wheel_stats_t &stats) const {
+        std::lock_guard lock(mutex_);
+        stats.active = active_;
+        stats.started = started_;
+        stats.stopped = stopped_;
+        stats.expired = expired_;
+        stats.wakeups = wakeups_;
+    }
+
+} // namespace ecliptix::networking
+
+struct ecliptix_timer_wheel : ecliptix::networking::TimerWheel {
+    using TimerWheel::TimerWheel;
+};
+
+using ecliptix::networking::TimerWheel;
+
+extern "C" {
+
+ecliptix_timer_wheel_t *ecliptix_timer_wheel_create(const ecliptix_timer_wheel_config_t *config,
+                                                    ecliptix_timer_expired_fn on_expired, void *context) {
+    if (on_expired == nullptr) {
+        return nullptr;
+    }
+    const uint32_t tick_us = config != nullptr && config->tick_us != 0 ? config->tick_us : TimerWheel::DEFAULT_TICK_US;
+    const uint32_t capacity = config != nullptr && config->capacity != 0 ? config->capacity : TimerWheel::DEFAULT_CAPACITY;
+    if (capacity > TimerWheel::MAX_CAPACITY) {
+        return nullptr;
+    }
+    try {
+        return new ecliptix_timer_wheel(tick_us, capacity, on_expired, context);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void ecliptix_timer_wheel_destroy(ecliptix_timer_wheel_t *wheel) {
+    delete wheel;
+}
+
+ecliptix_net_result_t ecliptix_timer_wheel_start(ecliptix_timer_wheel_t *wheel, uint64_t timeout_us, uint64_t tag,
+                                                 ecliptix_timer_id_t *out_timer_id) {
+    if (wheel == nullptr || out_timer_id == nullptr) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    return wheel->start(timeout_us, tag, out_timer_id);
+}
+
+ecliptix_net_result_t ecliptix_timer_wheel_stop(ecliptix_timer_wheel_t *wheel, ecliptix_timer_id_t timer_id) {
+    if (wheel == nullptr) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    return wheel->stop(timer_id);
+}
+
+ecliptix_net_result_t ecliptix_timer_wheel_extend(ecliptix_timer_wheel_t *wheel, ecliptix_timer_id_t timer_id,
+                                                  uint64_t additional_us) {
+    if (wheel == nullptr) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    return wheel->extend(timer_id, additional_us);
+}
+
+ecliptix_net_result_t ecliptix_timer_wheel_remaining(const ecliptix_timer_wheel_t *wheel,
+                                                     ecliptix_timer_id_t timer_id, uint64_t *out_remaining_us) {
+    if (wheel == nullptr || out_remaining_us == nullptr) {
+        return ECLIPTIX_NET_ERROR_INVALID_PARAMS;
+    }
+    return wheel->remaining(timer_id, out_remaining_us);
+}
+
+void ecliptix_timer_wheel_stop_all(ecliptix_timer_wheel_t *wheel) {
+    if (wheel != nullptr) {
+        wheel->stop_all();
+    }
+}
+
+void ecliptix_timer_wheel_get_stats(const ecliptix_timer_wheel_t *wheel, ecliptix_timer_wheel_stats_t *out_stats) {
+    if (wheel == nullptr || out_stats == nullptr) {
+        return;
+    }
+    wheel->get_stats(*out_stats);
+}
+
+}
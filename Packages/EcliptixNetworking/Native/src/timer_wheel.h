@@ -0,0 +1,119 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ecliptix_timer_wheel.h"
+
+namespace ecliptix::networking {
+
+    class TimerWheel {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr unsigned WHEEL_BITS = 6;
+        static constexpr unsigned WHEEL_SLOTS = 1u << WHEEL_BITS;
+        static constexpr unsigned WHEEL_COUNT = 7;
+        static constexpr unsigned OVERFLOW_BUCKET = WHEEL_COUNT * WHEEL_SLOTS;
+        static constexpr unsigned EXPIRED_BUCKET = OVERFLOW_BUCKET + 1;
+        static constexpr unsigned BUCKET_COUNT = EXPIRED_BUCKET + 1;
+        static constexpr uint32_t INDEX_BITS = 20;
+        static constexpr uint32_t MAX_CAPACITY = (1u << INDEX_BITS) - 1;
+        static constexpr uint32_t DEFAULT_TICK_US = 100;
+        static constexpr uint32_t DEFAULT_CAPACITY = 65536;
+
+        TimerWheel(uint32_t tick_us, uint32_t capacity, ecliptix_timer_expired_fn on_expired, void *context);
+
+        ~TimerWheel();
+
+        TimerWheel(const TimerWheel &) = delete;
+
+        TimerWheel &operator=(const TimerWheel &) = delete;
+
+        [[nodiscard]] ecliptix_net_result_t start(uint64_t timeout_us, uint64_t tag, ecliptix_timer_id_t *out_id);
+
+        [[nodiscard]] ecliptix_net_result_t stop(ecliptix_timer_id_t id);
+
+        [[nodiscard]] ecliptix_net_result_t extend(ecliptix_timer_id_t id, uint64_t additional_us);
+
+        [[nodiscard]] ecliptix_net_result_t remaining(ecliptix_timer_id_t id, uint64_t *out_remaining_us) const;
+
+        void stop_all();
+
+        void get_stats(ecliptix_timer_wheel_stats_t &stats) const;
+
+    private:
+        static constexpr uint32_t NIL = UINT32_MAX;
+        static constexpr uint64_t NEVER = UINT64_MAX;
+
+        struct Node {
+            uint64_t expires = 0;
+            uint64_t tag = 0;
+            uint32_t prev = NIL;
+            uint32_t next = NIL;
+            uint16_t generation = 0;
+            uint16_t bucket = 0;
+            bool active = false;
+        };
+
+        struct Fired {
+            ecliptix_timer_id_t id;
+            uint64_t tag;
+        };
+
+        [[nodiscard]] uint64_t now_ns() const;
+
+        [[nodiscard]] uint64_t now_tick() const;
+
+        [[nodiscard]] uint64_t deadline_tick(uint64_t from_ns, uint64_t duration_us) const;
+
+        [[nodiscard]] ecliptix_timer_id_t make_id(uint32_t index) const;
+
+        [[nodiscard]] Node *resolve(ecliptix_timer_id_t id);
+
+        [[nodiscard]] const Node *resolve(ecliptix_timer_id_t id) const;
+
+        void link(uint32_t index, unsigned bucket);
+
+        void unlink(uint32_t index);
+
+        void schedule(uint32_t index);
+
+        void release(uint32_t index);
+
+        void advance(uint64_t target_tick);
+
+        [[nodiscard]] uint64_t next_event_tick() const;
+
+        void run();
+
+        const uint64_t tick_ns_;
+        const ecliptix_timer_expired_fn on_expired_;
+        void *const context_;
+        const Clock::time_point epoch_;
+
+        mutable std::mutex mutex_;
+        std::condition_variable wakeup_;
+        std::thread thread_;
+        bool stopping_ = false;
+
+        std::vector<Node> nodes_;
+        uint32_t free_head_ = NIL;
+        std::array<uint32_t, BUCKET_COUNT> heads_{};
+        std::array<uint64_t, WHEEL_COUNT> occupied_{};
+        uint64_t current_tick_ = 0;
+        uint64_t scheduled_wake_tick_ = NEVER;
+        std::vector<uint32_t> cascade_scratch_;
+
+        uint64_t active_ = 0;
+        uint64_t started_ = 0;
+        uint64_t stopped_ = 0;
+        uint64_t expired_ = 0;
+        uint64_t wakeups_ = 0;
+    };
+
+} // namespace ecliptix::networking
@@ -1,8 +1,8 @@
+import CEcliptixNetworking
 import EcliptixCore
 import Foundation
 
-@MainActor
-public final class CircuitBreaker {
+public final class CircuitBreaker: @unchecked Sendable {
 
     public enum State: String {
         case closed
@@ -10,7 +10,13 @@ public final class CircuitBreaker {
         case halfOpen
     }
 
-    private(set) var state: State = .closed
+    var state: State {
+        lock.lock()
+        defer { lock.unlock() }
+        return currentState
+    }
+
+    private var currentState: State = .closed
 
     private let configuration: CircuitBreakerConfiguration
 
@@ -24,46 +30,36 @@ public final class CircuitBreaker {
 
     private var totalSuccesses: Int = 0
 
-    private var connectionCircuits: [UInt32: ConnectionCircuitState] = [:]
-    private let circuitLock = NSLock()
-
-    @MainActor
-    private class ConnectionCircuitState {
-        let connectId: UInt32
-        var state: State
-        var consecutiveFailures: Int
-        var lastStateTransition: Date
-        var lastFailureTime: Date?
-        private let stateLock = NSLock()
-
-        init(connectId: UInt32) {
-            self.connectId = connectId
-            self.state = .closed
-            self.consecutiveFailures = 0
-            self.lastStateTransition = Date()
-        }
+    private let lock = NSLock()
 
-        func atomicUpdate(_ update: (ConnectionCircuitState) -> Void) {
-            stateLock.lock()
-            defer { stateLock.unlock() }
-            update(self)
-        }
+    nonisolated(unsafe) private let connectionCircuits: OpaquePointer?
+
+    public init(configuration: CircuitBreakerConfiguration = .default) {
+        self.configuration = configuration
+
+        var tableConfig = ecliptix_circuit_table_config_t(
+            failure_threshold: UInt32(clamping: configuration.failureThreshold),
+            success_threshold: UInt32(clamping: configuration.successThreshold),
+            open_duration_ms: UInt64(max(1, (configuration.openStateDuration * 1000).rounded())),
+            capacity: UInt32(clamping: configuration.maxTrackedConnections)
+        )
+        self.connectionCircuits = configuration.usePerConnectionCircuits
+            ? ecliptix_circuit_table_create(&tableConfig)
+            : nil
 
-        func atomicRead<T>(_ read: (ConnectionCircuitState) -> T) -> T {
-            stateLock.lock()
-            defer { stateLock.unlock() }
-            return read(self)
+        if configuration.usePerConnectionCircuits && connectionCircuits == nil {
+            Log.error("[CircuitBreaker] Failed to create native circuit table (failure threshold \(configuration.failureThreshold), success threshold \(configuration.successThreshold)) - per-connection circuits disabled")
         }
     }
 
-    public init(configuration: CircuitBreakerConfiguration = .default) {
-        self.configuration = configuration
+    deinit {
+        ecliptix_circuit_table_destroy(connectionCircuits)
     }
 
-    public func execute<T>(
+    public func execute<T: Sendable>(
         connectId: UInt32? = nil,
         operationName: String,
-        operation: @escaping () async throws -> Result<T, NetworkFailure>
+        operation: @escaping @Sendable () async throws -> Result<T, NetworkFailure>
     ) async -> Result<T, NetworkFailure> {
 
         if let connectId = connectId {
@@ -75,7 +71,7 @@ public final class CircuitBreaker {
                 ))
             }
         } else {
-            if state == .open && !shouldAttemptReset() {
+            if !admitGlobally() {
                 Log.warning("[CircuitBreaker] [ERROR] Circuit OPEN globally - failing fast: \(operationName)")
                 return .failure(NetworkFailure(
                     type: .dataCenterNotResponding,
@@ -124,10 +120,19 @@ public final class CircuitBreaker {
         }
     }
 
+    private func admitGlobally() -> Bool {
+        lock.lock()
+        defer { lock.unlock() }
+        return currentState != .open || shouldAttemptReset()
+    }
+
     private func recordSuccess() {
+        lock.lock()
+        defer { lock.unlock() }
+
         totalSuccesses += 1
 
-        switch state {
+        switch currentState {
         case .halfOpen:
 
             consecutiveSuccesses += 1
@@ -153,6 +158,9 @@ public final class CircuitBreaker {
     }
 
     private func recordFailure(error: NetworkFailure) {
+        lock.lock()
+        defer { lock.unlock() }
+
         totalFailures += 1
 
         guard error.shouldRetry else {
@@ -161,7 +169,7 @@ public final class CircuitBreaker {
 
         consecutiveFailures += 1
 
-        switch state {
+        switch currentState {
         case .closed:
             if consecutiveFailures >= configuration.failureThreshold {
                 transitionTo(.open)
@@ -181,17 +189,17 @@ public final class CircuitBreaker {
     }
 
     private func transitionTo(_ newState: State) {
-        guard state != newState else { return }
+        guard currentState != newState else { return }
 
-        let oldState = state
-        state = newState
+        let oldState = currentState
+        currentState = newState
         lastStateTransition = Date()
 
         Log.info("[CircuitBreaker]  State transition: \(oldState.rawValue) → \(newState.rawValue)")
     }
 
     private func shouldAttemptReset() -> Bool {
-        guard state == .open else { return false }
+        guard currentState == .open else { return false }
 
         let timeSinceOpen = Date().timeIntervalSince(lastStateTransition)
         if timeSinceOpen >= configuration.openStateDuration {
@@ -204,22 +212,8 @@ public final class CircuitBreaker {
     }
 
     private func recordSuccess(connectId: UInt32) {
-        circuitLock.lock()
-        defer { circuitLock.unlock() }
-
-        guard let circuit = connectionCircuits[connectId] else {
-            return
-        }
-
-        circuit.atomicUpdate { state in
-            if state.state == .halfOpen {
-                state.state = .closed
-                state.consecutiveFailures = 0
-                state.lastStateTransition = Date()
-                Log.info("[CircuitBreaker] [OK] Circuit CLOSED for connection \(connectId)")
-            } else if state.state == .closed {
-                state.consecutiveFailures = 0
-            }
+        if ecliptix_circuit_table_record_success(connectionCircuits, connectId) == ECLIPTIX_CIRCUIT_TRANSITION_CLOSED {
+            Log.info("[CircuitBreaker] [OK] Circuit CLOSED for connection \(connectId)")
         }
     }
 
@@ -228,90 +222,62 @@ public final class CircuitBreaker {
             return
         }
 
-        circuitLock.lock()
-        let circuit = connectionCircuits[connectId] ?? ConnectionCircuitState(connectId: connectId)
-        if connectionCircuits[connectId] == nil {
-            connectionCircuits[connectId] = circuit
-        }
-        circuitLock.unlock()
-
-        circuit.atomicUpdate { state in
-            state.consecutiveFailures += 1
-            state.lastFailureTime = Date()
-        }
-
-        let shouldOpen = circuit.atomicRead { state in
-            state.state == .closed && state.consecutiveFailures >= configuration.failureThreshold
-        }
-
-        if shouldOpen {
-            circuit.atomicUpdate { state in
-                state.state = .open
-                state.lastStateTransition = Date()
-            }
-            let failures = circuit.atomicRead { $0.consecutiveFailures }
-            Log.warning("[CircuitBreaker] [ERROR] Circuit OPEN for connection \(connectId) - \(failures) failures")
-        } else {
-            let isHalfOpen = circuit.atomicRead { $0.state == .halfOpen }
-            if isHalfOpen {
-                circuit.atomicUpdate { state in
-                    state.state = .open
-                    state.lastStateTransition = Date()
-                }
-                Log.warning("[CircuitBreaker] [ERROR] Circuit RE-OPENED for connection \(connectId)")
-            }
+        switch ecliptix_circuit_table_record_failure(connectionCircuits, connectId) {
+        case ECLIPTIX_CIRCUIT_TRANSITION_OPENED:
+            Log.warning("[CircuitBreaker] [ERROR] Circuit OPEN for connection \(connectId) - \(configuration.failureThreshold) failures")
+        case ECLIPTIX_CIRCUIT_TRANSITION_REOPENED:
+            Log.warning("[CircuitBreaker] [ERROR] Circuit RE-OPENED for connection \(connectId)")
+        default:
+            break
         }
     }
 
     private func isCircuitOpen(connectId: UInt32) -> Bool {
-        guard let circuit = connectionCircuits[connectId] else {
-            return false
-        }
-
-        if circuit.state == .open {
-            let timeSinceOpen = Date().timeIntervalSince(circuit.lastStateTransition)
-            if timeSinceOpen >= configuration.openStateDuration {
-
-                circuit.state = .halfOpen
-                circuit.lastStateTransition = Date()
-                Log.info("[CircuitBreaker]  Circuit HALF-OPEN for connection \(connectId) - testing recovery")
-                return false
-            }
+        switch ecliptix_circuit_table_acquire(connectionCircuits, connectId) {
+        case ECLIPTIX_CIRCUIT_REJECT:
             return true
+        case ECLIPTIX_CIRCUIT_ALLOW_TRIAL:
+            Log.info("[CircuitBreaker]  Circuit HALF-OPEN for connection \(connectId) - testing recovery")
+            return false
+        default:
+            return false
         }
-
-        return false
     }
 
     public func trip() {
+        lock.lock()
+        defer { lock.unlock() }
+
         transitionTo(.open)
         Log.warning("[CircuitBreaker] [ERROR] Circuit manually TRIPPED")
     }
 
     public func reset() {
+        lock.lock()
         transitionTo(.closed)
         consecutiveFailures = 0
         consecutiveSuccesses = 0
         totalFailures = 0
         totalSuccesses = 0
+        lock.unlock()
 
-        connectionCircuits.removeAll()
+        ecliptix_circuit_table_reset_all(connectionCircuits)
 
         Log.info("[CircuitBreaker] [OK] Circuit manually RESET")
     }
 
     public func resetConnection(_ connectId: UInt32) {
-        if let circuit = connectionCircuits[connectId] {
-            circuit.state = .closed
-            circuit.consecutiveFailures = 0
-            circuit.lastStateTransition = Date()
+        if ecliptix_circuit_table_reset(connectionCircuits, connectId) == ECLIPTIX_NET_SUCCESS {
             Log.info("[CircuitBreaker] [OK] Circuit RESET for connection \(connectId)")
         }
     }
 
     public func getMetrics() -> CircuitBreakerMetrics {
+        lock.lock()
+        defer { lock.unlock() }
+
         return CircuitBreakerMetrics(
-            state: state,
+            state: currentState,
             consecutiveFailures: consecutiveFailures,
             consecutiveSuccesses: consecutiveSuccesses,
             totalFailures: totalFailures,
@@ -321,16 +287,29 @@ public final class CircuitBreaker {
     }
 
     public func getConnectionMetrics(connectId: UInt32) -> ConnectionCircuitMetrics? {
-        guard let circuit = connectionCircuits[connectId] else {
+        var snapshot = ecliptix_circuit_snapshot_t()
+        guard ecliptix_circuit_table_get(connectionCircuits, connectId, &snapshot) == ECLIPTIX_NET_SUCCESS else {
             return nil
         }
 
+        let state: State
+        switch snapshot.state {
+        case ECLIPTIX_CIRCUIT_OPEN:
+            state = .open
+        case ECLIPTIX_CIRCUIT_HALF_OPEN:
+            state = .halfOpen
+        default:
+            state = .closed
+        }
+
         return ConnectionCircuitMetrics(
             connectId: connectId,
-            state: circuit.state,
-            consecutiveFailures: circuit.consecutiveFailures,
-            timeSinceLastTransition: Date().timeIntervalSince(circuit.lastStateTransition),
-            timeSinceLastFailure: circuit.lastFailureTime.map { Date().timeIntervalSince($0) }
+            state: state,
+            consecutiveFailures: Int(snapshot.consecutive_failures),
+            timeSinceLastTransition: TimeInterval(snapshot.ms_since_transition) / 1000,
+            timeSinceLastFailure: snapshot.ms_since_failure == UInt64.max
+                ? nil
+                : TimeInterval(snapshot.ms_since_failure) / 1000
         )
     }
 }
@@ -345,16 +324,20 @@ public struct CircuitBreakerConfiguration: Sendable {
 
     public let usePerConnectionCircuits: Bool
 
+    public let maxTrackedConnections: Int
+
     public init(
         failureThreshold: Int = 5,
         successThreshold: Int = 2,
         openStateDuration: TimeInterval = 30.0,
-        usePerConnectionCircuits: Bool = true
+        usePerConnectionCircuits: Bool = true,
+        maxTrackedConnections: Int = 1024
     ) {
         self.failureThreshold = failureThreshold
         self.successThreshold = successThreshold
         self.openStateDuration = openStateDuration
         self.usePerConnectionCircuits = usePerConnectionCircuits
+        self.maxTrackedConnections = maxTrackedConnections
     }
 
     public static let `default` = CircuitBreakerConfiguration()
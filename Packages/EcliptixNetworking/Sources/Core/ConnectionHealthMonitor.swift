@@ -1,22 +1,29 @@
+import CEcliptixNetworking
 import Combine
 import EcliptixCore
 import Foundation
 
-@MainActor
-public final class ConnectionHealthMonitor {
+public final class ConnectionHealthMonitor: @unchecked Sendable {
 
-    public enum HealthStatus: String {
+    public enum HealthStatus: String, Sendable {
         case healthy
         case degraded
         case unhealthy
         case critical
     }
 
-    public struct ConnectionHealth {
+    public struct ConnectionHealth: Sendable {
         public let connectId: UInt32
         public let status: HealthStatus
         public let successRate: Double
-        public let averageLatency: TimeInterval
+        /// Mean over every sample since the connection was first tracked. The
+        /// old 100-sample average is gone; `ewmaLatency` tracks recent latency.
+        public let lifetimeMeanLatency: TimeInterval
+        public let ewmaLatency: TimeInterval
+        public let p50Latency: TimeInterval
+        public let p95Latency: TimeInterval
+        public let p99Latency: TimeInterval
+        public let maxLatency: TimeInterval
         public let failureCount: Int
         public let successCount: Int
         public let lastSuccessTime: Date?
@@ -42,7 +49,9 @@ public final class ConnectionHealthMonitor {
 
     public let healthStatusPublisher = PassthroughSubject<ConnectionHealth, Never>()
 
-    nonisolated(unsafe) private var cleanupTimer: Timer?
+    private let lock = NSLock()
+
+    private let cleanupTimer: DispatchSourceTimer
 
     private class ConnectionHealthTracker {
         let connectId: UInt32
@@ -52,8 +61,7 @@ public final class ConnectionHealthMonitor {
         var failureCount: Int = 0
         var consecutiveFailures: Int = 0
 
-        var latencySamples: [TimeInterval] = []
-        var maxLatencySamples: Int = 100
+        let latencySketch: OpaquePointer?
 
         var lastSuccessTime: Date?
         var lastFailureTime: Date?
@@ -61,6 +69,11 @@ public final class ConnectionHealthMonitor {
 
         init(connectId: UInt32) {
             self.connectId = connectId
+            self.latencySketch = ecliptix_latency_sketch_create(nil)
+        }
+
+        deinit {
+            ecliptix_latency_sketch_destroy(latencySketch)
         }
 
         var totalRequests: Int {
@@ -72,16 +85,14 @@ public final class ConnectionHealthMonitor {
             return Double(successCount) / Double(totalRequests)
         }
 
-        var averageLatency: TimeInterval {
-            guard !latencySamples.isEmpty else { return 0.0 }
-            return latencySamples.reduce(0.0, +) / Double(latencySamples.count)
+        var latencySummary: ecliptix_latency_summary_t {
+            var summary = ecliptix_latency_summary_t()
+            ecliptix_latency_sketch_get_summary(latencySketch, &summary)
+            return summary
         }
 
         func addLatencySample(_ latency: TimeInterval) {
-            latencySamples.append(latency)
-            if latencySamples.count > maxLatencySamples {
-                latencySamples.removeFirst()
-            }
+            ecliptix_latency_sketch_record(latencySketch, UInt64(max(0, latency * 1_000_000).rounded()))
         }
 
         func updateStatus(config: HealthMonitorConfiguration) {
@@ -92,7 +103,7 @@ public final class ConnectionHealthMonitor {
                 status = .unhealthy
             } else if successRate < config.degradedSuccessRateThreshold {
                 status = .degraded
-            } else if averageLatency > config.degradedLatencyThreshold {
+            } else if latencySummary.ewma_us / 1_000_000 > config.degradedLatencyThreshold {
                 status = .degraded
             } else {
                 status = .healthy
@@ -100,11 +111,17 @@ public final class ConnectionHealthMonitor {
         }
 
         func toConnectionHealth() -> ConnectionHealth {
+            let latency = latencySummary
             return ConnectionHealth(
                 connectId: connectId,
                 status: status,
                 successRate: successRate,
-                averageLatency: averageLatency,
+                lifetimeMeanLatency: latency.mean_us / 1_000_000,
+                ewmaLatency: latency.ewma_us / 1_000_000,
+                p50Latency: TimeInterval(latency.p50_us) / 1_000_000,
+                p95Latency: TimeInterval(latency.p95_us) / 1_000_000,
+                p99Latency: TimeInterval(latency.p99_us) / 1_000_000,
+                maxLatency: TimeInterval(latency.max_us) / 1_000_000,
                 failureCount: failureCount,
                 successCount: successCount,
                 lastSuccessTime: lastSuccessTime,
@@ -117,14 +134,16 @@ public final class ConnectionHealthMonitor {
     public init(configuration: HealthMonitorConfiguration = .default) {
         self.configuration = configuration
 
+        cleanupTimer = DispatchSource.makeTimerSource(queue: DispatchQueue.global(qos: .utility))
         startCleanupTimer()
     }
 
     deinit {
-        cleanupTimer?.invalidate()
+        cleanupTimer.cancel()
     }
 
     public func recordSuccess(connectId: UInt32, latency: TimeInterval) {
+        lock.lock()
         let tracker = getOrCreateTracker(connectId: connectId)
 
         tracker.successCount += 1
@@ -134,15 +153,17 @@ public final class ConnectionHealthMonitor {
 
         let previousStatus = tracker.status
         tracker.updateStatus(config: configuration)
+        let health = previousStatus != tracker.status ? tracker.toConnectionHealth() : nil
+        lock.unlock()
 
-        if previousStatus != tracker.status {
-            let health = tracker.toConnectionHealth()
-            Log.info("[HealthMonitor]  Connection \(connectId) status: \(previousStatus.rawValue) → \(tracker.status.rawValue)")
+        if let health = health {
+            Log.info("[HealthMonitor]  Connection \(connectId) status: \(previousStatus.rawValue) → \(health.status.rawValue)")
             healthStatusPublisher.send(health)
         }
     }
 
     public func recordFailure(connectId: UInt32, error: NetworkFailure) {
+        lock.lock()
         let tracker = getOrCreateTracker(connectId: connectId)
 
         tracker.failureCount += 1
@@ -151,23 +172,30 @@ public final class ConnectionHealthMonitor {
 
         let previousStatus = tracker.status
         tracker.updateStatus(config: configuration)
+        let health = previousStatus != tracker.status ? tracker.toConnectionHealth() : nil
+        lock.unlock()
 
-        if previousStatus != tracker.status {
-            let health = tracker.toConnectionHealth()
-            Log.warning("[HealthMonitor]  Connection \(connectId) status: \(previousStatus.rawValue) → \(tracker.status.rawValue)")
+        if let health = health {
+            Log.warning("[HealthMonitor]  Connection \(connectId) status: \(previousStatus.rawValue) → \(health.status.rawValue)")
             healthStatusPublisher.send(health)
         }
     }
 
     public func getHealth(connectId: UInt32) -> ConnectionHealth? {
+        lock.lock()
+        defer { lock.unlock() }
         return connectionHealth[connectId]?.toConnectionHealth()
     }
 
     public func getAllHealth() -> [ConnectionHealth] {
+        lock.lock()
+        defer { lock.unlock() }
         return connectionHealth.values.map { $0.toConnectionHealth() }
     }
 
     public func isHealthy(connectId: UInt32) -> Bool {
+        lock.lock()
+        defer { lock.unlock() }
         guard let tracker = connectionHealth[connectId] else {
             return true
         }
@@ -180,28 +208,35 @@ public final class ConnectionHealthMonitor {
     }
 
     public func markConnectionHealthy(connectId: UInt32) {
+        lock.lock()
         guard let tracker = connectionHealth[connectId] else {
+            lock.unlock()
             return
         }
 
         tracker.consecutiveFailures = 0
         let previousStatus = tracker.status
         tracker.updateStatus(config: configuration)
+        let health = previousStatus != tracker.status ? tracker.toConnectionHealth() : nil
+        lock.unlock()
 
-        if previousStatus != tracker.status {
-            let health = tracker.toConnectionHealth()
-            Log.info("[HealthMonitor] [OK] Connection \(connectId) marked healthy: \(previousStatus.rawValue) → \(tracker.status.rawValue)")
+        if let health = health {
+            Log.info("[HealthMonitor] [OK] Connection \(connectId) marked healthy: \(previousStatus.rawValue) → \(health.status.rawValue)")
             healthStatusPublisher.send(health)
         }
     }
 
     public func resetHealth(connectId: UInt32) {
+        lock.lock()
         connectionHealth.removeValue(forKey: connectId)
+        lock.unlock()
         Log.info("[HealthMonitor]  Reset health for connection \(connectId)")
     }
 
     public func resetAllHealth() {
+        lock.lock()
         connectionHealth.removeAll()
+        lock.unlock()
         Log.info("[HealthMonitor]  Reset all connection health")
     }
 
@@ -216,20 +251,19 @@ public final class ConnectionHealthMonitor {
     }
 
     private func startCleanupTimer() {
-        cleanupTimer = Timer.scheduledTimer(
-            withTimeInterval: configuration.cleanupInterval,
-            repeats: true
-        ) { [weak self] _ in
-            Task { @MainActor in
-                self?.cleanupStaleConnections()
-            }
+        let interval = max(1.0, configuration.cleanupInterval)
+        cleanupTimer.schedule(deadline: .now() + interval, repeating: interval, leeway: .seconds(1))
+        cleanupTimer.setEventHandler { [weak self] in
+            self?.cleanupStaleConnections()
         }
+        cleanupTimer.resume()
     }
 
     private func cleanupStaleConnections() {
         let cutoff = Date().addingTimeInterval(-configuration.staleConnectionTimeout)
         var removed = 0
 
+        lock.lock()
         for (connectId, tracker) in connectionHealth {
 
             let lastActivity = max(tracker.lastSuccessTime ?? tracker.firstTrackingTime,
@@ -240,6 +274,7 @@ public final class ConnectionHealthMonitor {
                 removed += 1
             }
         }
+        lock.unlock()
 
         if removed > 0 {
             Log.info("[HealthMonitor]  Cleaned up \(removed) stale connections")
@@ -247,6 +282,9 @@ public final class ConnectionHealthMonitor {
     }
 
     public func getStatistics() -> HealthStatistics {
+        lock.lock()
+        defer { lock.unlock() }
+
         let allHealth = connectionHealth.values.map { $0.toConnectionHealth() }
 
         let healthy = allHealth.filter { $0.status == .healthy }.count
@@ -260,6 +298,14 @@ public final class ConnectionHealthMonitor {
 
         let overallSuccessRate = totalRequests > 0 ? Double(totalSuccess) / Double(totalRequests) : 1.0
 
+        let aggregate = ecliptix_latency_sketch_create(nil)
+        defer { ecliptix_latency_sketch_destroy(aggregate) }
+        for tracker in connectionHealth.values {
+            _ = ecliptix_latency_sketch_merge(aggregate, tracker.latencySketch)
+        }
+        var latency = ecliptix_latency_summary_t()
+        ecliptix_latency_sketch_get_summary(aggregate, &latency)
+
         return HealthStatistics(
             totalConnections: allHealth.count,
             healthyConnections: healthy,
@@ -268,7 +314,11 @@ public final class ConnectionHealthMonitor {
             criticalConnections: critical,
             overallSuccessRate: overallSuccessRate,
             totalSuccesses: totalSuccess,
-            totalFailures: totalFailure
+            totalFailures: totalFailure,
+            p50Latency: TimeInterval(latency.p50_us) / 1_000_000,
+            p95Latency: TimeInterval(latency.p95_us) / 1_000_000,
+            p99Latency: TimeInterval(latency.p99_us) / 1_000_000,
+            maxLatency: TimeInterval(latency.max_us) / 1_000_000
         )
     }
 }
@@ -329,6 +379,10 @@ public struct HealthStatistics {
     public let overallSuccessRate: Double
     public let totalSuccesses: Int
     public let totalFailures: Int
+    public let p50Latency: TimeInterval
+    public let p95Latency: TimeInterval
+    public let p99Latency: TimeInterval
+    public let maxLatency: TimeInterval
 
     public var healthyPercentage: Double {
         guard totalConnections > 0 else { return 1.0 }
@@ -1,68 +1,129 @@
+import CEcliptixNetworking
+import CryptoKit
 import EcliptixCore
 import Foundation
 
-@MainActor
-public final class NetworkCache {
+public final class NetworkCache: @unchecked Sendable {
 
-    private struct CacheEntry {
-        let responseData: Data
-        let cachedAt: Date
-        let expiresAt: Date
-        let requestKey: String
-        let etag: String?
-
-        var isExpired: Bool {
-            return Date() > expiresAt
-        }
-
-        var age: TimeInterval {
-            return Date().timeIntervalSince(cachedAt)
-        }
+    private struct CachedValue {
+        var responseData: Data?
+        var etag: String?
+        var tags: [String] = []
+        var age: TimeInterval = 0
+        var remainingTimeToLive: TimeInterval = 0
     }
 
     private let configuration: NetworkCacheConfiguration
 
-    private var memoryCache: [String: CacheEntry] = [:]
+    nonisolated(unsafe) private let storage: OpaquePointer?
+
+    nonisolated(unsafe) private let diskStorage: OpaquePointer?
 
-    private var cacheHits: Int = 0
-    private var cacheMisses: Int = 0
-    private var cacheEvictions: Int = 0
+    private let cleanupTimer: DispatchSourceTimer
 
-    nonisolated(unsafe) private var cleanupTimer: Timer?
+    public convenience init(configuration: NetworkCacheConfiguration = .default) {
+        self.init(configuration: configuration, diskLocation: nil)
+    }
 
-    public init(configuration: NetworkCacheConfiguration = .default) {
+    init(configuration: NetworkCacheConfiguration, diskLocation: (directory: URL, key: Data)?) {
         self.configuration = configuration
 
+        var cacheConfig = ecliptix_response_cache_config_t(
+            max_total_bytes: UInt64(max(0, configuration.maxCacheBytes)),
+            max_entry_bytes: UInt64(max(0, configuration.maxCacheEntrySize)),
+            shard_count: UInt32(max(1, configuration.shardCount)),
+            protected_percent: 80,
+            prefix_delimiter: CChar(UInt8(ascii: "/"))
+        )
+        self.storage = ecliptix_response_cache_create(&cacheConfig)
+        if storage == nil {
+            Log.error("[NetworkCache] Failed to create native response cache - caching disabled")
+        }
+
+        self.diskStorage = configuration.enabled && configuration.maxDiskCacheBytes > 0
+            ? Self.openDiskTier(configuration: configuration, location: diskLocation)
+            : nil
+
+        cleanupTimer = DispatchSource.makeTimerSource(queue: DispatchQueue.global(qos: .utility))
         startCleanupTimer()
     }
 
     deinit {
-        cleanupTimer?.invalidate()
+        cleanupTimer.cancel()
+        ecliptix_response_cache_destroy(storage)
+        ecliptix_disk_cache_destroy(diskStorage)
     }
 
     public func getCachedResponse(requestKey: String) -> Data? {
-        guard let entry = memoryCache[requestKey] else {
-            cacheMisses += 1
+        var value = CachedValue()
+        let result = Self.withUTF8Bytes(requestKey) { key, keyLength in
+            withUnsafeMutablePointer(to: &value) { valuePointer in
+                ecliptix_response_cache_get(storage, key, keyLength, { data, length, etag, etagLength, ageMs, context in
+                    guard let context = context else { return }
+                    let value = context.assumingMemoryBound(to: CachedValue.self)
+                    value.pointee.responseData = data.map { Data(bytes: $0, count: length) } ?? Data()
+                    if let etag = etag, etagLength > 0 {
+                        value.pointee.etag = String(decoding: UnsafeBufferPointer(start: etag, count: etagLength), as: UTF8.self)
+                    }
+                    value.pointee.age = TimeInterval(ageMs) / 1000
+                }, valuePointer)
+            }
+        }
+
+        guard result == ECLIPTIX_NET_SUCCESS, let responseData = value.responseData else {
+            return getDiskCachedResponse(requestKey: requestKey)
+        }
+
+        Log.debug("[NetworkCache] [OK] Cache HIT for key: \(requestKey) (age: \(String(format: "%.1f", value.age))s)")
+        return responseData
+    }
+
+    private func getDiskCachedResponse(requestKey: String) -> Data? {
+        guard let diskStorage = diskStorage else {
             return nil
         }
 
-        if entry.isExpired {
-            memoryCache.removeValue(forKey: requestKey)
-            cacheMisses += 1
-            Log.debug("[NetworkCache] ⏰ Cache EXPIRED for key: \(requestKey)")
+        var value = CachedValue()
+        let result = Self.withUTF8Bytes(requestKey) { key, keyLength in
+            withUnsafeMutablePointer(to: &value) { valuePointer in
+                ecliptix_disk_cache_get(diskStorage, key, keyLength, { data, length, etag, etagLength, tags, tagsLength, remainingMs, context in
+                    guard let context = context else { return }
+                    let value = context.assumingMemoryBound(to: CachedValue.self)
+                    value.pointee.responseData = data.map { Data(bytes: $0, count: length) } ?? Data()
+                    if let etag = etag, etagLength > 0 {
+                        value.pointee.etag = String(decoding: UnsafeBufferPointer(start: etag, count: etagLength), as: UTF8.self)
+                    }
+                    if let tags = tags, tagsLength > 0 {
+                        value.pointee.tags = UnsafeBufferPointer(start: tags, count: tagsLength)
+                            .split(separator: 0)
+                            .map { String(decoding: $0, as: UTF8.self) }
+                    }
+                    value.pointee.remainingTimeToLive = TimeInterval(remainingMs) / 1000
+                }, valuePointer)
+            }
+        }
+
+        guard result == ECLIPTIX_NET_SUCCESS, let responseData = value.responseData else {
             return nil
         }
 
-        cacheHits += 1
-        Log.debug("[NetworkCache] [OK] Cache HIT for key: \(requestKey) (age: \(String(format: "%.1f", entry.age))s)")
-        return entry.responseData
+        storeInMemory(
+            requestKey: requestKey,
+            responseData: responseData,
+            timeToLive: value.remainingTimeToLive,
+            etag: value.etag,
+            tags: value.tags
+        )
+        Log.debug("[NetworkCache] [OK] Disk cache HIT for key: \(requestKey) (promoted, TTL left: \(String(format: "%.0f", value.remainingTimeToLive))s)")
+        return responseData
     }
 
     public func cacheResponse(
         requestKey: String,
         responseData: Data,
         timeToLive: TimeInterval? = nil,
-        etag: String? = nil
+        etag: String? = nil,
+        tags: [String] = []
     ) {
 
         guard configuration.enabled else {
@@ -74,46 +135,129 @@ public final class NetworkCache {
             return
         }
 
-        if memoryCache.count >= configuration.maxCacheEntries {
-            evictOldestEntry()
+        let ttl = timeToLive ?? configuration.defaultTimeToLive
+        guard storeInMemory(requestKey: requestKey, responseData: responseData, timeToLive: ttl, etag: etag, tags: tags) else {
+            return
         }
+        storeOnDisk(requestKey: requestKey, responseData: responseData, timeToLive: ttl, etag: etag, tags: tags)
+        Log.debug("[NetworkCache]  Cached response for key: \(requestKey) (size: \(responseData.count) bytes, TTL: \(String(format: "%.0f", ttl))s)")
+    }
 
-        let ttl = timeToLive ?? configuration.defaultTimeToLive
-        let entry = CacheEntry(
-            responseData: responseData,
-            cachedAt: Date(),
-            expiresAt: Date().addingTimeInterval(ttl),
-            requestKey: requestKey,
-            etag: etag
-        )
+    @discardableResult
+    private func storeInMemory(
+        requestKey: String,
+        responseData: Data,
+        timeToLive ttl: TimeInterval,
+        etag: String?,
+        tags: [String]
+    ) -> Bool {
+        let result = Self.withUTF8Bytes(requestKey) { key, keyLength in
+            Self.withUTF8Bytes(etag ?? "") { etagBytes, etagLength in
+                Self.withUTF8Bytes(tags.joined(separator: "\0")) { tagBytes, tagsLength in
+                    responseData.withUnsafeBytes { valueBuffer in
+                        ecliptix_response_cache_put(
+                            storage,
+                            key, keyLength,
+                            valueBuffer.bindMemory(to: UInt8.self).baseAddress, valueBuffer.count,
+                            etagBytes, etagLength,
+                            UInt64(max(0.001, ttl) * 1000),
+                            tagBytes, tagsLength
+                        )
+                    }
+                }
+            }
+        }
 
-        memoryCache[requestKey] = entry
-        Log.debug("[NetworkCache]  Cached response for key: \(requestKey) (size: \(responseData.count) bytes, TTL: \(String(format: "%.0f", ttl))s)")
+        guard result == ECLIPTIX_NET_SUCCESS else {
+            Log.warning("[NetworkCache] [WARNING] Response not cached for key: \(requestKey) (native result: \(result.rawValue))")
+            return false
+        }
+        return true
+    }
+
+    private func storeOnDisk(
+        requestKey: String,
+        responseData: Data,
+        timeToLive ttl: TimeInterval,
+        etag: String?,
+        tags: [String]
+    ) {
+        guard let diskStorage = diskStorage else {
+            return
+        }
+
+        let result = Self.withUTF8Bytes(requestKey) { key, keyLength in
+            Self.withUTF8Bytes(etag ?? "") { etagBytes, etagLength in
+                Self.withUTF8Bytes(tags.joined(separator: "\0")) { tagBytes, tagsLength in
+                    responseData.withUnsafeBytes { valueBuffer in
+                        ecliptix_disk_cache_put(
+                            diskStorage,
+                            key, keyLength,
+                            valueBuffer.bindMemory(to: UInt8.self).baseAddress, valueBuffer.count,
+                            etagBytes, etagLength,
+                            UInt64(max(0.001, ttl) * 1000),
+                            tagBytes, tagsLength
+                        )
+                    }
+                }
+            }
+        }
+
+        if result != ECLIPTIX_NET_SUCCESS {
+            Log.debug("[NetworkCache] Disk write skipped for key: \(requestKey) (native result: \(result.rawValue))")
+        }
     }
 
     public func invalidate(requestKey: String) {
 
-        if memoryCache.removeValue(forKey: requestKey) != nil {
+        let result = Self.withUTF8Bytes(requestKey) { key, keyLength in
+            ecliptix_response_cache_invalidate(storage, key, keyLength)
+        }
+        let diskResult = Self.withUTF8Bytes(requestKey) { key, keyLength in
+            ecliptix_disk_cache_remove(diskStorage, key, keyLength)
+        }
+        if result == ECLIPTIX_NET_SUCCESS || diskResult == ECLIPTIX_NET_SUCCESS {
             Log.debug("[NetworkCache]  Invalidated cache for key: \(requestKey)")
         }
     }
 
-    public func invalidateByPattern(_ pattern: String) {
+    public func invalidateByPrefix(_ prefix: String) {
+
+        let removed = Self.withUTF8Bytes(prefix) { bytes, length in
+            ecliptix_response_cache_invalidate_prefix(storage, bytes, length)
+                + ecliptix_disk_cache_remove_prefix(diskStorage, bytes, length)
+        }
+        if removed > 0 {
+            Log.debug("[NetworkCache]  Invalidated \(removed) cache entries with prefix: \(prefix)")
+        }
+    }
 
-        let keysToRemove = memoryCache.keys.filter { $0.contains(pattern) }
-        for key in keysToRemove {
-            memoryCache.removeValue(forKey: key)
+    public func invalidateByTag(_ tag: String) {
+
+        let removed = Self.withUTF8Bytes(tag) { bytes, length in
+            ecliptix_response_cache_invalidate_tag(storage, bytes, length)
+                + ecliptix_disk_cache_remove_tag(diskStorage, bytes, length)
+        }
+        if removed > 0 {
+            Log.debug("[NetworkCache]  Invalidated \(removed) cache entries tagged: \(tag)")
         }
+    }
 
-        if !keysToRemove.isEmpty {
-            Log.debug("[NetworkCache]  Invalidated \(keysToRemove.count) cache entries matching pattern: \(pattern)")
+    public func invalidateByPattern(_ pattern: String) {
+
+        let removed = Self.withUTF8Bytes(pattern) { bytes, length in
+            ecliptix_response_cache_invalidate_matching(storage, bytes, length)
+                + ecliptix_disk_cache_remove_matching(diskStorage, bytes, length)
+        }
+        if removed > 0 {
+            Log.debug("[NetworkCache]  Invalidated \(removed) cache entries matching pattern: \(pattern)")
         }
     }
 
     public func clearAll() {
 
-        let count = memoryCache.count
-        memoryCache.removeAll()
+        let count = ecliptix_response_cache_clear(storage)
+        ecliptix_disk_cache_clear(diskStorage)
 
         Log.info("[NetworkCache]  Cleared all \(count) cache entries")
     }
@@ -136,66 +280,131 @@ public final class NetworkCache {
         }
     }
 
-    private func evictOldestEntry() {
-        guard let oldestKey = memoryCache
-            .min(by: { $0.value.cachedAt < $1.value.cachedAt })?
-            .key
-        else {
+    public func flushToDisk() {
+        guard let diskStorage = diskStorage else {
             return
         }
 
-        memoryCache.removeValue(forKey: oldestKey)
-        cacheEvictions += 1
-        Log.debug("[NetworkCache]  Evicted oldest cache entry: \(oldestKey)")
+        let result = ecliptix_disk_cache_flush(diskStorage)
+        if result != ECLIPTIX_NET_SUCCESS {
+            Log.warning("[NetworkCache] [WARNING] Disk cache flush failed (native result: \(result.rawValue))")
+        }
     }
 
-    private func startCleanupTimer() {
-        cleanupTimer = Timer.scheduledTimer(
-            withTimeInterval: configuration.cleanupInterval,
-            repeats: true
-        ) { [weak self] _ in
-            Task { @MainActor in
-                await self?.cleanupExpiredEntries()
+    private static func openDiskTier(
+        configuration: NetworkCacheConfiguration,
+        location: (directory: URL, key: Data)?
+    ) -> OpaquePointer? {
+        guard let location = location ?? defaultDiskLocation(configuration: configuration) else {
+            return nil
+        }
+        let directory = location.directory
+
+        let diskStorage = directory.path.withCString { directoryPath in
+            location.key.withUnsafeBytes { keyBuffer in
+                var diskConfig = ecliptix_disk_cache_config_t(
+                    directory: directoryPath,
+                    key: keyBuffer.bindMemory(to: UInt8.self).baseAddress,
+                    key_len: keyBuffer.count,
+                    max_bytes: UInt64(configuration.maxDiskCacheBytes),
+                    max_pending_writes: 0
+                )
+                return ecliptix_disk_cache_create(&diskConfig)
             }
         }
+
+        if diskStorage == nil {
+            Log.error("[NetworkCache] Failed to open disk cache at \(directory.path) - disk tier disabled")
+        } else {
+            Log.info("[NetworkCache] Disk tier opened at \(directory.path)")
+        }
+        return diskStorage
     }
 
-    private func cleanupExpiredEntries() async {
-        let expiredKeys = memoryCache.filter { $0.value.isExpired }.map { $0.key }
+    private static func defaultDiskLocation(configuration: NetworkCacheConfiguration) -> (directory: URL, key: Data)? {
+        let keychainStorage = KeychainStorage()
+        let keyData: Data
+
+        do {
+            keyData = try keychainStorage.retrieve(forKey: "ecliptix.network_cache.encryption_key")
+        } catch KeychainError.notFound {
+            let newKey = SymmetricKey(size: .bits256)
+            keyData = newKey.withUnsafeBytes { Data($0) }
+
+            do {
+                try keychainStorage.store(keyData, forKey: "ecliptix.network_cache.encryption_key")
+            } catch {
+                Log.error("[NetworkCache] Failed to store disk cache key: \(error) - disk tier disabled")
+                return nil
+            }
+        } catch {
+            Log.error("[NetworkCache] Failed to retrieve disk cache key: \(error) - disk tier disabled")
+            return nil
+        }
 
-        for key in expiredKeys {
-            memoryCache.removeValue(forKey: key)
+        guard let cachesURL = FileManager.default.urls(for: .cachesDirectory, in: .userDomainMask).first else {
+            return nil
         }
+        return (cachesURL.appendingPathComponent(configuration.diskDirectoryName), keyData)
+    }
 
-        if !expiredKeys.isEmpty {
-            Log.debug("[NetworkCache]  Cleaned up \(expiredKeys.count) expired cache entries")
+    private func startCleanupTimer() {
+        let interval = max(1.0, configuration.cleanupInterval)
+        cleanupTimer.schedule(deadline: .now() + interval, repeating: interval, leeway: .seconds(1))
+        cleanupTimer.setEventHandler { [weak self] in
+            self?.cleanupExpiredEntries()
+        }
+        cleanupTimer.resume()
+    }
+
+    private func cleanupExpiredEntries() {
+        let removed = ecliptix_response_cache_purge_expired(storage)
+
+        if removed > 0 {
+            Log.debug("[NetworkCache]  Cleaned up \(removed) expired cache entries")
         }
     }
 
     public func getStatistics() -> CacheStatistics {
 
-        let totalSize = memoryCache.values.reduce(0) { $0 + $1.responseData.count }
+        var stats = ecliptix_response_cache_stats_t()
+        ecliptix_response_cache_get_stats(storage, &stats)
+
+        var diskStats = ecliptix_disk_cache_stats_t()
+        ecliptix_disk_cache_get_stats(diskStorage, &diskStats)
+
+        let cacheHits = Int(stats.hits)
+        let cacheMisses = Int(stats.misses)
         let totalRequests = cacheHits + cacheMisses
         let hitRate = totalRequests > 0 ? Double(cacheHits) / Double(totalRequests) : 0.0
 
         return CacheStatistics(
-            entryCount: memoryCache.count,
-            totalSizeBytes: totalSize,
+            entryCount: Int(stats.entries),
+            totalSizeBytes: Int(stats.total_bytes),
             cacheHits: cacheHits,
             cacheMisses: cacheMisses,
-            cacheEvictions: cacheEvictions,
-            hitRate: hitRate
+            cacheEvictions: Int(stats.evictions),
+            hitRate: hitRate,
+            diskEntryCount: Int(diskStats.entries),
+            diskSizeBytes: Int(diskStats.live_bytes),
+            diskHits: Int(diskStats.hits)
         )
     }
 
     public func resetStatistics() {
 
-        cacheHits = 0
-        cacheMisses = 0
-        cacheEvictions = 0
+        ecliptix_response_cache_reset_stats(storage)
 
         Log.debug("[NetworkCache]  Reset cache statistics")
     }
+
+    private static func withUTF8Bytes<T>(
+        _ string: String,
+        _ body: (UnsafePointer<UInt8>?, Int) -> T
+    ) -> T {
+        var string = string
+        return string.withUTF8 { body($0.baseAddress, $0.count) }
+    }
 }
 
 public enum CachePolicy {
@@ -213,24 +422,36 @@ public struct NetworkCacheConfiguration: Sendable {
 
     public let enabled: Bool
 
-    public let maxCacheEntries: Int
+    public let maxCacheBytes: Int
 
     public let maxCacheEntrySize: Int
 
+    public let shardCount: Int
+
+    public let maxDiskCacheBytes: Int
+
+    public let diskDirectoryName: String
+
     public let defaultTimeToLive: TimeInterval
 
     public let cleanupInterval: TimeInterval
 
     public init(
         enabled: Bool = true,
-        maxCacheEntries: Int = 100,
+        maxCacheBytes: Int = 8 * 1024 * 1024,
         maxCacheEntrySize: Int = 1024 * 1024,
+        shardCount: Int = 4,
+        maxDiskCacheBytes: Int = 32 * 1024 * 1024,
+        diskDirectoryName: String = "EcliptixNetworkCache",
         defaultTimeToLive: TimeInterval = 300.0,
         cleanupInterval: TimeInterval = 60.0
     ) {
         self.enabled = enabled
-        self.maxCacheEntries = maxCacheEntries
+        self.maxCacheBytes = maxCacheBytes
         self.maxCacheEntrySize = maxCacheEntrySize
+        self.shardCount = shardCount
+        self.maxDiskCacheBytes = maxDiskCacheBytes
+        self.diskDirectoryName = diskDirectoryName
         self.defaultTimeToLive = defaultTimeToLive
         self.cleanupInterval = cleanupInterval
     }
@@ -238,21 +459,24 @@ public struct NetworkCacheConfiguration: Sendable {
     public static let `default` = NetworkCacheConfiguration()
 
     public static let aggressive = NetworkCacheConfiguration(
-        maxCacheEntries: 200,
+        maxCacheBytes: 32 * 1024 * 1024,
         maxCacheEntrySize: 5 * 1024 * 1024,
+        maxDiskCacheBytes: 128 * 1024 * 1024,
         defaultTimeToLive: 900.0
     )
 
     public static let conservative = NetworkCacheConfiguration(
-        maxCacheEntries: 50,
+        maxCacheBytes: 4 * 1024 * 1024,
         maxCacheEntrySize: 512 * 1024,
+        maxDiskCacheBytes: 8 * 1024 * 1024,
         defaultTimeToLive: 120.0
     )
 
     public static let disabled = NetworkCacheConfiguration(
         enabled: false,
-        maxCacheEntries: 0,
+        maxCacheBytes: 0,
         maxCacheEntrySize: 0,
+        maxDiskCacheBytes: 0,
         defaultTimeToLive: 0
     )
 }
@@ -264,6 +488,9 @@ public struct CacheStatistics {
     public let cacheMisses: Int
     public let cacheEvictions: Int
     public let hitRate: Double
+    public let diskEntryCount: Int
+    public let diskSizeBytes: Int
+    public let diskHits: Int
 
     public var averageEntrySizeBytes: Int {
         guard entryCount > 0 else { return 0 }
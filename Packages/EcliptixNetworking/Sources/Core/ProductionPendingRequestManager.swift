@@ -0,0 +1,457 @@
+@preconcurrency import Combine
+import CEcliptixNetworking
+import EcliptixCore
+import Foundation
+
+
+public protocol TypedPendingRequest: Sendable {
+    associatedtype ResultType
+    var id: UUID { get }
+    var connectId: UInt32? { get }
+    var enqueuedAt: Date { get }
+    func execute() async throws -> ResultType
+}
+
+public struct ConcretePendingRequest<T>: TypedPendingRequest {
+    public let id: UUID
+    public let connectId: UInt32?
+    public let enqueuedAt: Date
+    private let operation: @Sendable () async throws -> T
+
+    public init(
+        id: UUID = UUID(),
+        connectId: UInt32? = nil,
+        enqueuedAt: Date = Date(),
+        operation: @escaping @Sendable () async throws -> T
+    ) {
+        self.id = id
+        self.connectId = connectId
+        self.enqueuedAt = enqueuedAt
+        self.operation = operation
+    }
+
+    public func execute() async throws -> T {
+        try await operation()
+    }
+}
+
+
+public enum PendingRequestPriority: UInt8, Sendable {
+    case background = 0
+    case low = 64
+    case normal = 128
+    case high = 192
+    case critical = 255
+}
+
+public actor ProductionPendingRequestManager {
+    private var entries: [ecliptix_request_handle_t: PendingEntry] = [:]
+
+    private var handles: [UUID: ecliptix_request_handle_t] = [:]
+
+    private var isRetryingAll = false
+
+    private var stats = Statistics()
+
+    private let maxQueueSize: Int
+    private let maxRequestAge: TimeInterval
+    private let maxConcurrentRetries: Int
+
+    nonisolated(unsafe) private let queue: OpaquePointer?
+
+    private let messageBus: MessageBus
+
+    private var connectivitySubscription: AnyCancellable?
+
+    private struct PendingEntry {
+        let id: UUID
+        let priority: PendingRequestPriority
+        let deadline: Date
+        let operation: @Sendable () async throws -> Void
+        var metadata: RequestMetadata
+    }
+
+    private struct RequestMetadata {
+        let connectId: UInt32?
+        let enqueuedAt: Date
+        let operationName: String?
+        var retryCount: Int
+    }
+
+    private struct Statistics {
+        var totalQueued: Int = 0
+        var totalProcessed: Int = 0
+        var totalFailed: Int = 0
+        var totalRequeued: Int = 0
+    }
+
+    public init(
+        maxQueueSize: Int = 100,
+        maxRequestAge: TimeInterval = 300,
+        maxConcurrentRetries: Int = 4,
+        retriesPerSecond: Double = 10,
+        messageBus: MessageBus = GlobalMessageBus
+    ) {
+        self.maxQueueSize = maxQueueSize
+        self.maxRequestAge = maxRequestAge
+        self.maxConcurrentRetries = max(1, maxConcurrentRetries)
+        self.messageBus = messageBus
+
+        var queueConfig = ecliptix_request_queue_config_t(
+            capacity: UInt32(clamping: max(1, maxQueueSize)),
+            max_in_flight: UInt32(clamping: max(1, maxConcurrentRetries)),
+            refill_per_second: retriesPerSecond > 0 ? retriesPerSecond : 0,
+            burst: 0
+        )
+        self.queue = ecliptix_request_queue_create(&queueConfig)
+
+        if queue == nil {
+            Log.error("[ProductionPendingRequestManager] Failed to create native request queue - requests will not be queued")
+        }
+
+        Log.info("[ProductionPendingRequestManager] Initialized (maxQueue: \(maxQueueSize), maxAge: \(String(format: "%.0fs", maxRequestAge)), maxConcurrent: \(self.maxConcurrentRetries))")
+
+        Task { [weak self] in
+            await self?.setupMessageBusSubscriptions()
+        }
+    }
+
+    deinit {
+        ecliptix_request_queue_destroy(queue)
+    }
+
+    @discardableResult
+    public func enqueue(
+        connectId: UInt32? = nil,
+        operationName: String? = nil,
+        priority: PendingRequestPriority = .normal,
+        timeout: TimeInterval? = nil,
+        operation: @escaping @Sendable () async throws -> Void
+    ) -> UUID {
+        let id = UUID()
+        let entry = makeEntry(
+            id: id,
+            connectId: connectId,
+            operationName: operationName,
+            priority: priority,
+            timeout: timeout,
+            operation: operation
+        )
+
+        if insert(entry) {
+            stats.totalQueued += 1
+            Log.info("[ProductionPendingRequestManager] Queued request [ID: \(id)] (queue: \(getTotalQueueSize()))")
+        }
+
+        return id
+    }
+
+    @discardableResult
+    public func enqueueTyped<T>(
+        connectId: UInt32? = nil,
+        operationName: String? = nil,
+        priority: PendingRequestPriority = .normal,
+        timeout: TimeInterval? = nil,
+        operation: @escaping @Sendable () async throws -> T
+    ) -> UUID {
+        let id = UUID()
+        let entry = makeEntry(
+            id: id,
+            connectId: connectId,
+            operationName: operationName,
+            priority: priority,
+            timeout: timeout
+        ) {
+            _ = try await operation()
+        }
+
+        if insert(entry) {
+            stats.totalQueued += 1
+            Log.info("[ProductionPendingRequestManager] Queued typed request [ID: \(id)] (queue: \(getTotalQueueSize()))")
+        }
+
+        return id
+    }
+
+    @discardableResult
+    public func retryAllPendingRequests() async throws -> (total: Int, success: Int, failure: Int) {
+        guard !isRetryingAll else {
+            Log.debug("[ProductionPendingRequestManager] Already retrying all requests")
+            return (0, 0, 0)
+        }
+
+        isRetryingAll = true
+        defer { isRetryingAll = false }
+
+        cleanExpiredRequests()
+
+        guard !entries.isEmpty else {
+            Log.debug("[ProductionPendingRequestManager] No requests to retry")
+            return (0, 0, 0)
+        }
+
+        Log.info("[ProductionPendingRequestManager] Retrying \(entries.count) pending requests (max \(maxConcurrentRetries) concurrent)...")
+
+        var successCount = 0
+        var failed: [PendingEntry] = []
+        var wasCancelled = false
+
+        await withTaskGroup(of: (ecliptix_request_handle_t, Bool).self) { group in
+            func settle(_ handle: ecliptix_request_handle_t, _ succeeded: Bool) {
+                ecliptix_request_queue_complete(queue, handle)
+                guard let entry = entries.removeValue(forKey: handle) else {
+                    return
+                }
+                handles.removeValue(forKey: entry.id)
+                if succeeded {
+                    successCount += 1
+                    stats.totalProcessed += 1
+                } else {
+                    failed.append(entry)
+                    stats.totalFailed += 1
+                }
+            }
+
+            var draining = true
+            while draining {
+                if Task.isCancelled {
+                    wasCancelled = true
+                    break
+                }
+
+                var handle: ecliptix_request_handle_t = 0
+                var waitMs: UInt64 = 0
+
+                switch ecliptix_request_queue_next(queue, &handle, &waitMs) {
+                case ECLIPTIX_REQUEST_READY:
+                    guard let entry = entries[handle] else {
+                        ecliptix_request_queue_complete(queue, handle)
+                        continue
+                    }
+                    group.addTask {
+                        do {
+                            try await entry.operation()
+                            return (handle, true)
+                        } catch {
+                            Log.warning("[ProductionPendingRequestManager] Request \(entry.id) failed: \(error)")
+                            return (handle, false)
+                        }
+                    }
+                case ECLIPTIX_REQUEST_EXPIRED:
+                    if let entry = entries.removeValue(forKey: handle) {
+                        handles.removeValue(forKey: entry.id)
+                        Log.debug("[ProductionPendingRequestManager] Request \(entry.id) expired before retry")
+                    }
+                case ECLIPTIX_REQUEST_THROTTLED:
+                    do {
+                        try await Task.sleep(nanoseconds: waitMs * 1_000_000)
+                    } catch {
+                        wasCancelled = true
+                        draining = false
+                    }
+                case ECLIPTIX_REQUEST_SATURATED:
+                    if case let (finished, succeeded)? = await group.next() {
+                        settle(finished, succeeded)
+                    } else {
+                        draining = false
+                    }
+                default:
+                    draining = false
+                }
+            }
+
+            for await (handle, succeeded) in group {
+                settle(handle, succeeded)
+            }
+        }
+
+        for var entry in failed {
+            entry.metadata.retryCount += 1
+            if insert(entry) {
+                stats.totalRequeued += 1
+            }
+        }
+
+        let failureCount = failed.count
+        let totalCount = successCount + failureCount
+
+        if wasCancelled {
+            Log.info("[ProductionPendingRequestManager] Retry cancelled: \(successCount) success, \(failureCount) failed, \(entries.count) still queued")
+            throw CancellationError()
+        }
+
+        Log.info("[ProductionPendingRequestManager] Retry complete: \(successCount) success, \(failureCount) failed")
+
+        await messageBus.publish(ManualRetryResponseMessage(
+            correlationId: UUID(),
+            requestId: UUID(),
+            retriedCount: totalCount,
+            successCount: successCount,
+            failureCount: failureCount
+        ))
+
+        return (totalCount, successCount, failureCount)
+    }
+
+    @discardableResult
+    public func cancel(requestId: UUID) -> Bool {
+        guard let handle = handles[requestId] else {
+            return false
+        }
+
+        let result = ecliptix_request_queue_cancel(queue, handle)
+        guard result == ECLIPTIX_NET_SUCCESS else {
+            Log.debug("[ProductionPendingRequestManager] Request \(requestId) not cancelled (native result: \(result.rawValue)) - already in flight")
+            return false
+        }
+
+        handles.removeValue(forKey: requestId)
+        entries.removeValue(forKey: handle)
+
+        Log.debug("[ProductionPendingRequestManager] Cancelled request \(requestId)")
+
+        return true
+    }
+
+    public func clearQueue() {
+        let count = getTotalQueueSize()
+
+        ecliptix_request_queue_clear(queue)
+        entries.removeAll()
+        handles.removeAll()
+
+        Log.info("[ProductionPendingRequestManager] Cleared queue (\(count) requests)")
+    }
+
+    public func getQueueSize() -> Int {
+        getTotalQueueSize()
+    }
+
+    public func isEmpty() -> Bool {
+        getTotalQueueSize() == 0
+    }
+
+    public func isFull() -> Bool {
+        getTotalQueueSize() >= maxQueueSize
+    }
+
+    public func getStatistics() -> (queued: Int, processed: Int, failed: Int, requeued: Int) {
+        (stats.totalQueued, stats.totalProcessed, stats.totalFailed, stats.totalRequeued)
+    }
+
+    private func getTotalQueueSize() -> Int {
+        entries.count
+    }
+
+    private func makeEntry(
+        id: UUID,
+        connectId: UInt32?,
+        operationName: String?,
+        priority: PendingRequestPriority,
+        timeout: TimeInterval?,
+        operation: @escaping @Sendable () async throws -> Void
+    ) -> PendingEntry {
+        let now = Date()
+        return PendingEntry(
+            id: id,
+            priority: priority,
+            deadline: now.addingTimeInterval(min(timeout ?? maxRequestAge, maxRequestAge)),
+            operation: operation,
+            metadata: RequestMetadata(
+                connectId: connectId,
+                enqueuedAt: now,
+                operationName: operationName,
+                retryCount: 0
+            )
+        )
+    }
+
+    private func insert(_ entry: PendingEntry) -> Bool {
+        let remaining = entry.deadline.timeIntervalSinceNow
+        guard remaining > 0 else {
+            Log.debug("[ProductionPendingRequestManager] Request \(entry.id) expired, not queued")
+            return false
+        }
+
+        var handle: ecliptix_request_handle_t = 0
+        var evicted: ecliptix_request_handle_t = 0
+        let result = ecliptix_request_queue_enqueue(
+            queue,
+            entry.priority.rawValue,
+            UInt64(max(1, (remaining * 1000).rounded(.up))),
+            &handle,
+            &evicted
+        )
+
+        switch result {
+        case ECLIPTIX_NET_SUCCESS:
+            break
+        case ECLIPTIX_NET_ERROR_CAPACITY:
+            Log.warning("[ProductionPendingRequestManager] Queue full (\(maxQueueSize)), dropping request \(entry.id) ranked below every queued request")
+            return false
+        default:
+            Log.error("[ProductionPendingRequestManager] Native request queue rejected request \(entry.id) (native result: \(result.rawValue))")
+            return false
+        }
+
+        if evicted != 0, let dropped = entries.removeValue(forKey: evicted) {
+            handles.removeValue(forKey: dropped.id)
+            Log.warning("[ProductionPendingRequestManager] Queue full (\(maxQueueSize)), evicted request \(dropped.id)")
+        }
+
+        entries[handle] = entry
+        handles[entry.id] = handle
+        return true
+    }
+
+    private func cleanExpiredRequests() {
+        var expired: [ecliptix_request_handle_t] = []
+        withUnsafeMutablePointer(to: &expired) { expiredPointer in
+            _ = ecliptix_request_queue_purge_expired(queue, { handle, context in
+                context?.assumingMemoryBound(to: [ecliptix_request_handle_t].self).pointee.append(handle)
+            }, expiredPointer)
+        }
+
+        for handle in expired {
+            if let entry = entries.removeValue(forKey: handle) {
+                handles.removeValue(forKey: entry.id)
+            }
+        }
+
+        if !expired.isEmpty {
+            Log.info("[ProductionPendingRequestManager] Cleaned \(expired.count) expired requests")
+        }
+    }
+
+    private func setupMessageBusSubscriptions() {
+        Task {
+            connectivitySubscription = await messageBus.subscribe(
+                lifetime: .strong
+            ) { [weak self] (message: ConnectivityRestoredMessage) in
+                await self?.handleConnectivityRestored(message)
+            }
+
+            let _ = await messageBus.subscribe(
+                lifetime: .strong
+            ) { [weak self] (message: ManualRetryRequestedMessage) in
+                await self?.handleManualRetryRequest(message)
+            }
+        }
+    }
+
+    private func handleConnectivityRestored(_ message: ConnectivityRestoredMessage) async {
+        Log.info("[ProductionPendingRequestManager] Connectivity restored, retrying pending requests...")
+        _ = try? await retryAllPendingRequests()
+    }
+
+    private func handleManualRetryRequest(_ message: ManualRetryRequestedMessage) async {
+        Log.info("[ProductionPendingRequestManager] Manual retry requested")
+        _ = try? await retryAllPendingRequests()
+    }
+}
+
+extension ProductionPendingRequestManager: CustomStringConvertible {
+    nonisolated public var description: String {
+        return "ProductionPendingRequestManager"
+    }
+}
@@ -0,0 +1,105 @@
+import CryptoKit
+import EcliptixCore
+import Foundation
+
+public struct CoalescingStatistics: Sendable {
+    public var executions: Int = 0
+    public var coalescedCalls: Int = 0
+    public var failedExecutions: Int = 0
+    public var savedRequestBytes: Int = 0
+    public var savedLatency: TimeInterval = 0
+
+    public var savedFraction: Double {
+        let total = executions + coalescedCalls
+        return total > 0 ? Double(coalescedCalls) / Double(total) : 0
+    }
+}
+
+@MainActor
+public final class RequestCoalescer {
+
+    private final class Flight {
+        let statisticsKey: String
+        let requestBytes: Int
+        let startTime: Date
+        var waiters: [CheckedContinuation<Result<Data, NetworkFailure>, Never>] = []
+
+        init(statisticsKey: String, requestBytes: Int) {
+            self.statisticsKey = statisticsKey
+            self.requestBytes = requestBytes
+            self.startTime = Date()
+        }
+    }
+
+    private var flights: [String: Flight] = [:]
+
+    private var statistics: [String: CoalescingStatistics] = [:]
+
+    public init() {}
+
+    public var inFlightCount: Int {
+        flights.count
+    }
+
+    public static func fingerprint(connectId: UInt32, operation: String, payload: Data) -> String {
+        var hasher = SHA256()
+        withUnsafeBytes(of: connectId.littleEndian) { hasher.update(bufferPointer: $0) }
+        hasher.update(data: Data(operation.utf8))
+        hasher.update(data: payload)
+        let digest = hasher.finalize().prefix(16).map { String(format: "%02x", $0) }.joined()
+        return "\(connectId)_\(operation)_\(digest)"
+    }
+
+    public func execute(
+        key: String,
+        statisticsKey: String,
+        requestBytes: Int = 0,
+        operation: () async -> Result<Data, NetworkFailure>
+    ) async -> Result<Data, NetworkFailure> {
+
+        if let flight = flights[key] {
+            statistics[flight.statisticsKey, default: CoalescingStatistics()].coalescedCalls += 1
+            Log.debug("[RequestCoalescer] Joined in-flight request \(key) (\(flight.waiters.count + 1) waiting)")
+            return await withCheckedContinuation { continuation in
+                flight.waiters.append(continuation)
+            }
+        }
+
+        let flight = Flight(statisticsKey: statisticsKey, requestBytes: requestBytes)
+        flights[key] = flight
+
+        let result = await operation()
+
+        flights.removeValue(forKey: key)
+
+        var keyStatistics = statistics[statisticsKey, default: CoalescingStatistics()]
+        keyStatistics.executions += 1
+        if case .failure = result {
+            keyStatistics.failedExecutions += 1
+        }
+        if !flight.waiters.isEmpty {
+            keyStatistics.savedRequestBytes += flight.requestBytes * flight.waiters.count
+            keyStatistics.savedLatency += Date().timeIntervalSince(flight.startTime) * Double(flight.waiters.count)
+            Log.info("[RequestCoalescer] Shared result of \(key) with \(flight.waiters.count) duplicate call(s)")
+        }
+        statistics[statisticsKey] = keyStatistics
+
+        for waiter in flight.waiters {
+            waiter.resume(returning: result)
+        }
+
+        return result
+    }
+
+    public func getStatistics() -> [String: CoalescingStatistics] {
+        statistics
+    }
+
+    public func getStatistics(for statisticsKey: String) -> CoalescingStatistics {
+        statistics[statisticsKey] ?? CoalescingStatistics()
+    }
+
+    public func resetStatistics() {
+        statistics.removeAll()
+    }
+}
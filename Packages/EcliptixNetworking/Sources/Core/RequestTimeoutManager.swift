@@ -1,3 +1,4 @@
+import CEcliptixNetworking
 import EcliptixCore
 import Foundation
 
@@ -6,25 +7,24 @@ public final class RequestTimeoutManager {
 
     private class TimeoutEntry {
         let requestId: String
+        let timerId: ecliptix_timer_id_t
         let startTime: Date
-        let timeoutDuration: TimeInterval
+        var timeoutDuration: TimeInterval
         let onTimeout: () -> Void
 
         init(
             requestId: String,
+            timerId: ecliptix_timer_id_t,
             timeoutDuration: TimeInterval,
             onTimeout: @escaping () -> Void
         ) {
             self.requestId = requestId
+            self.timerId = timerId
             self.startTime = Date()
             self.timeoutDuration = timeoutDuration
             self.onTimeout = onTimeout
         }
 
-        var isTimedOut: Bool {
-            return Date().timeIntervalSince(startTime) >= timeoutDuration
-        }
-
         var remainingTime: TimeInterval {
             let elapsed = Date().timeIntervalSince(startTime)
             return max(0, timeoutDuration - elapsed)
@@ -35,11 +35,25 @@ public final class RequestTimeoutManager {
         }
     }
 
+    private final class ExpiryRelay: @unchecked Sendable {
+        weak var manager: RequestTimeoutManager?
+
+        func timerExpired(_ timerId: ecliptix_timer_id_t) {
+            Task { @MainActor [weak self] in
+                self?.manager?.handleExpiredTimer(timerId)
+            }
+        }
+    }
+
     private let configuration: TimeoutConfiguration
 
     private var activeTimeouts: [String: TimeoutEntry] = [:]
 
-    nonisolated(unsafe) private var checkTimer: Timer?
+    private var requestIdsByTimer: [ecliptix_timer_id_t: String] = [:]
+
+    private let expiryRelay: ExpiryRelay
+
+    nonisolated(unsafe) private let timerWheel: OpaquePointer?
 
     private var totalTimeouts: Int = 0
     private var totalRequests: Int = 0
@@ -47,11 +61,31 @@ public final class RequestTimeoutManager {
     public init(configuration: TimeoutConfiguration = .default) {
         self.configuration = configuration
 
-        startCheckTimer()
+        let relay = ExpiryRelay()
+        self.expiryRelay = relay
+
+        var wheelConfig = ecliptix_timer_wheel_config_t(
+            tick_us: UInt32(Self.clampedMicroseconds(configuration.timerResolution, minimum: 1, maximum: UInt64(UInt32.max))),
+            capacity: UInt32(clamping: max(1, configuration.maxConcurrentTimeouts))
+        )
+        self.timerWheel = ecliptix_timer_wheel_create(
+            &wheelConfig,
+            { timerId, _, context in
+                guard let context = context else { return }
+                Unmanaged<ExpiryRelay>.fromOpaque(context).takeUnretainedValue().timerExpired(timerId)
+            },
+            Unmanaged.passUnretained(relay).toOpaque()
+        )
+
+        if timerWheel == nil {
+            Log.error("[TimeoutManager] Failed to create native timer wheel - timeouts will not fire")
+        }
+
+        relay.manager = self
     }
 
     deinit {
-        checkTimer?.invalidate()
+        ecliptix_timer_wheel_destroy(timerWheel)
     }
 
     public func startTracking(
@@ -61,13 +95,26 @@ public final class RequestTimeoutManager {
     ) {
         let timeoutDuration = timeout ?? configuration.defaultTimeout
 
+        if let existing = activeTimeouts.removeValue(forKey: requestId) {
+            releaseTimer(existing.timerId)
+        }
+
+        var timerId: ecliptix_timer_id_t = ECLIPTIX_TIMER_INVALID_ID
+        let result = ecliptix_timer_wheel_start(timerWheel, microseconds(timeoutDuration), 0, &timerId)
+        guard result == ECLIPTIX_NET_SUCCESS else {
+            Log.error("[TimeoutManager] Failed to track request: \(requestId) (native result: \(result.rawValue))")
+            return
+        }
+
         let entry = TimeoutEntry(
             requestId: requestId,
+            timerId: timerId,
             timeoutDuration: timeoutDuration,
             onTimeout: onTimeout
         )
 
         activeTimeouts[requestId] = entry
+        requestIdsByTimer[timerId] = requestId
         totalRequests += 1
 
         Log.debug("[TimeoutManager] ⏱ Tracking request: \(requestId) (timeout: \(String(format: "%.1f", timeoutDuration))s)")
@@ -75,6 +122,7 @@ public final class RequestTimeoutManager {
 
     public func stopTracking(requestId: String) {
         if let entry = activeTimeouts.removeValue(forKey: requestId) {
+            releaseTimer(entry.timerId)
             Log.debug("[TimeoutManager] [OK] Completed request: \(requestId) (elapsed: \(String(format: "%.2f", entry.elapsedTime))s)")
         }
     }
@@ -84,13 +132,11 @@ public final class RequestTimeoutManager {
             return
         }
 
-        let newEntry = TimeoutEntry(
-            requestId: requestId,
-            timeoutDuration: entry.timeoutDuration + additionalTime,
-            onTimeout: entry.onTimeout
-        )
+        guard ecliptix_timer_wheel_extend(timerWheel, entry.timerId, microseconds(additionalTime)) == ECLIPTIX_NET_SUCCESS else {
+            return
+        }
 
-        activeTimeouts[requestId] = newEntry
+        entry.timeoutDuration += additionalTime
         Log.debug("[TimeoutManager] ⏱ Extended timeout for: \(requestId) (+\(String(format: "%.1f", additionalTime))s)")
     }
 
@@ -99,43 +145,52 @@ public final class RequestTimeoutManager {
             return false
         }
 
-        return entry.isTimedOut
+        return entry.remainingTime <= 0
     }
 
     public func getRemainingTime(requestId: String) -> TimeInterval? {
         return activeTimeouts[requestId]?.remainingTime
     }
 
-    private func startCheckTimer() {
-        checkTimer = Timer.scheduledTimer(
-            withTimeInterval: configuration.checkInterval,
-            repeats: true
-        ) { [weak self] _ in
-            Task { @MainActor in
-                self?.checkTimeouts()
-            }
+    private func handleExpiredTimer(_ timerId: ecliptix_timer_id_t) {
+        guard let requestId = requestIdsByTimer.removeValue(forKey: timerId),
+              let entry = activeTimeouts[requestId],
+              entry.timerId == timerId
+        else {
+            return
         }
 
-        RunLoop.main.add(checkTimer!, forMode: .common)
+        activeTimeouts.removeValue(forKey: requestId)
+        totalTimeouts += 1
+        Log.warning("[TimeoutManager] ⏰ Request TIMED OUT: \(entry.requestId) (duration: \(String(format: "%.2f", entry.timeoutDuration))s)")
+        entry.onTimeout()
     }
 
-    private func checkTimeouts() {
-        let timedOutEntries = activeTimeouts.values.filter { $0.isTimedOut }
+    private func releaseTimer(_ timerId: ecliptix_timer_id_t) {
+        requestIdsByTimer.removeValue(forKey: timerId)
+        _ = ecliptix_timer_wheel_stop(timerWheel, timerId)
+    }
 
-        for entry in timedOutEntries {
-            activeTimeouts.removeValue(forKey: entry.requestId)
-        }
+    private func microseconds(_ interval: TimeInterval) -> UInt64 {
+        return Self.clampedMicroseconds(interval, minimum: 0, maximum: UInt64.max)
+    }
 
-        for entry in timedOutEntries {
-            totalTimeouts += 1
-            Log.warning("[TimeoutManager] ⏰ Request TIMED OUT: \(entry.requestId) (duration: \(String(format: "%.2f", entry.timeoutDuration))s)")
-            entry.onTimeout()
+    private static func clampedMicroseconds(_ interval: TimeInterval, minimum: UInt64, maximum: UInt64) -> UInt64 {
+        let micros = (interval * 1_000_000).rounded()
+        if micros.isNaN || micros <= Double(minimum) {
+            return minimum
+        }
+        if micros >= Double(maximum) {
+            return maximum
         }
+        return UInt64(micros)
     }
 
     public func cancelAll() {
         let count = activeTimeouts.count
+        ecliptix_timer_wheel_stop_all(timerWheel)
         activeTimeouts.removeAll()
+        requestIdsByTimer.removeAll()
 
         if count > 0 {
             Log.info("[TimeoutManager]  Cancelled all \(count) active timeouts")
@@ -202,35 +257,37 @@ public struct TimeoutConfiguration: Sendable {
 
     public let defaultTimeout: TimeInterval
 
-    public let checkInterval: TimeInterval
+    public let timerResolution: TimeInterval
+
+    public let maxConcurrentTimeouts: Int
 
     public let enabled: Bool
 
     public init(
         defaultTimeout: TimeInterval = 30.0,
-        checkInterval: TimeInterval = 1.0,
+        timerResolution: TimeInterval = 0.0001,
+        maxConcurrentTimeouts: Int = 65_536,
         enabled: Bool = true
     ) {
         self.defaultTimeout = defaultTimeout
-        self.checkInterval = checkInterval
+        self.timerResolution = timerResolution
+        self.maxConcurrentTimeouts = maxConcurrentTimeouts
         self.enabled = enabled
     }
 
     public static let `default` = TimeoutConfiguration()
 
     public static let short = TimeoutConfiguration(
-        defaultTimeout: 10.0,
-        checkInterval: 0.5
+        defaultTimeout: 10.0
     )
 
     public static let long = TimeoutConfiguration(
         defaultTimeout: 60.0,
-        checkInterval: 2.0
+        timerResolution: 0.001
     )
 
     public static let disabled = TimeoutConfiguration(
         defaultTimeout: 0,
-        checkInterval: 0,
         enabled: false
     )
 }
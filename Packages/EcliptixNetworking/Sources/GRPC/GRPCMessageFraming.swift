@@ -0,0 +1,209 @@
+import CEcliptixNetworking
+import EcliptixCore
+import Foundation
+
+public struct GRPCSlabPoolStatistics: Sendable {
+    public let slabAllocations: UInt64
+    public let slabReuses: UInt64
+    public let oversizeAllocations: UInt64
+    public let cachedSlabs: Int
+    public let outstandingSlabs: Int
+}
+
+public final class GRPCSlabPool: @unchecked Sendable {
+
+    fileprivate let pool: OpaquePointer?
+
+    public init(slabSize: Int = 64 * 1024, maxCachedSlabs: Int = 32) {
+        var poolConfig = ecliptix_slab_pool_config_t(
+            slab_size: max(0, slabSize),
+            max_cached_slabs: UInt32(clamping: max(0, maxCachedSlabs))
+        )
+        self.pool = ecliptix_slab_pool_create(&poolConfig)
+
+        if pool == nil {
+            Log.error("[GRPCSlabPool] Failed to create native slab pool")
+        }
+    }
+
+    deinit {
+        ecliptix_slab_pool_destroy(pool)
+    }
+
+    public var statistics: GRPCSlabPoolStatistics {
+        var stats = ecliptix_slab_pool_stats_t()
+        ecliptix_slab_pool_get_stats(pool, &stats)
+        return GRPCSlabPoolStatistics(
+            slabAllocations: stats.slab_allocations,
+            slabReuses: stats.slab_reuses,
+            oversizeAllocations: stats.oversize_allocations,
+            cachedSlabs: stats.cached_slabs,
+            outstandingSlabs: stats.outstanding_slabs
+        )
+    }
+}
+
+public enum GRPCMessageFramer {
+
+    public static let maxSegments = Int(ECLIPTIX_GRPC_MAX_SEGMENTS)
+
+    public static func write(_ segments: [Data], compressed: Bool = false, to fileDescriptor: Int32) throws {
+        guard segments.count <= maxSegments else {
+            throw NetworkFailure.invalidRequest("gRPC frame supports at most \(maxSegments) segments")
+        }
+
+        let result = withUnsafeTemporaryAllocation(of: ecliptix_grpc_segment_t.self, capacity: max(1, segments.count)) { buffer in
+            withSegments(segments[...], into: buffer, at: 0) { count in
+                var frame = ecliptix_grpc_frame_t()
+                let initResult = ecliptix_grpc_frame_init(&frame, compressed ? 1 : 0, buffer.baseAddress, count)
+                guard initResult == ECLIPTIX_NET_SUCCESS else {
+                    return initResult
+                }
+                var writeResult = ecliptix_grpc_frame_write(&frame, fileDescriptor)
+                while writeResult == ECLIPTIX_NET_ERROR_CAPACITY {
+                    var descriptor = pollfd(fd: fileDescriptor, events: Int16(POLLOUT), revents: 0)
+                    _ = poll(&descriptor, 1, -1)
+                    writeResult = ecliptix_grpc_frame_write(&frame, fileDescriptor)
+                }
+                return writeResult
+            }
+        }
+
+        guard result == ECLIPTIX_NET_SUCCESS else {
+            throw NetworkFailure(type: .connectionFailed, message: "gRPC frame write failed (\(result.rawValue), errno \(errno))")
+        }
+    }
+
+    public static func append(_ segments: [Data], compressed: Bool = false, to buffer: inout Data) throws {
+        guard segments.count <= maxSegments else {
+            throw NetworkFailure.invalidRequest("gRPC frame supports at most \(maxSegments) segments")
+        }
+
+        var frame = ecliptix_grpc_frame_t()
+        let result = withUnsafeTemporaryAllocation(of: ecliptix_grpc_segment_t.self, capacity: max(1, segments.count)) { segmentBuffer in
+            withSegments(segments[...], into: segmentBuffer, at: 0) { count in
+                let initResult = ecliptix_grpc_frame_init(&frame, compressed ? 1 : 0, segmentBuffer.baseAddress, count)
+                guard initResult == ECLIPTIX_NET_SUCCESS else {
+                    return initResult
+                }
+                buffer.reserveCapacity(buffer.count + frame.total_length)
+                withUnsafeTemporaryAllocation(of: iovec.self, capacity: maxSegments + 1) { iovecs in
+                    let iovecCount = ecliptix_grpc_frame_iovecs(&frame, iovecs.baseAddress, iovecs.count)
+                    for iovec in iovecs.prefix(iovecCount) {
+                        buffer.append(UnsafeRawBufferPointer(start: iovec.iov_base, count: iovec.iov_len).bindMemory(to: UInt8.self))
+                    }
+                }
+                return initResult
+            }
+        }
+
+        guard result == ECLIPTIX_NET_SUCCESS else {
+            throw NetworkFailure(type: .serialization, message: "gRPC frame could not be built (\(result.rawValue))")
+        }
+    }
+
+    private static func withSegments<R>(
+        _ remaining: ArraySlice<Data>,
+        into buffer: UnsafeMutableBufferPointer<ecliptix_grpc_segment_t>,
+        at index: Int,
+        _ body: (Int) -> R
+    ) -> R {
+        guard let segment = remaining.first else {
+            return body(index)
+        }
+        return segment.withUnsafeBytes { bytes in
+            buffer[index] = ecliptix_grpc_segment_t(
+                data: bytes.bindMemory(to: UInt8.self).baseAddress,
+                length: bytes.count
+            )
+            return withSegments(remaining.dropFirst(), into: buffer, at: index + 1, body)
+        }
+    }
+}
+
+public final class GRPCInboundMessage: @unchecked Sendable {
+
+    private var message: ecliptix_grpc_message_t
+
+    fileprivate init(message: ecliptix_grpc_message_t) {
+        self.message = message
+    }
+
+    deinit {
+        ecliptix_grpc_message_release(&message)
+    }
+
+    public var isCompressed: Bool {
+        message.compressed != 0
+    }
+
+    public var count: Int {
+        message.length
+    }
+
+    public func withUnsafeBytes<R>(_ body: (UnsafeRawBufferPointer) throws -> R) rethrows -> R {
+        try body(UnsafeRawBufferPointer(start: message.data, count: message.length))
+    }
+
+    public var data: Data {
+        withUnsafeBytes { Data($0) }
+    }
+}
+
+public final class GRPCMessageDeframer {
+
+    private let deframer: OpaquePointer?
+
+    public init(pool: GRPCSlabPool, maxMessageSize: Int = 4 * 1024 * 1024) {
+        self.deframer = ecliptix_grpc_deframer_create(pool.pool, max(0, maxMessageSize))
+
+        if deframer == nil {
+            Log.error("[GRPCMessageDeframer] Failed to create native deframer")
+        }
+    }
+
+    deinit {
+        ecliptix_grpc_deframer_destroy(deframer)
+    }
+
+    public var bufferedBytes: Int {
+        ecliptix_grpc_deframer_buffered(deframer)
+    }
+
+    public func feed(_ data: Data) throws {
+        let result = data.withUnsafeBytes { bytes in
+            ecliptix_grpc_deframer_feed(deframer, bytes.bindMemory(to: UInt8.self).baseAddress, bytes.count)
+        }
+        guard result == ECLIPTIX_NET_SUCCESS else {
+            throw NetworkFailure(type: .serialization, message: "gRPC deframer rejected input (\(result.rawValue))")
+        }
+    }
+
+    @discardableResult
+    public func read(from fileDescriptor: Int32) throws -> Int {
+        var bytesRead = 0
+        var result = ecliptix_grpc_deframer_read(deframer, fileDescriptor, &bytesRead)
+        while result == ECLIPTIX_NET_ERROR_CAPACITY {
+            var descriptor = pollfd(fd: fileDescriptor, events: Int16(POLLIN), revents: 0)
+            _ = poll(&descriptor, 1, -1)
+            result = ecliptix_grpc_deframer_read(deframer, fileDescriptor, &bytesRead)
+        }
+        guard result == ECLIPTIX_NET_SUCCESS else {
+            throw NetworkFailure(type: .connectionFailed, message: "gRPC frame read failed (\(result.rawValue), errno \(errno))")
+        }
+        return bytesRead
+    }
+
+    public func nextMessage() throws -> GRPCInboundMessage? {
+        var message = ecliptix_grpc_message_t()
+        let result = ecliptix_grpc_deframer_next(deframer, &message)
+        switch result {
+        case ECLIPTIX_NET_SUCCESS:
+            return GRPCInboundMessage(message: message)
+        case ECLIPTIX_NET_ERROR_NOT_FOUND:
+            return nil
+        default:
+            throw NetworkFailure(type: .serialization, message: "Malformed gRPC frame (\(result.rawValue))")
+        }
+    }
+}
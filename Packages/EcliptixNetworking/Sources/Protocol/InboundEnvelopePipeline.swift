@@ -0,0 +1,161 @@
+import EcliptixCore
+import EcliptixSecurity
+import Foundation
+
+struct InboundEnvelopeKeys: Sendable {
+    let messageKey: Data
+    let headerKey: Data
+}
+
+struct InboundReplayWindow: Sendable {
+
+    static let defaultCapacity = 1024
+
+    private let capacity: Int
+    private var seen: Set<Data> = []
+    private var reserved: Set<Data> = []
+    private var order: [Data] = []
+    private var oldest = 0
+
+    init(capacity: Int = InboundReplayWindow.defaultCapacity) {
+        self.capacity = max(1, capacity)
+        seen.reserveCapacity(self.capacity)
+        order.reserveCapacity(self.capacity)
+    }
+
+    func contains(_ headerNonce: Data) -> Bool {
+        seen.contains(headerNonce) || reserved.contains(headerNonce)
+    }
+
+    mutating func reserve(_ headerNonce: Data) -> Bool {
+        guard !contains(headerNonce) else {
+            return false
+        }
+        reserved.insert(headerNonce)
+        return true
+    }
+
+    mutating func commit(_ headerNonce: Data) {
+        reserved.remove(headerNonce)
+        record(headerNonce)
+    }
+
+    mutating func release(_ headerNonce: Data) {
+        reserved.remove(headerNonce)
+    }
+
+    mutating func record(_ headerNonce: Data) {
+        guard seen.insert(headerNonce).inserted else {
+            return
+        }
+        if order.count < capacity {
+            order.append(headerNonce)
+            return
+        }
+        seen.remove(order[oldest])
+        order[oldest] = headerNonce
+        oldest = (oldest + 1) % capacity
+    }
+}
+
+enum InboundEnvelopePipeline {
+
+    static let defaultConcurrency = max(1, ProcessInfo.processInfo.activeProcessorCount)
+
+    static func parseHeaders(_ envelopes: [SecureEnvelope]) async -> [Result<UInt32, ProtocolFailure>] {
+        await parallelMap(envelopes) { envelope in
+            EnvelopeBuilder.parseEnvelopeMetadata(from: envelope.metaData).map { UInt32($0.ratchetIndex) }
+        }
+    }
+
+    static func sequence(
+        headerNonces: [Data],
+        headers: [Result<UInt32, ProtocolFailure>],
+        replayWindow: inout InboundReplayWindow,
+        deriveKeys: (UInt32) -> Result<InboundEnvelopeKeys, ProtocolFailure>
+    ) -> [Result<InboundEnvelopeKeys, ProtocolFailure>] {
+        var keys = [Result<InboundEnvelopeKeys, ProtocolFailure>](
+            repeating: .failure(.generic("Envelope was not sequenced")),
+            count: headers.count
+        )
+
+        var ordered: [(position: Int, receivedIndex: UInt32)] = []
+        ordered.reserveCapacity(headers.count)
+        for (position, header) in headers.enumerated() {
+            switch header {
+            case .success(let receivedIndex):
+                if !replayWindow.reserve(headerNonces[position]) {
+                    keys[position] = .failure(.generic("Replayed envelope at index \(receivedIndex)"))
+                } else {
+                    ordered.append((position, receivedIndex))
+                }
+            case .failure:
+                keys[position] = .failure(.decode("Failed to parse envelope metadata"))
+            }
+        }
+        ordered.sort { ($0.receivedIndex, $0.position) < ($1.receivedIndex, $1.position) }
+
+        for entry in ordered {
+            keys[entry.position] = deriveKeys(entry.receivedIndex)
+            if case .failure = keys[entry.position] {
+                replayWindow.release(headerNonces[entry.position])
+            }
+        }
+
+        return keys
+    }
+
+    static func decryptPayloads(
+        _ envelopes: [SecureEnvelope],
+        keys: [Result<InboundEnvelopeKeys, ProtocolFailure>]
+    ) async -> [Result<(envelopeId: String, payload: Data), ProtocolFailure>] {
+        await parallelMap(Array(zip(envelopes, keys))) { envelope, derivedKeys in
+            derivedKeys.flatMap { keys in
+                EnvelopeBuilder.decryptResponseEnvelope(
+                    envelope: envelope,
+                    messageKey: keys.messageKey,
+                    headerKey: keys.headerKey,
+                    associatedData: Data()
+                ).map { decrypted in
+                    if decrypted.resultCode != .success {
+                        Log.warning("[InboundEnvelopePipeline] Envelope result code indicates error: \(decrypted.resultCode)")
+                    }
+                    return (decrypted.metadata.envelopeId, decrypted.payload)
+                }
+            }
+        }
+    }
+
+    static func parallelMap<Element: Sendable, Output: Sendable>(
+        _ elements: [Element],
+        maxConcurrency: Int = defaultConcurrency,
+        _ transform: @escaping @Sendable (Element) -> Output
+    ) async -> [Output] {
+        guard elements.count > 1, maxConcurrency > 1 else {
+            return elements.map(transform)
+        }
+
+        var outputs = [Output?](repeating: nil, count: elements.count)
+        await withTaskGroup(of: (Int, Output).self) { group in
+            var nextIndex = 0
+            for _ in 0..<min(maxConcurrency, elements.count) {
+                let index = nextIndex
+                let element = elements[index]
+                group.addTask { (index, transform(element)) }
+                nextIndex += 1
+            }
+
+            while let completed = await group.next() {
+                outputs[completed.0] = completed.1
+                guard nextIndex < elements.count else {
+                    continue
+                }
+                let pendingIndex = nextIndex
+                let element = elements[pendingIndex]
+                group.addTask { (pendingIndex, transform(element)) }
+                nextIndex += 1
+            }
+        }
+        return outputs.map { $0! }
+    }
+}
@@ -13,6 +13,8 @@ public final class NetworkProvider {
     internal let pendingRequestManager: PendingRequestManager
     internal let circuitBreaker: CircuitBreaker
     internal let healthMonitor: ConnectionHealthMonitor
+    internal let requestCoalescer: RequestCoalescer
+    internal var envelopeBatcher: SecureEnvelopeBatcher?
 
     internal var activeRequests: [String: Task<Void, Never>] = [:]
 
@@ -49,6 +51,11 @@ public final class NetworkProvider {
         case sendMessage
     }
 
+    @MainActor
+    private final class CapturedResponse<Value: Sendable> {
+        var value: Value?
+    }
+
     public init(
         connectionManager: ProtocolConnectionManager = ProtocolConnectionManager(),
         channelManager: GRPCChannelManager,
@@ -69,6 +76,7 @@ public final class NetworkProvider {
 
         self.circuitBreaker = CircuitBreaker(configuration: circuitBreakerConfiguration)
         self.healthMonitor = ConnectionHealthMonitor(configuration: healthMonitorConfiguration)
+        self.requestCoalescer = RequestCoalescer()
 
         if let defaultConnectivity = connectivity as? DefaultConnectivityService {
             defaultConnectivity.startMonitoring()
@@ -220,6 +228,16 @@ public final class NetworkProvider {
         }
     }
 
+    private func canServiceTypeBeCoalesced(_ serviceType: RPCServiceType) -> Bool {
+
+        switch serviceType {
+        case .validateMobileNumber, .checkMobileAvailability, .registerDevice, .getDeviceStatus:
+            return true
+        default:
+            return false
+        }
+    }
+
     public func setConnectionMode(_ mode: ConnectionMode) {
         self.connectionMode = mode
         switch mode {
@@ -244,6 +262,31 @@ public final class NetworkProvider {
         Log.info("[NetworkProvider] Cleaned up protocol connection \(connectId)")
     }
 
+    public func enableEnvelopeBatching(
+        transport: SecureEnvelopeBatchTransport,
+        configuration: BatchConfiguration = .default
+    ) {
+        envelopeBatcher = SecureEnvelopeBatcher(
+            connectionManager: connectionManager,
+            transport: transport,
+            configuration: configuration
+        )
+        Log.info("[NetworkProvider] Envelope batching enabled")
+    }
+
+    public func disableEnvelopeBatching() async {
+        guard let batcher = envelopeBatcher else {
+            return
+        }
+        envelopeBatcher = nil
+        await batcher.flushAll()
+        Log.info("[NetworkProvider] Envelope batching disabled")
+    }
+
+    public func getBatchStatistics() -> BatchStatistics? {
+        envelopeBatcher?.getStatistics()
+    }
+
     public func setApplicationInstanceSettings(_ settings: ApplicationInstanceSettings) {
         self.applicationInstanceSettings = settings
         Log.info("[NetworkProvider] Application instance settings configured")
@@ -255,13 +298,23 @@ public final class NetworkProvider {
         plainBuffer: Data,
         allowDuplicates: Bool = false,
         waitForRecovery: Bool = true,
-        onCompleted: @escaping (Data) async throws -> Void
+        onCompleted: @escaping @Sendable (Data) async throws -> Void
     ) async -> Result<Void, NetworkFailure> {
 
         let requestKey = generateRequestKey(connectId: connectId, serviceType: serviceType, plainBuffer: plainBuffer)
 
         let shouldAllowDuplicates = allowDuplicates || canServiceTypeBeDuplicated(serviceType)
 
+        if !shouldAllowDuplicates && canServiceTypeBeCoalesced(serviceType) {
+            return await executeCoalescedRequest(
+                connectId: connectId,
+                serviceType: serviceType,
+                plainBuffer: plainBuffer,
+                waitForRecovery: waitForRecovery,
+                onCompleted: onCompleted
+            )
+        }
+
         if !shouldAllowDuplicates {
             if activeRequests[requestKey] != nil {
                 Log.warning("[NetworkProvider] Duplicate request rejected: \(requestKey)")
@@ -295,6 +348,64 @@ public final class NetworkProvider {
         }
     }
 
+    private func executeCoalescedRequest(
+        connectId: UInt32,
+        serviceType: RPCServiceType,
+        plainBuffer: Data,
+        waitForRecovery: Bool,
+        onCompleted: @escaping @Sendable (Data) async throws -> Void
+    ) async -> Result<Void, NetworkFailure> {
+
+        let fingerprint = RequestCoalescer.fingerprint(
+            connectId: connectId,
+            operation: serviceType.rawValue,
+            payload: plainBuffer
+        )
+
+        let sharedResult = await requestCoalescer.execute(
+            key: fingerprint,
+            statisticsKey: serviceType.rawValue,
+            requestBytes: plainBuffer.count
+        ) {
+            let captured = CapturedResponse<Data>()
+            let result = await self.executeRequestInternal(
+                connectId: connectId,
+                serviceType: serviceType,
+                plainBuffer: plainBuffer,
+                requestKey: fingerprint,
+                shouldAllowDuplicates: true,
+                waitForRecovery: waitForRecovery
+            ) { @MainActor data in
+                captured.value = data
+            }
+
+            return result.flatMap {
+                captured.value.map { .success($0) } ?? .failure(NetworkFailure(
+                    type: .unknown,
+                    message: "Response processing failed - no response captured"
+                ))
+            }
+        }
+
+        guard case .success(let responseData) = sharedResult else {
+            if case .failure(let error) = sharedResult {
+                return .failure(error)
+            }
+            return .failure(NetworkFailure(type: .unknown, message: "Coalesced request failed"))
+        }
+
+        do {
+            try await onCompleted(responseData)
+            return .success(())
+        } catch {
+            Log.error("[NetworkProvider] Completion handler failed: \(error)")
+            return .failure(NetworkFailure(
+                type: .serverError,
+                message: "Failed to process response: \(error.localizedDescription)",
+            ))
+        }
+    }
+
     public func executeWithRetry<T: Sendable>(
         operationName: String,
         connectId: UInt32,
@@ -311,23 +422,23 @@ public final class NetworkProvider {
             connectId: connectId,
             serviceType: serviceType,
             maxRetries: maxRetries
-        ) { attempt in
+        ) { @MainActor attempt in
             Log.debug("[NetworkProvider] Executing '\(operationName)' attempt \(attempt)")
 
-            var capturedResult: T?
+            let captured = CapturedResponse<T>()
             let requestResult = await self.executeUnaryRequest(
                 connectId: connectId,
                 serviceType: serviceType,
                 plainBuffer: plainBuffer,
                 allowDuplicates: allowDuplicates,
                 waitForRecovery: waitForRecovery
-            ) { responseData in
-                capturedResult = try await onCompleted(responseData)
+            ) { @MainActor responseData in
+                captured.value = try await onCompleted(responseData)
             }
 
             switch requestResult {
             case .success:
-                if let value = capturedResult {
+                if let value = captured.value {
                     return .success(value)
                 } else {
                     return .failure(NetworkFailure(
@@ -350,7 +461,7 @@ public final class NetworkProvider {
         requestKey: String,
         shouldAllowDuplicates: Bool,
         waitForRecovery: Bool,
-        onCompleted: @escaping (Data) async throws -> Void
+        onCompleted: @escaping @Sendable (Data) async throws -> Void
     ) async -> Result<Void, NetworkFailure> {
 
         let requestStartTime = Date()
@@ -364,7 +475,7 @@ public final class NetworkProvider {
         let circuitResult = await circuitBreaker.execute(
             connectId: connectId,
             operationName: serviceType.rawValue
-        ) {
+        ) { @MainActor in
             await self.executeRequestWithProtocol(
                 connectId: connectId,
                 serviceType: serviceType,
@@ -392,7 +503,7 @@ public final class NetworkProvider {
         plainBuffer: Data,
         requestKey: String,
         waitForRecovery: Bool,
-        onCompleted: @escaping (Data) async throws -> Void
+        onCompleted: @escaping @Sendable (Data) async throws -> Void
     ) async -> Result<Void, NetworkFailure> {
 
         if waitForRecovery {
@@ -429,7 +540,7 @@ public final class NetworkProvider {
         connectId: UInt32,
         serviceType: RPCServiceType,
         plainBuffer: Data,
-        onCompleted: @escaping (Data) async throws -> Void
+        onCompleted: @escaping @Sendable (Data) async throws -> Void
     ) async -> Result<Void, NetworkFailure> {
 
         guard await connectionManager.hasConnection(connectId) else {
@@ -440,6 +551,29 @@ public final class NetworkProvider {
             ))
         }
 
+        if let envelopeBatcher = envelopeBatcher {
+            let batchedResult = await envelopeBatcher.submit(
+                connectId: connectId,
+                serviceType: serviceType.rawValue,
+                plainBuffer: plainBuffer
+            )
+            guard case .success(let decryptedData) = batchedResult else {
+                if case .failure(let networkError) = batchedResult {
+                    return .failure(networkError)
+                }
+                return .failure(NetworkFailure(
+                    type: .serverError,
+                    message: "Batched request failed",
+                ))
+            }
+            return await completeDecryptedRequest(
+                connectId: connectId,
+                serviceType: serviceType,
+                decryptedData: decryptedData,
+                onCompleted: onCompleted
+            )
+        }
+
         let encryptResult = await connectionManager.encryptOutbound(connectId, plainData: plainBuffer)
         guard case .success(let encryptedEnvelope) = encryptResult else {
             if case .failure(let protocolError) = encryptResult {
@@ -486,6 +620,21 @@ public final class NetworkProvider {
             ))
         }
 
+        return await completeDecryptedRequest(
+            connectId: connectId,
+            serviceType: serviceType,
+            decryptedData: decryptedData,
+            onCompleted: onCompleted
+        )
+    }
+
+    private func completeDecryptedRequest(
+        connectId: UInt32,
+        serviceType: RPCServiceType,
+        decryptedData: Data,
+        onCompleted: @escaping @Sendable (Data) async throws -> Void
+    ) async -> Result<Void, NetworkFailure> {
+
         Log.info("[NetworkProvider]  Decrypted inbound for \(serviceType.rawValue), size: \(decryptedData.count)")
 
         do {
@@ -505,7 +654,7 @@ public final class NetworkProvider {
         connectId: UInt32,
         serviceType: RPCServiceType,
         plainBuffer: Data,
-        onCompleted: @escaping (Data) async throws -> Void
+        onCompleted: @escaping @Sendable (Data) async throws -> Void
     ) async -> Result<Void, NetworkFailure> {
 
         Log.info("[NetworkProvider] [WARNING] Sending PLAIN (unencrypted) request for \(serviceType.rawValue)")
@@ -555,7 +704,7 @@ public final class NetworkProvider {
         connectId: UInt32,
         serviceType: RPCServiceType,
         plainBuffer: Data,
-        onCompleted: @escaping (Data) async throws -> Void
+        onCompleted: @escaping @Sendable (Data) async throws -> Void
     ) {
         pendingRequestManager.registerPendingRequest(requestId: requestKey) {
 
@@ -800,6 +949,10 @@ public final class NetworkProvider {
         return healthMonitor.getAllHealth()
     }
 
+    public func getCoalescingStatistics() -> [String: CoalescingStatistics] {
+        requestCoalescer.getStatistics()
+    }
+
     public func getHealthStatistics() -> HealthStatistics {
         return healthMonitor.getStatistics()
     }
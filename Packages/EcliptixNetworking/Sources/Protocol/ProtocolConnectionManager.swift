@@ -6,6 +6,8 @@ public actor ProtocolConnectionManager {
 
     internal var connections: [UInt32: ProtocolSession] = [:]
 
+    private var replayWindows: [UInt32: InboundReplayWindow] = [:]
+
     public struct ProtocolSession: @unchecked Sendable {
         public let connectId: UInt32
         public let identityKeys: IdentityKeys
@@ -55,6 +57,7 @@ public actor ProtocolConnectionManager {
 
     public func removeConnection(_ connectId: UInt32) {
         connections.removeValue(forKey: connectId)
+        replayWindows.removeValue(forKey: connectId)
         Log.info("[ProtocolConnectionManager] Removed connection \(connectId)")
     }
 
@@ -69,11 +72,16 @@ public actor ProtocolConnectionManager {
     public func removeAll() {
         let count = connections.count
         connections.removeAll()
+        replayWindows.removeAll()
 
         Log.info("[ProtocolConnectionManager] Removed all \(count) connections")
     }
 
-    public func encryptOutbound(_ connectId: UInt32, plainData: Data) -> Result<SecureEnvelope, ProtocolFailure> {
+    public func encryptOutbound(
+        _ connectId: UInt32,
+        plainData: Data,
+        requestId explicitRequestId: UInt32? = nil
+    ) -> Result<SecureEnvelope, ProtocolFailure> {
         guard var session = connections[connectId] else {
             return .failure(.connectionNotFound("No protocol connection for connectId: \(connectId)"))
         }
@@ -135,7 +143,7 @@ public actor ProtocolConnectionManager {
             return .failure(.generic("Failed to get sending chain index: \(error.localizedDescription)"))
         }
 
-        let requestId: UInt32 = UInt32(Date().timeIntervalSince1970 * 1000) % UInt32.max
+        let requestId: UInt32 = explicitRequestId ?? UInt32(Date().timeIntervalSince1970 * 1000) % UInt32.max
 
         let associatedData = Data()
         let envelopeResult = EnvelopeBuilder.createRequestEnvelope(
@@ -166,35 +174,70 @@ public actor ProtocolConnectionManager {
         return .success(envelope)
     }
 
-    public func decryptInbound(_ connectId: UInt32, envelope: SecureEnvelope) -> Result<Data, ProtocolFailure> {
-        guard var session = connections[connectId] else {
-            return .failure(.connectionNotFound("No protocol connection for connectId: \(connectId)"))
-        }
+    public func encryptOutboundBatch(
+        _ connectId: UInt32,
+        requests: [(requestId: UInt32, plainData: Data)]
+    ) -> [Result<SecureEnvelope, ProtocolFailure>] {
+        requests.map { encryptOutbound(connectId, plainData: $0.plainData, requestId: $0.requestId) }
+    }
 
-        guard let ratchet = session.doubleRatchet else {
-            return .failure(.noDoubleRatchet("Double Ratchet not initialized for connectId: \(connectId)"))
+    public func decryptInboundBatch(
+        _ connectId: UInt32,
+        envelopes: [SecureEnvelope]
+    ) async -> [Result<(envelopeId: String, payload: Data), ProtocolFailure>] {
+        guard envelopes.count > 1 else {
+            return envelopes.map { decryptInboundEnvelope(connectId, envelope: $0) }
         }
 
-        Log.info("[ProtocolConnectionManager] Decrypting inbound for connection \(connectId)")
+        Log.info("[ProtocolConnectionManager] Pipelined decrypt of \(envelopes.count) envelopes for connection \(connectId)")
 
-        do {
-            let sendingIndex = try ratchet.getSendingChainIndex()
-            let receivingIndex = try ratchet.getReceivingChainIndex()
-            Log.debug("[ProtocolConnectionManager] Before decryption - Sending: \(sendingIndex), Receiving: \(receivingIndex)")
-        } catch {
-            Log.warning("[ProtocolConnectionManager] Failed to get chain indices: \(error.localizedDescription)")
+        let headers = await InboundEnvelopePipeline.parseHeaders(envelopes)
+        let keys = sequenceInbound(connectId, envelopes: envelopes, headers: headers)
+        let results = await InboundEnvelopePipeline.decryptPayloads(envelopes, keys: keys)
+
+        for position in envelopes.indices {
+            guard case .success = keys[position] else {
+                continue
+            }
+            let headerNonce = envelopes[position].headerNonce
+            if case .success = results[position] {
+                replayWindows[connectId]?.commit(headerNonce)
+            } else {
+                replayWindows[connectId]?.release(headerNonce)
+            }
         }
 
-        guard case .success(let metadata) = EnvelopeBuilder.parseEnvelopeMetadata(from: envelope.metaData) else {
-            return .failure(.decode("Failed to parse envelope metadata"))
+        return results
+    }
+
+    private func sequenceInbound(
+        _ connectId: UInt32,
+        envelopes: [SecureEnvelope],
+        headers: [Result<UInt32, ProtocolFailure>]
+    ) -> [Result<InboundEnvelopeKeys, ProtocolFailure>] {
+        guard let ratchet = connections[connectId]?.doubleRatchet else {
+            let failure: ProtocolFailure = connections[connectId] == nil
+                ? .connectionNotFound("No protocol connection for connectId: \(connectId)")
+                : .noDoubleRatchet("Double Ratchet not initialized for connectId: \(connectId)")
+            return headers.map { _ in .failure(failure) }
         }
 
-        let receivedIndex = UInt32(metadata.ratchetIndex)
+        var replayWindow = replayWindows.removeValue(forKey: connectId) ?? InboundReplayWindow()
+        defer { replayWindows[connectId] = replayWindow }
 
-        guard case .success(let ratchetKey) = ratchet.processReceivedMessage(receivedIndex: receivedIndex) else {
-            return .failure(.generic("Failed to process received message at index \(receivedIndex)"))
+        return InboundEnvelopePipeline.sequence(
+            headerNonces: envelopes.map(\.headerNonce),
+            headers: headers,
+            replayWindow: &replayWindow
+        ) { receivedIndex in
+            guard case .success(let ratchetKey) = ratchet.processReceivedMessage(receivedIndex: receivedIndex) else {
+                return .failure(.generic("Failed to process received message at index \(receivedIndex)"))
+            }
+            return deriveInboundKeys(from: ratchetKey)
         }
+    }
 
+    private func deriveInboundKeys(from ratchetKey: RatchetChainKey) -> Result<InboundEnvelopeKeys, ProtocolFailure> {
         var messageKey: Data?
         var headerKey: Data?
         do {
@@ -224,15 +267,66 @@ public actor ProtocolConnectionManager {
             return .failure(.generic("Failed to execute key derivation"))
         }
 
+        return .success(InboundEnvelopeKeys(messageKey: msgKey, headerKey: hdrKey))
+    }
+
+    public func decryptInbound(_ connectId: UInt32, envelope: SecureEnvelope) -> Result<Data, ProtocolFailure> {
+        decryptInboundEnvelope(connectId, envelope: envelope).map { $0.payload }
+    }
+
+    private func decryptInboundEnvelope(
+        _ connectId: UInt32,
+        envelope: SecureEnvelope
+    ) -> Result<(envelopeId: String, payload: Data), ProtocolFailure> {
+        guard var session = connections[connectId] else {
+            return .failure(.connectionNotFound("No protocol connection for connectId: \(connectId)"))
+        }
+
+        guard let ratchet = session.doubleRatchet else {
+            return .failure(.noDoubleRatchet("Double Ratchet not initialized for connectId: \(connectId)"))
+        }
+
+        Log.info("[ProtocolConnectionManager] Decrypting inbound for connection \(connectId)")
+
+        do {
+            let sendingIndex = try ratchet.getSendingChainIndex()
+            let receivingIndex = try ratchet.getReceivingChainIndex()
+            Log.debug("[ProtocolConnectionManager] Before decryption - Sending: \(sendingIndex), Receiving: \(receivingIndex)")
+        } catch {
+            Log.warning("[ProtocolConnectionManager] Failed to get chain indices: \(error.localizedDescription)")
+        }
+
+        guard case .success(let metadata) = EnvelopeBuilder.parseEnvelopeMetadata(from: envelope.metaData) else {
+            return .failure(.decode("Failed to parse envelope metadata"))
+        }
+
+        let receivedIndex = UInt32(metadata.ratchetIndex)
+
+        if replayWindows[connectId]?.contains(envelope.headerNonce) == true {
+            return .failure(.generic("Replayed envelope at index \(receivedIndex)"))
+        }
+
+        guard case .success(let ratchetKey) = ratchet.processReceivedMessage(receivedIndex: receivedIndex) else {
+            return .failure(.generic("Failed to process received message at index \(receivedIndex)"))
+        }
+
+        let keys: InboundEnvelopeKeys
+        switch deriveInboundKeys(from: ratchetKey) {
+        case .success(let derivedKeys):
+            keys = derivedKeys
+        case .failure(let error):
+            return .failure(error)
+        }
+
         let associatedData = Data()
         let decryptResult = EnvelopeBuilder.decryptResponseEnvelope(
             envelope: envelope,
-            messageKey: msgKey,
-            headerKey: hdrKey,
+            messageKey: keys.messageKey,
+            headerKey: keys.headerKey,
             associatedData: associatedData
         )
 
-        guard case .success(let (_, payload, resultCode)) = decryptResult else {
+        guard case .success(let (responseMetadata, payload, resultCode)) = decryptResult else {
             if case .failure(let error) = decryptResult {
                 return .failure(error)
             }
@@ -245,10 +339,11 @@ public actor ProtocolConnectionManager {
 
         session.doubleRatchet = ratchet
         connections[connectId] = session
+        replayWindows[connectId, default: InboundReplayWindow()].record(envelope.headerNonce)
 
         Log.info("[ProtocolConnectionManager] Successfully decrypted inbound for connection \(connectId), payloadSize: \(payload.count)")
 
-        return .success(payload)
+        return .success((responseMetadata.envelopeId, payload))
     }
 
     func establishSecureChannel(connectId: UInt32) async throws -> Data {
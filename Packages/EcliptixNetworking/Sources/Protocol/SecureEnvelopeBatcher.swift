@@ -0,0 +1,249 @@
+import EcliptixCore
+import Foundation
+
+// A request batch carries two gRPC messages per call: the UTF-8 service type, then the SecureEnvelope.
+// The response batch carries one SecureEnvelope message per reply, in any order.
+public protocol SecureEnvelopeBatchTransport: Sendable {
+    func sendBatch(_ batch: Data, connectId: UInt32) async -> Result<Data, NetworkFailure>
+}
+
+protocol SecureEnvelopeBatchCodec: Sendable {
+    func encryptOutboundBatch(
+        _ connectId: UInt32,
+        requests: [(requestId: UInt32, plainData: Data)]
+    ) async -> [Result<SecureEnvelope, ProtocolFailure>]
+
+    func decryptInboundBatch(
+        _ connectId: UInt32,
+        envelopes: [SecureEnvelope]
+    ) async -> [Result<(envelopeId: String, payload: Data), ProtocolFailure>]
+}
+
+extension ProtocolConnectionManager: SecureEnvelopeBatchCodec {}
+
+public struct BatchConfiguration: Sendable {
+
+    public let window: TimeInterval
+
+    public let maxBatchSize: Int
+
+    public let maxBatchBytes: Int
+
+    public init(
+        window: TimeInterval = 0.005,
+        maxBatchSize: Int = 32,
+        maxBatchBytes: Int = 1024 * 1024
+    ) {
+        self.window = window
+        self.maxBatchSize = maxBatchSize
+        self.maxBatchBytes = maxBatchBytes
+    }
+
+    public static let `default` = BatchConfiguration()
+
+    public static let aggressive = BatchConfiguration(
+        window: 0.010,
+        maxBatchSize: 64,
+        maxBatchBytes: 4 * 1024 * 1024
+    )
+
+    public static let conservative = BatchConfiguration(
+        window: 0.002,
+        maxBatchSize: 8,
+        maxBatchBytes: 256 * 1024
+    )
+}
+
+public struct BatchStatistics: Sendable {
+    public var batchesSent: Int = 0
+    public var requestsBatched: Int = 0
+    public var largestBatch: Int = 0
+    public var failedBatches: Int = 0
+    public var unmatchedResponses: Int = 0
+
+    public var averageBatchSize: Double {
+        batchesSent > 0 ? Double(requestsBatched) / Double(batchesSent) : 0
+    }
+}
+
+@MainActor
+public final class SecureEnvelopeBatcher {
+
+    private struct PendingCall {
+        let serviceType: String
+        let plainBuffer: Data
+        let continuation: CheckedContinuation<Result<Data, NetworkFailure>, Never>
+    }
+
+    private let codec: SecureEnvelopeBatchCodec
+    private let transport: SecureEnvelopeBatchTransport
+    private let configuration: BatchConfiguration
+
+    private var pendingCalls: [UInt32: [PendingCall]] = [:]
+    private var pendingBytes: [UInt32: Int] = [:]
+    private var flushTasks: [UInt32: Task<Void, Never>] = [:]
+
+    private var nextEnvelopeId: UInt32 = UInt32.random(in: 1...UInt32.max / 2)
+
+    private var statistics = BatchStatistics()
+
+    public convenience init(
+        connectionManager: ProtocolConnectionManager,
+        transport: SecureEnvelopeBatchTransport,
+        configuration: BatchConfiguration = .default
+    ) {
+        self.init(codec: connectionManager, transport: transport, configuration: configuration)
+    }
+
+    init(
+        codec: SecureEnvelopeBatchCodec,
+        transport: SecureEnvelopeBatchTransport,
+        configuration: BatchConfiguration = .default
+    ) {
+        self.codec = codec
+        self.transport = transport
+        self.configuration = configuration
+
+        Log.info("[SecureEnvelopeBatcher] Initialized (window: \(String(format: "%.0fms", configuration.window * 1000)), maxBatch: \(configuration.maxBatchSize))")
+    }
+
+    public func submit(connectId: UInt32, serviceType: String, plainBuffer: Data) async -> Result<Data, NetworkFailure> {
+        await withCheckedContinuation { continuation in
+            pendingCalls[connectId, default: []].append(PendingCall(
+                serviceType: serviceType,
+                plainBuffer: plainBuffer,
+                continuation: continuation
+            ))
+            pendingBytes[connectId, default: 0] += plainBuffer.count
+
+            if pendingCalls[connectId, default: []].count >= configuration.maxBatchSize ||
+                pendingBytes[connectId, default: 0] >= configuration.maxBatchBytes {
+                flushTasks.removeValue(forKey: connectId)?.cancel()
+                Task { await self.flush(connectId: connectId) }
+            } else if flushTasks[connectId] == nil {
+                let window = configuration.window
+                flushTasks[connectId] = Task {
+                    try? await Task.sleep(nanoseconds: UInt64(window * 1_000_000_000))
+                    guard !Task.isCancelled else {
+                        return
+                    }
+                    await self.flush(connectId: connectId)
+                }
+            }
+        }
+    }
+
+    public func flushAll() async {
+        for connectId in Array(pendingCalls.keys) {
+            flushTasks.removeValue(forKey: connectId)?.cancel()
+            await flush(connectId: connectId)
+        }
+    }
+
+    public func getStatistics() -> BatchStatistics {
+        statistics
+    }
+
+    private func flush(connectId: UInt32) async {
+        flushTasks.removeValue(forKey: connectId)
+        guard let calls = pendingCalls.removeValue(forKey: connectId), !calls.isEmpty else {
+            return
+        }
+        pendingBytes.removeValue(forKey: connectId)
+
+        var requests: [(requestId: UInt32, plainData: Data)] = []
+        requests.reserveCapacity(calls.count)
+        for call in calls {
+            requests.append((allocateEnvelopeId(), call.plainBuffer))
+        }
+
+        let encrypted = await codec.encryptOutboundBatch(connectId, requests: requests)
+
+        var waiting: [String: PendingCall] = [:]
+        var batch = Data()
+        for (index, call) in calls.enumerated() {
+            do {
+                let envelopeData = try encrypted[index].get().toData()
+                var frames = Data()
+                try GRPCMessageFramer.append([Data(call.serviceType.utf8)], to: &frames)
+                try GRPCMessageFramer.append([envelopeData], to: &frames)
+                batch.append(frames)
+                waiting[String(requests[index].requestId)] = call
+            } catch {
+                Log.error("[SecureEnvelopeBatcher] Failed to pack \(call.serviceType): \(error)")
+                call.continuation.resume(returning: .failure(NetworkFailure(
+                    type: .encryptionFailed,
+                    message: "Failed to pack batched request: \(error.localizedDescription)",
+                    underlyingError: error
+                )))
+            }
+        }
+
+        guard !waiting.isEmpty else {
+            return
+        }
+
+        statistics.batchesSent += 1
+        statistics.requestsBatched += waiting.count
+        statistics.largestBatch = max(statistics.largestBatch, waiting.count)
+
+        Log.debug("[SecureEnvelopeBatcher] Sending batch of \(waiting.count) envelopes (\(batch.count) bytes) on connection \(connectId)")
+
+        let response = await transport.sendBatch(batch, connectId: connectId)
+
+        switch response {
+        case .success(let responseBatch):
+            await deliver(responseBatch, connectId: connectId, to: &waiting)
+        case .failure(let error):
+            statistics.failedBatches += 1
+            Log.warning("[SecureEnvelopeBatcher] Batch of \(waiting.count) failed: \(error.message)")
+            for call in waiting.values {
+                call.continuation.resume(returning: .failure(error))
+            }
+            waiting.removeAll()
+        }
+
+        for call in waiting.values {
+            call.continuation.resume(returning: .failure(NetworkFailure(
+                type: .serverError,
+                message: "Batch response did not include a reply for this request"
+            )))
+        }
+    }
+
+    private func deliver(_ responseBatch: Data, connectId: UInt32, to waiting: inout [String: PendingCall]) async {
+        var envelopes: [SecureEnvelope] = []
+        do {
+            let deframer = GRPCMessageDeframer(pool: Self.framingPool)
+            try deframer.feed(responseBatch)
+            while let message = try deframer.nextMessage() {
+                envelopes.append(try SecureEnvelope.fromData(message.data))
+            }
+        } catch {
+            Log.error("[SecureEnvelopeBatcher] Malformed batch response: \(error)")
+        }
+
+        let decrypted = await codec.decryptInboundBatch(connectId, envelopes: envelopes)
+
+        for result in decrypted {
+            switch result {
+            case .success(let (envelopeId, payload)):
+                guard let call = waiting.removeValue(forKey: envelopeId) else {
+                    statistics.unmatchedResponses += 1
+                    Log.warning("[SecureEnvelopeBatcher] Response for unknown envelope \(envelopeId)")
+                    continue
+                }
+                call.continuation.resume(returning: .success(payload))
+            case .failure(let protocolError):
+                Log.error("[SecureEnvelopeBatcher] Batched response decryption failed: \(protocolError.message)")
+            }
+        }
+    }
+
+    private func allocateEnvelopeId() -> UInt32 {
+        nextEnvelopeId = nextEnvelopeId == UInt32.max ? 1 : nextEnvelopeId + 1
+        return nextEnvelopeId
+    }
+
+    private static let framingPool = GRPCSlabPool(slabSize: 256 * 1024, maxCachedSlabs: 4)
+}
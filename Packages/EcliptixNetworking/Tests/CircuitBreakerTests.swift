@@ -0,0 +1,102 @@
+import CEcliptixNetworking
+import XCTest
+
+@testable import EcliptixNetworking
+
+final class CircuitBreakerTests: XCTestCase {
+    func testNativeTableRejectsUnreachableThresholds() {
+        var failures = ecliptix_circuit_table_config_t(
+            failure_threshold: UInt32(ECLIPTIX_CIRCUIT_MAX_FAILURE_THRESHOLD) + 1,
+            success_threshold: 0,
+            open_duration_ms: 0,
+            capacity: 0
+        )
+        XCTAssertNil(ecliptix_circuit_table_create(&failures))
+
+        var successes = ecliptix_circuit_table_config_t(
+            failure_threshold: 0,
+            success_threshold: UInt32(ECLIPTIX_CIRCUIT_MAX_SUCCESS_THRESHOLD) + 1,
+            open_duration_ms: 0,
+            capacity: 0
+        )
+        XCTAssertNil(ecliptix_circuit_table_create(&successes))
+
+        var largest = ecliptix_circuit_table_config_t(
+            failure_threshold: UInt32(ECLIPTIX_CIRCUIT_MAX_FAILURE_THRESHOLD),
+            success_threshold: UInt32(ECLIPTIX_CIRCUIT_MAX_SUCCESS_THRESHOLD),
+            open_duration_ms: 0,
+            capacity: 0
+        )
+        let table = ecliptix_circuit_table_create(&largest)
+        XCTAssertNotNil(table)
+        for _ in 1..<ECLIPTIX_CIRCUIT_MAX_FAILURE_THRESHOLD {
+            XCTAssertEqual(ecliptix_circuit_table_record_failure(table, 7), ECLIPTIX_CIRCUIT_TRANSITION_NONE)
+        }
+        XCTAssertEqual(ecliptix_circuit_table_record_failure(table, 7), ECLIPTIX_CIRCUIT_TRANSITION_OPENED)
+        ecliptix_circuit_table_destroy(table)
+    }
+    func testConnectionCircuitOpensAndRecovers() async {
+        let breaker = CircuitBreaker(configuration: CircuitBreakerConfiguration(
+            failureThreshold: 2,
+            successThreshold: 1,
+            openStateDuration: 0.05
+        ))
+
+        for _ in 0..<2 {
+            _ = await breaker.execute(connectId: 1, operationName: "fail") { () -> Result<Int, NetworkFailure> in
+                .failure(.timeout("timed out"))
+            }
+        }
+        XCTAssertEqual(breaker.getConnectionMetrics(connectId: 1)?.state, .open)
+
+        let rejected = await breaker.execute(connectId: 1, operationName: "rejected") { () -> Result<Int, NetworkFailure> in
+            XCTFail("Operation must not run while the circuit is open")
+            return .success(0)
+        }
+        XCTAssertEqual(rejected.failureType, .dataCenterNotResponding)
+
+        let other = await breaker.execute(connectId: 2, operationName: "other") { () -> Result<Int, NetworkFailure> in
+            .success(2)
+        }
+        XCTAssertEqual(try? other.get(), 2)
+
+        try? await Task.sleep(nanoseconds: 100_000_000)
+        let trial = await breaker.execute(connectId: 1, operationName: "trial") { () -> Result<Int, NetworkFailure> in
+            .success(1)
+        }
+        XCTAssertEqual(try? trial.get(), 1)
+        XCTAssertEqual(breaker.getConnectionMetrics(connectId: 1)?.state, .closed)
+    }
+    func testGlobalCircuitIsSafeAcrossConcurrentCallers() async {
+        let breaker = CircuitBreaker(configuration: CircuitBreakerConfiguration(
+            failureThreshold: 1_000,
+            openStateDuration: 60
+        ))
+
+        await withTaskGroup(of: Void.self) { group in
+            for index in 0..<200 {
+                group.addTask {
+                    _ = await breaker.execute(operationName: "call-\(index)") { () -> Result<Int, NetworkFailure> in
+                        index % 2 == 0 ? .success(index) : .failure(.serverError("failed"))
+                    }
+                }
+            }
+        }
+
+        let metrics = breaker.getMetrics()
+        XCTAssertEqual(metrics.totalSuccesses, 100)
+        XCTAssertEqual(metrics.totalFailures, 100)
+        XCTAssertEqual(metrics.state, .closed)
+    }
+    func testDisabledConfigurationSkipsConnectionTracking() async {
+        let breaker = CircuitBreaker(configuration: .disabled)
+
+        for _ in 0..<10 {
+            _ = await breaker.execute(connectId: 3, operationName: "fail") { () -> Result<Int, NetworkFailure> in
+                .failure(.timeout("timed out"))
+            }
+        }
+        XCTAssertNil(breaker.getConnectionMetrics(connectId: 3))
+        XCTAssertEqual(breaker.getMetrics().state, .closed)
+    }
+}
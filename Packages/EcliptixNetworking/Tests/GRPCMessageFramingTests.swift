@@ -0,0 +1,61 @@
+import XCTest
+
+@testable import EcliptixNetworking
+
+final class GRPCMessageFramingTests: XCTestCase {
+    func testLoopbackEchoReusesSlabs() throws {
+        var sockets: [Int32] = [0, 0]
+        XCTAssertEqual(socketpair(AF_UNIX, SOCK_STREAM, 0, &sockets), 0)
+        defer {
+            close(sockets[0])
+            close(sockets[1])
+        }
+
+        let pool = GRPCSlabPool()
+        let messageCount = 500
+        let serverSocket = sockets[1]
+
+        let server = Thread {
+            let deframer = GRPCMessageDeframer(pool: pool)
+            var echoed = 0
+            while echoed < messageCount, (try? deframer.read(from: serverSocket)) ?? 0 > 0 {
+                while let message = try? deframer.nextMessage() {
+                    try? GRPCMessageFramer.write([message.data], compressed: message.isCompressed, to: serverSocket)
+                    echoed += 1
+                }
+            }
+        }
+        server.start()
+
+        let deframer = GRPCMessageDeframer(pool: pool)
+        for index in 0..<messageCount {
+            let header = Data("envelope-\(index)".utf8)
+            let payload = Data(repeating: UInt8(truncatingIfNeeded: index), count: index * 7)
+            try GRPCMessageFramer.write([header, payload], compressed: index % 2 == 1, to: sockets[0])
+
+            var response = try deframer.nextMessage()
+            while response == nil {
+                XCTAssertGreaterThan(try deframer.read(from: sockets[0]), 0)
+                response = try deframer.nextMessage()
+            }
+
+            XCTAssertEqual(response?.data, header + payload)
+            XCTAssertEqual(response?.isCompressed, index % 2 == 1)
+        }
+
+        let statistics = pool.statistics
+        XCTAssertLessThanOrEqual(statistics.slabAllocations, 4)
+        XCTAssertEqual(statistics.oversizeAllocations, 0)
+    }
+
+    func testMalformedPrefixIsRejected() throws {
+        let deframer = GRPCMessageDeframer(pool: GRPCSlabPool())
+
+        try deframer.feed(Data([0, 0, 0, 0, 2, 0xAA]))
+        XCTAssertNil(try deframer.nextMessage())
+
+        try deframer.feed(Data([0xBB, 7, 0, 0, 0, 0]))
+        XCTAssertEqual(try deframer.nextMessage()?.data, Data([0xAA, 0xBB]))
+        XCTAssertThrowsError(try deframer.nextMessage())
+    }
+}
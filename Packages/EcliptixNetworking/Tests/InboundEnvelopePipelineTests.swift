@@ -0,0 +1,227 @@
+import EcliptixCore
+import EcliptixSecurity
+import XCTest
+
+@testable import EcliptixNetworking
+
+final class InboundEnvelopePipelineTests: XCTestCase {
+    func testParallelMapPreservesOrder() async {
+        let input = Array(0..<257)
+
+        let output = await InboundEnvelopePipeline.parallelMap(input, maxConcurrency: 8) { value in
+            value * value
+        }
+
+        XCTAssertEqual(output, input.map { $0 * $0 })
+    }
+
+    func testReplayWindowEvictsOldestNonce() {
+        var window = InboundReplayWindow(capacity: 2)
+        let nonces = (0..<3).map { Data(repeating: UInt8($0), count: 12) }
+
+        window.record(nonces[0])
+        window.record(nonces[1])
+        window.record(nonces[1])
+        XCTAssertTrue(window.contains(nonces[0]))
+
+        window.record(nonces[2])
+        XCTAssertFalse(window.contains(nonces[0]))
+        XCTAssertTrue(window.contains(nonces[1]))
+        XCTAssertTrue(window.contains(nonces[2]))
+    }
+
+    func testSequencingAdvancesInIndexOrderAndKeepsInputPositions() {
+        let receivedIndices: [UInt32] = [5, 2, 9, 3]
+        var window = InboundReplayWindow()
+        var derivedOrder: [UInt32] = []
+
+        let keys = InboundEnvelopePipeline.sequence(
+            headerNonces: receivedIndices.map { Data(repeating: UInt8($0), count: 12) },
+            headers: receivedIndices.map { .success($0) },
+            replayWindow: &window
+        ) { receivedIndex in
+            derivedOrder.append(receivedIndex)
+            return .success(InboundEnvelopeKeys(messageKey: Data([UInt8(receivedIndex)]), headerKey: Data()))
+        }
+
+        XCTAssertEqual(derivedOrder, [2, 3, 5, 9])
+        XCTAssertEqual(keys.map { try? $0.get().messageKey }, receivedIndices.map { Data([UInt8($0)]) })
+    }
+
+    func testSequencingRejectsReplayedEnvelopes() {
+        let nonces = (0..<3).map { Data(repeating: UInt8($0), count: 12) }
+        var window = InboundReplayWindow()
+        window.record(nonces[0])
+        var derivedOrder: [UInt32] = []
+
+        let keys = InboundEnvelopePipeline.sequence(
+            headerNonces: [nonces[0], nonces[1], nonces[2], nonces[1]],
+            headers: [.success(1), .success(2), .failure(.decode("bad header")), .success(3)],
+            replayWindow: &window
+        ) { receivedIndex in
+            derivedOrder.append(receivedIndex)
+            return .success(InboundEnvelopeKeys(messageKey: Data(), headerKey: Data()))
+        }
+
+        XCTAssertEqual(derivedOrder, [2])
+        XCTAssertEqual(keys.map(\.isSuccess), [false, true, false, false])
+    }
+
+    func testSequencingReleasesReservationsWhenKeysCannotBeDerived() {
+        let nonces = (0..<2).map { Data(repeating: UInt8($0), count: 12) }
+        var window = InboundReplayWindow()
+
+        let keys = InboundEnvelopePipeline.sequence(
+            headerNonces: nonces,
+            headers: [.success(1), .success(2)],
+            replayWindow: &window
+        ) { receivedIndex in
+            receivedIndex == 1
+                ? .failure(.generic("No key for \(receivedIndex)"))
+                : .success(InboundEnvelopeKeys(messageKey: Data(), headerKey: Data()))
+        }
+
+        XCTAssertEqual(keys.map(\.isSuccess), [false, true])
+        XCTAssertFalse(window.contains(nonces[0]))
+        XCTAssertTrue(window.contains(nonces[1]))
+    }
+
+    func testReplayWindowReservationsBlockUntilReleased() {
+        var window = InboundReplayWindow()
+        let nonce = Data(repeating: 0x42, count: 12)
+
+        XCTAssertTrue(window.reserve(nonce))
+        XCTAssertFalse(window.reserve(nonce))
+
+        window.release(nonce)
+        XCTAssertFalse(window.contains(nonce))
+        XCTAssertTrue(window.reserve(nonce))
+
+        window.commit(nonce)
+        XCTAssertTrue(window.contains(nonce))
+        XCTAssertFalse(window.reserve(nonce))
+    }
+
+    func testSequencingRejectsEnvelopesBehindTheRatchetWindow() throws {
+        let receiver = try makeConnectionPair().receiver
+        let derive: (UInt32) -> Result<InboundEnvelopeKeys, ProtocolFailure> = { receivedIndex in
+            receiver.processReceivedMessage(receivedIndex: receivedIndex).map { _ in
+                InboundEnvelopeKeys(messageKey: Data(), headerKey: Data())
+            }
+        }
+        let firstBatch = Array(UInt32(1)...ProtocolChainStep.defaultCacheWindowSize + 10).shuffled()
+
+        var window = InboundReplayWindow()
+
+        let first = InboundEnvelopePipeline.sequence(
+            headerNonces: firstBatch.map { Data("first-\($0)".utf8) },
+            headers: firstBatch.map { .success($0) },
+            replayWindow: &window,
+            deriveKeys: derive
+        )
+        XCTAssertTrue(first.allSatisfy(\.isSuccess))
+
+        let stale: UInt32 = 1
+        let next = ProtocolChainStep.defaultCacheWindowSize + 11
+        let second = InboundEnvelopePipeline.sequence(
+            headerNonces: [Data("second-stale".utf8), Data("second-next".utf8)],
+            headers: [.success(stale), .success(next)],
+            replayWindow: &window,
+            deriveKeys: derive
+        )
+        XCTAssertEqual(second.map(\.isSuccess), [false, true])
+    }
+
+    func testDecryptPayloadsPreservesInputOrder() async throws {
+        var envelopes: [SecureEnvelope] = []
+        var keys: [Result<InboundEnvelopeKeys, ProtocolFailure>] = []
+        for requestId in UInt32(1)...64 {
+            let derivedKeys = InboundEnvelopeKeys(
+                messageKey: Data(repeating: UInt8(requestId), count: 32),
+                headerKey: Data(repeating: UInt8(requestId) ^ 0xFF, count: 32)
+            )
+            envelopes.append(try EnvelopeBuilder.createRequestEnvelope(
+                requestId: requestId,
+                payload: Data("payload-\(requestId)".utf8),
+                messageKey: derivedKeys.messageKey,
+                headerKey: derivedKeys.headerKey,
+                nonce: Data(repeating: UInt8(requestId), count: 12),
+                headerNonce: Data(repeating: UInt8(requestId) ^ 0x55, count: 12),
+                ratchetIndex: requestId,
+                associatedData: Data()
+            ).get())
+            keys.append(requestId % 16 == 0 ? .failure(.generic("No key for \(requestId)")) : .success(derivedKeys))
+        }
+
+        let results = await InboundEnvelopePipeline.decryptPayloads(envelopes, keys: keys)
+
+        XCTAssertEqual(results.count, 64)
+        for (offset, result) in results.enumerated() {
+            let requestId = offset + 1
+            if requestId % 16 == 0 {
+                XCTAssertFalse(result.isSuccess)
+                continue
+            }
+            let decrypted = try result.get()
+            XCTAssertEqual(decrypted.envelopeId, String(requestId))
+            XCTAssertEqual(decrypted.payload, Data("payload-\(requestId)".utf8))
+        }
+    }
+
+    func testOverlappingBatchesAcceptASharedEnvelopeOnce() async throws {
+        let connections = try makeConnectionPair()
+        let outbound = ProtocolConnectionManager()
+        let inbound = ProtocolConnectionManager()
+        await outbound.addConnection(
+            connectId: 1,
+            identityKeys: try IdentityKeys.create(oneTimeKeyCount: 1),
+            doubleRatchet: connections.sender
+        )
+        await inbound.addConnection(
+            connectId: 1,
+            identityKeys: try IdentityKeys.create(oneTimeKeyCount: 1),
+            doubleRatchet: connections.receiver
+        )
+
+        var envelopes: [SecureEnvelope] = []
+        for requestId in UInt32(1)...3 {
+            envelopes.append(try await outbound.encryptOutbound(
+                1,
+                plainData: Data("payload-\(requestId)".utf8),
+                requestId: requestId
+            ).get())
+        }
+
+        async let firstBatch = inbound.decryptInboundBatch(1, envelopes: [envelopes[0], envelopes[1]])
+        async let secondBatch = inbound.decryptInboundBatch(1, envelopes: [envelopes[2], envelopes[1]])
+        let (first, second) = await (firstBatch, secondBatch)
+
+        XCTAssertTrue(first[0].isSuccess)
+        XCTAssertTrue(second[0].isSuccess)
+        XCTAssertEqual([first[1], second[1]].filter(\.isSuccess).count, 1)
+
+        let replayed = await inbound.decryptInboundBatch(1, envelopes: [envelopes[1], envelopes[0]])
+        XCTAssertEqual(replayed.map(\.isSuccess), [false, false])
+    }
+
+    private func makeConnectionPair() throws -> (sender: ProtocolConnection, receiver: ProtocolConnection) {
+        let sender = try ProtocolConnection.create(
+            connectionId: 1,
+            isInitiator: true,
+            initialRootKey: Data(repeating: 0x11, count: 32),
+            initialChainKey: Data(repeating: 0x22, count: 32)
+        ).get()
+        var state = try sender.toProtoState().get()
+        state.receivingStep = state.sendingStep
+        return (sender, try ProtocolConnection.fromProtoState(connectionId: 1, state: state).get())
+    }
+}
+
+private extension Result {
+    var isSuccess: Bool {
+        if case .success = self {
+            return true
+        }
+        return false
+    }
+}
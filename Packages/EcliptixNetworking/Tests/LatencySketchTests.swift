@@ -0,0 +1,115 @@
+import CEcliptixNetworking
+import XCTest
+
+@testable import EcliptixNetworking
+
+final class LatencySketchTests: XCTestCase {
+    func testQuantilesStayWithinRelativeAccuracy() {
+        for accuracy in [0.01, 0.02, 0.05] {
+            var config = ecliptix_latency_sketch_config_t(relative_accuracy: accuracy, max_latency_us: 0, ewma_weight: 0)
+            let sketch = ecliptix_latency_sketch_create(&config)
+            defer { ecliptix_latency_sketch_destroy(sketch) }
+            XCTAssertNotNil(sketch)
+
+            let samples = logUniformSamples(count: 20_000, seed: 0x9e37_79b9_7f4a_7c15)
+            samples.forEach { ecliptix_latency_sketch_record(sketch, $0) }
+            let sorted = samples.sorted()
+
+            for quantile in [0.0, 0.1, 0.25, 0.5, 0.75, 0.9, 0.95, 0.99, 0.999, 1.0] {
+                var estimate: UInt64 = 0
+                XCTAssertEqual(ecliptix_latency_sketch_quantile(sketch, quantile, &estimate), ECLIPTIX_NET_SUCCESS)
+
+                let exact = Double(sorted[Int(quantile * Double(sorted.count - 1))])
+                // Estimates are reported in whole microseconds, so allow half a microsecond of rounding on top.
+                XCTAssertLessThanOrEqual(
+                    abs(Double(estimate) - exact),
+                    accuracy * exact + 0.5,
+                    "q\(quantile) at accuracy \(accuracy): estimate \(estimate), exact \(exact)"
+                )
+            }
+        }
+    }
+    func testMergeMatchesSingleSketchOverUnion() {
+        let first = ecliptix_latency_sketch_create(nil)
+        let second = ecliptix_latency_sketch_create(nil)
+        let combined = ecliptix_latency_sketch_create(nil)
+        defer {
+            ecliptix_latency_sketch_destroy(first)
+            ecliptix_latency_sketch_destroy(second)
+            ecliptix_latency_sketch_destroy(combined)
+        }
+
+        let fast = logUniformSamples(count: 5_000, seed: 1, range: 100...10_000)
+        let slow = logUniformSamples(count: 1_000, seed: 2, range: 50_000...2_000_000)
+        fast.forEach {
+            ecliptix_latency_sketch_record(first, $0)
+            ecliptix_latency_sketch_record(combined, $0)
+        }
+        slow.forEach {
+            ecliptix_latency_sketch_record(second, $0)
+            ecliptix_latency_sketch_record(combined, $0)
+        }
+
+        XCTAssertEqual(ecliptix_latency_sketch_merge(first, second), ECLIPTIX_NET_SUCCESS)
+
+        var merged = ecliptix_latency_summary_t()
+        var expected = ecliptix_latency_summary_t()
+        ecliptix_latency_sketch_get_summary(first, &merged)
+        ecliptix_latency_sketch_get_summary(combined, &expected)
+
+        XCTAssertEqual(merged.count, 6_000)
+        XCTAssertEqual(merged.min_us, fast.min())
+        XCTAssertEqual(merged.max_us, slow.max())
+        XCTAssertEqual(merged.p50_us, expected.p50_us)
+        XCTAssertEqual(merged.p95_us, expected.p95_us)
+        XCTAssertEqual(merged.p99_us, expected.p99_us)
+        XCTAssertEqual(merged.mean_us, expected.mean_us, accuracy: 1e-6)
+    }
+    func testMergeRejectsMismatchedAccuracy() {
+        var coarse = ecliptix_latency_sketch_config_t(relative_accuracy: 0.05, max_latency_us: 0, ewma_weight: 0)
+        let target = ecliptix_latency_sketch_create(nil)
+        let source = ecliptix_latency_sketch_create(&coarse)
+        defer {
+            ecliptix_latency_sketch_destroy(target)
+            ecliptix_latency_sketch_destroy(source)
+        }
+
+        ecliptix_latency_sketch_record(source, 1_000)
+        XCTAssertEqual(ecliptix_latency_sketch_merge(target, source), ECLIPTIX_NET_ERROR_INVALID_PARAMS)
+        XCTAssertEqual(ecliptix_latency_sketch_merge(target, target), ECLIPTIX_NET_ERROR_INVALID_PARAMS)
+    }
+    func testHealthMonitorAggregatesConnectionsOffMainActor() async {
+        let monitor = ConnectionHealthMonitor()
+
+        await withTaskGroup(of: Void.self) { group in
+            for connectId in UInt32(1)...4 {
+                group.addTask {
+                    for sample in 1...250 {
+                        monitor.recordSuccess(connectId: connectId, latency: TimeInterval(sample) / 1_000)
+                    }
+                }
+            }
+        }
+
+        let statistics = monitor.getStatistics()
+        XCTAssertEqual(statistics.totalConnections, 4)
+        XCTAssertEqual(statistics.totalSuccesses, 1_000)
+        XCTAssertEqual(statistics.p50Latency, 0.125, accuracy: 0.125 * 0.01 + 1e-6)
+        XCTAssertEqual(statistics.maxLatency, 0.25, accuracy: 1e-6)
+    }
+
+    private func logUniformSamples(
+        count: Int,
+        seed: UInt64,
+        range: ClosedRange<Double> = 10...10_000_000
+    ) -> [UInt64] {
+        var state = seed
+        let low = log(range.lowerBound)
+        let high = log(range.upperBound)
+        return (0..<count).map { _ in
+            state = state &* 6_364_136_223_846_793_005 &+ 1_442_695_040_888_963_407
+            let unit = Double(state >> 11) / Double(1 << 53)
+            return UInt64(exp(low + unit * (high - low)).rounded())
+        }
+    }
+}
@@ -0,0 +1,149 @@
+import XCTest
+
+@testable import EcliptixNetworking
+
+final class NetworkCacheTests: XCTestCase {
+    func testCachedResponseRoundTrip() {
+        let cache = NetworkCache(configuration: NetworkCacheConfiguration(maxDiskCacheBytes: 0))
+        let payload = Data("response".utf8)
+
+        cache.cacheResponse(requestKey: "membership/profile/1", responseData: payload)
+
+        XCTAssertEqual(cache.getCachedResponse(requestKey: "membership/profile/1"), payload)
+        XCTAssertNil(cache.getCachedResponse(requestKey: "membership/profile/2"))
+        XCTAssertEqual(cache.getStatistics().cacheHits, 1)
+        XCTAssertEqual(cache.getStatistics().cacheMisses, 1)
+    }
+    func testPrefixAndTagInvalidation() {
+        let cache = NetworkCache(configuration: NetworkCacheConfiguration(maxDiskCacheBytes: 0))
+        let payload = Data("response".utf8)
+
+        cache.cacheResponse(requestKey: "membership/profile/1", responseData: payload, tags: ["user-1"])
+        cache.cacheResponse(requestKey: "membership/profile/2", responseData: payload)
+        cache.cacheResponse(requestKey: "device/settings", responseData: payload, tags: ["user-1"])
+
+        cache.invalidateByPrefix("membership/")
+        XCTAssertNil(cache.getCachedResponse(requestKey: "membership/profile/2"))
+        XCTAssertNotNil(cache.getCachedResponse(requestKey: "device/settings"))
+
+        cache.invalidateByTag("user-1")
+        XCTAssertNil(cache.getCachedResponse(requestKey: "device/settings"))
+        XCTAssertEqual(cache.getStatistics().entryCount, 0)
+    }
+    func testByteBudgetKeepsFrequentlyUsedEntries() {
+        let cache = NetworkCache(configuration: NetworkCacheConfiguration(maxCacheBytes: 64 * 1024, shardCount: 1, maxDiskCacheBytes: 0))
+        let payload = Data(repeating: 0xAB, count: 512)
+
+        cache.cacheResponse(requestKey: "hot", responseData: payload)
+        XCTAssertNotNil(cache.getCachedResponse(requestKey: "hot"))
+
+        for index in 0..<1_000 {
+            cache.cacheResponse(requestKey: "cold/\(index)", responseData: payload)
+        }
+
+        let statistics = cache.getStatistics()
+        XCTAssertLessThanOrEqual(statistics.totalSizeBytes, 64 * 1024)
+        XCTAssertGreaterThan(statistics.cacheEvictions, 0)
+        XCTAssertNotNil(cache.getCachedResponse(requestKey: "hot"))
+    }
+
+    func testDiskTierSurvivesReopen() {
+        let location = makeDiskLocation()
+        let payload = Data("persisted-response".utf8)
+
+        do {
+            let cache = NetworkCache(configuration: NetworkCacheConfiguration(), diskLocation: location)
+            cache.cacheResponse(requestKey: "membership/profile/1", responseData: payload, etag: "v1", tags: ["user-1"])
+            cache.flushToDisk()
+        }
+
+        let reopened = NetworkCache(configuration: NetworkCacheConfiguration(), diskLocation: location)
+        XCTAssertEqual(reopened.getCachedResponse(requestKey: "membership/profile/1"), payload)
+        XCTAssertEqual(reopened.getStatistics().diskHits, 1)
+
+        reopened.invalidateByTag("user-1")
+        XCTAssertNil(reopened.getCachedResponse(requestKey: "membership/profile/1"))
+    }
+
+    func testBulkInvalidationOnlyRemovesMatchingDiskEntries() {
+        let location = makeDiskLocation()
+        let payload = Data("response".utf8)
+
+        do {
+            let cache = NetworkCache(configuration: NetworkCacheConfiguration(), diskLocation: location)
+            cache.cacheResponse(requestKey: "membership/profile/1", responseData: payload)
+            cache.cacheResponse(requestKey: "membership/profile/2", responseData: payload)
+            cache.cacheResponse(requestKey: "device/settings", responseData: payload, tags: ["user-1"])
+            cache.cacheResponse(requestKey: "device/keys", responseData: payload)
+            cache.cacheResponse(requestKey: "feed/page-7", responseData: payload)
+            cache.flushToDisk()
+        }
+
+        let cache = NetworkCache(configuration: NetworkCacheConfiguration(), diskLocation: location)
+        cache.invalidateByPrefix("membership/")
+        cache.invalidateByTag("user-1")
+        cache.invalidateByPattern("page-")
+
+        XCTAssertNil(cache.getCachedResponse(requestKey: "membership/profile/1"))
+        XCTAssertNil(cache.getCachedResponse(requestKey: "membership/profile/2"))
+        XCTAssertNil(cache.getCachedResponse(requestKey: "device/settings"))
+        XCTAssertNil(cache.getCachedResponse(requestKey: "feed/page-7"))
+        XCTAssertEqual(cache.getCachedResponse(requestKey: "device/keys"), payload)
+        XCTAssertEqual(cache.getStatistics().diskEntryCount, 1)
+    }
+
+    func testDiskRemovalIsPersistedBeforeShutdown() {
+        let location = makeDiskLocation()
+        let payload = Data("response".utf8)
+
+        let cache = NetworkCache(configuration: NetworkCacheConfiguration(), diskLocation: location)
+        cache.cacheResponse(requestKey: "membership/profile/1", responseData: payload)
+        cache.cacheResponse(requestKey: "device/settings", responseData: payload)
+        cache.flushToDisk()
+
+        cache.invalidate(requestKey: "membership/profile/1")
+        cache.invalidateByPrefix("device/")
+
+        // A second instance reads only what is on disk, so anything still in memory would show up here.
+        let observer = NetworkCache(configuration: NetworkCacheConfiguration(), diskLocation: location)
+        XCTAssertNil(observer.getCachedResponse(requestKey: "membership/profile/1"))
+        XCTAssertNil(observer.getCachedResponse(requestKey: "device/settings"))
+        XCTAssertEqual(observer.getStatistics().diskEntryCount, 0)
+    }
+
+    func testDiskRecordsAreEncrypted() throws {
+        let location = makeDiskLocation()
+        let marker = "plaintext-marker-4f1c"
+
+        do {
+            let cache = NetworkCache(configuration: NetworkCacheConfiguration(), diskLocation: location)
+            cache.cacheResponse(
+                requestKey: "membership/\(marker)",
+                responseData: Data(marker.utf8),
+                etag: marker,
+                tags: [marker]
+            )
+            cache.flushToDisk()
+        }
+
+        let files = try FileManager.default.contentsOfDirectory(at: location.directory, includingPropertiesForKeys: nil)
+        XCTAssertFalse(files.isEmpty)
+        for file in files {
+            let contents = try Data(contentsOf: file)
+            XCTAssertNil(contents.range(of: Data(marker.utf8)), "\(file.lastPathComponent) leaks plaintext")
+        }
+
+        let wrongKey = (directory: location.directory, key: Data(repeating: 0x5A, count: 32))
+        let reopened = NetworkCache(configuration: NetworkCacheConfiguration(), diskLocation: wrongKey)
+        XCTAssertNil(reopened.getCachedResponse(requestKey: "membership/\(marker)"))
+    }
+
+    private func makeDiskLocation() -> (directory: URL, key: Data) {
+        let directory = FileManager.default.temporaryDirectory
+            .appendingPathComponent("NetworkCacheTests-\(UUID().uuidString)")
+        addTeardownBlock {
+            try? FileManager.default.removeItem(at: directory)
+        }
+        return (directory, Data((0..<32).map { UInt8($0) }))
+    }
+}
@@ -0,0 +1,152 @@
+import EcliptixCore
+import XCTest
+
+@testable import EcliptixNetworking
+
+final class ProductionPendingRequestManagerTests: XCTestCase {
+    func testRetryDrainsInPriorityOrder() async throws {
+        let manager = ProductionPendingRequestManager(
+            maxConcurrentRetries: 1,
+            retriesPerSecond: 1_000,
+            messageBus: MessageBus()
+        )
+        let recorder = Recorder()
+
+        await manager.enqueue(operationName: "low", priority: .low) { await recorder.append("low") }
+        await manager.enqueue(operationName: "critical", priority: .critical) { await recorder.append("critical") }
+        await manager.enqueue(operationName: "normal") { await recorder.append("normal") }
+
+        let outcome = try await manager.retryAllPendingRequests()
+
+        XCTAssertEqual(outcome.total, 3)
+        XCTAssertEqual(outcome.success, 3)
+        let order = await recorder.values
+        XCTAssertEqual(order, ["critical", "normal", "low"])
+        let isEmpty = await manager.isEmpty()
+        XCTAssertTrue(isEmpty)
+    }
+    func testFailedRequestsAreRequeued() async throws {
+        let manager = ProductionPendingRequestManager(messageBus: MessageBus())
+
+        await manager.enqueue(operationName: "failing") { throw URLError(.notConnectedToInternet) }
+
+        let outcome = try await manager.retryAllPendingRequests()
+
+        XCTAssertEqual(outcome.failure, 1)
+        let size = await manager.getQueueSize()
+        XCTAssertEqual(size, 1)
+        let statistics = await manager.getStatistics()
+        XCTAssertEqual(statistics.requeued, 1)
+    }
+    func testCancelRemovesQueuedRequestOnce() async {
+        let manager = ProductionPendingRequestManager(messageBus: MessageBus())
+
+        let id = await manager.enqueue(operationName: "queued") {}
+
+        let first = await manager.cancel(requestId: id)
+        let second = await manager.cancel(requestId: id)
+        XCTAssertTrue(first)
+        XCTAssertFalse(second)
+        let isEmpty = await manager.isEmpty()
+        XCTAssertTrue(isEmpty)
+    }
+    func testCancelReportsNativeResultForInFlightRequest() async throws {
+        let manager = ProductionPendingRequestManager(messageBus: MessageBus())
+        let (started, startedContinuation) = AsyncStream<Void>.makeStream()
+        let release = Latch()
+
+        let id = await manager.enqueue(operationName: "in-flight") {
+            startedContinuation.yield()
+            await release.wait()
+        }
+
+        let retry = Task { try await manager.retryAllPendingRequests() }
+        for await _ in started {
+            break
+        }
+
+        let cancelled = await manager.cancel(requestId: id)
+        XCTAssertFalse(cancelled, "An in-flight request cannot be cancelled in the native queue")
+
+        await release.open()
+        let outcome = try await retry.value
+        XCTAssertEqual(outcome.success, 1)
+    }
+    func testCancellingThrottledRetryStopsDraining() async {
+        let manager = ProductionPendingRequestManager(
+            maxConcurrentRetries: 1,
+            retriesPerSecond: 0.01,
+            messageBus: MessageBus()
+        )
+        let (started, startedContinuation) = AsyncStream<Void>.makeStream()
+
+        await manager.enqueue(operationName: "first", priority: .high) { startedContinuation.yield() }
+        await manager.enqueue(operationName: "throttled") {}
+
+        let retry = Task { try await manager.retryAllPendingRequests() }
+        for await _ in started {
+            break
+        }
+        retry.cancel()
+
+        do {
+            _ = try await retry.value
+            XCTFail("A cancelled retry must not report completion")
+        } catch {
+            XCTAssertTrue(error is CancellationError)
+        }
+        let size = await manager.getQueueSize()
+        XCTAssertEqual(size, 1)
+    }
+    func testFullQueueEvictsLowestRankedRequest() async {
+        let manager = ProductionPendingRequestManager(maxQueueSize: 1, messageBus: MessageBus())
+
+        let normal = await manager.enqueue(operationName: "normal") {}
+        let refused = await manager.enqueue(operationName: "background", priority: .background) {}
+        let refusedCancelled = await manager.cancel(requestId: refused)
+        XCTAssertFalse(refusedCancelled)
+
+        await manager.enqueue(operationName: "high", priority: .high) {}
+        let evictedCancelled = await manager.cancel(requestId: normal)
+        XCTAssertFalse(evictedCancelled)
+
+        let size = await manager.getQueueSize()
+        XCTAssertEqual(size, 1)
+    }
+    func testRequestsAreNotQueuedWithoutNativeQueue() async {
+        let manager = ProductionPendingRequestManager(maxQueueSize: 2_000_000, messageBus: MessageBus())
+
+        let id = await manager.enqueue(operationName: "orphan") {}
+
+        let size = await manager.getQueueSize()
+        XCTAssertEqual(size, 0)
+        let cancelled = await manager.cancel(requestId: id)
+        XCTAssertFalse(cancelled)
+    }
+}
+
+private actor Recorder {
+    private(set) var values: [String] = []
+
+    func append(_ value: String) {
+        values.append(value)
+    }
+}
+
+private actor Latch {
+    private var isOpen = false
+    private var waiters: [CheckedContinuation<Void, Never>] = []
+
+    func wait() async {
+        guard !isOpen else {
+            return
+        }
+        await withCheckedContinuation { waiters.append($0) }
+    }
+
+    func open() {
+        isOpen = true
+        waiters.forEach { $0.resume() }
+        waiters.removeAll()
+    }
+}
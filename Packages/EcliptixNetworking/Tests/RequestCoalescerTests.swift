@@ -0,0 +1,51 @@
+import XCTest
+
+@testable import EcliptixNetworking
+
+@MainActor
+final class RequestCoalescerTests: XCTestCase {
+    @MainActor
+    private final class ExecutionCounter {
+        var count = 0
+    }
+
+    func testConcurrentDuplicatesShareOneExecution() async {
+        let coalescer = RequestCoalescer()
+        let key = RequestCoalescer.fingerprint(connectId: 1, operation: "getDeviceStatus", payload: Data("device".utf8))
+        let executions = ExecutionCounter()
+
+        let first = Task {
+            await coalescer.execute(key: key, statisticsKey: "getDeviceStatus", requestBytes: 6) {
+                executions.count += 1
+                try? await Task.sleep(nanoseconds: 50_000_000)
+                return .success(Data("status".utf8))
+            }
+        }
+        let second = Task {
+            await coalescer.execute(key: key, statisticsKey: "getDeviceStatus", requestBytes: 6) {
+                executions.count += 1
+                return .success(Data("other".utf8))
+            }
+        }
+
+        let results = [await first.value, await second.value]
+
+        XCTAssertEqual(executions.count, 1)
+        XCTAssertEqual(results.compactMap { try? $0.get() }, [Data("status".utf8), Data("status".utf8)])
+
+        let statistics = coalescer.getStatistics(for: "getDeviceStatus")
+        XCTAssertEqual(statistics.executions, 1)
+        XCTAssertEqual(statistics.coalescedCalls, 1)
+        XCTAssertEqual(statistics.savedRequestBytes, 6)
+        XCTAssertEqual(coalescer.inFlightCount, 0)
+    }
+
+    func testFingerprintCoversWholePayload() {
+        let prefix = Data(repeating: 0x01, count: 64)
+
+        XCTAssertNotEqual(
+            RequestCoalescer.fingerprint(connectId: 1, operation: "validateMobileNumber", payload: prefix + Data([0x02])),
+            RequestCoalescer.fingerprint(connectId: 1, operation: "validateMobileNumber", payload: prefix + Data([0x03]))
+        )
+    }
+}
@@ -0,0 +1,75 @@
+import XCTest
+
+@testable import EcliptixNetworking
+
+@MainActor
+final class RequestTimeoutManagerTests: XCTestCase {
+    func testTimeoutFiresAfterDeadline() async {
+        let manager = RequestTimeoutManager()
+        let fired = expectation(description: "timeout fired")
+        let startedAt = Date()
+
+        manager.startTracking(requestId: "request-1", timeout: 0.05) {
+            XCTAssertGreaterThanOrEqual(Date().timeIntervalSince(startedAt), 0.05)
+            fired.fulfill()
+        }
+
+        await fulfillment(of: [fired], timeout: 2.0)
+        XCTAssertEqual(manager.activeTimeoutCount, 0)
+        XCTAssertEqual(manager.getStatistics().totalTimeouts, 1)
+    }
+    func testStoppedRequestDoesNotTimeOut() async throws {
+        let manager = RequestTimeoutManager()
+        let fired = expectation(description: "timeout fired")
+        fired.isInverted = true
+
+        manager.startTracking(requestId: "request-1", timeout: 0.05) {
+            fired.fulfill()
+        }
+        manager.stopTracking(requestId: "request-1")
+
+        await fulfillment(of: [fired], timeout: 0.2)
+        XCTAssertEqual(manager.getStatistics().totalTimeouts, 0)
+    }
+    func testExtendTimeoutDelaysExpiry() async {
+        let manager = RequestTimeoutManager()
+        let fired = expectation(description: "timeout fired")
+        let startedAt = Date()
+
+        manager.startTracking(requestId: "request-1", timeout: 0.05) {
+            XCTAssertGreaterThanOrEqual(Date().timeIntervalSince(startedAt), 0.15)
+            fired.fulfill()
+        }
+        manager.extendTimeout(requestId: "request-1", additionalTime: 0.1)
+
+        await fulfillment(of: [fired], timeout: 2.0)
+    }
+    func testManyConcurrentTimeouts() async {
+        let manager = RequestTimeoutManager()
+        let requestCount = 10_000
+        let fired = expectation(description: "all timeouts fired")
+        fired.expectedFulfillmentCount = requestCount / 2
+
+        for index in 0..<requestCount {
+            manager.startTracking(requestId: "request-\(index)", timeout: 0.01 + Double(index % 50) / 1000) {
+                fired.fulfill()
+            }
+        }
+        for index in stride(from: 0, to: requestCount, by: 2) {
+            manager.stopTracking(requestId: "request-\(index)")
+        }
+
+        await fulfillment(of: [fired], timeout: 5.0)
+        XCTAssertEqual(manager.activeTimeoutCount, 0)
+    }
+    func testOutOfRangeIntervalsAreClamped() {
+        let manager = RequestTimeoutManager(configuration: TimeoutConfiguration(timerResolution: 1e12))
+        manager.startTracking(requestId: "request-1", timeout: .infinity) {}
+        manager.startTracking(requestId: "request-2", timeout: -1) {}
+
+        XCTAssertFalse(manager.isTimedOut(requestId: "request-1"))
+        manager.stopTracking(requestId: "request-1")
+        manager.stopTracking(requestId: "request-2")
+        XCTAssertEqual(manager.activeTimeoutCount, 0)
+    }
+}
@@ -0,0 +1,147 @@
+import EcliptixCore
+import XCTest
+
+@testable import EcliptixNetworking
+
+final class SecureEnvelopeBatcherTests: XCTestCase {
+    @MainActor
+    func testRepliesAreDemultiplexedByEnvelopeId() async {
+        let transport = MockBatchTransport { requests in
+            XCTAssertEqual(Set(requests.map { $0.serviceType }), ["membership.SignIn", "device.Register", "feed.Page"])
+            return .success(requests.reversed().map { request in
+                reply(to: request.envelope, payload: Data("\(request.serviceType):".utf8) + request.envelope.encryptedPayload)
+            })
+        }
+        let batcher = makeBatcher(transport: transport, maxBatchSize: 3)
+
+        async let signIn = batcher.submit(connectId: 1, serviceType: "membership.SignIn", plainBuffer: Data("a".utf8))
+        async let register = batcher.submit(connectId: 1, serviceType: "device.Register", plainBuffer: Data("b".utf8))
+        async let page = batcher.submit(connectId: 1, serviceType: "feed.Page", plainBuffer: Data("c".utf8))
+        let results = await [signIn, register, page]
+
+        XCTAssertEqual(results.map { try? $0.get() }, [
+            Data("membership.SignIn:a".utf8),
+            Data("device.Register:b".utf8),
+            Data("feed.Page:c".utf8),
+        ])
+        let statistics = batcher.getStatistics()
+        XCTAssertEqual(statistics.batchesSent, 1)
+        XCTAssertEqual(statistics.requestsBatched, 3)
+    }
+    @MainActor
+    func testMissingReplyFailsOnlyThatCall() async {
+        let transport = MockBatchTransport { requests in
+            .success(requests
+                .filter { $0.envelope.encryptedPayload != Data("a".utf8) }
+                .map { reply(to: $0.envelope, payload: $0.envelope.encryptedPayload) })
+        }
+        let batcher = makeBatcher(transport: transport, maxBatchSize: 2)
+
+        async let dropped = batcher.submit(connectId: 1, serviceType: "membership.SignIn", plainBuffer: Data("a".utf8))
+        async let answered = batcher.submit(connectId: 1, serviceType: "membership.SignIn", plainBuffer: Data("b".utf8))
+        let (droppedResult, answeredResult) = await (dropped, answered)
+
+        XCTAssertEqual(droppedResult.failureType, .serverError)
+        XCTAssertEqual(try? answeredResult.get(), Data("b".utf8))
+    }
+    @MainActor
+    func testPackFailureFailsOnlyThatCall() async {
+        let transport = MockBatchTransport { requests in
+            XCTAssertEqual(requests.count, 1)
+            return .success(requests.map { reply(to: $0.envelope, payload: $0.envelope.encryptedPayload) })
+        }
+        let batcher = makeBatcher(transport: transport, maxBatchSize: 2)
+
+        async let unpackable = batcher.submit(connectId: 1, serviceType: "device.Register", plainBuffer: MockBatchCodec.unpackable)
+        async let packed = batcher.submit(connectId: 1, serviceType: "device.Register", plainBuffer: Data("b".utf8))
+        let (unpackableResult, packedResult) = await (unpackable, packed)
+
+        XCTAssertEqual(unpackableResult.failureType, .encryptionFailed)
+        XCTAssertEqual(try? packedResult.get(), Data("b".utf8))
+        XCTAssertEqual(batcher.getStatistics().requestsBatched, 1)
+    }
+    @MainActor
+    func testTransportFailureFailsEveryCall() async {
+        let transport = MockBatchTransport { _ in
+            .failure(.timeout("batch timed out"))
+        }
+        let batcher = makeBatcher(transport: transport, maxBatchSize: 2)
+
+        async let first = batcher.submit(connectId: 1, serviceType: "membership.SignIn", plainBuffer: Data("a".utf8))
+        async let second = batcher.submit(connectId: 1, serviceType: "membership.SignIn", plainBuffer: Data("b".utf8))
+        let results = await [first, second]
+
+        XCTAssertEqual(results.map(\.failureType), [.timeout, .timeout])
+        XCTAssertEqual(batcher.getStatistics().failedBatches, 1)
+    }
+
+    @MainActor
+    private func makeBatcher(transport: MockBatchTransport, maxBatchSize: Int) -> SecureEnvelopeBatcher {
+        SecureEnvelopeBatcher(
+            codec: MockBatchCodec(),
+            transport: transport,
+            configuration: BatchConfiguration(window: 10, maxBatchSize: maxBatchSize)
+        )
+    }
+}
+
+private func reply(to request: SecureEnvelope, payload: Data) -> SecureEnvelope {
+    SecureEnvelope(metaData: request.metaData, encryptedPayload: payload, resultCode: Data(), headerNonce: Data())
+}
+
+private struct MockBatchCodec: SecureEnvelopeBatchCodec {
+    static let unpackable = Data("unpackable".utf8)
+
+    func encryptOutboundBatch(
+        _ connectId: UInt32,
+        requests: [(requestId: UInt32, plainData: Data)]
+    ) async -> [Result<SecureEnvelope, ProtocolFailure>] {
+        requests.map { request in
+            guard request.plainData != Self.unpackable else {
+                return .failure(.encode("Cannot encrypt request \(request.requestId)"))
+            }
+            return .success(SecureEnvelope(
+                metaData: Data(String(request.requestId).utf8),
+                encryptedPayload: request.plainData,
+                resultCode: Data(),
+                headerNonce: Data()
+            ))
+        }
+    }
+
+    func decryptInboundBatch(
+        _ connectId: UInt32,
+        envelopes: [SecureEnvelope]
+    ) async -> [Result<(envelopeId: String, payload: Data), ProtocolFailure>] {
+        envelopes.map { .success((String(decoding: $0.metaData, as: UTF8.self), $0.encryptedPayload)) }
+    }
+}
+
+private struct MockBatchTransport: SecureEnvelopeBatchTransport {
+    let respond: @Sendable ([(serviceType: String, envelope: SecureEnvelope)]) -> Result<[SecureEnvelope], NetworkFailure>
+
+    func sendBatch(_ batch: Data, connectId: UInt32) async -> Result<Data, NetworkFailure> {
+        do {
+            let deframer = GRPCMessageDeframer(pool: GRPCSlabPool())
+            try deframer.feed(batch)
+            var requests: [(serviceType: String, envelope: SecureEnvelope)] = []
+            while let serviceType = try deframer.nextMessage() {
+                guard let envelope = try deframer.nextMessage() else {
+                    return .failure(.invalidRequest("Service type frame without an envelope"))
+                }
+                requests.append((String(decoding: serviceType.data, as: UTF8.self), try SecureEnvelope.fromData(envelope.data)))
+            }
+            XCTAssertEqual(deframer.bufferedBytes, 0)
+
+            var response = Data()
+            for envelope in try respond(requests).get() {
+                try GRPCMessageFramer.append([envelope.toData()], to: &response)
+            }
+            return .success(response)
+        } catch let failure as NetworkFailure {
+            return .failure(failure)
+        } catch {
+            return .failure(.invalidRequest("Malformed batch: \(error)"))
+        }
+    }
+}
@@ -0,0 +1,10 @@
+@testable import EcliptixNetworking
+
+extension Result where Failure == NetworkFailure {
+    var failureType: NetworkFailureType? {
+        if case .failure(let failure) = self {
+            return failure.type
+        }
+        return nil
+    }
+}
@@ -0,0 +1,163 @@
+#import <XCTest/XCTest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "opaque/admission_control.h"
+#include "Support/opaque_test_support.h"
+
+using namespace ecliptix::security::opaque;
+using namespace ecliptix::security::opaque::responder;
+
+namespace {
+
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
+AdmissionResult admit(AdmissionController& controller, const secure_bytes& identifier, const secure_bytes& source,
+                      steady_clock::time_point now) {
+  return controller.admit(identifier.data(), identifier.size(), source.data(), source.size(), now);
+}
+
+}  // namespace
+
+@interface AdmissionControlTests : XCTestCase
+@end
+
+@implementation AdmissionControlTests
+
+- (void)setUp {
+  [super setUp];
+  XCTAssertTrue(crypto::init());
+}
+
+- (void)testBurstIsAdmittedThenDeferredUntilRefill {
+  AdmissionConfig config;
+  config.identity_rate_per_second = 1;
+  config.identity_burst = 2;
+  AdmissionController controller(config);
+  const secure_bytes identifier = test_support::bytes("alice");
+  const secure_bytes source = test_support::bytes("10.0.0.1");
+  const auto now = steady_clock::now();
+
+  XCTAssertTrue(admit(controller, identifier, source, now).decision == AdmissionDecision::Accept);
+  XCTAssertTrue(admit(controller, identifier, source, now).decision == AdmissionDecision::Accept);
+
+  const AdmissionResult denied = admit(controller, identifier, source, now);
+  XCTAssertTrue(denied.decision == AdmissionDecision::Defer);
+  XCTAssertEqual(denied.retry_after.count(), 1000);
+
+  XCTAssertTrue(admit(controller, identifier, source, now + milliseconds(1000)).decision ==
+                AdmissionDecision::Accept);
+  XCTAssertTrue(admit(controller, test_support::bytes("bob"), source, now).decision == AdmissionDecision::Accept);
+}
+
+- (void)testExhaustedBucketWithoutRefillIsRejected {
+  AdmissionConfig config;
+  config.identity_rate_per_second = 0;
+  config.identity_burst = 1;
+  AdmissionController controller(config);
+  const secure_bytes identifier = test_support::bytes("alice");
+  const auto now = steady_clock::now();
+
+  XCTAssertTrue(admit(controller, identifier, secure_bytes(), now).decision == AdmissionDecision::Accept);
+  XCTAssertTrue(admit(controller, identifier, secure_bytes(), now).decision == AdmissionDecision::Reject);
+
+  const AdmissionStats stats = controller.get_stats();
+  XCTAssertEqual(stats.accepted, 1u);
+  XCTAssertEqual(stats.rejected, 1u);
+}
+
+- (void)testSourceDenialRefundsIdentityToken {
+  AdmissionConfig config;
+  config.identity_rate_per_second = 0;
+  config.identity_burst = 1;
+  config.source_rate_per_second = 0;
+  config.source_burst = 1;
+  AdmissionController controller(config);
+  const secure_bytes busy_source = test_support::bytes("10.0.0.1");
+  const auto now = steady_clock::now();
+
+  XCTAssertTrue(admit(controller, test_support::bytes("alice"), busy_source, now).decision ==
+                AdmissionDecision::Accept);
+  XCTAssertTrue(admit(controller, test_support::bytes("bob"), busy_source, now).decision ==
+                AdmissionDecision::Reject);
+  XCTAssertTrue(admit(controller, test_support::bytes("bob"), test_support::bytes("10.0.0.2"), now).decision ==
+                AdmissionDecision::Accept);
+}
+
+- (void)testColdKeysSharingARowWithHotKeysAreAdmitted {
+  constexpr int HOT_KEYS = 32;
+  constexpr int COLD_KEYS = 64;
+  AdmissionConfig config;
+  config.identity_rate_per_second = 0;
+  config.identity_burst = 4;
+  config.width = 64;
+  config.depth = 4;
+  AdmissionController controller(config);
+  const auto now = steady_clock::now();
+
+  for (int hot = 0; hot < HOT_KEYS; ++hot) {
+    const secure_bytes identifier = test_support::bytes("hot-" + std::to_string(hot));
+    while (admit(controller, identifier, secure_bytes(), now).decision == AdmissionDecision::Accept) {
+    }
+  }
+
+  // Each row has a hot key in ~40% of its cells, so most cold keys collide
+  // somewhere; only one landing on hot cells in all four rows is denied.
+  // Debiting on the busiest row would admit about 9 of them.
+  int admitted = 0;
+  for (int cold = 0; cold < COLD_KEYS; ++cold) {
+    const secure_bytes identifier = test_support::bytes("cold-" + std::to_string(cold));
+    if (admit(controller, identifier, secure_bytes(), now).decision == AdmissionDecision::Accept) {
+      ++admitted;
+    }
+  }
+  XCTAssertGreaterThanOrEqual(admitted, 48);
+}
+
+- (void)testConcurrentBurstNeverOverdrawsBucket {
+  constexpr int THREADS = 8;
+  constexpr int ATTEMPTS = 200;
+  AdmissionConfig config;
+  config.identity_rate_per_second = 0;
+  config.identity_burst = 5;
+  config.source_rate_per_second = 0;
+  config.source_burst = 40;
+  // Separate controllers, so per-identity cells only ever see one key.
+  AdmissionController identity_controller(config);
+  AdmissionController source_controller(config);
+  const secure_bytes shared_identifier = test_support::bytes("alice");
+  const secure_bytes shared_source = test_support::bytes("10.0.0.1");
+  const auto now = steady_clock::now();
+
+  std::atomic<int> same_identity{0};
+  std::atomic<int> same_source{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < THREADS; ++t) {
+    threads.emplace_back([&, t] {
+      for (int attempt = 0; attempt < ATTEMPTS; ++attempt) {
+        if (admit(identity_controller, shared_identifier, secure_bytes(), now).decision ==
+            AdmissionDecision::Accept) {
+          same_identity.fetch_add(1);
+        }
+        const secure_bytes identifier = test_support::bytes("user-" + std::to_string(t * ATTEMPTS + attempt));
+        if (admit(source_controller, identifier, shared_source, now).decision == AdmissionDecision::Accept) {
+          same_source.fetch_add(1);
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  XCTAssertEqual(same_identity.load(), 5);
+  XCTAssertEqual(same_source.load(), 40);
+  XCTAssertEqual(identity_controller.get_stats().accepted, 5u);
+  XCTAssertEqual(source_controller.get_stats().accepted, 40u);
+}
+
+@end
@@ -0,0 +1,116 @@
+#import <XCTest/XCTest.h>
+
+#include <sodium.h>
+
+#include <stdexcept>
+
+#include "opaque/fake_credentials.h"
+#include "Support/opaque_test_support.h"
+
+using namespace ecliptix::security::opaque;
+using namespace ecliptix::security::opaque::responder;
+
+@interface FakeCredentialTests : XCTestCase
+@end
+
+@implementation FakeCredentialTests
+
+- (void)setUp {
+  [super setUp];
+  XCTAssertTrue(crypto::init());
+}
+
+- (void)testRecordHasRealRecordShape {
+  const secure_bytes seed = test_support::random_bytes(FAKE_RECORD_SEED_LENGTH);
+  const secure_bytes identifier = test_support::bytes("unknown@example.com");
+  FakeCredentialGenerator generator(seed.data(), seed.size());
+
+  ResponderCredentials credentials;
+  XCTAssertTrue(generator.generate(identifier.data(), identifier.size(), credentials) == Result::Success);
+  XCTAssertEqual(credentials.envelope.size(), ENVELOPE_LENGTH);
+  XCTAssertEqual(credentials.masking_key.size(), MASKING_KEY_LENGTH);
+  XCTAssertEqual(credentials.initiator_public_key.size(), PUBLIC_KEY_LENGTH);
+  XCTAssertEqual(crypto_core_ristretto255_is_valid_point(credentials.initiator_public_key.data()), 1);
+}
+
+- (void)testRecordIsStablePerIdentifierAndSeed {
+  const secure_bytes seed = test_support::random_bytes(FAKE_RECORD_SEED_LENGTH);
+  const secure_bytes identifier = test_support::bytes("unknown@example.com");
+  FakeCredentialGenerator generator(seed.data(), seed.size());
+  FakeCredentialGenerator restarted(seed.data(), seed.size());
+  FakeCredentialGenerator other_seed(test_support::random_bytes(FAKE_RECORD_SEED_LENGTH).data(),
+                                     FAKE_RECORD_SEED_LENGTH);
+
+  ResponderCredentials first;
+  ResponderCredentials again;
+  ResponderCredentials after_restart;
+  ResponderCredentials other_identifier;
+  ResponderCredentials under_other_seed;
+  XCTAssertTrue(generator.generate(identifier.data(), identifier.size(), first) == Result::Success);
+  generator.clear();
+  XCTAssertTrue(generator.generate(identifier.data(), identifier.size(), again) == Result::Success);
+  XCTAssertTrue(restarted.generate(identifier.data(), identifier.size(), after_restart) == Result::Success);
+  const secure_bytes other = test_support::bytes("someone-else@example.com");
+  XCTAssertTrue(generator.generate(other.data(), other.size(), other_identifier) == Result::Success);
+  XCTAssertTrue(other_seed.generate(identifier.data(), identifier.size(), under_other_seed) == Result::Success);
+
+  XCTAssertTrue(again.envelope == first.envelope);
+  XCTAssertTrue(again.masking_key == first.masking_key);
+  XCTAssertTrue(again.initiator_public_key == first.initiator_public_key);
+  XCTAssertTrue(after_restart.envelope == first.envelope);
+  XCTAssertTrue(other_identifier.envelope != first.envelope);
+  XCTAssertTrue(other_identifier.initiator_public_key != first.initiator_public_key);
+  XCTAssertTrue(under_other_seed.envelope != first.envelope);
+}
+
+- (void)testRepeatedProbesAreServedFromCache {
+  const secure_bytes seed = test_support::random_bytes(FAKE_RECORD_SEED_LENGTH);
+  const secure_bytes identifier = test_support::bytes("unknown@example.com");
+  FakeCredentialGenerator generator(seed.data(), seed.size());
+
+  ResponderCredentials credentials;
+  for (int probe = 0; probe < 3; ++probe) {
+    XCTAssertTrue(generator.generate(identifier.data(), identifier.size(), credentials) == Result::Success);
+  }
+
+  const FakeCredentialStats stats = generator.get_stats();
+  XCTAssertEqual(stats.generated, 1u);
+  XCTAssertEqual(stats.cache_hits, 2u);
+  XCTAssertEqual(stats.size, 1u);
+}
+
+- (void)testFakeRecordDrivesKe2 {
+  const secure_bytes seed = test_support::random_bytes(FAKE_RECORD_SEED_LENGTH);
+  const secure_bytes identifier = test_support::bytes("unknown@example.com");
+  FakeCredentialGenerator generator(seed.data(), seed.size());
+  ResponderKeyPair keypair;
+  XCTAssertTrue(ResponderKeyPair::generate(keypair) == Result::Success);
+  OpaqueResponder responder(keypair);
+
+  ResponderCredentials credentials;
+  XCTAssertTrue(generator.generate(identifier.data(), identifier.size(), credentials) == Result::Success);
+  const secure_bytes ke1 = test_support::random_bytes(KE1_LENGTH);
+  KE2 ke2;
+  ResponderState state;
+  XCTAssertTrue(responder.generate_ke2(ke1.data(), ke1.size(), credentials, ke2, state) == Result::Success);
+  XCTAssertEqual(ke2.credential_response.size(), CREDENTIAL_RESPONSE_LENGTH);
+}
+
+- (void)testRejectsMalformedInput {
+  const secure_bytes seed = test_support::random_bytes(FAKE_RECORD_SEED_LENGTH);
+  FakeCredentialGenerator generator(seed.data(), seed.size());
+  ResponderCredentials credentials;
+
+  XCTAssertTrue(generator.generate(seed.data(), 0, credentials) == Result::InvalidInput);
+  XCTAssertTrue(generator.generate(nullptr, 4, credentials) == Result::InvalidInput);
+
+  bool rejected = false;
+  try {
+    FakeCredentialGenerator short_seed(seed.data(), seed.size() - 1);
+  } catch (const std::invalid_argument&) {
+    rejected = true;
+  }
+  XCTAssertTrue(rejected);
+}
+
+@end
@@ -0,0 +1,118 @@
+#import <XCTest/XCTest.h>
+
+#include <sodium.h>
+
+#include <array>
+
+#include "opaque/oprf_keys.h"
+#include "Support/opaque_test_support.h"
+
+using namespace ecliptix::security::opaque;
+using namespace ecliptix::security::opaque::responder;
+
+namespace {
+
+using Scalar = std::array<uint8_t, PRIVATE_KEY_LENGTH>;
+
+Scalar derive(const secure_bytes& seed, const secure_bytes& identifier) {
+  Scalar scalar{};
+  if (oblivious_prf::derive_key(seed.data(), seed.size(), identifier.data(), identifier.size(), scalar.data()) !=
+      Result::Success) {
+    scalar.fill(0);
+  }
+  return scalar;
+}
+
+}  // namespace
+
+@interface OprfKeyTests : XCTestCase
+@end
+
+@implementation OprfKeyTests
+
+- (void)setUp {
+  [super setUp];
+  XCTAssertTrue(crypto::init());
+}
+
+- (void)testDerivedKeyIsDeterministicPerIdentifier {
+  const secure_bytes seed = test_support::random_bytes(OPRF_SEED_LENGTH);
+  const Scalar alice = derive(seed, test_support::bytes("alice"));
+
+  XCTAssertFalse(sodium_is_zero(alice.data(), alice.size()));
+  XCTAssertTrue(alice == derive(seed, test_support::bytes("alice")));
+  XCTAssertTrue(alice != derive(seed, test_support::bytes("bob")));
+  XCTAssertTrue(alice != derive(test_support::random_bytes(OPRF_SEED_LENGTH), test_support::bytes("alice")));
+}
+
+- (void)testDeriveKeyRejectsMalformedInput {
+  const secure_bytes seed = test_support::random_bytes(OPRF_SEED_LENGTH);
+  const secure_bytes identifier = test_support::bytes("alice");
+  Scalar scalar{};
+
+  XCTAssertTrue(oblivious_prf::derive_key(seed.data(), seed.size() - 1, identifier.data(), identifier.size(),
+                                          scalar.data()) == Result::InvalidInput);
+  XCTAssertTrue(oblivious_prf::derive_key(seed.data(), seed.size(), identifier.data(), 0, scalar.data()) ==
+                Result::InvalidInput);
+}
+
+- (void)testDeriverCachesAndMatchesDirectDerivation {
+  const secure_bytes seed = test_support::random_bytes(OPRF_SEED_LENGTH);
+  const secure_bytes identifier = test_support::bytes("alice");
+  OprfKeyDeriver deriver(seed.data(), seed.size());
+
+  Scalar first{};
+  Scalar second{};
+  XCTAssertTrue(deriver.derive_key(identifier.data(), identifier.size(), first.data()) == Result::Success);
+  XCTAssertTrue(deriver.derive_key(identifier.data(), identifier.size(), second.data()) == Result::Success);
+  XCTAssertTrue(first == derive(seed, identifier));
+  XCTAssertTrue(second == first);
+
+  OprfKeyCacheStats stats = deriver.get_stats();
+  XCTAssertEqual(stats.misses, 1u);
+  XCTAssertEqual(stats.hits, 1u);
+  XCTAssertEqual(stats.size, 1u);
+
+  deriver.clear();
+  XCTAssertEqual(deriver.get_stats().size, 0u);
+}
+
+- (void)testDeriverEvictsLeastRecentlyUsed {
+  const secure_bytes seed = test_support::random_bytes(OPRF_SEED_LENGTH);
+  OprfKeyCacheConfig config;
+  config.capacity = 2;
+  config.shard_count = 1;
+  OprfKeyDeriver deriver(seed.data(), seed.size(), config);
+
+  XCTAssertTrue(deriver.precompute({test_support::bytes("alice"), test_support::bytes("bob"),
+                                    test_support::bytes("carol")}) == Result::Success);
+  OprfKeyCacheStats stats = deriver.get_stats();
+  XCTAssertEqual(stats.evictions, 1u);
+  XCTAssertEqual(stats.size, 2u);
+
+  const secure_bytes alice = test_support::bytes("alice");
+  Scalar scalar{};
+  XCTAssertTrue(deriver.derive_key(alice.data(), alice.size(), scalar.data()) == Result::Success);
+  XCTAssertTrue(scalar == derive(seed, alice));
+  XCTAssertEqual(deriver.get_stats().misses, 4u);
+}
+
+- (void)testEvaluateUsesPerCredentialKey {
+  const secure_bytes seed = test_support::random_bytes(OPRF_SEED_LENGTH);
+  const secure_bytes identifier = test_support::bytes("alice");
+  OprfKeyDeriver deriver(seed.data(), seed.size());
+
+  std::array<uint8_t, PUBLIC_KEY_LENGTH> blinded{};
+  crypto_core_ristretto255_random(blinded.data());
+
+  std::array<uint8_t, PUBLIC_KEY_LENGTH> evaluated{};
+  XCTAssertTrue(deriver.evaluate(identifier.data(), identifier.size(), blinded.data(), evaluated.data()) ==
+                Result::Success);
+
+  const Scalar scalar = derive(seed, identifier);
+  std::array<uint8_t, PUBLIC_KEY_LENGTH> expected{};
+  XCTAssertEqual(crypto_scalarmult_ristretto255(expected.data(), scalar.data(), blinded.data()), 0);
+  XCTAssertTrue(evaluated == expected);
+}
+
+@end
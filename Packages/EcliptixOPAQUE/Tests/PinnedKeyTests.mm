@@ -0,0 +1,107 @@
+#import <XCTest/XCTest.h>
+
+#include <sodium.h>
+
+#include <array>
+
+#include "opaque/hardcoded_keys.h"
+#include "opaque/pinned_key.h"
+#include "Support/opaque_test_support.h"
+
+using namespace ecliptix::security::opaque;
+
+namespace {
+
+using Bytes32 = std::array<uint8_t, 32>;
+
+constexpr Bytes32 GROUP_ORDER = {0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7,
+                                 0xa2, 0xde, 0xf9, 0xde, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10};
+
+Bytes32 pinned_key() {
+  Bytes32 key{};
+  std::copy(std::begin(keys::SERVER_PUBLIC_KEY), std::end(keys::SERVER_PUBLIC_KEY), key.begin());
+  return key;
+}
+
+// Returns the number of scalars where the table and libsodium disagree.
+int mismatches_against_libsodium(int rounds) {
+  const Bytes32 key = pinned_key();
+  int mismatches = 0;
+  for (int round = 0; round < rounds; ++round) {
+    Bytes32 scalar{};
+    randombytes_buf(scalar.data(), scalar.size());
+    if (round % 2 == 1) {
+      scalar[31] |= 0x80;
+    }
+    Bytes32 expected{};
+    Bytes32 actual{};
+    const bool expected_ok = crypto_scalarmult_ristretto255(expected.data(), scalar.data(), key.data()) == 0;
+    const bool actual_ok = crypto::scalar_mult_pinned(scalar.data(), actual.data()) == Result::Success;
+    if (expected_ok != actual_ok || (expected_ok && expected != actual)) {
+      ++mismatches;
+    }
+  }
+  return mismatches;
+}
+
+}  // namespace
+
+@interface PinnedKeyTests : XCTestCase
+@end
+
+@implementation PinnedKeyTests
+
+- (void)setUp {
+  [super setUp];
+  XCTAssertTrue(crypto::init());
+}
+
+- (void)testPinnedKeyIsValidPoint {
+  XCTAssertEqual(crypto_core_ristretto255_is_valid_point(pinned_key().data()), 1);
+}
+
+- (void)testTableMatchesLibsodiumForRandomScalars {
+  XCTAssertEqual(mismatches_against_libsodium(512), 0);
+}
+
+- (void)testSmallScalarsMatchRepeatedAddition {
+  const Bytes32 key = pinned_key();
+  Bytes32 sum = key;
+  for (uint8_t k = 1; k <= 16; ++k) {
+    Bytes32 scalar{};
+    scalar[0] = k;
+    Bytes32 product{};
+    XCTAssertTrue(crypto::scalar_mult_pinned(scalar.data(), product.data()) == Result::Success);
+    XCTAssertTrue(product == sum);
+    XCTAssertEqual(crypto_core_ristretto255_add(sum.data(), sum.data(), key.data()), 0);
+  }
+}
+
+- (void)testIdentityResultIsCryptoError {
+  const Bytes32 zero{};
+  Bytes32 product{};
+  XCTAssertTrue(crypto::scalar_mult_pinned(zero.data(), product.data()) == Result::CryptoError);
+  XCTAssertTrue(crypto::scalar_mult_pinned(GROUP_ORDER.data(), product.data()) == Result::CryptoError);
+  XCTAssertTrue(crypto::scalar_mult_pinned(nullptr, product.data()) != Result::Success);
+}
+
+- (void)testPreferPinnedRoutesByPoint {
+  Bytes32 scalar{};
+  crypto_core_ristretto255_scalar_random(scalar.data());
+
+  const Bytes32 key = pinned_key();
+  Bytes32 routed{};
+  Bytes32 expected{};
+  XCTAssertTrue(crypto::scalar_mult_prefer_pinned(scalar.data(), key.data(), routed.data()) == Result::Success);
+  XCTAssertEqual(crypto_scalarmult_ristretto255(expected.data(), scalar.data(), key.data()), 0);
+  XCTAssertTrue(routed == expected);
+
+  Bytes32 other{};
+  crypto_core_ristretto255_random(other.data());
+  XCTAssertTrue(crypto::scalar_mult_prefer_pinned(scalar.data(), other.data(), routed.data()) == Result::Success);
+  XCTAssertEqual(crypto_scalarmult_ristretto255(expected.data(), scalar.data(), other.data()), 0);
+  XCTAssertTrue(routed == expected);
+}
+
+@end
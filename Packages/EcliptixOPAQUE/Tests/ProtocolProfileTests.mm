@@ -0,0 +1,131 @@
+#import <XCTest/XCTest.h>
+
+#include <vector>
+
+#include "opaque/protocol_profile.h"
+#include "Support/opaque_test_support.h"
+
+using namespace ecliptix::security::opaque;
+using namespace ecliptix::security::opaque::profile;
+
+namespace {
+
+template <typename Profile>
+responder::KE2 make_ke2() {
+  responder::KE2 ke2;
+  ke2.responder_nonce = test_support::random_bytes(NONCE_LENGTH);
+  ke2.responder_public_key = test_support::random_bytes(PUBLIC_KEY_LENGTH);
+  ke2.credential_response = test_support::random_bytes(WireLayout<Profile>::CREDENTIAL_RESPONSE_LENGTH);
+  ke2.responder_mac = test_support::random_bytes(Profile::Mac::LENGTH);
+  return ke2;
+}
+
+struct RoundTrip {
+  responder::KE2 sent;
+  responder::KE2 received;
+  ProtocolVersion version = ProtocolVersion::Legacy;
+  size_t written = 0;
+  Result result = Result::InvalidInput;
+};
+
+template <typename Profile>
+RoundTrip round_trip() {
+  ResponderCredentials credentials;
+  credentials.envelope = test_support::random_bytes(WireLayout<Profile>::ENVELOPE_LENGTH);
+  RoundTrip trip;
+  trip.sent = make_ke2<Profile>();
+
+  std::vector<uint8_t> wire(KE2_LENGTH);
+  trip.result = serialize_ke2_for_credentials(credentials, trip.sent, wire.data(), wire.size(), trip.written);
+  if (trip.result == Result::Success) {
+    trip.result = parse_ke2_any(wire.data(), trip.written, trip.received, trip.version);
+  }
+  return trip;
+}
+
+bool same_ke2(const responder::KE2& a, const responder::KE2& b) {
+  return a.responder_nonce == b.responder_nonce && a.responder_public_key == b.responder_public_key &&
+         a.credential_response == b.credential_response && a.responder_mac == b.responder_mac;
+}
+
+}  // namespace
+
+@interface ProtocolProfileTests : XCTestCase
+@end
+
+@implementation ProtocolProfileTests
+
+- (void)setUp {
+  [super setUp];
+  XCTAssertTrue(crypto::init());
+}
+
+- (void)testLegacyKe2RoundTrips {
+  const RoundTrip trip = round_trip<LegacyProfile>();
+  XCTAssertTrue(trip.result == Result::Success);
+  XCTAssertEqual(trip.written, WireLayout<LegacyProfile>::KE2_LENGTH);
+  XCTAssertTrue(trip.version == ProtocolVersion::Legacy);
+  XCTAssertTrue(same_ke2(trip.sent, trip.received));
+}
+
+- (void)testCurrentKe2RoundTrips {
+  const RoundTrip trip = round_trip<CurrentProfile>();
+  XCTAssertTrue(trip.result == Result::Success);
+  XCTAssertEqual(trip.written, KE2_LENGTH);
+  XCTAssertTrue(trip.version == ProtocolVersion::Current);
+  XCTAssertTrue(same_ke2(trip.sent, trip.received));
+}
+
+- (void)testVersionIsResolvedFromLength {
+  XCTAssertTrue(version_for_ke2_length(KE2_LENGTH) == ProtocolVersion::Current);
+  XCTAssertTrue(version_for_ke2_length(WireLayout<LegacyProfile>::KE2_LENGTH) == ProtocolVersion::Legacy);
+  XCTAssertFalse(version_for_ke2_length(KE2_LENGTH - 1).has_value());
+  XCTAssertTrue(version_for_envelope_length(ENVELOPE_LENGTH) == ProtocolVersion::Current);
+  XCTAssertTrue(version_for_envelope_length(WireLayout<LegacyProfile>::ENVELOPE_LENGTH) ==
+                ProtocolVersion::Legacy);
+  XCTAssertFalse(version_for_envelope_length(0).has_value());
+}
+
+- (void)testMismatchedFieldsAndBuffersAreRejected {
+  ResponderCredentials legacy_credentials;
+  legacy_credentials.envelope = test_support::random_bytes(WireLayout<LegacyProfile>::ENVELOPE_LENGTH);
+  std::vector<uint8_t> wire(KE2_LENGTH);
+  size_t written = 0;
+
+  const responder::KE2 current_ke2 = make_ke2<CurrentProfile>();
+  XCTAssertTrue(serialize_ke2_for_credentials(legacy_credentials, current_ke2, wire.data(), wire.size(),
+                                              written) == Result::InvalidInput);
+  XCTAssertEqual(written, 0u);
+
+  const responder::KE2 legacy_ke2 = make_ke2<LegacyProfile>();
+  XCTAssertTrue(serialize_ke2_for_credentials(legacy_credentials, legacy_ke2, wire.data(),
+                                              WireLayout<LegacyProfile>::KE2_LENGTH - 1, written) ==
+                Result::InvalidInput);
+
+  ResponderCredentials unknown_credentials;
+  unknown_credentials.envelope = test_support::random_bytes(ENVELOPE_LENGTH + 1);
+  XCTAssertTrue(serialize_ke2_for_credentials(unknown_credentials, current_ke2, wire.data(), wire.size(),
+                                              written) == Result::InvalidInput);
+
+  responder::KE2 parsed;
+  ProtocolVersion version = ProtocolVersion::Legacy;
+  XCTAssertTrue(parse_ke2_any(wire.data(), KE2_LENGTH - 1, parsed, version) == Result::InvalidInput);
+}
+
+- (void)testEnvelopeSplitsAndJoinsPerGeneration {
+  const secure_bytes legacy = test_support::random_bytes(WireLayout<LegacyProfile>::ENVELOPE_LENGTH);
+  Envelope envelope;
+  XCTAssertTrue(WireCodec<LegacyProfile>::split_envelope(legacy.data(), envelope) == Result::Success);
+  XCTAssertEqual(envelope.nonce.size(), LegacyProfile::ENVELOPE_NONCE_LENGTH);
+  XCTAssertEqual(envelope.ciphertext.size(), LegacyProfile::ENVELOPE_PLAINTEXT_LENGTH);
+  XCTAssertEqual(envelope.auth_tag.size(), LegacyProfile::ENVELOPE_AUTH_TAG_LENGTH);
+
+  secure_bytes joined(legacy.size());
+  XCTAssertTrue(WireCodec<LegacyProfile>::join_envelope(envelope, joined.data()) == Result::Success);
+  XCTAssertTrue(joined == legacy);
+
+  secure_bytes current(WireLayout<CurrentProfile>::ENVELOPE_LENGTH);
+  XCTAssertTrue(WireCodec<CurrentProfile>::join_envelope(envelope, current.data()) == Result::InvalidInput);
+}
+
+@end
@@ -0,0 +1,99 @@
+#import <XCTest/XCTest.h>
+
+#include "opaque/replay_filter.h"
+#include "Support/opaque_test_support.h"
+
+using namespace ecliptix::security::opaque;
+using namespace ecliptix::security::opaque::responder;
+
+namespace {
+
+using std::chrono::seconds;
+using std::chrono::steady_clock;
+
+Result check(ReplayFilter& filter, const secure_bytes& ke1, steady_clock::time_point now) {
+  return filter.check_and_record(ke1.data(), ke1.size(), now);
+}
+
+}  // namespace
+
+@interface ReplayFilterTests : XCTestCase
+@end
+
+@implementation ReplayFilterTests
+
+- (void)setUp {
+  [super setUp];
+  XCTAssertTrue(crypto::init());
+}
+
+- (void)testReplayIsKeyedByNonceAndPublicKey {
+  ReplayFilter filter;
+  const auto now = steady_clock::now();
+  const secure_bytes ke1 = test_support::random_bytes(KE1_LENGTH);
+
+  XCTAssertTrue(check(filter, ke1, now) == Result::Success);
+  XCTAssertTrue(check(filter, ke1, now) == Result::ValidationError);
+
+  secure_bytes new_request = ke1;
+  new_request[KE1_REPLAY_KEY_LENGTH] ^= 0x01;
+  XCTAssertTrue(check(filter, new_request, now) == Result::ValidationError);
+
+  secure_bytes new_key = ke1;
+  new_key[KE1_PUBLIC_KEY_OFFSET] ^= 0x01;
+  XCTAssertTrue(check(filter, new_key, now) == Result::Success);
+
+  const ReplayFilterStats stats = filter.get_stats();
+  XCTAssertEqual(stats.checked, 4u);
+  XCTAssertEqual(stats.replays, 2u);
+}
+
+- (void)testNonceIsRememberedForOneToTwoWindows {
+  ReplayFilterConfig config;
+  config.window = seconds(60);
+  ReplayFilter filter(config);
+  const auto start = steady_clock::now();
+  const secure_bytes ke1 = test_support::random_bytes(KE1_LENGTH);
+
+  XCTAssertTrue(check(filter, ke1, start) == Result::Success);
+  XCTAssertTrue(check(filter, ke1, start + seconds(61)) == Result::ValidationError);
+  XCTAssertTrue(check(filter, ke1, start + seconds(200)) == Result::Success);
+  XCTAssertEqual(filter.get_stats().rotations, 2u);
+
+  filter.clear();
+  XCTAssertTrue(check(filter, ke1, steady_clock::now()) == Result::Success);
+}
+
+- (void)testFalsePositiveRateStaysNearTarget {
+  ReplayFilterConfig config;
+  config.expected_messages_per_window = 10000;
+  config.false_positive_rate = 1e-3;
+  ReplayFilter filter(config);
+  const auto now = steady_clock::now();
+
+  for (int i = 0; i < 10000; ++i) {
+    XCTAssertTrue(check(filter, test_support::random_bytes(KE1_LENGTH), now) != Result::InvalidInput);
+  }
+  const uint64_t replays_while_filling = filter.get_stats().replays;
+
+  // Probing also records, so keep the probe small next to the load.
+  int false_positives = 0;
+  for (int i = 0; i < 1000; ++i) {
+    if (check(filter, test_support::random_bytes(KE1_LENGTH), now) == Result::ValidationError) {
+      ++false_positives;
+    }
+  }
+  XCTAssertLessThanOrEqual(replays_while_filling, 10u);
+  XCTAssertLessThanOrEqual(false_positives, 10);
+}
+
+- (void)testMalformedKe1IsRejected {
+  ReplayFilter filter;
+  const secure_bytes short_ke1 = test_support::random_bytes(KE1_LENGTH - 1);
+
+  XCTAssertTrue(filter.check_and_record(short_ke1.data(), short_ke1.size()) == Result::InvalidInput);
+  XCTAssertTrue(filter.check_and_record(nullptr, KE1_LENGTH) == Result::InvalidInput);
+  XCTAssertEqual(filter.get_stats().checked, 0u);
+}
+
+@end
@@ -0,0 +1,178 @@
+#import <XCTest/XCTest.h>
+
+#include <sodium.h>
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+#include "opaque/responder_async.h"
+#include "Support/opaque_test_support.h"
+
+using namespace ecliptix::security::opaque;
+using namespace ecliptix::security::opaque::responder;
+
+namespace {
+
+class FailingFetcher final : public CredentialFetcher {
+ public:
+  void fetch(const secure_bytes&, CredentialCallback done) override {
+    done(CredentialLookup::Failed, ResponderCredentials());
+  }
+};
+
+class ThrowingExecutor final : public Executor {
+ public:
+  void post(std::function<void()>) override { throw std::runtime_error("executor stopped"); }
+};
+
+secure_bytes make_ke1() {
+  secure_bytes ke1 = test_support::random_bytes(KE1_LENGTH);
+  crypto_core_ristretto255_random(ke1.data() + KE1_CREDENTIAL_REQUEST_OFFSET);
+  return ke1;
+}
+
+ResponderCredentials make_credentials() {
+  ResponderCredentials credentials;
+  credentials.envelope = test_support::random_bytes(ENVELOPE_LENGTH);
+  credentials.masking_key = test_support::random_bytes(HASH_LENGTH);
+  credentials.initiator_public_key = test_support::random_bytes(PUBLIC_KEY_LENGTH);
+  return credentials;
+}
+
+bool carries_credentials(const KE2& ke2, const ResponderCredentials& credentials) {
+  return ke2.credential_response.size() == CREDENTIAL_RESPONSE_LENGTH &&
+         std::equal(credentials.initiator_public_key.begin(), credentials.initiator_public_key.end(),
+                    ke2.credential_response.begin()) &&
+         std::equal(credentials.envelope.begin(), credentials.envelope.end(),
+                    ke2.credential_response.begin() + PUBLIC_KEY_LENGTH);
+}
+
+}  // namespace
+
+@interface ResponderAsyncTests : XCTestCase
+@end
+
+@implementation ResponderAsyncTests
+
+- (void)setUp {
+  [super setUp];
+  XCTAssertTrue(crypto::init());
+}
+
+- (void)testFoundCredentialsProduceAFinishableKe2 {
+  ThreadPoolExecutor executor(2);
+  InMemoryCredentialFetcher fetcher(executor);
+  ResponderKeyPair keypair;
+  XCTAssertTrue(ResponderKeyPair::generate(keypair) == Result::Success);
+  OpaqueResponder responder(keypair);
+  const secure_bytes identifier = test_support::bytes("alice");
+  const ResponderCredentials stored = make_credentials();
+  fetcher.store(identifier, stored);
+  const secure_bytes ke1 = make_ke1();
+
+  KE2 ke2;
+  ResponderState state;
+  XCTAssertTrue(sync_wait(generate_ke2_async(responder, executor, fetcher, identifier, ke1, ke2, state)) ==
+                Result::Success);
+
+  XCTAssertTrue(carries_credentials(ke2, stored));
+  XCTAssertTrue(ke2.responder_public_key == responder.get_public_key());
+  XCTAssertTrue(state.initiator_public_key == stored.initiator_public_key);
+
+  const secure_bytes ke3 = test_support::expected_ke3(keypair, ke1);
+  secure_bytes session_key;
+  XCTAssertTrue(OpaqueResponder::responder_finish(ke3.data(), ke3.size(), state, session_key) == Result::Success);
+  XCTAssertTrue(session_key == test_support::expected_session_key(keypair, ke1));
+}
+
+- (void)testUnknownIdentifierIsAnsweredWithFakeCredentials {
+  ThreadPoolExecutor executor(2);
+  InMemoryCredentialFetcher fetcher(executor);
+  ResponderKeyPair keypair;
+  XCTAssertTrue(ResponderKeyPair::generate(keypair) == Result::Success);
+  OpaqueResponder responder(keypair);
+  const secure_bytes identifier = test_support::bytes("mallory");
+  const secure_bytes seed = test_support::random_bytes(FAKE_RECORD_SEED_LENGTH);
+  FakeCredentialGenerator fake_credentials(seed.data(), seed.size());
+
+  KE2 ke2;
+  ResponderState state;
+  AsyncResponderOptions options;
+  options.fake_credentials = &fake_credentials;
+  XCTAssertTrue(sync_wait(generate_ke2_async(responder, executor, fetcher, identifier, make_ke1(), ke2, state,
+                                             options)) == Result::Success);
+
+  ResponderCredentials expected;
+  XCTAssertTrue(fake_credentials.generate(identifier.data(), identifier.size(), expected) == Result::Success);
+  XCTAssertTrue(carries_credentials(ke2, expected));
+}
+
+- (void)testUnknownIdentifierWithoutFakeCredentialsFails {
+  InlineExecutor executor;
+  InMemoryCredentialFetcher fetcher(executor);
+  ResponderKeyPair keypair;
+  XCTAssertTrue(ResponderKeyPair::generate(keypair) == Result::Success);
+  OpaqueResponder responder(keypair);
+
+  KE2 ke2;
+  ResponderState state;
+  XCTAssertTrue(sync_wait(generate_ke2_async(responder, executor, fetcher, test_support::bytes("mallory"),
+                                             make_ke1(), ke2, state)) == Result::AuthenticationError);
+  XCTAssertTrue(ke2.credential_response.empty());
+}
+
+- (void)testFailedLookupIsReported {
+  ThreadPoolExecutor executor(1);
+  FailingFetcher fetcher;
+  ResponderKeyPair keypair;
+  XCTAssertTrue(ResponderKeyPair::generate(keypair) == Result::Success);
+  OpaqueResponder responder(keypair);
+  const secure_bytes seed = test_support::random_bytes(FAKE_RECORD_SEED_LENGTH);
+  FakeCredentialGenerator fake_credentials(seed.data(), seed.size());
+
+  KE2 ke2;
+  ResponderState state;
+  AsyncResponderOptions options;
+  options.fake_credentials = &fake_credentials;
+  XCTAssertTrue(sync_wait(generate_ke2_async(responder, executor, fetcher, test_support::bytes("alice"), make_ke1(),
+                                             ke2, state, options)) == Result::ValidationError);
+  XCTAssertTrue(ke2.credential_response.empty());
+}
+
+- (void)testMalformedRequestIsRejectedBeforeFetch {
+  InlineExecutor executor;
+  FailingFetcher fetcher;
+  ResponderKeyPair keypair;
+  XCTAssertTrue(ResponderKeyPair::generate(keypair) == Result::Success);
+  OpaqueResponder responder(keypair);
+  KE2 ke2;
+  ResponderState state;
+
+  XCTAssertTrue(sync_wait(generate_ke2_async(responder, executor, fetcher, test_support::bytes("alice"),
+                                             test_support::random_bytes(KE1_LENGTH - 1), ke2, state)) ==
+                Result::InvalidInput);
+  XCTAssertTrue(sync_wait(generate_ke2_async(responder, executor, fetcher, secure_bytes(), make_ke1(), ke2,
+                                             state)) == Result::InvalidInput);
+}
+
+- (void)testSyncWaitRethrowsExecutorException {
+  ThrowingExecutor executor;
+  FailingFetcher fetcher;
+  ResponderKeyPair keypair;
+  XCTAssertTrue(ResponderKeyPair::generate(keypair) == Result::Success);
+  OpaqueResponder responder(keypair);
+
+  KE2 ke2;
+  ResponderState state;
+  bool rethrown = false;
+  try {
+    (void)sync_wait(generate_ke2_async(responder, executor, fetcher, test_support::bytes("alice"), make_ke1(), ke2,
+                                       state));
+  } catch (const std::runtime_error&) {
+    rethrown = true;
+  }
+  XCTAssertTrue(rethrown);
+}
+
+@end
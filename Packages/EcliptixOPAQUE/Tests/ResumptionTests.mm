@@ -0,0 +1,133 @@
+#import <XCTest/XCTest.h>
+
+#include "opaque/resumption.h"
+#include "Support/opaque_test_support.h"
+
+using namespace ecliptix::security::opaque;
+using namespace ecliptix::security::opaque::resumption;
+
+namespace {
+
+ResumptionTicket issue(TicketIssuer& issuer, const secure_bytes& credential_identifier) {
+  ResumptionTicket ticket;
+  if (derive_resumption_secret(test_support::random_bytes(HASH_LENGTH), ticket.resumption_secret) != Result::Success ||
+      issuer.issue_ticket(credential_identifier, ticket.resumption_secret, ticket.ticket) != Result::Success) {
+    ticket.ticket.clear();
+  }
+  return ticket;
+}
+
+}  // namespace
+
+@interface ResumptionTests : XCTestCase
+@end
+
+@implementation ResumptionTests
+
+- (void)setUp {
+  [super setUp];
+  XCTAssertTrue(crypto::init());
+}
+
+- (void)testResumeYieldsSessionKeyAndIdentifier {
+  TicketIssuer issuer;
+  const secure_bytes account = test_support::bytes("account-42");
+  ResumptionTicket ticket = issue(issuer, account);
+  XCTAssertEqual(ticket.ticket.size(), TICKET_LENGTH);
+
+  for (int round = 0; round < 2; ++round) {
+    ResumptionState state;
+    secure_bytes request;
+    XCTAssertTrue(create_resume_request(ticket, state, request) == Result::Success);
+
+    secure_bytes response;
+    secure_bytes responder_key;
+    secure_bytes identifier;
+    XCTAssertTrue(issuer.resume(request.data(), request.size(), response, responder_key, identifier) ==
+                  Result::Success);
+    XCTAssertTrue(identifier == account);
+
+    ResumptionTicket next;
+    secure_bytes initiator_key;
+    XCTAssertTrue(finish_resume(response.data(), response.size(), state, next, initiator_key) == Result::Success);
+    XCTAssertTrue(initiator_key == responder_key);
+    XCTAssertTrue(next.ticket != ticket.ticket);
+    ticket = next;
+  }
+}
+
+- (void)testTicketIsAcceptedOnce {
+  TicketIssuer issuer;
+  const ResumptionTicket ticket = issue(issuer, test_support::bytes("account-42"));
+
+  ResumptionState first_state;
+  secure_bytes first;
+  XCTAssertTrue(create_resume_request(ticket, first_state, first) == Result::Success);
+  secure_bytes response;
+  secure_bytes session_key;
+  secure_bytes identifier;
+  XCTAssertTrue(issuer.resume(first.data(), first.size(), response, session_key, identifier) == Result::Success);
+
+  XCTAssertTrue(issuer.resume(first.data(), first.size(), response, session_key, identifier) ==
+                Result::ValidationError);
+  XCTAssertTrue(response.empty());
+
+  ResumptionState second_state;
+  secure_bytes second;
+  XCTAssertTrue(create_resume_request(ticket, second_state, second) == Result::Success);
+  XCTAssertTrue(issuer.resume(second.data(), second.size(), response, session_key, identifier) ==
+                Result::ValidationError);
+
+  issuer.rotate();
+  XCTAssertTrue(issuer.resume(second.data(), second.size(), response, session_key, identifier) ==
+                Result::ValidationError);
+}
+
+- (void)testForgedBinderDoesNotConsumeTicket {
+  TicketIssuer issuer;
+  const ResumptionTicket ticket = issue(issuer, test_support::bytes("account-42"));
+
+  ResumptionState state;
+  secure_bytes request;
+  XCTAssertTrue(create_resume_request(ticket, state, request) == Result::Success);
+  secure_bytes forged = request;
+  forged.back() ^= 0x01;
+
+  secure_bytes response;
+  secure_bytes session_key;
+  secure_bytes identifier;
+  XCTAssertTrue(issuer.resume(forged.data(), forged.size(), response, session_key, identifier) ==
+                Result::AuthenticationError);
+  XCTAssertTrue(issuer.resume(request.data(), request.size(), response, session_key, identifier) ==
+                Result::Success);
+}
+
+- (void)testExpiredTicketIsRejected {
+  TicketKeyConfig config;
+  config.ticket_lifetime = std::chrono::seconds(-1);
+  TicketIssuer issuer(config);
+  const ResumptionTicket ticket = issue(issuer, test_support::bytes("account-42"));
+
+  ResumptionState state;
+  secure_bytes request;
+  XCTAssertTrue(create_resume_request(ticket, state, request) == Result::Success);
+  secure_bytes response;
+  secure_bytes session_key;
+  secure_bytes identifier;
+  XCTAssertTrue(issuer.resume(request.data(), request.size(), response, session_key, identifier) ==
+                Result::ValidationError);
+}
+
+- (void)testIssueRejectsIdentifierOutsideBounds {
+  TicketIssuer issuer;
+  const secure_bytes secret = test_support::random_bytes(RESUMPTION_SECRET_LENGTH);
+  secure_bytes ticket;
+
+  XCTAssertTrue(issuer.issue_ticket(secure_bytes(), secret, ticket) == Result::InvalidInput);
+  XCTAssertTrue(issuer.issue_ticket(secure_bytes(TICKET_MAX_IDENTIFIER_LENGTH + 1, 'a'), secret, ticket) ==
+                Result::InvalidInput);
+  XCTAssertTrue(issuer.issue_ticket(secure_bytes(TICKET_MAX_IDENTIFIER_LENGTH, 'a'), secret, ticket) ==
+                Result::Success);
+}
+
+@end
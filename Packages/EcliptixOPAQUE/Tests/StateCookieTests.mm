@@ -0,0 +1,175 @@
+#import <XCTest/XCTest.h>
+
+#include "opaque/responder_cookie.h"
+#include "Support/opaque_test_support.h"
+
+using namespace ecliptix::security::opaque;
+using namespace ecliptix::security::opaque::responder;
+
+namespace {
+
+ResponderState make_state() {
+  ResponderState state;
+  state.session_key = test_support::random_bytes(HASH_LENGTH);
+  state.expected_initiator_mac = test_support::random_bytes(MAC_LENGTH);
+  return state;
+}
+
+ResponderCredentials make_credentials() {
+  ResponderCredentials credentials;
+  credentials.initiator_public_key = test_support::random_bytes(PUBLIC_KEY_LENGTH);
+  credentials.envelope = test_support::random_bytes(ENVELOPE_LENGTH);
+  return credentials;
+}
+
+}  // namespace
+
+@interface StateCookieTests : XCTestCase
+@end
+
+@implementation StateCookieTests
+
+- (void)setUp {
+  [super setUp];
+  XCTAssertTrue(crypto::init());
+}
+
+- (void)testSealedCookieOpensWithSameContext {
+  StateCookieKeyRing key_ring;
+  const ResponderState state = make_state();
+  const secure_bytes context = test_support::bytes("device-1");
+
+  secure_bytes cookie;
+  XCTAssertTrue(key_ring.seal(state, context.data(), context.size(), cookie) == Result::Success);
+  XCTAssertEqual(cookie.size(), STATE_COOKIE_LENGTH);
+
+  ResponderState opened;
+  XCTAssertTrue(key_ring.open(cookie.data(), cookie.size(), context.data(), context.size(), opened) == Result::Success);
+  XCTAssertTrue(opened.session_key == state.session_key);
+  XCTAssertTrue(opened.expected_initiator_mac == state.expected_initiator_mac);
+}
+
+- (void)testTamperedCookieIsRejected {
+  StateCookieKeyRing key_ring;
+  secure_bytes cookie;
+  XCTAssertTrue(key_ring.seal(make_state(), nullptr, 0, cookie) == Result::Success);
+
+  cookie[STATE_COOKIE_HEADER_LENGTH] ^= 0x01;
+  ResponderState opened;
+  XCTAssertTrue(key_ring.open(cookie.data(), cookie.size(), nullptr, 0, opened) == Result::AuthenticationError);
+
+  XCTAssertTrue(key_ring.open(cookie.data(), cookie.size() - 1, nullptr, 0, opened) == Result::InvalidInput);
+}
+
+- (void)testCookieIsBoundToContext {
+  StateCookieKeyRing key_ring;
+  const secure_bytes context = test_support::bytes("device-1");
+  const secure_bytes other = test_support::bytes("device-2");
+
+  secure_bytes cookie;
+  XCTAssertTrue(key_ring.seal(make_state(), context.data(), context.size(), cookie) == Result::Success);
+
+  ResponderState opened;
+  XCTAssertTrue(key_ring.open(cookie.data(), cookie.size(), other.data(), other.size(), opened) ==
+                Result::AuthenticationError);
+  XCTAssertTrue(key_ring.open(cookie.data(), cookie.size(), nullptr, 0, opened) == Result::AuthenticationError);
+}
+
+- (void)testCookieSurvivesOneRotationOnly {
+  StateCookieKeyRing key_ring;
+  secure_bytes cookie;
+  XCTAssertTrue(key_ring.seal(make_state(), nullptr, 0, cookie) == Result::Success);
+
+  ResponderState opened;
+  key_ring.rotate();
+  XCTAssertTrue(key_ring.open(cookie.data(), cookie.size(), nullptr, 0, opened) == Result::Success);
+
+  key_ring.rotate();
+  XCTAssertTrue(key_ring.open(cookie.data(), cookie.size(), nullptr, 0, opened) == Result::ValidationError);
+}
+
+- (void)testExpiredCookieIsRejected {
+  StateCookieConfig config;
+  config.max_age = std::chrono::seconds(-1);
+  config.clock_skew = std::chrono::seconds(0);
+  StateCookieKeyRing key_ring(config);
+
+  secure_bytes cookie;
+  XCTAssertTrue(key_ring.seal(make_state(), nullptr, 0, cookie) == Result::Success);
+
+  ResponderState opened;
+  XCTAssertTrue(key_ring.open(cookie.data(), cookie.size(), nullptr, 0, opened) == Result::ValidationError);
+}
+
+- (void)testStatelessResponderFinishesFromCookie {
+  ResponderKeyPair keypair;
+  XCTAssertTrue(ResponderKeyPair::generate(keypair) == Result::Success);
+  StatelessResponder responder(keypair);
+  const secure_bytes ke1 = test_support::random_bytes(KE1_LENGTH);
+  const secure_bytes context = test_support::bytes("device-1");
+
+  KE2 ke2;
+  secure_bytes cookie;
+  XCTAssertTrue(responder.generate_ke2(ke1.data(), ke1.size(), make_credentials(), ke2, cookie,
+                                       context.data(), context.size()) == Result::Success);
+  XCTAssertTrue(ke2.responder_public_key == responder.get_public_key());
+
+  secure_bytes wrong_ke3 = test_support::expected_ke3(keypair, ke1);
+  wrong_ke3[0] ^= 0x01;
+  secure_bytes session_key;
+  XCTAssertTrue(responder.responder_finish(wrong_ke3.data(), wrong_ke3.size(), cookie.data(), cookie.size(),
+                                           session_key, context.data(), context.size()) ==
+                Result::AuthenticationError);
+
+  const secure_bytes ke3 = test_support::expected_ke3(keypair, ke1);
+  XCTAssertTrue(responder.responder_finish(ke3.data(), ke3.size(), cookie.data(), cookie.size(), session_key,
+                                           context.data(), context.size()) == Result::Success);
+  XCTAssertTrue(session_key == test_support::expected_session_key(keypair, ke1));
+}
+
+- (void)testReplayedCookieFinishesOnce {
+  ResponderKeyPair keypair;
+  XCTAssertTrue(ResponderKeyPair::generate(keypair) == Result::Success);
+  StatelessResponder responder(keypair);
+  const secure_bytes ke1 = test_support::random_bytes(KE1_LENGTH);
+
+  KE2 ke2;
+  secure_bytes cookie;
+  XCTAssertTrue(responder.generate_ke2(ke1.data(), ke1.size(), make_credentials(), ke2, cookie) == Result::Success);
+
+  const secure_bytes ke3 = test_support::expected_ke3(keypair, ke1);
+  secure_bytes session_key;
+  XCTAssertTrue(responder.responder_finish(ke3.data(), ke3.size(), cookie.data(), cookie.size(), session_key) ==
+                Result::Success);
+
+  secure_bytes replayed_key;
+  XCTAssertTrue(responder.responder_finish(ke3.data(), ke3.size(), cookie.data(), cookie.size(), replayed_key) ==
+                Result::ValidationError);
+  XCTAssertTrue(replayed_key.empty());
+
+  KE2 other_ke2;
+  secure_bytes other_cookie;
+  XCTAssertTrue(responder.generate_ke2(ke1.data(), ke1.size(), make_credentials(), other_ke2, other_cookie) ==
+                Result::Success);
+  XCTAssertTrue(responder.responder_finish(ke3.data(), ke3.size(), other_cookie.data(), other_cookie.size(),
+                                           session_key) == Result::Success);
+}
+
+- (void)testSpentCookiesAreForgottenAfterMaxAge {
+  StateCookieConfig config;
+  config.max_age = std::chrono::seconds(-1);
+  StateCookieKeyRing key_ring(config);
+
+  secure_bytes cookie;
+  XCTAssertTrue(key_ring.seal(make_state(), nullptr, 0, cookie) == Result::Success);
+  XCTAssertTrue(key_ring.redeem(cookie.data(), cookie.size()) == Result::Success);
+  XCTAssertTrue(key_ring.redeem(cookie.data(), cookie.size()) == Result::Success);
+
+  StateCookieKeyRing fresh_ring;
+  XCTAssertTrue(fresh_ring.seal(make_state(), nullptr, 0, cookie) == Result::Success);
+  XCTAssertTrue(fresh_ring.redeem(cookie.data(), cookie.size()) == Result::Success);
+  XCTAssertTrue(fresh_ring.redeem(cookie.data(), cookie.size()) == Result::ValidationError);
+  XCTAssertTrue(fresh_ring.redeem(cookie.data(), cookie.size() - 1) == Result::InvalidInput);
+}
+
+@end
@@ -0,0 +1,299 @@
+#include <sodium.h>
+
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "opaque_test_support.h"
+
+namespace ecliptix::security::opaque {
+
+namespace {
+
+constexpr std::string_view SESSION_LABEL = "StandInSessionKey";
+constexpr std::string_view KE3_LABEL = "StandInKE3";
+constexpr std::string_view KE2_LABEL = "StandInKE2";
+
+Result hmac_parts(const uint8_t* key, size_t key_length, std::initializer_list<std::pair<const uint8_t*, size_t>> parts,
+                  uint8_t* mac) {
+  crypto_auth_hmacsha512_state state;
+  if (crypto_auth_hmacsha512_init(&state, key, key_length) != 0) {
+    return Result::CryptoError;
+  }
+  for (const auto& [data, length] : parts) {
+    crypto_auth_hmacsha512_update(&state, data, length);
+  }
+  crypto_auth_hmacsha512_final(&state, mac);
+  sodium_memzero(&state, sizeof(state));
+  return Result::Success;
+}
+
+const uint8_t* label_data(std::string_view label) {
+  return reinterpret_cast<const uint8_t*>(label.data());
+}
+
+secure_bytes derive_session_key(const secure_bytes& private_key, const uint8_t* ke1, size_t ke1_length) {
+  secure_bytes session_key(HASH_LENGTH);
+  (void)hmac_parts(private_key.data(), private_key.size(),
+                   {{label_data(SESSION_LABEL), SESSION_LABEL.size()}, {ke1, ke1_length}}, session_key.data());
+  return session_key;
+}
+
+secure_bytes derive_ke3(const secure_bytes& session_key, const uint8_t* ke1, size_t ke1_length) {
+  secure_bytes ke3(KE3_LENGTH);
+  (void)hmac_parts(session_key.data(), session_key.size(),
+                   {{label_data(KE3_LABEL), KE3_LABEL.size()}, {ke1, ke1_length}}, ke3.data());
+  return ke3;
+}
+
+}  // namespace
+
+template<SecurelyAllocatable T>
+T* SecureAllocator<T>::allocate(size_t n) {
+  void* memory = sodium_malloc(std::max<size_t>(1, n) * sizeof(T));
+  if (memory == nullptr) {
+    throw std::bad_alloc();
+  }
+  return static_cast<T*>(memory);
+}
+
+template<SecurelyAllocatable T>
+void SecureAllocator<T>::deallocate(T* p, size_t) {
+  sodium_free(p);
+}
+
+template class SecureAllocator<uint8_t>;
+
+SecureBuffer::SecureBuffer(size_t size) : data_(static_cast<uint8_t*>(sodium_malloc(std::max<size_t>(1, size)))),
+                                          size_(size) {
+  if (data_ == nullptr) {
+    throw std::bad_alloc();
+  }
+  sodium_memzero(data_, size_);
+}
+
+SecureBuffer::~SecureBuffer() {
+  if (data_ != nullptr) {
+    sodium_free(data_);
+  }
+}
+
+SecureBuffer::SecureBuffer(SecureBuffer&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+
+SecureBuffer& SecureBuffer::operator=(SecureBuffer&& other) noexcept {
+  if (this != &other) {
+    if (data_ != nullptr) {
+      sodium_free(data_);
+    }
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+  }
+  return *this;
+}
+
+uint8_t* SecureBuffer::data() noexcept { return data_; }
+
+const uint8_t* SecureBuffer::data() const noexcept { return data_; }
+
+size_t SecureBuffer::size() const noexcept { return size_; }
+
+void SecureBuffer::make_readonly() { sodium_mprotect_readonly(data_); }
+
+void SecureBuffer::make_readwrite() { sodium_mprotect_readwrite(data_); }
+
+void SecureBuffer::make_noaccess() { sodium_mprotect_noaccess(data_); }
+
+Envelope::Envelope() = default;
+
+ResponderCredentials::ResponderCredentials() = default;
+
+namespace crypto {
+
+bool init() {
+  return sodium_init() >= 0;
+}
+
+Result random_bytes(uint8_t* buffer, size_t length) {
+  if (buffer == nullptr && length != 0) {
+    return Result::InvalidInput;
+  }
+  randombytes_buf(buffer, length);
+  return Result::Success;
+}
+
+Result derive_key_pair(const uint8_t* seed, uint8_t* private_key, uint8_t* public_key) {
+  if (seed == nullptr || private_key == nullptr || public_key == nullptr) {
+    return Result::InvalidInput;
+  }
+  std::array<uint8_t, crypto_core_ristretto255_NONREDUCEDSCALARBYTES> wide{};
+  crypto_generichash(wide.data(), wide.size(), seed, PRIVATE_KEY_LENGTH, nullptr, 0);
+  crypto_core_ristretto255_scalar_reduce(private_key, wide.data());
+  sodium_memzero(wide.data(), wide.size());
+  return crypto_scalarmult_ristretto255_base(public_key, private_key) == 0 ? Result::Success : Result::CryptoError;
+}
+
+Result scalar_mult(const uint8_t* scalar, const uint8_t* point, uint8_t* result) {
+  if (scalar == nullptr || point == nullptr || result == nullptr) {
+    return Result::InvalidInput;
+  }
+  return crypto_scalarmult_ristretto255(result, scalar, point) == 0 ? Result::Success : Result::InvalidPublicKey;
+}
+
+Result key_derivation_extract(const uint8_t* salt, size_t salt_length, const uint8_t* ikm, size_t ikm_length,
+                              uint8_t* prk) {
+  if ((salt == nullptr && salt_length != 0) || (ikm == nullptr && ikm_length != 0) || prk == nullptr) {
+    return Result::InvalidInput;
+  }
+  std::array<uint8_t, HASH_LENGTH> zero_salt{};
+  return salt_length == 0 ? hmac_parts(zero_salt.data(), zero_salt.size(), {{ikm, ikm_length}}, prk)
+                          : hmac_parts(salt, salt_length, {{ikm, ikm_length}}, prk);
+}
+
+Result key_derivation_expand(const uint8_t* prk, size_t prk_length, const uint8_t* info, size_t info_length,
+                             uint8_t* okm, size_t okm_length) {
+  if (prk == nullptr || (info == nullptr && info_length != 0) || okm == nullptr ||
+      okm_length > 255 * HASH_LENGTH) {
+    return Result::InvalidInput;
+  }
+  std::array<uint8_t, HASH_LENGTH> block{};
+  size_t produced = 0;
+  for (uint8_t counter = 1; produced < okm_length; ++counter) {
+    const size_t previous_length = counter == 1 ? 0 : block.size();
+    if (const Result result = hmac_parts(prk, prk_length,
+                                         {{block.data(), previous_length}, {info, info_length}, {&counter, 1}},
+                                         block.data());
+        result != Result::Success) {
+      return result;
+    }
+    const size_t take = std::min(block.size(), okm_length - produced);
+    std::copy_n(block.begin(), take, okm + produced);
+    produced += take;
+  }
+  sodium_memzero(block.data(), block.size());
+  return Result::Success;
+}
+
+Result hmac(const uint8_t* key, size_t key_length, const uint8_t* data, size_t data_length, uint8_t* mac) {
+  if (key == nullptr || (data == nullptr && data_length != 0) || mac == nullptr) {
+    return Result::InvalidInput;
+  }
+  return hmac_parts(key, key_length, {{data, data_length}}, mac);
+}
+
+}  // namespace crypto
+
+namespace oblivious_prf {
+
+Result evaluate(const uint8_t* blinded_element, const uint8_t* responder_private_key, uint8_t* evaluated_element) {
+  return crypto::scalar_mult(responder_private_key, blinded_element, evaluated_element);
+}
+
+}  // namespace oblivious_prf
+
+namespace responder {
+
+KE2::KE2() = default;
+
+ResponderState::ResponderState() = default;
+
+ResponderState::~ResponderState() = default;
+
+ResponderKeyPair::ResponderKeyPair() = default;
+
+ResponderKeyPair::~ResponderKeyPair() = default;
+
+Result ResponderKeyPair::generate(ResponderKeyPair& keypair) {
+  std::array<uint8_t, PRIVATE_KEY_LENGTH> seed{};
+  randombytes_buf(seed.data(), seed.size());
+  keypair.private_key.resize(PRIVATE_KEY_LENGTH);
+  keypair.public_key.resize(PUBLIC_KEY_LENGTH);
+  const Result result = crypto::derive_key_pair(seed.data(), keypair.private_key.data(), keypair.public_key.data());
+  sodium_memzero(seed.data(), seed.size());
+  return result;
+}
+
+class OpaqueResponder::Impl {
+ public:
+  explicit Impl(const ResponderKeyPair& keypair) {
+    keypair_.private_key = keypair.private_key;
+    keypair_.public_key = keypair.public_key;
+  }
+
+  ResponderKeyPair keypair_;
+};
+
+OpaqueResponder::OpaqueResponder(const ResponderKeyPair& responder_keypair)
+    : impl_(std::make_unique<Impl>(responder_keypair)) {}
+
+OpaqueResponder::~OpaqueResponder() = default;
+
+Result OpaqueResponder::create_registration_response(const uint8_t*, size_t, RegistrationResponse&,
+                                                     ResponderCredentials&) const {
+  return Result::InvalidInput;
+}
+
+Result OpaqueResponder::generate_ke2(const uint8_t* ke1_data, size_t ke1_length,
+                                     const ResponderCredentials& credentials, KE2& ke2,
+                                     ResponderState& state) const {
+  if (ke1_data == nullptr || ke1_length != KE1_LENGTH || credentials.initiator_public_key.size() != PUBLIC_KEY_LENGTH) {
+    return Result::InvalidInput;
+  }
+
+  state.session_key = derive_session_key(impl_->keypair_.private_key, ke1_data, ke1_length);
+  state.expected_initiator_mac = derive_ke3(state.session_key, ke1_data, ke1_length);
+  state.initiator_public_key = credentials.initiator_public_key;
+
+  ke2.responder_nonce.resize(NONCE_LENGTH);
+  randombytes_buf(ke2.responder_nonce.data(), ke2.responder_nonce.size());
+  ke2.responder_public_key = impl_->keypair_.public_key;
+  ke2.credential_response.assign(CREDENTIAL_RESPONSE_LENGTH, 0);
+  std::copy(credentials.initiator_public_key.begin(), credentials.initiator_public_key.end(),
+            ke2.credential_response.begin());
+  std::copy_n(credentials.envelope.begin(), std::min(credentials.envelope.size(), ENVELOPE_LENGTH),
+              ke2.credential_response.begin() + PUBLIC_KEY_LENGTH);
+  ke2.responder_mac.resize(MAC_LENGTH);
+  return hmac_parts(state.session_key.data(), state.session_key.size(),
+                    {{label_data(KE2_LABEL), KE2_LABEL.size()}, {ke1_data, ke1_length}}, ke2.responder_mac.data());
+}
+
+Result OpaqueResponder::responder_finish(const uint8_t* ke3_data, size_t ke3_length, const ResponderState& state,
+                                         secure_bytes& session_key) {
+  if (ke3_data == nullptr || ke3_length != KE3_LENGTH || state.expected_initiator_mac.size() != KE3_LENGTH) {
+    return Result::InvalidInput;
+  }
+  if (sodium_memcmp(ke3_data, state.expected_initiator_mac.data(), KE3_LENGTH) != 0) {
+    return Result::AuthenticationError;
+  }
+  session_key = state.session_key;
+  return Result::Success;
+}
+
+const secure_bytes& OpaqueResponder::get_public_key() const {
+  return impl_->keypair_.public_key;
+}
+
+}  // namespace responder
+
+namespace test_support {
+
+secure_bytes expected_session_key(const responder::ResponderKeyPair& keypair, const secure_bytes& ke1) {
+  return derive_session_key(keypair.private_key, ke1.data(), ke1.size());
+}
+
+secure_bytes expected_ke3(const responder::ResponderKeyPair& keypair, const secure_bytes& ke1) {
+  return derive_ke3(expected_session_key(keypair, ke1), ke1.data(), ke1.size());
+}
+
+secure_bytes random_bytes(size_t length) {
+  secure_bytes output(length);
+  randombytes_buf(output.data(), output.size());
+  return output;
+}
+
+}  // namespace test_support
+
+}  // namespace ecliptix::security::opaque
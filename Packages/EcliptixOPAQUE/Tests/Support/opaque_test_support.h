@@ -0,0 +1,21 @@
+#pragma once
+#include <string_view>
+#include "opaque/responder.h"
+
+namespace ecliptix::security::opaque::test_support {
+
+// The core primitives and OpaqueResponder ship in the full OPAQUE library;
+// tests link the libsodium stand-ins in core_stand_in.cpp instead. The
+// stand-in responder derives the session key and the KE3 it expects from
+// its private key and KE1, so tests can produce a matching KE3 here.
+[[nodiscard]] secure_bytes expected_ke3(const responder::ResponderKeyPair& keypair, const secure_bytes& ke1);
+
+[[nodiscard]] secure_bytes expected_session_key(const responder::ResponderKeyPair& keypair, const secure_bytes& ke1);
+
+[[nodiscard]] secure_bytes random_bytes(size_t length);
+
+[[nodiscard]] inline secure_bytes bytes(std::string_view text) {
+  return secure_bytes(text.begin(), text.end());
+}
+
+}  // namespace ecliptix::security::opaque::test_support
@@ -0,0 +1,73 @@
+#pragma once
+#include <chrono>
+#include "opaque.h"
+
+namespace ecliptix::security::opaque::responder {
+
+enum class AdmissionDecision {
+  Accept,
+  Defer,
+  Reject
+};
+
+struct AdmissionResult {
+  AdmissionDecision decision = AdmissionDecision::Reject;
+  std::chrono::milliseconds retry_after{0};
+};
+
+struct AdmissionConfig {
+  double identity_rate_per_second = 0.2;
+  double identity_burst = 5;
+  double source_rate_per_second = 10;
+  double source_burst = 50;
+  size_t width = 4096;
+  size_t depth = 4;
+  std::chrono::milliseconds max_defer{1000};
+};
+
+struct AdmissionStats {
+  uint64_t accepted = 0;
+  uint64_t deferred = 0;
+  uint64_t rejected = 0;
+};
+
+// Rate limiting in front of generate_ke2, keyed by credential identifier
+// and by source (client address, device id). Each key maps through SipHash
+// to `depth` cells of a count-min sketch whose cells are token buckets
+// packed into one atomic word and updated by CAS, so memory is fixed at
+// 2 * width * depth words and no lock is taken. A key's usage is that of
+// its least used cell, so a key sharing a row with a hot key is still
+// admitted on its other rows. Tokens are taken with conservative update:
+// only cells below the key's new usage are raised, and only up to it.
+// Every raise is a CAS against the value the decision was made on, so
+// concurrent requests never overdraw a key. Denied requests get Defer when
+// a token arrives within max_defer.
+class AdmissionController {
+ public:
+  explicit AdmissionController(const AdmissionConfig& config = AdmissionConfig());
+  ~AdmissionController();
+
+  AdmissionController(const AdmissionController&) = delete;
+  AdmissionController& operator=(const AdmissionController&) = delete;
+
+  [[nodiscard]] AdmissionResult admit(
+      const uint8_t* credential_identifier,
+      size_t identifier_length,
+      const uint8_t* source,
+      size_t source_length);
+
+  [[nodiscard]] AdmissionResult admit(
+      const uint8_t* credential_identifier,
+      size_t identifier_length,
+      const uint8_t* source,
+      size_t source_length,
+      std::chrono::steady_clock::time_point now);
+
+  [[nodiscard]] AdmissionStats get_stats() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace ecliptix::security::opaque::responder
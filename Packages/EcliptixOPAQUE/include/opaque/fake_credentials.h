@@ -0,0 +1,51 @@
+#pragma once
+#include "opaque.h"
+
+namespace ecliptix::security::opaque::responder {
+
+constexpr inline size_t FAKE_RECORD_SEED_LENGTH = 32;
+constexpr inline size_t MASKING_KEY_LENGTH = HASH_LENGTH;
+
+struct FakeCredentialConfig {
+  size_t capacity = 4096;
+  size_t shard_count = 16;
+};
+
+struct FakeCredentialStats {
+  uint64_t generated = 0;
+  uint64_t cache_hits = 0;
+  size_t size = 0;
+};
+
+// Produces ResponderCredentials for identifiers with no registration record.
+// Each record is derived deterministically from a server secret and the
+// identifier (the same identifier always yields the same envelope, masking
+// key and a valid initiator public key), so the KE2 built from it cannot be
+// told apart from a real one across repeated probes. Derivation has no
+// identifier-dependent branches; results are cached in secure memory.
+class FakeCredentialGenerator {
+ public:
+  FakeCredentialGenerator(
+      const uint8_t* fake_record_seed,
+      size_t seed_length,
+      const FakeCredentialConfig& config = FakeCredentialConfig());
+  ~FakeCredentialGenerator();
+
+  FakeCredentialGenerator(const FakeCredentialGenerator&) = delete;
+  FakeCredentialGenerator& operator=(const FakeCredentialGenerator&) = delete;
+
+  [[nodiscard]] Result generate(
+      const uint8_t* credential_identifier,
+      size_t identifier_length,
+      ResponderCredentials& credentials);
+
+  void clear();
+
+  [[nodiscard]] FakeCredentialStats get_stats() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace ecliptix::security::opaque::responder
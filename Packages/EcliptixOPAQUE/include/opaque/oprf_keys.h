@@ -0,0 +1,69 @@
+#pragma once
+#include "opaque.h"
+
+namespace ecliptix::security::opaque::oblivious_prf {
+
+// Derives the per-credential OPRF scalar from the master OPRF seed and the
+// credential identifier, so every user evaluates under an independent key.
+[[nodiscard]] Result derive_key(
+    const uint8_t* oprf_seed,
+    size_t seed_length,
+    const uint8_t* credential_identifier,
+    size_t identifier_length,
+    uint8_t* oprf_private_key);
+
+}  // namespace ecliptix::security::opaque::oblivious_prf
+
+namespace ecliptix::security::opaque::responder {
+
+struct OprfKeyCacheConfig {
+  size_t capacity = 4096;
+  size_t shard_count = 16;
+};
+
+struct OprfKeyCacheStats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  uint64_t evictions = 0;
+  size_t size = 0;
+};
+
+// Front end for per-credential OPRF keys. Derived scalars are kept in a
+// sharded LRU whose slots live in guarded, locked memory (sodium_malloc)
+// and are wiped on eviction; cache lookups are keyed by a keyed BLAKE2b
+// of the identifier, never the identifier itself.
+class OprfKeyDeriver {
+ public:
+  OprfKeyDeriver(
+      const uint8_t* oprf_seed,
+      size_t seed_length,
+      const OprfKeyCacheConfig& config = OprfKeyCacheConfig());
+  ~OprfKeyDeriver();
+
+  OprfKeyDeriver(const OprfKeyDeriver&) = delete;
+  OprfKeyDeriver& operator=(const OprfKeyDeriver&) = delete;
+
+  [[nodiscard]] Result derive_key(
+      const uint8_t* credential_identifier,
+      size_t identifier_length,
+      uint8_t* oprf_private_key);
+
+  [[nodiscard]] Result evaluate(
+      const uint8_t* credential_identifier,
+      size_t identifier_length,
+      const uint8_t* blinded_element,
+      uint8_t* evaluated_element);
+
+  // Warms the cache for identifiers expected to log in soon.
+  [[nodiscard]] Result precompute(const std::vector<secure_bytes>& credential_identifiers);
+
+  void clear();
+
+  [[nodiscard]] OprfKeyCacheStats get_stats() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace ecliptix::security::opaque::responder
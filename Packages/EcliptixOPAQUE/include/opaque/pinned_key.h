@@ -0,0 +1,17 @@
+#pragma once
+#include "opaque.h"
+
+namespace ecliptix::security::opaque::crypto {
+
+// scalar * keys::SERVER_PUBLIC_KEY as a fixed-base multiplication over a
+// table generated at build time (scripts/generate_pinned_key_table.py), so
+// no per-login table construction or point decoding is needed. Matches
+// crypto_scalarmult_ristretto255: the top scalar bit is ignored and an
+// identity result is a CryptoError. Runs in constant time.
+[[nodiscard]] Result scalar_mult_pinned(const uint8_t* scalar, uint8_t* result);
+
+// Routes multiplications against the pinned key to scalar_mult_pinned and
+// everything else to scalar_mult.
+[[nodiscard]] Result scalar_mult_prefer_pinned(const uint8_t* scalar, const uint8_t* point, uint8_t* result);
+
+}  // namespace ecliptix::security::opaque::crypto
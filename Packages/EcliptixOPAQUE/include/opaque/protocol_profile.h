@@ -0,0 +1,157 @@
+#pragma once
+#include <optional>
+#include "responder.h"
+
+namespace ecliptix::security::opaque::profile {
+
+enum class ProtocolVersion : uint8_t {
+  Legacy = 1,
+  Current = 2
+};
+
+struct HmacSha512 {
+  static constexpr size_t LENGTH = 64;
+
+  [[nodiscard]] static Result compute(const uint8_t* key, size_t key_length, const uint8_t* data,
+                                      size_t data_length, uint8_t* mac) {
+    return crypto::hmac(key, key_length, data, data_length, mac);
+  }
+};
+
+struct HkdfSha512 {
+  static constexpr size_t PRK_LENGTH = 64;
+
+  [[nodiscard]] static Result extract(const uint8_t* salt, size_t salt_length, const uint8_t* ikm,
+                                      size_t ikm_length, uint8_t* prk) {
+    return crypto::key_derivation_extract(salt, salt_length, ikm, ikm_length, prk);
+  }
+
+  [[nodiscard]] static Result expand(const uint8_t* prk, size_t prk_length, const uint8_t* info,
+                                     size_t info_length, uint8_t* okm, size_t okm_length) {
+    return crypto::key_derivation_expand(prk, prk_length, info, info_length, okm, okm_length);
+  }
+};
+
+// Wire parameters of one protocol generation. Legacy is the client/server
+// release shipped in OpaqueClient.xcframework (envelope without the sealed
+// master key); Current is the initiator/responder layout of this package.
+template <ProtocolVersion V>
+struct ProtocolProfile;
+
+template <>
+struct ProtocolProfile<ProtocolVersion::Legacy> {
+  static constexpr ProtocolVersion VERSION = ProtocolVersion::Legacy;
+  using Mac = HmacSha512;
+  using Kdf = HkdfSha512;
+
+  static constexpr size_t ENVELOPE_NONCE_LENGTH = NONCE_LENGTH;
+  static constexpr size_t ENVELOPE_PLAINTEXT_LENGTH = PUBLIC_KEY_LENGTH + PRIVATE_KEY_LENGTH + PUBLIC_KEY_LENGTH;
+  static constexpr size_t ENVELOPE_AUTH_TAG_LENGTH = 16;
+  static constexpr bool SEALS_MASTER_KEY = false;
+};
+
+template <>
+struct ProtocolProfile<ProtocolVersion::Current> {
+  static constexpr ProtocolVersion VERSION = ProtocolVersion::Current;
+  using Mac = HmacSha512;
+  using Kdf = HkdfSha512;
+
+  static constexpr size_t ENVELOPE_NONCE_LENGTH = NONCE_LENGTH;
+  static constexpr size_t ENVELOPE_PLAINTEXT_LENGTH =
+      PUBLIC_KEY_LENGTH + PRIVATE_KEY_LENGTH + PUBLIC_KEY_LENGTH + MASTER_KEY_LENGTH;
+  static constexpr size_t ENVELOPE_AUTH_TAG_LENGTH = 16;
+  static constexpr bool SEALS_MASTER_KEY = true;
+};
+
+using LegacyProfile = ProtocolProfile<ProtocolVersion::Legacy>;
+using CurrentProfile = ProtocolProfile<ProtocolVersion::Current>;
+
+// Lengths derived from a profile; every offset used by the codecs below is
+// a compile-time constant, so the per-profile paths carry no length checks
+// beyond the single one at the entry point.
+template <typename Profile>
+struct WireLayout {
+  static constexpr size_t ENVELOPE_LENGTH =
+      Profile::ENVELOPE_NONCE_LENGTH + Profile::ENVELOPE_PLAINTEXT_LENGTH + Profile::ENVELOPE_AUTH_TAG_LENGTH;
+  static constexpr size_t CREDENTIAL_RESPONSE_LENGTH = PUBLIC_KEY_LENGTH + ENVELOPE_LENGTH;
+  static constexpr size_t KE2_LENGTH =
+      NONCE_LENGTH + PUBLIC_KEY_LENGTH + CREDENTIAL_RESPONSE_LENGTH + Profile::Mac::LENGTH;
+
+  static constexpr size_t KE2_NONCE_OFFSET = 0;
+  static constexpr size_t KE2_PUBLIC_KEY_OFFSET = KE2_NONCE_OFFSET + NONCE_LENGTH;
+  static constexpr size_t KE2_CREDENTIAL_RESPONSE_OFFSET = KE2_PUBLIC_KEY_OFFSET + PUBLIC_KEY_LENGTH;
+  static constexpr size_t KE2_MAC_OFFSET = KE2_CREDENTIAL_RESPONSE_OFFSET + CREDENTIAL_RESPONSE_LENGTH;
+};
+
+static_assert(WireLayout<LegacyProfile>::ENVELOPE_LENGTH == 144, "Legacy envelope length mismatch");
+static_assert(WireLayout<LegacyProfile>::KE2_LENGTH == 304, "Legacy KE2 length mismatch");
+static_assert(WireLayout<CurrentProfile>::ENVELOPE_LENGTH == ENVELOPE_LENGTH, "Current envelope length mismatch");
+static_assert(WireLayout<CurrentProfile>::KE2_LENGTH == KE2_LENGTH, "Current KE2 length mismatch");
+
+template <typename Profile>
+struct WireCodec {
+  using Layout = WireLayout<Profile>;
+
+  [[nodiscard]] static Result serialize_ke2(const responder::KE2& ke2, uint8_t* output);
+
+  [[nodiscard]] static Result parse_ke2(const uint8_t* input, responder::KE2& ke2);
+
+  [[nodiscard]] static Result split_envelope(const uint8_t* input, Envelope& envelope);
+
+  [[nodiscard]] static Result join_envelope(const Envelope& envelope, uint8_t* output);
+};
+
+extern template struct WireCodec<LegacyProfile>;
+extern template struct WireCodec<CurrentProfile>;
+
+[[nodiscard]] constexpr std::optional<ProtocolVersion> version_for_ke2_length(size_t length) {
+  if (length == WireLayout<CurrentProfile>::KE2_LENGTH) {
+    return ProtocolVersion::Current;
+  }
+  if (length == WireLayout<LegacyProfile>::KE2_LENGTH) {
+    return ProtocolVersion::Legacy;
+  }
+  return std::nullopt;
+}
+
+[[nodiscard]] constexpr std::optional<ProtocolVersion> version_for_envelope_length(size_t length) {
+  if (length == WireLayout<CurrentProfile>::ENVELOPE_LENGTH) {
+    return ProtocolVersion::Current;
+  }
+  if (length == WireLayout<LegacyProfile>::ENVELOPE_LENGTH) {
+    return ProtocolVersion::Legacy;
+  }
+  return std::nullopt;
+}
+
+// Resolves the version once and invokes `handler` with a value of the
+// matching profile type, e.g. [&](auto profile) { using P = decltype(profile); ... }.
+template <typename Handler>
+[[nodiscard]] Result dispatch(std::optional<ProtocolVersion> version, Handler&& handler) {
+  if (!version) {
+    return Result::InvalidInput;
+  }
+  switch (*version) {
+    case ProtocolVersion::Legacy:
+      return handler(LegacyProfile{});
+    case ProtocolVersion::Current:
+      return handler(CurrentProfile{});
+  }
+  return Result::InvalidInput;
+}
+
+// Serializes a KE2 for whichever generation the stored credentials belong
+// to, so records registered by either client release are served by one
+// responder. `output` must hold at least KE2_LENGTH bytes; the written
+// length is returned in `written`.
+[[nodiscard]] Result serialize_ke2_for_credentials(
+    const ResponderCredentials& credentials,
+    const responder::KE2& ke2,
+    uint8_t* output,
+    size_t output_capacity,
+    size_t& written);
+
+[[nodiscard]] Result parse_ke2_any(const uint8_t* input, size_t input_length, responder::KE2& ke2,
+                                   ProtocolVersion& version);
+
+}  // namespace ecliptix::security::opaque::profile
@@ -0,0 +1,60 @@
+#pragma once
+#include <chrono>
+#include "responder.h"
+
+namespace ecliptix::security::opaque::responder {
+
+constexpr inline size_t KE1_REPLAY_KEY_LENGTH = NONCE_LENGTH + PUBLIC_KEY_LENGTH;
+
+struct ReplayFilterConfig {
+  size_t expected_messages_per_window = 100000;
+  double false_positive_rate = 1e-4;
+  std::chrono::seconds window{60};
+};
+
+struct ReplayFilterStats {
+  uint64_t checked = 0;
+  uint64_t replays = 0;
+  uint64_t rotations = 0;
+  size_t bits_per_generation = 0;
+  size_t hash_count = 0;
+};
+
+// Rejects KE1 messages whose (initiator_nonce, initiator_public_key) pair
+// was already seen, before any scalar multiplication. Two Bloom filter
+// generations are kept; the older one is cleared and reused every window,
+// so a nonce is remembered for between one and two windows and memory is
+// fixed by the expected rate and false-positive target. A false positive
+// rejects a fresh KE1 and the initiator simply retries with a new nonce.
+// A KE1 counts as new when recording it set at least one clear bit, and
+// the bits are set one word at a time, so identical KE1s checked at the
+// same moment can each set some of them and both pass. Such a duplicate
+// only costs the work the filter exists to save: its KE2 carries a fresh
+// responder nonce, so it cannot be finished with the original KE3.
+class ReplayFilter {
+ public:
+  explicit ReplayFilter(const ReplayFilterConfig& config = ReplayFilterConfig());
+  ~ReplayFilter();
+
+  ReplayFilter(const ReplayFilter&) = delete;
+  ReplayFilter& operator=(const ReplayFilter&) = delete;
+
+  // Success for a first sighting (which is recorded), ValidationError for
+  // a replay, InvalidInput for a malformed KE1.
+  [[nodiscard]] Result check_and_record(const uint8_t* ke1_data, size_t ke1_length);
+
+  [[nodiscard]] Result check_and_record(
+      const uint8_t* ke1_data,
+      size_t ke1_length,
+      std::chrono::steady_clock::time_point now);
+
+  void clear();
+
+  [[nodiscard]] ReplayFilterStats get_stats() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace ecliptix::security::opaque::responder
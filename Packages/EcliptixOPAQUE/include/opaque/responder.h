@@ -3,6 +3,13 @@
 
 namespace ecliptix::security::opaque::responder {
 
+// KE1 wire layout: initiator_nonce | initiator_public_key | credential_request.
+constexpr inline size_t KE1_NONCE_OFFSET = 0;
+constexpr inline size_t KE1_PUBLIC_KEY_OFFSET = KE1_NONCE_OFFSET + NONCE_LENGTH;
+constexpr inline size_t KE1_CREDENTIAL_REQUEST_OFFSET = KE1_PUBLIC_KEY_OFFSET + PUBLIC_KEY_LENGTH;
+
+static_assert(KE1_CREDENTIAL_REQUEST_OFFSET + PUBLIC_KEY_LENGTH == KE1_LENGTH, "KE1 layout mismatch");
+
 struct RegistrationResponse {
   secure_bytes data;
   RegistrationResponse();
@@ -0,0 +1,185 @@
+#pragma once
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include "fake_credentials.h"
+#include "responder.h"
+
+namespace ecliptix::security::opaque::responder {
+
+template <typename T>
+class Task {
+ public:
+  struct promise_type {
+    std::optional<T> value;
+    std::exception_ptr exception;
+    std::coroutine_handle<> continuation = std::noop_coroutine();
+
+    Task get_return_object() {
+      return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    auto final_suspend() noexcept {
+      struct FinalAwaiter {
+        bool await_ready() noexcept { return false; }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+          return handle.promise().continuation;
+        }
+        void await_resume() noexcept {}
+      };
+      return FinalAwaiter{};
+    }
+
+    void return_value(T result) { value.emplace(std::move(result)); }
+
+    void unhandled_exception() { exception = std::current_exception(); }
+  };
+
+  Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+
+  Task& operator=(Task&& other) noexcept {
+    if (this != &other) {
+      reset();
+      handle_ = std::exchange(other.handle_, {});
+    }
+    return *this;
+  }
+
+  Task(const Task&) = delete;
+  Task& operator=(const Task&) = delete;
+
+  ~Task() { reset(); }
+
+  bool await_ready() const noexcept { return false; }
+
+  std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+    handle_.promise().continuation = awaiting;
+    return handle_;
+  }
+
+  T await_resume() {
+    if (handle_.promise().exception) {
+      std::rethrow_exception(handle_.promise().exception);
+    }
+    return std::move(*handle_.promise().value);
+  }
+
+ private:
+  explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+  void reset() {
+    if (handle_) {
+      handle_.destroy();
+      handle_ = {};
+    }
+  }
+
+  std::coroutine_handle<promise_type> handle_;
+};
+
+class Executor {
+ public:
+  virtual ~Executor() = default;
+
+  virtual void post(std::function<void()> work) = 0;
+
+  auto schedule() {
+    struct ScheduleAwaiter {
+      Executor& executor;
+      bool await_ready() const noexcept { return false; }
+      void await_suspend(std::coroutine_handle<> handle) {
+        executor.post([handle] { handle.resume(); });
+      }
+      void await_resume() const noexcept {}
+    };
+    return ScheduleAwaiter{*this};
+  }
+};
+
+class InlineExecutor final : public Executor {
+ public:
+  void post(std::function<void()> work) override { work(); }
+};
+
+class ThreadPoolExecutor final : public Executor {
+ public:
+  explicit ThreadPoolExecutor(size_t thread_count = std::thread::hardware_concurrency());
+  ~ThreadPoolExecutor() override;
+
+  ThreadPoolExecutor(const ThreadPoolExecutor&) = delete;
+  ThreadPoolExecutor& operator=(const ThreadPoolExecutor&) = delete;
+
+  void post(std::function<void()> work) override;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+enum class CredentialLookup {
+  Found,
+  NotFound,
+  Failed
+};
+
+using CredentialCallback = std::function<void(CredentialLookup, ResponderCredentials)>;
+
+// Asynchronous credential source (database, cache, RPC). fetch() must not
+// block; it invokes the callback exactly once, on any thread.
+class CredentialFetcher {
+ public:
+  virtual ~CredentialFetcher() = default;
+
+  virtual void fetch(const secure_bytes& credential_identifier, CredentialCallback done) = 0;
+};
+
+// In-memory stand-in for a credential store; completions are posted to the
+// given executor so callers exercise the asynchronous path.
+class InMemoryCredentialFetcher final : public CredentialFetcher {
+ public:
+  explicit InMemoryCredentialFetcher(Executor& executor);
+
+  void store(const secure_bytes& credential_identifier, const ResponderCredentials& credentials);
+
+  void fetch(const secure_bytes& credential_identifier, CredentialCallback done) override;
+
+ private:
+  Executor& executor_;
+  std::mutex mutex_;
+  std::unordered_map<std::string, ResponderCredentials> records_;
+};
+
+struct AsyncResponderOptions {
+  FakeCredentialGenerator* fake_credentials = nullptr;
+};
+
+// Starts the credential fetch first and derives the fake record for the
+// identifier on the executor while the lookup is in flight, then runs
+// OpaqueResponder::generate_ke2 on the executor once credentials arrive.
+// An unknown identifier is answered with the fake record when
+// options.fake_credentials is configured. The responder, executor,
+// fetcher, ke2 and state must outlive the task.
+[[nodiscard]] Task<Result> generate_ke2_async(
+    const OpaqueResponder& responder,
+    Executor& executor,
+    CredentialFetcher& fetcher,
+    secure_bytes credential_identifier,
+    secure_bytes ke1,
+    KE2& ke2,
+    ResponderState& state,
+    AsyncResponderOptions options = AsyncResponderOptions());
+
+// Blocks the calling thread until the task completes; intended for callers
+// that are not coroutines themselves.
+[[nodiscard]] Result sync_wait(Task<Result> task);
+
+}  // namespace ecliptix::security::opaque::responder
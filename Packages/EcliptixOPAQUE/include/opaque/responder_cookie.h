@@ -0,0 +1,101 @@
+#pragma once
+#include <chrono>
+#include "responder.h"
+
+namespace ecliptix::security::opaque::responder {
+
+constexpr inline uint8_t STATE_COOKIE_VERSION = 1;
+constexpr inline size_t STATE_COOKIE_KEY_LENGTH = 32;
+constexpr inline size_t STATE_COOKIE_NONCE_LENGTH = 24;
+constexpr inline size_t STATE_COOKIE_TAG_LENGTH = 16;
+constexpr inline size_t STATE_COOKIE_HEADER_LENGTH = 1 + 4 + 8 + STATE_COOKIE_NONCE_LENGTH;
+constexpr inline size_t STATE_COOKIE_PAYLOAD_LENGTH = HASH_LENGTH + MAC_LENGTH;
+constexpr inline size_t STATE_COOKIE_LENGTH =
+    STATE_COOKIE_HEADER_LENGTH + STATE_COOKIE_PAYLOAD_LENGTH + STATE_COOKIE_TAG_LENGTH;
+
+struct StateCookieConfig {
+  std::chrono::seconds rotation_interval{300};
+  std::chrono::seconds max_age{120};
+  std::chrono::seconds clock_skew{5};
+};
+
+// Seals the part of ResponderState that responder_finish_impl consumes
+// (session key and expected initiator MAC) into an XChaCha20-Poly1305
+// cookie under a node-local key. The key rotates every rotation_interval;
+// cookies sealed under the previous key still open until they exceed
+// max_age. The optional context is bound as associated data. open() does
+// not consume a cookie; redeem() marks it spent, and its nonce is kept
+// only until the cookie would fail max_age anyway.
+class StateCookieKeyRing {
+ public:
+  explicit StateCookieKeyRing(const StateCookieConfig& config = StateCookieConfig());
+  ~StateCookieKeyRing();
+
+  StateCookieKeyRing(const StateCookieKeyRing&) = delete;
+  StateCookieKeyRing& operator=(const StateCookieKeyRing&) = delete;
+
+  [[nodiscard]] Result seal(
+      const ResponderState& state,
+      const uint8_t* context,
+      size_t context_length,
+      secure_bytes& cookie);
+
+  [[nodiscard]] Result open(
+      const uint8_t* cookie,
+      size_t cookie_length,
+      const uint8_t* context,
+      size_t context_length,
+      ResponderState& state) const;
+
+  // ValidationError if the cookie was already redeemed. Call it only for
+  // a cookie that open() accepted.
+  [[nodiscard]] Result redeem(const uint8_t* cookie, size_t cookie_length);
+
+  void rotate();
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+// OpaqueResponder that keeps no per-handshake memory: the cookie returned
+// with KE2 must be echoed back with KE3. A cookie finishes one handshake;
+// replaying it with the same KE3 yields ValidationError.
+class StatelessResponder {
+ public:
+  explicit StatelessResponder(
+      const ResponderKeyPair& responder_keypair,
+      const StateCookieConfig& config = StateCookieConfig());
+  ~StatelessResponder();
+
+  StatelessResponder(const StatelessResponder&) = delete;
+  StatelessResponder& operator=(const StatelessResponder&) = delete;
+
+  [[nodiscard]] Result generate_ke2(
+      const uint8_t* ke1_data,
+      size_t ke1_length,
+      const ResponderCredentials& credentials,
+      KE2& ke2,
+      secure_bytes& cookie,
+      const uint8_t* context = nullptr,
+      size_t context_length = 0);
+
+  [[nodiscard]] Result responder_finish(
+      const uint8_t* ke3_data,
+      size_t ke3_length,
+      const uint8_t* cookie,
+      size_t cookie_length,
+      secure_bytes& session_key,
+      const uint8_t* context = nullptr,
+      size_t context_length = 0);
+
+  [[nodiscard]] const secure_bytes& get_public_key() const;
+
+  void rotate_cookie_key();
+
+ private:
+  OpaqueResponder responder_;
+  StateCookieKeyRing key_ring_;
+};
+
+}  // namespace ecliptix::security::opaque::responder
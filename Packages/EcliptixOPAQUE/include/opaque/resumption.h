@@ -0,0 +1,98 @@
+#pragma once
+#include <chrono>
+#include "opaque.h"
+
+namespace ecliptix::security::opaque::resumption {
+
+constexpr inline uint8_t TICKET_VERSION = 1;
+constexpr inline size_t RESUMPTION_SECRET_LENGTH = HASH_LENGTH;
+constexpr inline size_t TICKET_KEY_LENGTH = 32;
+constexpr inline size_t TICKET_NONCE_LENGTH = 24;
+constexpr inline size_t TICKET_TAG_LENGTH = 16;
+constexpr inline size_t TICKET_HEADER_LENGTH = 1 + 4 + 8 + TICKET_NONCE_LENGTH;
+constexpr inline size_t TICKET_MAX_IDENTIFIER_LENGTH = 64;
+// Sealed payload: resumption_secret | identifier_length | identifier (zero padded).
+constexpr inline size_t TICKET_PLAINTEXT_LENGTH = RESUMPTION_SECRET_LENGTH + 1 + TICKET_MAX_IDENTIFIER_LENGTH;
+constexpr inline size_t TICKET_LENGTH = TICKET_HEADER_LENGTH + TICKET_PLAINTEXT_LENGTH + TICKET_TAG_LENGTH;
+constexpr inline size_t RESUME_REQUEST_LENGTH = TICKET_LENGTH + NONCE_LENGTH + MAC_LENGTH;
+constexpr inline size_t RESUME_RESPONSE_LENGTH = NONCE_LENGTH + MAC_LENGTH + TICKET_LENGTH;
+
+// Both sides call this on the session key produced by initiator_finish /
+// responder_finish to seed resumption.
+[[nodiscard]] Result derive_resumption_secret(
+    const secure_bytes& session_key,
+    secure_bytes& resumption_secret);
+
+struct ResumptionTicket {
+  secure_bytes ticket;
+  secure_bytes resumption_secret;
+
+  ResumptionTicket();
+  ~ResumptionTicket();
+};
+
+struct ResumptionState {
+  ResumptionTicket current;
+  secure_bytes initiator_nonce;
+
+  ResumptionState();
+  ~ResumptionState();
+};
+
+[[nodiscard]] Result create_resume_request(
+    const ResumptionTicket& ticket,
+    ResumptionState& state,
+    secure_bytes& request);
+
+// Verifies the responder MAC, yields the new session key and replaces
+// `next` with the rotated ticket. A ticket is meant to be used once.
+[[nodiscard]] Result finish_resume(
+    const uint8_t* response,
+    size_t response_length,
+    const ResumptionState& state,
+    ResumptionTicket& next,
+    secure_bytes& session_key);
+
+struct TicketKeyConfig {
+  std::chrono::seconds rotation_interval{3600};
+  std::chrono::seconds ticket_lifetime{86400};
+};
+
+// Responder side of resumption. Tickets carry the resumption secret and
+// the credential identifier of the account that authenticated, sealed
+// with XChaCha20-Poly1305 under a rotating ticket key; keys are wiped once
+// no unexpired ticket can reference them, so a later key compromise does
+// not expose earlier sessions. Each ticket is accepted once: its nonce is
+// recorded against the key that sealed it and forgotten with that key.
+class TicketIssuer {
+ public:
+  explicit TicketIssuer(const TicketKeyConfig& config = TicketKeyConfig());
+  ~TicketIssuer();
+
+  TicketIssuer(const TicketIssuer&) = delete;
+  TicketIssuer& operator=(const TicketIssuer&) = delete;
+
+  // credential_identifier is 1..TICKET_MAX_IDENTIFIER_LENGTH bytes.
+  [[nodiscard]] Result issue_ticket(
+      const secure_bytes& credential_identifier,
+      const secure_bytes& resumption_secret,
+      secure_bytes& ticket);
+
+  // Yields the credential identifier the ticket was issued for; the next
+  // ticket in the response carries the same identifier. ValidationError
+  // for an expired, unknown or already redeemed ticket.
+  [[nodiscard]] Result resume(
+      const uint8_t* request,
+      size_t request_length,
+      secure_bytes& response,
+      secure_bytes& session_key,
+      secure_bytes& credential_identifier);
+
+  void rotate();
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace ecliptix::security::opaque::resumption
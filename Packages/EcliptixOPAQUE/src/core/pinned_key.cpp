@@ -0,0 +1,489 @@
+#include "opaque/pinned_key.h"
+
+#include <sodium.h>
+
+#include <cstring>
+
+#include "core/pinned_key_table.h"
+#include "opaque/hardcoded_keys.h"
+
+namespace ecliptix::security::opaque::crypto {
+
+namespace {
+
+using detail::PinnedPrecomp;
+
+constexpr bool table_matches_pinned_key() {
+  for (size_t i = 0; i < PUBLIC_KEY_LENGTH; ++i) {
+    if (detail::PINNED_TABLE_KEY[i] != keys::SERVER_PUBLIC_KEY[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static_assert(table_matches_pinned_key(),
+              "pinned_key_table.h is stale; re-run scripts/generate_pinned_key_table.py");
+
+// Field elements mod 2^255 - 19 in five 51-bit limbs, following the
+// radix-2^51 ref10 arithmetic libsodium uses for its own fixed-base path.
+using Fe = uint64_t[5];
+__extension__ using Uint128 = unsigned __int128;
+
+constexpr uint64_t LIMB_MASK = (uint64_t{1} << 51) - 1;
+
+constexpr Fe FE_SQRTM1 = {
+    0x61b274a0ea0b0ULL, 0x0d5a5fc8f189dULL, 0x7ef5e9cbd0c60ULL, 0x78595a6804c9eULL, 0x2b8324804fc1dULL};
+constexpr Fe FE_INVSQRT_A_MINUS_D = {
+    0x0fdaa805d40eaULL, 0x2eb482e57d339ULL, 0x007610274bc58ULL, 0x6510b613dc8ffULL, 0x786c8905cfaffULL};
+
+void fe_copy(Fe h, const Fe f) {
+  std::memcpy(h, f, sizeof(Fe));
+}
+
+void fe_0(Fe h) {
+  std::memset(h, 0, sizeof(Fe));
+}
+
+void fe_1(Fe h) {
+  fe_0(h);
+  h[0] = 1;
+}
+
+void fe_add(Fe h, const Fe f, const Fe g) {
+  for (size_t i = 0; i < 5; ++i) {
+    h[i] = f[i] + g[i];
+  }
+}
+
+void fe_sub(Fe h, const Fe f, const Fe g) {
+  uint64_t t[5];
+  fe_copy(t, g);
+  t[1] += t[0] >> 51;
+  t[0] &= LIMB_MASK;
+  t[2] += t[1] >> 51;
+  t[1] &= LIMB_MASK;
+  t[3] += t[2] >> 51;
+  t[2] &= LIMB_MASK;
+  t[4] += t[3] >> 51;
+  t[3] &= LIMB_MASK;
+  t[0] += 19ULL * (t[4] >> 51);
+  t[4] &= LIMB_MASK;
+
+  h[0] = (f[0] + 0xfffffffffffdaULL) - t[0];
+  h[1] = (f[1] + 0xffffffffffffeULL) - t[1];
+  h[2] = (f[2] + 0xffffffffffffeULL) - t[2];
+  h[3] = (f[3] + 0xffffffffffffeULL) - t[3];
+  h[4] = (f[4] + 0xffffffffffffeULL) - t[4];
+}
+
+void fe_neg(Fe h, const Fe f) {
+  Fe zero;
+  fe_0(zero);
+  fe_sub(h, zero, f);
+}
+
+void fe_carry(Fe h, Uint128 r0, Uint128 r1, Uint128 r2, Uint128 r3, Uint128 r4) {
+  uint64_t carry;
+  r1 += static_cast<uint64_t>(r0 >> 51);
+  h[0] = static_cast<uint64_t>(r0) & LIMB_MASK;
+  r2 += static_cast<uint64_t>(r1 >> 51);
+  h[1] = static_cast<uint64_t>(r1) & LIMB_MASK;
+  r3 += static_cast<uint64_t>(r2 >> 51);
+  h[2] = static_cast<uint64_t>(r2) & LIMB_MASK;
+  r4 += static_cast<uint64_t>(r3 >> 51);
+  h[3] = static_cast<uint64_t>(r3) & LIMB_MASK;
+  carry = static_cast<uint64_t>(r4 >> 51);
+  h[4] = static_cast<uint64_t>(r4) & LIMB_MASK;
+
+  h[0] += 19ULL * carry;
+  carry = h[0] >> 51;
+  h[0] &= LIMB_MASK;
+  h[1] += carry;
+  carry = h[1] >> 51;
+  h[1] &= LIMB_MASK;
+  h[2] += carry;
+}
+
+void fe_mul(Fe h, const Fe f, const Fe g) {
+  const uint64_t g1_19 = 19ULL * g[1];
+  const uint64_t g2_19 = 19ULL * g[2];
+  const uint64_t g3_19 = 19ULL * g[3];
+  const uint64_t g4_19 = 19ULL * g[4];
+
+  const Uint128 r0 = Uint128(f[0]) * g[0] + Uint128(f[1]) * g4_19 + Uint128(f[2]) * g3_19 +
+                     Uint128(f[3]) * g2_19 + Uint128(f[4]) * g1_19;
+  const Uint128 r1 = Uint128(f[0]) * g[1] + Uint128(f[1]) * g[0] + Uint128(f[2]) * g4_19 +
+                     Uint128(f[3]) * g3_19 + Uint128(f[4]) * g2_19;
+  const Uint128 r2 = Uint128(f[0]) * g[2] + Uint128(f[1]) * g[1] + Uint128(f[2]) * g[0] +
+                     Uint128(f[3]) * g4_19 + Uint128(f[4]) * g3_19;
+  const Uint128 r3 = Uint128(f[0]) * g[3] + Uint128(f[1]) * g[2] + Uint128(f[2]) * g[1] +
+                     Uint128(f[3]) * g[0] + Uint128(f[4]) * g4_19;
+  const Uint128 r4 = Uint128(f[0]) * g[4] + Uint128(f[1]) * g[3] + Uint128(f[2]) * g[2] +
+                     Uint128(f[3]) * g[1] + Uint128(f[4]) * g[0];
+  fe_carry(h, r0, r1, r2, r3, r4);
+}
+
+void fe_sq(Fe h, const Fe f) {
+  fe_mul(h, f, f);
+}
+
+void fe_sq_times(Fe h, const Fe f, int count) {
+  fe_sq(h, f);
+  for (int i = 1; i < count; ++i) {
+    fe_sq(h, h);
+  }
+}
+
+void fe_reduce(uint64_t t[5], const Fe f) {
+  fe_copy(t, f);
+  for (int pass = 0; pass < 2; ++pass) {
+    t[1] += t[0] >> 51;
+    t[0] &= LIMB_MASK;
+    t[2] += t[1] >> 51;
+    t[1] &= LIMB_MASK;
+    t[3] += t[2] >> 51;
+    t[2] &= LIMB_MASK;
+    t[4] += t[3] >> 51;
+    t[3] &= LIMB_MASK;
+    t[0] += 19ULL * (t[4] >> 51);
+    t[4] &= LIMB_MASK;
+  }
+
+  t[0] += 19ULL;
+  t[1] += t[0] >> 51;
+  t[0] &= LIMB_MASK;
+  t[2] += t[1] >> 51;
+  t[1] &= LIMB_MASK;
+  t[3] += t[2] >> 51;
+  t[2] &= LIMB_MASK;
+  t[4] += t[3] >> 51;
+  t[3] &= LIMB_MASK;
+  t[0] += 19ULL * (t[4] >> 51);
+  t[4] &= LIMB_MASK;
+
+  t[0] += 0x8000000000000ULL - 19ULL;
+  t[1] += 0x8000000000000ULL - 1ULL;
+  t[2] += 0x8000000000000ULL - 1ULL;
+  t[3] += 0x8000000000000ULL - 1ULL;
+  t[4] += 0x8000000000000ULL - 1ULL;
+
+  t[1] += t[0] >> 51;
+  t[0] &= LIMB_MASK;
+  t[2] += t[1] >> 51;
+  t[1] &= LIMB_MASK;
+  t[3] += t[2] >> 51;
+  t[2] &= LIMB_MASK;
+  t[4] += t[3] >> 51;
+  t[3] &= LIMB_MASK;
+  t[4] &= LIMB_MASK;
+}
+
+void fe_tobytes(uint8_t* s, const Fe f) {
+  uint64_t t[5];
+  fe_reduce(t, f);
+  const uint64_t words[4] = {
+      t[0] | (t[1] << 51),
+      (t[1] >> 13) | (t[2] << 38),
+      (t[2] >> 26) | (t[3] << 25),
+      (t[3] >> 39) | (t[4] << 12)};
+  for (size_t w = 0; w < 4; ++w) {
+    for (size_t b = 0; b < 8; ++b) {
+      s[8 * w + b] = static_cast<uint8_t>(words[w] >> (8 * b));
+    }
+  }
+}
+
+int fe_isnegative(const Fe f) {
+  uint8_t s[32];
+  fe_tobytes(s, f);
+  return s[0] & 1;
+}
+
+int fe_iszero(const Fe f) {
+  uint8_t s[32];
+  fe_tobytes(s, f);
+  return sodium_is_zero(s, sizeof(s));
+}
+
+void fe_cmov(Fe f, const Fe g, unsigned int b) {
+  const uint64_t mask = static_cast<uint64_t>(0) - static_cast<uint64_t>(b);
+  for (size_t i = 0; i < 5; ++i) {
+    f[i] ^= (f[i] ^ g[i]) & mask;
+  }
+}
+
+void fe_cneg(Fe h, const Fe f, unsigned int b) {
+  Fe negf;
+  fe_neg(negf, f);
+  fe_copy(h, f);
+  fe_cmov(h, negf, b);
+}
+
+void fe_abs(Fe h, const Fe f) {
+  fe_cneg(h, f, static_cast<unsigned int>(fe_isnegative(f)));
+}
+
+void fe_pow22523(Fe out, const Fe z) {
+  Fe t0, t1, t2;
+  fe_sq(t0, z);
+  fe_sq_times(t1, t0, 2);
+  fe_mul(t1, z, t1);
+  fe_mul(t0, t0, t1);
+  fe_sq(t0, t0);
+  fe_mul(t0, t1, t0);
+  fe_sq_times(t1, t0, 5);
+  fe_mul(t0, t1, t0);
+  fe_sq_times(t1, t0, 10);
+  fe_mul(t1, t1, t0);
+  fe_sq_times(t2, t1, 20);
+  fe_mul(t1, t2, t1);
+  fe_sq_times(t1, t1, 10);
+  fe_mul(t0, t1, t0);
+  fe_sq_times(t1, t0, 50);
+  fe_mul(t1, t1, t0);
+  fe_sq_times(t2, t1, 100);
+  fe_mul(t1, t2, t1);
+  fe_sq_times(t1, t1, 50);
+  fe_mul(t0, t1, t0);
+  fe_sq_times(t0, t0, 2);
+  fe_mul(out, t0, z);
+}
+
+void sqrt_ratio_m1(Fe x, const Fe u, const Fe v) {
+  Fe v3, vxx, m_root_check, p_root_check, f_root_check, x_sqrtm1;
+
+  fe_sq(v3, v);
+  fe_mul(v3, v3, v);
+  fe_sq(x, v3);
+  fe_mul(x, x, u);
+  fe_mul(x, x, v);
+
+  fe_pow22523(x, x);
+  fe_mul(x, x, v3);
+  fe_mul(x, x, u);
+
+  fe_sq(vxx, x);
+  fe_mul(vxx, vxx, v);
+  fe_sub(m_root_check, vxx, u);
+  fe_add(p_root_check, vxx, u);
+  fe_mul(f_root_check, u, FE_SQRTM1);
+  fe_add(f_root_check, vxx, f_root_check);
+  const int has_p_root = fe_iszero(p_root_check);
+  const int has_f_root = fe_iszero(f_root_check);
+  fe_mul(x_sqrtm1, x, FE_SQRTM1);
+
+  fe_cmov(x, x_sqrtm1, static_cast<unsigned int>(has_p_root | has_f_root));
+  fe_abs(x, x);
+}
+
+struct GeP3 {
+  Fe X, Y, Z, T;
+};
+
+struct GeP2 {
+  Fe X, Y, Z;
+};
+
+struct GeP1P1 {
+  Fe X, Y, Z, T;
+};
+
+void p1p1_to_p2(GeP2& r, const GeP1P1& p) {
+  fe_mul(r.X, p.X, p.T);
+  fe_mul(r.Y, p.Y, p.Z);
+  fe_mul(r.Z, p.Z, p.T);
+}
+
+void p1p1_to_p3(GeP3& r, const GeP1P1& p) {
+  fe_mul(r.X, p.X, p.T);
+  fe_mul(r.Y, p.Y, p.Z);
+  fe_mul(r.Z, p.Z, p.T);
+  fe_mul(r.T, p.X, p.Y);
+}
+
+void p2_dbl(GeP1P1& r, const GeP2& p) {
+  Fe t0;
+  fe_sq(r.X, p.X);
+  fe_sq(r.Z, p.Y);
+  fe_sq(r.T, p.Z);
+  fe_add(r.T, r.T, r.T);
+  fe_add(r.Y, p.X, p.Y);
+  fe_sq(t0, r.Y);
+  fe_add(r.Y, r.Z, r.X);
+  fe_sub(r.Z, r.Z, r.X);
+  fe_sub(r.X, t0, r.Y);
+  fe_sub(r.T, r.T, r.Z);
+}
+
+void p3_dbl(GeP1P1& r, const GeP3& p) {
+  GeP2 q;
+  fe_copy(q.X, p.X);
+  fe_copy(q.Y, p.Y);
+  fe_copy(q.Z, p.Z);
+  p2_dbl(r, q);
+}
+
+void madd(GeP1P1& r, const GeP3& p, const PinnedPrecomp& q) {
+  Fe t0;
+  fe_add(r.X, p.Y, p.X);
+  fe_sub(r.Y, p.Y, p.X);
+  fe_mul(r.Z, r.X, q.yplusx);
+  fe_mul(r.Y, r.Y, q.yminusx);
+  fe_mul(r.T, q.xy2d, p.T);
+  fe_add(t0, p.Z, p.Z);
+  fe_sub(r.X, r.Z, r.Y);
+  fe_add(r.Y, r.Z, r.Y);
+  fe_add(r.Z, t0, r.T);
+  fe_sub(r.T, t0, r.T);
+}
+
+void precomp_cmov(PinnedPrecomp& t, const PinnedPrecomp& u, unsigned int b) {
+  fe_cmov(t.yplusx, u.yplusx, b);
+  fe_cmov(t.yminusx, u.yminusx, b);
+  fe_cmov(t.xy2d, u.xy2d, b);
+}
+
+unsigned int equal(int8_t b, int8_t c) {
+  const uint32_t x = static_cast<uint8_t>(b ^ c);
+  return (x - 1U) >> 31;
+}
+
+unsigned int negative(int8_t b) {
+  return static_cast<uint64_t>(static_cast<int64_t>(b)) >> 63;
+}
+
+// Constant-time selection of b * 256^pos * P for b in [-8, 8].
+void select(PinnedPrecomp& t, size_t pos, int8_t b) {
+  const unsigned int b_negative = negative(b);
+  const int8_t b_abs = static_cast<int8_t>(b - ((-static_cast<int8_t>(b_negative) & b) * 2));
+
+  fe_1(t.yplusx);
+  fe_1(t.yminusx);
+  fe_0(t.xy2d);
+  for (int8_t j = 0; j < 8; ++j) {
+    precomp_cmov(t, detail::PINNED_KEY_TABLE[pos][j], equal(b_abs, static_cast<int8_t>(j + 1)));
+  }
+
+  PinnedPrecomp minus_t;
+  fe_copy(minus_t.yplusx, t.yminusx);
+  fe_copy(minus_t.yminusx, t.yplusx);
+  fe_neg(minus_t.xy2d, t.xy2d);
+  precomp_cmov(t, minus_t, b_negative);
+}
+
+void ristretto_encode(uint8_t* s, const GeP3& h) {
+  Fe den1, den2, den_inv, eden, inv_sqrt, ix, iy, one, s_, t_z_inv, u1, u2, u1_u2u2, x_, y_, x_z_inv,
+      z_inv, zmy;
+
+  fe_add(u1, h.Z, h.Y);
+  fe_sub(zmy, h.Z, h.Y);
+  fe_mul(u1, u1, zmy);
+  fe_mul(u2, h.X, h.Y);
+
+  fe_sq(u1_u2u2, u2);
+  fe_mul(u1_u2u2, u1, u1_u2u2);
+
+  fe_1(one);
+  sqrt_ratio_m1(inv_sqrt, one, u1_u2u2);
+  fe_mul(den1, inv_sqrt, u1);
+  fe_mul(den2, inv_sqrt, u2);
+  fe_mul(z_inv, den1, den2);
+  fe_mul(z_inv, z_inv, h.T);
+
+  fe_mul(ix, h.X, FE_SQRTM1);
+  fe_mul(iy, h.Y, FE_SQRTM1);
+  fe_mul(eden, den1, FE_INVSQRT_A_MINUS_D);
+
+  fe_mul(t_z_inv, h.T, z_inv);
+  const unsigned int rotate = static_cast<unsigned int>(fe_isnegative(t_z_inv));
+
+  fe_copy(x_, h.X);
+  fe_copy(y_, h.Y);
+  fe_copy(den_inv, den2);
+
+  fe_cmov(x_, iy, rotate);
+  fe_cmov(y_, ix, rotate);
+  fe_cmov(den_inv, eden, rotate);
+
+  fe_mul(x_z_inv, x_, z_inv);
+  fe_cneg(y_, y_, static_cast<unsigned int>(fe_isnegative(x_z_inv)));
+
+  fe_sub(s_, h.Z, y_);
+  fe_mul(s_, den_inv, s_);
+  fe_abs(s_, s_);
+  fe_tobytes(s, s_);
+}
+
+}  // namespace
+
+Result scalar_mult_pinned(const uint8_t* scalar, uint8_t* result) {
+  if (scalar == nullptr || result == nullptr) {
+    return Result::InvalidInput;
+  }
+
+  int8_t e[64];
+  for (size_t i = 0; i < 32; ++i) {
+    const uint8_t byte = i == 31 ? static_cast<uint8_t>(scalar[i] & 0x7f) : scalar[i];
+    e[2 * i + 0] = static_cast<int8_t>(byte & 15);
+    e[2 * i + 1] = static_cast<int8_t>((byte >> 4) & 15);
+  }
+  int8_t carry = 0;
+  for (size_t i = 0; i < 63; ++i) {
+    e[i] = static_cast<int8_t>(e[i] + carry);
+    carry = static_cast<int8_t>((e[i] + 8) >> 4);
+    e[i] = static_cast<int8_t>(e[i] - carry * 16);
+  }
+  e[63] = static_cast<int8_t>(e[63] + carry);
+
+  GeP3 h;
+  fe_0(h.X);
+  fe_1(h.Y);
+  fe_1(h.Z);
+  fe_0(h.T);
+  GeP1P1 r;
+  GeP2 s;
+  PinnedPrecomp t;
+
+  for (size_t i = 1; i < 64; i += 2) {
+    select(t, i / 2, e[i]);
+    madd(r, h, t);
+    p1p1_to_p3(h, r);
+  }
+
+  p3_dbl(r, h);
+  p1p1_to_p2(s, r);
+  p2_dbl(r, s);
+  p1p1_to_p2(s, r);
+  p2_dbl(r, s);
+  p1p1_to_p2(s, r);
+  p2_dbl(r, s);
+  p1p1_to_p3(h, r);
+
+  for (size_t i = 0; i < 64; i += 2) {
+    select(t, i / 2, e[i]);
+    madd(r, h, t);
+    p1p1_to_p3(h, r);
+  }
+
+  ristretto_encode(result, h);
+  sodium_memzero(e, sizeof(e));
+  sodium_memzero(&h, sizeof(h));
+  sodium_memzero(&r, sizeof(r));
+  sodium_memzero(&s, sizeof(s));
+  sodium_memzero(&t, sizeof(t));
+
+  if (sodium_is_zero(result, PUBLIC_KEY_LENGTH)) {
+    return Result::CryptoError;
+  }
+  return Result::Success;
+}
+
+Result scalar_mult_prefer_pinned(const uint8_t* scalar, const uint8_t* point, uint8_t* result) {
+  if (point != nullptr && std::memcmp(point, keys::SERVER_PUBLIC_KEY, PUBLIC_KEY_LENGTH) == 0) {
+    return scalar_mult_pinned(scalar, result);
+  }
+  return scalar_mult(scalar, point, result);
+}
+
+}  // namespace ecliptix::security::opaque::crypto
@@ -0,0 +1,851 @@
+#pragma once
+// Generated by scripts/generate_pinned_key_table.py from
+// include/opaque/hardcoded_keys.h. Do not edit.
+#include <cstdint>
+
+namespace ecliptix::security::opaque::crypto::detail {
+
+constexpr uint8_t PINNED_TABLE_KEY[32] = {0x34, 0xc4, 0x46, 0x38, 0x47, 0x76, 0x16, 0x89, 0x71, 0x3e, 0x30, 0xbd, 0x33, 0x07, 0xa0, 0x05, 0xcb, 0x6f, 0x98, 0x99, 0x80, 0x50, 0x76, 0x1c, 0x6e, 0x0c, 0x76, 0x44, 0x58, 0x28, 0x12, 0x08};
+
+struct PinnedPrecomp {
+  uint64_t yplusx[5];
+  uint64_t yminusx[5];
+  uint64_t xy2d[5];
+};
+
+constexpr PinnedPrecomp PINNED_KEY_TABLE[32][8] = {
+    {
+        {{0x736986e6ec57fULL, 0x54c7d29c767f3ULL, 0x5daaea70987b7ULL, 0x31d3e94005e3bULL, 0x5faf2165f4a91ULL},
+         {0x11bfebf94e694ULL, 0x0fee24ae3545cULL, 0x35a72ac925e3eULL, 0x0dfa78c396624ULL, 0x697c5fbbba74bULL},
+         {0x10636f7bb6ae4ULL, 0x586cf330784bfULL, 0x4b40cecb4dceaULL, 0x2ef2e3cd5c103ULL, 0x55828994f7bafULL}},
+        {{0x1f334f9abf41aULL, 0x27e61ad3626d0ULL, 0x708768a7c006aULL, 0x23b4a7543d65eULL, 0x3e28e7997bf91ULL},
+         {0x3bf5ab44657d9ULL, 0x5c9c151bc00b9ULL, 0x57133713987a9ULL, 0x000199f3a149aULL, 0x17ed939b99298ULL},
+         {0x00a5b691707f8ULL, 0x2f2eb76c3ad7fULL, 0x536d1c3e5dbbeULL, 0x73ee1ac32d5c8ULL, 0x73189e5de8f33ULL}},
+        {{0x3b90c0dbac40dULL, 0x0bbaf84582fe5ULL, 0x0274e80484b5fULL, 0x1a8f0517e61d9ULL, 0x338378c7a60fbULL},
+         {0x4e55e2c5ef1d1ULL, 0x616d9f68bb0f3ULL, 0x124ccd437ce80ULL, 0x637c2bd7d8e07ULL, 0x329280ef44ae2ULL},
+         {0x1605be13e1cacULL, 0x7aed988b15780ULL, 0x350fb635c8891ULL, 0x1b7b960513989ULL, 0x7ad305611126dULL}},
+        {{0x6045c3da16befULL, 0x60978b259899bULL, 0x13517dd96c711ULL, 0x3ec5d12682d6bULL, 0x503758d7c3722ULL},
+         {0x5dd5c43e5e268ULL, 0x04bdf55db4109ULL, 0x5d605f3c92a4bULL, 0x7ef25240de396ULL, 0x78d392694b46cULL},
+         {0x704e06acd42afULL, 0x053464f0ec417ULL, 0x5b9acf0521824ULL, 0x79864439c0deeULL, 0x520635eb973b1ULL}},
+        {{0x391e09370c7fbULL, 0x60c59dd9aa297ULL, 0x1621dbab03096ULL, 0x7967d200a7158ULL, 0x34a752f2bec0aULL},
+         {0x68d1e2439415aULL, 0x74890ab61919cULL, 0x5e796b25a9bf1ULL, 0x08f03117e2788ULL, 0x7ffaae2c968c3ULL},
+         {0x08a1f6a245116ULL, 0x680fd47952b08ULL, 0x2062f9acc44b5ULL, 0x22fd306b200fbULL, 0x05c7719451f5cULL}},
+        {{0x25beb3668967aULL, 0x087a7dccf245bULL, 0x1d44ce7101d9eULL, 0x024403a476b52ULL, 0x29bf32939df28ULL},
+         {0x43868bd7b5b2bULL, 0x23d8b909b3b4bULL, 0x488a1696aa80fULL, 0x43708fdb1ca8dULL, 0x3af3b9f5d8463ULL},
+         {0x48c599331cacaULL, 0x1023e7da5ce3cULL, 0x711714a4f9a92ULL, 0x63ae617502d69ULL, 0x713674056143cULL}},
+        {{0x54405c55e3675ULL, 0x3e52bc009c741ULL, 0x288dcc16acabdULL, 0x506e3ae5ebb93ULL, 0x25b287cc6e670ULL},
+         {0x5a5e94660ae01ULL, 0x4dfc2309ac11cULL, 0x2440b9c2f9b5fULL, 0x63c25e5200b33ULL, 0x6f407bc0e4ad1ULL},
+         {0x6f4d7fa78b90dULL, 0x02ab915bbad8aULL, 0x06750d307ba7eULL, 0x58a56e9ba01caULL, 0x31dcba58553c6ULL}},
+        {{0x3d6743f0d046aULL, 0x373a8f9eb1de1ULL, 0x2856c0999fac8ULL, 0x7549efb2794beULL, 0x4d37fbc88840bULL},
+         {0x5f11b989a807cULL, 0x3ffb772543e63ULL, 0x690125cb94b13ULL, 0x3976ab6b4bc43ULL, 0x6cee75530eae7ULL},
+         {0x67d44230d7e02ULL, 0x20139d6736b07ULL, 0x21a573f5f15e7ULL, 0x54f4560cfd221ULL, 0x4faa1f543d103ULL}}
+    },
+    {
+        {{0x584fb21902e20ULL, 0x0386cd47440bfULL, 0x1b0272c7c6833ULL, 0x287cc7329ae18ULL, 0x6859299cba26dULL},
+         {0x4867aaed44ef8ULL, 0x309bbf778de87ULL, 0x793f5eec589c1ULL, 0x2569bb50a79d0ULL, 0x5c5ee2d4dbebeULL},
+         {0x4b7708aef8ed3ULL, 0x0cd51069535b6ULL, 0x21b24a6a6e3bfULL, 0x23e562ec8a061ULL, 0x79182994c37f4ULL}},
+        {{0x47ed2fc070f5bULL, 0x645e12c0af324ULL, 0x49f7db432dc53ULL, 0x2604e41150caeULL, 0x36776859bd152ULL},
+         {0x2881cd5743f28ULL, 0x1bad331067d4cULL, 0x129aa68c2af77ULL, 0x76855782b642fULL, 0x3fbf72bd75786ULL},
+         {0x4e5f0597a19e1ULL, 0x1a65bddbeff5bULL, 0x322decc933c19ULL, 0x2d7cc685db04fULL, 0x0a5eadae77810ULL}},
+        {{0x3f31ac830f4e0ULL, 0x17a3a8d5ee82aULL, 0x393dc5eb8ee6dULL, 0x750010906a663ULL, 0x116bd28aae5a0ULL},
+         {0x720cbb6cc895fULL, 0x47ddd2d005e7dULL, 0x5876392bb4efbULL, 0x6211608c1e13bULL, 0x0bf6500853e58ULL},
+         {0x064d7d8d31a64ULL, 0x1d11a5cda48dfULL, 0x762c0dd9d0d16ULL, 0x50adfdb42e09dULL, 0x2275936d017a0ULL}},
+        {{0x29a560e2d1173ULL, 0x4498465541810ULL, 0x71a79cd0f650cULL, 0x6f5e91dfee1b5ULL, 0x4e44abe51e5d7ULL},
+         {0x6329413f43f1bULL, 0x33eeee74cf006ULL, 0x0f00ccf64f1efULL, 0x4355426563f46ULL, 0x17bc40fb5b620ULL},
+         {0x78622ac188027ULL, 0x1a31358fc29b8ULL, 0x7ed9e1c93d42bULL, 0x771d712365020ULL, 0x0b5319380a24aULL}},
+        {{0x5c8f2c8dbcc0fULL, 0x6e79fc9717aa7ULL, 0x58d628551b6b2ULL, 0x6760f09076b68ULL, 0x4bd61411dc1a7ULL},
+         {0x4296124420abfULL, 0x7954255f57915ULL, 0x15a4026b32b7dULL, 0x1091a7dbace4eULL, 0x02c192bcd5f1aULL},
+         {0x3d3248fe61094ULL, 0x053cda5a50544ULL, 0x4fac3735b15ecULL, 0x540c450d795a5ULL, 0x5cfd726b09d9eULL}},
+        {{0x00c46357fcde6ULL, 0x2a1b2c002eda5ULL, 0x1e9c7a7c79d46ULL, 0x7d16b00ca7ab6ULL, 0x7b3460e4b2762ULL},
+         {0x5632b71febfafULL, 0x2d0d752a2b0c0ULL, 0x58687650cd507ULL, 0x3339afdfe3f75ULL, 0x7a6786576d094ULL},
+         {0x1fdfc07a47ae4ULL, 0x3b50b53326a4dULL, 0x1b0c0fa829dceULL, 0x3a63dab0c95a5ULL, 0x41e1bf4f535d8ULL}},
+        {{0x2d700612b0480ULL, 0x4763d93a8837fULL, 0x50c4e7a61f784ULL, 0x331698a13c7b6ULL, 0x110d9b664262bULL},
+         {0x6152964b3cae6ULL, 0x0cfd8c5385240ULL, 0x47e131a658277ULL, 0x5bdceb41ad073ULL, 0x6d1db6d9fbfdaULL},
+         {0x5ccfbb6894307ULL, 0x4a44eff143b24ULL, 0x66f1db7264eb3ULL, 0x2b40dee1e01a1ULL, 0x3a39b6e716571ULL}},
+        {{0x67a76bfa0f82eULL, 0x5e98f23e298e3ULL, 0x556d7b8a2e775ULL, 0x709ea7bae406eULL, 0x02fb39f0e5d07ULL},
+         {0x4e399019f3100ULL, 0x60541a8dab17dULL, 0x3f88ef11f4912ULL, 0x024ae5fe9ebcbULL, 0x7d147cb2e14efULL},
+         {0x39a4c39501216ULL, 0x62b90e01147f6ULL, 0x116fe9e5b7abaULL, 0x25c18d1a1f53eULL, 0x1f4e262755d54ULL}}
+    },
+    {
+        {{0x3a47aef2e1b74ULL, 0x30be553771bc1ULL, 0x487f8beb14295ULL, 0x65312f1fbd01aULL, 0x0dca33286caa5ULL},
+         {0x1ab6e8870389fULL, 0x6c07c4ac4718fULL, 0x269bffbe574a2ULL, 0x4e3f7fe227e84ULL, 0x20398cc4c197aULL},
+         {0x1d92fa5777465ULL, 0x1fe8d915894abULL, 0x45863779278f8ULL, 0x62325b5a34a5cULL, 0x3585052649c25ULL}},
+        {{0x1e203fbd3a87fULL, 0x700393bfb9ba3ULL, 0x74fc21d664570ULL, 0x0d5ae04517fc6ULL, 0x530b3efd6d33cULL},
+         {0x4de86f86206b1ULL, 0x1d532d503e68bULL, 0x73fe7c7f97366ULL, 0x0dcba164750d4ULL, 0x1af46792a633fULL},
+         {0x13c6bff8a1aaaULL, 0x7dbd6a7c3eecbULL, 0x2b300f9246c0aULL, 0x4c96510f38868ULL, 0x2686c6f8a0cacULL}},
+        {{0x5ac3c325f1566ULL, 0x487ed04ba8d07ULL, 0x33f69fa8f0f15ULL, 0x14a5712b1c5b1ULL, 0x3107d5235a6caULL},
+         {0x79f9cb613a7eaULL, 0x629b7bda2c882ULL, 0x37be153f3dd9bULL, 0x678d8b1f1ed19ULL, 0x109c5101544c7ULL},
+         {0x56665a9c80a37ULL, 0x30861ad433daaULL, 0x10c94d24683a3ULL, 0x11cca011a9896ULL, 0x60ec6ad98447fULL}},
+        {{0x7d0d9ca83c103ULL, 0x6878dca2e03a1ULL, 0x2a5fe1e6aa732ULL, 0x4efd1e73cd12eULL, 0x2f41845787c81ULL},
+         {0x450a6dc74b8d9ULL, 0x1f3a91cc1ef7bULL, 0x3962716ac95c0ULL, 0x13f6e54a010c2ULL, 0x723f9ba35473cULL},
+         {0x1740ec3b3fc45ULL, 0x06ce80fd8ccd8ULL, 0x6909f8d4424d6ULL, 0x4a4e7ae55e466ULL, 0x4ce000aff9d60ULL}},
+        {{0x0aaad9385b18fULL, 0x21a31338261f5ULL, 0x047fac9d7f99dULL, 0x718459d788ae8ULL, 0x1caa2b52b00bfULL},
+         {0x0cb74f6346b8bULL, 0x0f73edb96e35aULL, 0x6ce939434708bULL, 0x5f2fe971940e7ULL, 0x4669d64bf60f4ULL},
+         {0x26a417df8b52dULL, 0x3cc8422f8935dULL, 0x1928587e3b8ddULL, 0x3bc0bc038b517ULL, 0x5b7033f26d1b3ULL}},
+        {{0x089f9a3cfd188ULL, 0x666cec2a05f6bULL, 0x3935f19574c74ULL, 0x2fcc89d31860fULL, 0x6db9e74b43b9fULL},
+         {0x5ece6e9a7ff8aULL, 0x10c760eb2f500ULL, 0x32453a94b4fedULL, 0x1c6f55103f62aULL, 0x45813b683da47ULL},
+         {0x77e8b4d5a5b9cULL, 0x32f2c5cebc900ULL, 0x798221aabced1ULL, 0x59be7527a0d58ULL, 0x4b2c26e266172ULL}},
+        {{0x6408fdd50dca3ULL, 0x64c753b46ed6cULL, 0x1c69082384c5fULL, 0x2c8d4852a420bULL, 0x5ddcf989c339eULL},
+         {0x54c53cf8aecd8ULL, 0x5ddf639155427ULL, 0x3af39240878a6ULL, 0x3f0d38076a5c9ULL, 0x35b5d6f66e540ULL},
+         {0x1d45d4fc60376ULL, 0x49d78870319a1ULL, 0x7e5e6504c6855ULL, 0x40c59c56c4c2dULL, 0x26818f2b6b695ULL}},
+        {{0x57fee13267780ULL, 0x2badf3a9a83d0ULL, 0x018ff506e043cULL, 0x124a81a18daadULL, 0x22b3ea8844c31ULL},
+         {0x2a91fcf577575ULL, 0x17a124e024a04ULL, 0x1dd6a0623c53fULL, 0x262f719a1d0b2ULL, 0x50332e88f4a31ULL},
+         {0x4bcea019c47d9ULL, 0x54c2d1e3925d8ULL, 0x7c3276925f3dbULL, 0x6d3d513d4f489ULL, 0x373e4216f72efULL}}
+    },
+    {
+        {{0x4a19d598f948bULL, 0x08ad92e10d708ULL, 0x6316c4e41ff9bULL, 0x5539e3eeee374ULL, 0x6a8657fe214a5ULL},
+         {0x1500166931175ULL, 0x57b934816e6a2ULL, 0x70dfd5a9d0bd5ULL, 0x5c8a2aa634aa4ULL, 0x3fd8d2aa66f90ULL},
+         {0x6ab8b67d3f9ebULL, 0x42508c72b3dcdULL, 0x3722832675c8dULL, 0x6b6a70aff08e9ULL, 0x20574df738e68ULL}},
+        {{0x4d9487456e704ULL, 0x066d8bcf9efceULL, 0x73ebeea347e7dULL, 0x76a93c3092ef5ULL, 0x40399155f3a17ULL},
+         {0x496ddd908bd2cULL, 0x4a4833a5457caULL, 0x48cff93d1822dULL, 0x560c0089bd5fcULL, 0x5574a0cb6e74cULL},
+         {0x596542c87b21fULL, 0x4ca4afde059c7ULL, 0x14e4662efe0c6ULL, 0x4bdf8f53c6015ULL, 0x225d8e527d2dfULL}},
+        {{0x064a935a8e0dbULL, 0x124c9dfb8be72ULL, 0x3b604ed30a9abULL, 0x2d926fd1ef53dULL, 0x3086e5c70c077ULL},
+         {0x7f8ef07c9f5e4ULL, 0x4610d5efcb4dbULL, 0x654624f6ab1c4ULL, 0x1b30161376b93ULL, 0x61150d7689fa5ULL},
+         {0x0f42b6f8611e0ULL, 0x246b0d2ac7f7bULL, 0x16b9094134b57ULL, 0x5b9d32c38a1edULL, 0x57a25cf812d07ULL}},
+        {{0x40a3a5cd5c764ULL, 0x1f539ad7d785cULL, 0x2d4869ee6ad8bULL, 0x29835bb792426ULL, 0x2c7ddbc634a8fULL},
+         {0x079b52e9dde83ULL, 0x3ea14d2c02ed2ULL, 0x37bf114635ff9ULL, 0x55cf0c797277cULL, 0x57f459e1a4955ULL},
+         {0x391ebe889ae8cULL, 0x7439408dd9c3dULL, 0x6ed1241974a4fULL, 0x6d4f2265657d9ULL, 0x7584a72a3b228ULL}},
+        {{0x0b8fea99f24f9ULL, 0x5aad355c654feULL, 0x226510a5f506bULL, 0x58f53cd4fcc92ULL, 0x232a8dc60edf8ULL},
+         {0x1841bbcf1189dULL, 0x6c8cdfec2fd9aULL, 0x588b0df427978ULL, 0x28f59c499d936ULL, 0x06e317ae8c1e0ULL},
+         {0x414587e61ad27ULL, 0x5526d0f3aa938ULL, 0x7827709bc03daULL, 0x7d0c549fe7d5bULL, 0x5286b610dad39ULL}},
+        {{0x50f756ae651b8ULL, 0x7f741aff88edbULL, 0x79bece3804bb1ULL, 0x380d80f8df0eaULL, 0x29e986f9ca44dULL},
+         {0x356ebd08f3322ULL, 0x7743e44f14a34ULL, 0x355043065dcd0ULL, 0x76fa55c69228eULL, 0x1b0ea056e1163ULL},
+         {0x2fa1df0ef7103ULL, 0x1b7c2b5f05ed1ULL, 0x78bc204433ef5ULL, 0x266ea037b9bf7ULL, 0x425f42272f3c1ULL}},
+        {{0x333113165ddebULL, 0x6f8a2f7a042a4ULL, 0x7abd424acd2acULL, 0x051ee7411ad2dULL, 0x7dc97b71702a4ULL},
+         {0x3c5f7d8e99829ULL, 0x78c3aa045579aULL, 0x4c0fff8b5a27fULL, 0x24e948573b2b8ULL, 0x2f94e8bc9f8ebULL},
+         {0x3410ff84527fdULL, 0x6b9476363e149ULL, 0x65068f1a5fbe9ULL, 0x5df5d1426b4a4ULL, 0x2b30e9403ea1fULL}},
+        {{0x5c8e170fa6d6cULL, 0x498bb6eac3061ULL, 0x0be8a2acf47c5ULL, 0x49562af5b4d19ULL, 0x4250563b15ce0ULL},
+         {0x27efdbbacf548ULL, 0x70343f322b989ULL, 0x53dac36d5e13aULL, 0x6454c1814a7baULL, 0x14ede900cb2b8ULL},
+         {0x2618ea00ef6f3ULL, 0x73f60d2395082ULL, 0x5843c9f9cea8dULL, 0x04bc1e2bffde2ULL, 0x5da912d80f9ffULL}}
+    },
+    {
+        {{0x4405f1d486e09ULL, 0x71d6cf00e6cf9ULL, 0x342ba254c22e3ULL, 0x536b2cababa79ULL, 0x4739adf5a9558ULL},
+         {0x58512079de896ULL, 0x42019244b65a8ULL, 0x745684951efb9ULL, 0x6583abf0abf3dULL, 0x0d29f9a6fb644ULL},
+         {0x5cc23c8912ad6ULL, 0x5e7b55d2bbb1fULL, 0x7ab5f640d9bd4ULL, 0x18073420418ddULL, 0x1c071b5adf1d3ULL}},
+        {{0x71ce0c13e0d39ULL, 0x1331355a33318ULL, 0x3da2358900a6fULL, 0x0e305faffa812ULL, 0x3faae98746fb3ULL},
+         {0x45ed7f37805ebULL, 0x2096ca17d9bc9ULL, 0x6d4e623d74bf0ULL, 0x46c5fb83ef873ULL, 0x1402a303b972aULL},
+         {0x32e70e549e6a1ULL, 0x427d591ba4661ULL, 0x5c2947436f83bULL, 0x6cf622d5c5ad4ULL, 0x493c0d1989bafULL}},
+        {{0x0f097303ff891ULL, 0x01079c5b7e10bULL, 0x4e2c27f0ec912ULL, 0x680b4fb31ce55ULL, 0x3c0bfca7dba29ULL},
+         {0x4a980e404f626ULL, 0x12c8ffeae7120ULL, 0x773ddf36688a9ULL, 0x76696a04350e9ULL, 0x59bdbbf67dc82ULL},
+         {0x2e0de2feab505ULL, 0x1b2081bc2d05cULL, 0x26fe3ddb2c83dULL, 0x443e42592ee89ULL, 0x012ec893a816eULL}},
+        {{0x6e4007b02503cULL, 0x25220f4d4dd9bULL, 0x1307f90dfd76eULL, 0x751fcd9c15b7dULL, 0x5114f86c6e3cdULL},
+         {0x18dc10fa8313cULL, 0x27f309e53c0edULL, 0x019e3ee3768c5ULL, 0x65faffc8949aaULL, 0x688cd4507b166ULL},
+         {0x200e144132269ULL, 0x375c1779b65dbULL, 0x75769282ec7e3ULL, 0x0bd693a278baeULL, 0x0221f3f7ee347ULL}},
+        {{0x5bc168c83aa26ULL, 0x7f50d4ed9688fULL, 0x0094c27004d63ULL, 0x6d2f63cbc46e9ULL, 0x2f689eadb15eeULL},
+         {0x45e646c16c455ULL, 0x585348d7e2b25ULL, 0x08bf57ae9403fULL, 0x5188f850d096aULL, 0x615a8f60522caULL},
+         {0x2cfdd151beea9ULL, 0x7cf16842f6543ULL, 0x0a3d0d2c08edeULL, 0x3243d7346f5d0ULL, 0x43b68ff2b6825ULL}},
+        {{0x37cf396c810cbULL, 0x6c46ea96091b9ULL, 0x4467453b9c8e8ULL, 0x152bb725facbdULL, 0x0bae0ac69a41dULL},
+         {0x70d388bae2645ULL, 0x555f4f50e7f7dULL, 0x4a354018f5794ULL, 0x60a42a14e4e02ULL, 0x6ee92139cad23ULL},
+         {0x6f87347b8afa3ULL, 0x1157429600a95ULL, 0x0307f9c49b70bULL, 0x644eb7a6f8254ULL, 0x1b644ff8c6b80ULL}},
+        {{0x0061015786dc6ULL, 0x29367ad822e12ULL, 0x16232597dff10ULL, 0x4e27b85e5b3a9ULL, 0x2de0f8b898065ULL},
+         {0x01dcd53e208e6ULL, 0x3129e526ed512ULL, 0x2d19c76c94e0cULL, 0x2bf77a5c6791bULL, 0x171943d162593ULL},
+         {0x4c4ac31f9c59bULL, 0x2b402a76c624fULL, 0x41ac0cb042429ULL, 0x51c8b17de857fULL, 0x7147da73c735dULL}},
+        {{0x72f41bc6acef7ULL, 0x2d68e5ce228ecULL, 0x779d8bf4cf457ULL, 0x630bfa9375efaULL, 0x3cb9ae34b202aULL},
+         {0x55d431b527fe8ULL, 0x02d1aaac26831ULL, 0x7242687843428ULL, 0x380ae1de06c71ULL, 0x1345acd33c42dULL},
+         {0x7361f0b7f1190ULL, 0x326daacb7d297ULL, 0x0934d5560acefULL, 0x11b559c04f4ccULL, 0x11199ee0c2051ULL}}
+    },
+    {
+        {{0x3b0714c0df23bULL, 0x51ccaa14f1f9bULL, 0x539e3ced53dc2ULL, 0x03d8958a3e4b6ULL, 0x3c94c7383e353ULL},
+         {0x0994c6cc1d906ULL, 0x779f95fe6ba22ULL, 0x4195ef8748482ULL, 0x08cffc5da4aa2ULL, 0x52484ef715d76ULL},
+         {0x32669beb2784cULL, 0x4ba3d33498c49ULL, 0x72764bc5532ecULL, 0x277697638b9fcULL, 0x49783c6471d38ULL}},
+        {{0x4b53177f858efULL, 0x28b7b27494ed2ULL, 0x181a32c91f81eULL, 0x42285ced92e50ULL, 0x2a7364d81c31fULL},
+         {0x15d31440be2bfULL, 0x7c5c24f22e153ULL, 0x5b0313ff5f58dULL, 0x486338731edd4ULL, 0x08622d03987e7ULL},
+         {0x3db92a3934e53ULL, 0x07a9a5f1f0173ULL, 0x5c273d8c3cf98ULL, 0x6269c446e2ac3ULL, 0x733e4e16f3b3cULL}},
+        {{0x0fba527029387ULL, 0x19a7699169faeULL, 0x6a14d77b741e3ULL, 0x5d27870b89495ULL, 0x61c5a7854e372ULL},
+         {0x401b7a588926fULL, 0x323ee0ee955b0ULL, 0x6477f630f7578ULL, 0x55d71d5e8eb7cULL, 0x6767e8ddbb898ULL},
+         {0x5986ab4652485ULL, 0x5e5894c86c1f5ULL, 0x498d406d312faULL, 0x7d68422888756ULL, 0x70d4fa1a21ca1ULL}},
+        {{0x003952fd036e2ULL, 0x60ff8a477667eULL, 0x098befff1e7f7ULL, 0x01759f0d88553ULL, 0x4cbf22439dbf9ULL},
+         {0x1af212b67c1ceULL, 0x398d101dc1773ULL, 0x43038fda6e787ULL, 0x3ee52cd35f6b9ULL, 0x4572d311bc91fULL},
+         {0x438d71ee43188ULL, 0x24861578a6cd3ULL, 0x60004de0f7824ULL, 0x2c195b407bc6bULL, 0x6f08d191230b7ULL}},
+        {{0x0ec3361d75a16ULL, 0x3c9917cbb46c0ULL, 0x5cf45124fe51bULL, 0x212abb9a8def9ULL, 0x605eaa7ab8153ULL},
+         {0x3dc38ee2fd94eULL, 0x0fe12c6f93a25ULL, 0x0fb069392aa62ULL, 0x21857954705afULL, 0x7d78894dfcb04ULL},
+         {0x1d4b2ab5d554aULL, 0x05e6378493b5bULL, 0x6d38ac75bd820ULL, 0x4fe141ef080bdULL, 0x118ac3099fe1eULL}},
+        {{0x4b730c2e7fd24ULL, 0x3ce7d3a969965ULL, 0x0df7c997fddd8ULL, 0x424c474a3cdd2ULL, 0x5d646c4f09030ULL},
+         {0x35abb2f4318b3ULL, 0x441ee30155dd7ULL, 0x34676450e2d48ULL, 0x6bc0ec14beeffULL, 0x7dbacabf56cc0ULL},
+         {0x24187032f552fULL, 0x3208fd2d47230ULL, 0x1c723c12bf5c8ULL, 0x730a959f234b3ULL, 0x3a47ea7763e80ULL}},
+        {{0x0439d88a6f7edULL, 0x43739daae4f09ULL, 0x507fc78ffd56eULL, 0x201f8f5077785ULL, 0x3879b36d9648fULL},
+         {0x468fee93dcaccULL, 0x66a1c19898802ULL, 0x091798c3008cfULL, 0x2b74b72690374ULL, 0x7b51e959cb3cfULL},
+         {0x13ad2053bad33ULL, 0x7305bac5274e4ULL, 0x0bdc66129e423ULL, 0x7c3f02c1e9154ULL, 0x5839afccc291eULL}},
+        {{0x5255137a1cc42ULL, 0x041f6fd5333a8ULL, 0x7a270d2f46b03ULL, 0x4283f885f9418ULL, 0x07cb25821535bULL},
+         {0x6734d41f4373aULL, 0x228f1b63d0b1bULL, 0x77bc59a84c27aULL, 0x782979c73030bULL, 0x24773b87abadcULL},
+         {0x157bdea819c52ULL, 0x507edd2318852ULL, 0x0f646cd246997ULL, 0x5c59a660f253bULL, 0x0151082d21053ULL}}
+    },
+    {
+        {{0x0d79ef0d99f36ULL, 0x0e25e5a7364feULL, 0x1f33c620e4294ULL, 0x65df5e263d28bULL, 0x70f46bba7cbf7ULL},
+         {0x6ae36d4d4f639ULL, 0x7186b95e2eb67ULL, 0x520476923618eULL, 0x309b4d867fd61ULL, 0x3bcaa1c24353bULL},
+         {0x0ee80d9255001ULL, 0x39c0b1b67cb44ULL, 0x70a00a88345ceULL, 0x32b04c70286adULL, 0x2a6180f3b7edfULL}},
+        {{0x1d834a45e2963ULL, 0x68161429d61edULL, 0x2417ac6deec51ULL, 0x4d753b3d7e692ULL, 0x29cf3b916ad40ULL},
+         {0x6e6bc4bd4530cULL, 0x313dcb1863f43ULL, 0x28c54a0757611ULL, 0x0bd6a4d9c2f98ULL, 0x076f232329d2fULL},
+         {0x0fbcb2336b892ULL, 0x2b094061a7af4ULL, 0x57ec8833ff2adULL, 0x0542db9013998ULL, 0x36aee1f073f38ULL}},
+        {{0x6c870516d3be7ULL, 0x5ae760e16de79ULL, 0x6af8a0048b87cULL, 0x2a46e6fec6f3aULL, 0x7133b42aa3336ULL},
+         {0x1a22cd7b137f8ULL, 0x47e192f274061ULL, 0x2290f749f1af3ULL, 0x6fa271018095bULL, 0x010cc419a8ef2ULL},
+         {0x2ec7737d6bfc8ULL, 0x42457ca09b5cfULL, 0x48d783b8a44f8ULL, 0x16f9ddad8ba2fULL, 0x2bef2b4fd5a39ULL}},
+        {{0x444b383fb27b4ULL, 0x48e0b9fcabd1eULL, 0x2dd7176b76967ULL, 0x34e369a5fca7eULL, 0x79237fb914d22ULL},
+         {0x21cb50c529766ULL, 0x33feea0bce248ULL, 0x3fc5e5df036d2ULL, 0x4e31ec16f488fULL, 0x1a598cb6ef202ULL},
+         {0x6f9505698ab8fULL, 0x240a7177eb223ULL, 0x397d11551a676ULL, 0x0b4622e64c4b7ULL, 0x55adb86cb3c1aULL}},
+        {{0x39f3c735e650cULL, 0x670537ff8f2b6ULL, 0x0bd23b5364ce3ULL, 0x58b4489d5d7e9ULL, 0x21de9501c25feULL},
+         {0x420c2413a2c90ULL, 0x4b01c78a303bbULL, 0x48a2f8fa7fadcULL, 0x0ca5ca2252f66ULL, 0x3feb44856bac5ULL},
+         {0x723fa1a93940dULL, 0x3aaba920a7495ULL, 0x4a94482828388ULL, 0x2eaf81d4a02c2ULL, 0x32022a23129cfULL}},
+        {{0x6e33cc5922bfeULL, 0x0aac66dce95efULL, 0x31c48a4d9a213ULL, 0x5d486877e9f36ULL, 0x6e45cad14ee62ULL},
+         {0x0d14135a28ea5ULL, 0x31e9cfaa6a868ULL, 0x5fc1b633d8246ULL, 0x1da97f3694bf6ULL, 0x4b14a62ccd337ULL},
+         {0x689aff76df5dbULL, 0x2eac747299e70ULL, 0x543ebbe000f87ULL, 0x11700f9cb15e7ULL, 0x3669c3b2f7719ULL}},
+        {{0x65e6b6c05e4a3ULL, 0x6027c245b53a4ULL, 0x5bc99a118e924ULL, 0x3dc864a02f9c8ULL, 0x783316f58bc29ULL},
+         {0x067dd09e5b259ULL, 0x01626fd2df17dULL, 0x71494fb2c60bdULL, 0x12387488e4c1eULL, 0x619ac7933e5d2ULL},
+         {0x12c00ce6995e1ULL, 0x6022c9cd8d517ULL, 0x5ab4fc313c845ULL, 0x5b453033516afULL, 0x505a3918f2253ULL}},
+        {{0x1a096b4314eb8ULL, 0x113aaae9fcad5ULL, 0x22a8e4875e869ULL, 0x00748abc75cf1ULL, 0x0e99467297940ULL},
+         {0x715f83e875040ULL, 0x69f3259e1195dULL, 0x3f3609fdd120fULL, 0x747a6b8e6f0e2ULL, 0x3b69e501c1635ULL},
+         {0x1b59b8ed85057ULL, 0x705398135f69fULL, 0x25a14edb1c137ULL, 0x3f5f040145eb7ULL, 0x7845ac6dbce7cULL}}
+    },
+    {
+        {{0x0c5fc99329ea3ULL, 0x7ba91df5dbe12ULL, 0x295874f9d791eULL, 0x2f9aba839f860ULL, 0x27a54a45133d8ULL},
+         {0x1bd6b6255df85ULL, 0x3b3730c03b35bULL, 0x6edd3bb484f2dULL, 0x2491fed3d2c8dULL, 0x171ad7cb61f7dULL},
+         {0x41ef25399c3a8ULL, 0x19b60ebcbf7f5ULL, 0x2365b57121c80ULL, 0x096012988a9f4ULL, 0x718fb24c0826eULL}},
+        {{0x4d50f3b4576d1ULL, 0x385700a2c30baULL, 0x03b525e76e492ULL, 0x1a0b92aedd6daULL, 0x13d3b21965c78ULL},
+         {0x1472cb1a8b05bULL, 0x61534d1bf01d7ULL, 0x4df354e382b41ULL, 0x1204f15c17ec1ULL, 0x10b1e3ceb8cd9ULL},
+         {0x3c91bc10ea007ULL, 0x519873fbc1fd3ULL, 0x00cfe0c96ae16ULL, 0x75ddd0f62a03cULL, 0x27ce552cc69e9ULL}},
+        {{0x600f68202e29eULL, 0x0e6741b381b65ULL, 0x42761414dbcb5ULL, 0x5d88e65a2162cULL, 0x3471b04690344ULL},
+         {0x2daaa45292bdfULL, 0x42af3a01512cbULL, 0x16520bf454a55ULL, 0x628a3ac12777fULL, 0x482e21b2f3c57ULL},
+         {0x46df332fec1dfULL, 0x3544e8a20f744ULL, 0x446a94083129eULL, 0x0caa44138dbadULL, 0x302cad33656d2ULL}},
+        {{0x70c9d5d169628ULL, 0x102773bd6acf0ULL, 0x4bc040fb91513ULL, 0x5c76a4b79f407ULL, 0x5c73ea058ba8bULL},
+         {0x160da52a19ff0ULL, 0x56ec6030e9fc9ULL, 0x20282191f352aULL, 0x4074f6aaed26eULL, 0x5db010769bdedULL},
+         {0x05e57b5c0e27aULL, 0x5b2fe41a3db95ULL, 0x27fd5ea4eda41ULL, 0x518c64017cc92ULL, 0x6994e9e064092ULL}},
+        {{0x6902fc95e883aULL, 0x1ec4e86249fffULL, 0x4438e4067b7d2ULL, 0x58372f7e274e8ULL, 0x5371a50b11332ULL},
+         {0x21fb220aea88fULL, 0x77ede626b76bcULL, 0x06965336656a4ULL, 0x150c83c7fb275ULL, 0x3c1b18b9adfd0ULL},
+         {0x38970eec6cbdcULL, 0x60076e04d4891ULL, 0x0f44a561d95feULL, 0x2677cf717ed1dULL, 0x6ac1fea54c52dULL}},
+        {{0x75eef87c3ea69ULL, 0x09e9ea27fccedULL, 0x43926e5975200ULL, 0x73d05b20d699aULL, 0x52c8e11136648ULL},
+         {0x1ade85c31287eULL, 0x19d2e1cefdc22ULL, 0x1737e5ef13c06ULL, 0x135c3b55c8a47ULL, 0x7b1f8824151efULL},
+         {0x1ccfc1cb3b110ULL, 0x13853231c0991ULL, 0x4ee8ce2246342ULL, 0x67855e2e7fae3ULL, 0x520f6dc529300ULL}},
+        {{0x53fcff5f48917ULL, 0x6e046b7a37feaULL, 0x19a2df43f741fULL, 0x7ae51b737c9b0ULL, 0x3db865fe2a360ULL},
+         {0x7572c27d9e64dULL, 0x3867e59a83840ULL, 0x2fb50a245e619ULL, 0x2e91859d32fe9ULL, 0x2c0f0df669388ULL},
+         {0x34cf63ed2a470ULL, 0x09cfa44d364b1ULL, 0x2d8fed3a73e4aULL, 0x47280a39c69e5ULL, 0x63b5f3acc7d90ULL}},
+        {{0x6ebecbed462fcULL, 0x1aaa3118fbc31ULL, 0x172cdf5cf19bcULL, 0x29df84ed343d1ULL, 0x521415661cfd9ULL},
+         {0x51cb4bdee271cULL, 0x762b74efbe50eULL, 0x722684e042a56ULL, 0x4278879f30799ULL, 0x1a15aeee11375ULL},
+         {0x25307735e3af5ULL, 0x02f4688f3c9e3ULL, 0x4b459675b1928ULL, 0x6e1f878c34a12ULL, 0x5d95ca1ec8993ULL}}
+    },
+    {
+        {{0x4feb68087e69fULL, 0x744c45c4203edULL, 0x1f3e79fddc7bdULL, 0x27cbaeeb239cfULL, 0x389b4c26461e4ULL},
+         {0x637de8f47ccc0ULL, 0x76784637082cfULL, 0x4bf4486d2cc94ULL, 0x34b87824079feULL, 0x7d523bac453f6ULL},
+         {0x6e03a94cae68eULL, 0x2ac5943761760ULL, 0x0dd4e38879dedULL, 0x389ad234cb6a5ULL, 0x45bd09964ff84ULL}},
+        {{0x47533d37331bdULL, 0x73926f2f32f86ULL, 0x17bdb0deda45cULL, 0x28c0cb8cf8686ULL, 0x6f35ee20791beULL},
+         {0x47533070a4f7aULL, 0x49daefbbe386fULL, 0x66a166f7f5a6eULL, 0x29f091972f8cfULL, 0x2e94913a81bbbULL},
+         {0x6b980c32fa400ULL, 0x7694c0d2028b3ULL, 0x417abc1f1ecadULL, 0x33899e70af039ULL, 0x34aeb26ee07aaULL}},
+        {{0x5324bba449156ULL, 0x748682b491988ULL, 0x1e72b90386943ULL, 0x46a3f19b383f7ULL, 0x16b6f80709888ULL},
+         {0x01956d3ab8e11ULL, 0x0b7201c4920daULL, 0x2f7a3f60c7f0aULL, 0x785bb1d7b019bULL, 0x5f02baac99d0dULL},
+         {0x45f685c7959b1ULL, 0x45f1d270c6204ULL, 0x4bb3f26445ad2ULL, 0x339a8500cda6cULL, 0x2266a5684aaaeULL}},
+        {{0x52ace0d661215ULL, 0x2d6b89087233eULL, 0x71cddfbb3a5b2ULL, 0x536a0201dc0c4ULL, 0x6eed618e33effULL},
+         {0x726994b6df2f5ULL, 0x1f1c1363edff6ULL, 0x6a033a9fe2312ULL, 0x5ff8cf64afe0aULL, 0x17d4e939cf531ULL},
+         {0x052a0e7eabbd7ULL, 0x1adbe2138fe02ULL, 0x69604c1fc885fULL, 0x597491dab50e0ULL, 0x47d221972c48fULL}},
+        {{0x6a34ff2c1c93cULL, 0x48bf44adf3bbaULL, 0x6119e9f14253cULL, 0x50d3641b7f774ULL, 0x2dbdd8a5a77cfULL},
+         {0x58e39b4c8af1fULL, 0x512f08cdf40f7ULL, 0x7197d35f7aa0bULL, 0x1a0da214eac58ULL, 0x326832b05328aULL},
+         {0x1c87ae9eeb7cfULL, 0x578efc4e6e06fULL, 0x23488e5c49140ULL, 0x7bcc672ec2b37ULL, 0x557ce53de87ecULL}},
+        {{0x10da7c4abfec5ULL, 0x44ca1196f8458ULL, 0x3a15ea7da8214ULL, 0x27ba64a165bb2ULL, 0x3b7302758c3d1ULL},
+         {0x1dc65e6ef746cULL, 0x2abb40688c1c8ULL, 0x38dfb6ed66cfdULL, 0x20ca8c65d6898ULL, 0x56b2f069aea54ULL},
+         {0x28cdfee565328ULL, 0x26d6766f95c7eULL, 0x6ebb653d5570dULL, 0x208c4b05c4d85ULL, 0x17ac9bb8abcdbULL}},
+        {{0x4e1c402efbc3dULL, 0x13ff11f4df497ULL, 0x34ca1783b4904ULL, 0x7ad38bc793c25ULL, 0x2b3715df186b4ULL},
+         {0x6fa6d3d319917ULL, 0x78fa213238407ULL, 0x3d3138d16727dULL, 0x3ef4734e9988fULL, 0x4291ed7764a52ULL},
+         {0x5dfef01dd5ba8ULL, 0x773a9804288ceULL, 0x00225476c8823ULL, 0x54a566bac6d33ULL, 0x5aece280ea00dULL}},
+        {{0x2dfdc856d7b46ULL, 0x665f7b36d30d9ULL, 0x3ce315d3866baULL, 0x4d20ddd8ff009ULL, 0x249bf98907c18ULL},
+         {0x7ba0cf9007d72ULL, 0x2f5605cda1226ULL, 0x4fddf3d25bc70ULL, 0x1f2ff42a36bc2ULL, 0x230f8306e8ed7ULL},
+         {0x7f90de18e6a04ULL, 0x635953475d5c9ULL, 0x4828cd31bcef0ULL, 0x027643d480f65ULL, 0x7ab89a1d0e593ULL}}
+    },
+    {
+        {{0x3ca26d5ef04a0ULL, 0x79ace0529f2d4ULL, 0x270e585749a84ULL, 0x6208082d61df7ULL, 0x57cbc6328b6d1ULL},
+         {0x368accbfab30aULL, 0x683888b517c37ULL, 0x1901f18273dfdULL, 0x468ca7c61dbd7ULL, 0x294f9d954b744ULL},
+         {0x342e1d092041aULL, 0x7c30560fc6010ULL, 0x2ef0c1857337eULL, 0x0b03c77a911b1ULL, 0x231f644b71491ULL}},
+        {{0x13d3d23513692ULL, 0x75a86bfebb4e6ULL, 0x1ec50c311049fULL, 0x1ce2604a26afeULL, 0x620882e6e4e04ULL},
+         {0x267aa6fb7bf1eULL, 0x243c9c0eb0286ULL, 0x1767daaba51fcULL, 0x3e8211574fd15ULL, 0x33c68a3d8bcceULL},
+         {0x780dfc4a46276ULL, 0x2ef31b7e901beULL, 0x2ea55aec09af4ULL, 0x7726177e5002eULL, 0x23dadbdc2dc64ULL}},
+        {{0x62b6b6eed85a6ULL, 0x201ad9bce3749ULL, 0x4c44deb19b23bULL, 0x1efee62577a06ULL, 0x0a82b63cf77c9ULL},
+         {0x4477f2784fb3dULL, 0x028dee78c2c40ULL, 0x4a7089d9a51cbULL, 0x32e52e69c3c64ULL, 0x72de771d7f11cULL},
+         {0x699c9298df427ULL, 0x4335e2db7ff1dULL, 0x5ae3500e8f9e4ULL, 0x593add0c3ce73ULL, 0x528c0bc9ea62fULL}},
+        {{0x04d069b621855ULL, 0x09d67f135914dULL, 0x7ac49f7665bc2ULL, 0x7bb2e6bec197aULL, 0x52341811be0e0ULL},
+         {0x1a06aec800d5eULL, 0x44e6e227ecd52ULL, 0x7b96b2e1444f9ULL, 0x311c80bc0da13ULL, 0x150217c8617bbULL},
+         {0x2ba5982f4b772ULL, 0x7e0e1b3a82378ULL, 0x0408c950a148eULL, 0x2c370d95c5e10ULL, 0x68f1dac7a0689ULL}},
+        {{0x2ef605b0b89b5ULL, 0x4c038ebc0bbe6ULL, 0x46502b308daa2ULL, 0x703a18ef3e0feULL, 0x17bfcf9dfc3d8ULL},
+         {0x5295d018ce05dULL, 0x68cc0c6a4a8b3ULL, 0x5d1ae6e9aea85ULL, 0x7b60fe5745bfbULL, 0x3cc3aa4c07862ULL},
+         {0x793ee46335a86ULL, 0x6c0fd0375f9eaULL, 0x5dbcfbe619e50ULL, 0x423e3bb591e40ULL, 0x22dc2cf061860ULL}},
+        {{0x27acda9ae4298ULL, 0x4220ce724b323ULL, 0x1a9dfcd7df683ULL, 0x126eefba5822fULL, 0x34818389aeac2ULL},
+         {0x468dd3c520fb1ULL, 0x77c50fa8b839aULL, 0x38732048bde23ULL, 0x676a229dd4164ULL, 0x7fa2dc35a8d2cULL},
+         {0x29e7947845f90ULL, 0x56b7d41d56f07ULL, 0x0887b979bce63ULL, 0x7de81e0cbb96eULL, 0x46a68c4db83ffULL}},
+        {{0x6d9635b338d7fULL, 0x0981dd72e406cULL, 0x253441b1445b1ULL, 0x47c151280f66bULL, 0x2989bd5eda4b0ULL},
+         {0x7758c74395459ULL, 0x56bec8734a05aULL, 0x358b726312160ULL, 0x49985e057ecdcULL, 0x312f37bcaf9c3ULL},
+         {0x3e76aea779759ULL, 0x2200add02db4eULL, 0x4c66fe1d0f8b7ULL, 0x70fb2317c3f96ULL, 0x320f2d17b2845ULL}},
+        {{0x7dd8785c0d3acULL, 0x2200029e35d98ULL, 0x0651cc8436b2cULL, 0x47e5c1895cdd3ULL, 0x0ffe2a2b4deddULL},
+         {0x1ecfdfb0348a9ULL, 0x2a39e6126500bULL, 0x4a2f678392633ULL, 0x21202cc4a3cf4ULL, 0x5379734bd3495ULL},
+         {0x4882e4c6452d1ULL, 0x20e84d204756cULL, 0x03fe2785d6fbcULL, 0x51921c522ac9bULL, 0x382b07ce4ebd6ULL}}
+    },
+    {
+        {{0x4e19a5f8ba3baULL, 0x453b60e964365ULL, 0x518961e0638baULL, 0x1580d6cbe5578ULL, 0x2b10308fb203dULL},
+         {0x37c39ef774185ULL, 0x54171653cbb53ULL, 0x632bb595977f9ULL, 0x1250926a83ddeULL, 0x0a36e26bcdfbdULL},
+         {0x6ad216a25f0a6ULL, 0x4bdfafe2d8891ULL, 0x6116882e9e607ULL, 0x079cebee5b062ULL, 0x3dfce0ee17ee8ULL}},
+        {{0x4caa41d786217ULL, 0x670bf38b41b07ULL, 0x15d76b68752bbULL, 0x187c1c8514c14ULL, 0x6e607eec94017ULL},
+         {0x3189cd0d4cd5cULL, 0x544a53e40a6a6ULL, 0x4e6d85612500bULL, 0x1fa329cc066f5ULL, 0x5190d9c087d2cULL},
+         {0x16f7772377fb2ULL, 0x1ece3fa82e553ULL, 0x07ab243866c63ULL, 0x3474a60d44f28ULL, 0x7fcf071eeb3edULL}},
+        {{0x3693bfb04d5efULL, 0x4ba1dc3d96f8fULL, 0x06ddb802bfd35ULL, 0x520e64626ed89ULL, 0x3f9066d197f17ULL},
+         {0x0913c3ffde8bdULL, 0x6b4e0c30944c7ULL, 0x6ced60f33eb9fULL, 0x13d281fbef725ULL, 0x503893e2bb139ULL},
+         {0x3ad1e6b2e1ffaULL, 0x4bc4f53686ab6ULL, 0x7f910c7c54066ULL, 0x63dece20117f9ULL, 0x2a66df32a502eULL}},
+        {{0x3254ab82e02ecULL, 0x6d71aba0870a4ULL, 0x04b9dbcacb76dULL, 0x6a6091dfca5e0ULL, 0x0af725b3288a4ULL},
+         {0x5ae92fe3c02dcULL, 0x1be8522e1fd37ULL, 0x7ba7edfc9fc65ULL, 0x1650c67b84446ULL, 0x3c182b574dcc3ULL},
+         {0x168b04e99e42eULL, 0x7ea88dd7838fbULL, 0x2469d778b65d8ULL, 0x0e5ed86eee3a2ULL, 0x0e36a4bade7c2ULL}},
+        {{0x1864d870f37e3ULL, 0x41513febe774fULL, 0x11d02670032e8ULL, 0x415d583e86e1eULL, 0x2e6d48708db5aULL},
+         {0x0477ac7f5076aULL, 0x49f97e6568c77ULL, 0x0a4829e3a7d4eULL, 0x7510899c01d84ULL, 0x360838e7fcd1aULL},
+         {0x62e24a1821656ULL, 0x527141b1292acULL, 0x3ad0ebbb4def9ULL, 0x2b33adcb09d06ULL, 0x161d9bfa8974cULL}},
+        {{0x7f8a4eae7df0eULL, 0x6146318696172ULL, 0x6ac99e7ad701bULL, 0x374d3b2838ba1ULL, 0x56fa2cfae2d3fULL},
+         {0x155253c47937aULL, 0x08c644a49e1bfULL, 0x1af3f7bccb4aeULL, 0x0401db4124005ULL, 0x012c76310de14ULL},
+         {0x0cc64e9f1d0a0ULL, 0x0e9e97e664b2eULL, 0x58aa6a6790129ULL, 0x32cd86c133146ULL, 0x699152ea285e1ULL}},
+        {{0x1a7f35fb9a3eeULL, 0x78fe29186b9b2ULL, 0x15f458bfb7ab8ULL, 0x2e4ac8d6f1c9cULL, 0x6d79b4cadeedeULL},
+         {0x4bd0df8e08dedULL, 0x720b66f184b21ULL, 0x6b9ce3ca84ba0ULL, 0x1aa12b09f6ad0ULL, 0x0733d1060c6bcULL},
+         {0x31e220f5628b4ULL, 0x46300414f2062ULL, 0x09d101f1d3475ULL, 0x7b36a5ce5bed9ULL, 0x6c8cb31b95fa2ULL}},
+        {{0x28e772a6c9449ULL, 0x29f6a8d53277eULL, 0x34d5da044ad62ULL, 0x2c3d333ec5174ULL, 0x49ea1c2c2e685ULL},
+         {0x205d606a21a1eULL, 0x00aa48285632bULL, 0x527f7722c7dafULL, 0x3c789e9c296b7ULL, 0x5b65f20c04969ULL},
+         {0x7c3a0b1e3b1cfULL, 0x4e07be737dd26ULL, 0x002e94a22ea94ULL, 0x2b81a14c69f40ULL, 0x3b1d07f3c6b0bULL}}
+    },
+    {
+        {{0x0e494d4d782cfULL, 0x14f71db44dd87ULL, 0x5543375239d57ULL, 0x544088aa18fa3ULL, 0x5ce7415ebbc45ULL},
+         {0x46dc242cd3e10ULL, 0x50e7dfbba94abULL, 0x0fa62135cedddULL, 0x5a77fc8d3dd36ULL, 0x1dd7fe58e973cULL},
+         {0x7eb2cfe057571ULL, 0x32503204844deULL, 0x79a689dedd7ecULL, 0x63ad89c3db61aULL, 0x3769eadbee8a7ULL}},
+        {{0x0e87f30727d59ULL, 0x1beec5a34efcfULL, 0x35b6bb776e8c9ULL, 0x0a5cc052afcf3ULL, 0x682b2ba1f2fddULL},
+         {0x558aaf17914e7ULL, 0x478b0ca3fdbfbULL, 0x22a2100685ce3ULL, 0x61b40b803e169ULL, 0x266610fb3796bULL},
+         {0x2c9e97a3d12a2ULL, 0x11cc5d6ff342eULL, 0x0b9d985e92fb7ULL, 0x41fa2fa4ee592ULL, 0x4a9af723ab60aULL}},
+        {{0x30afce4e84f1fULL, 0x77ba4db4a4d2fULL, 0x37b92dbf5bd36ULL, 0x4213405b438c7ULL, 0x60e4577cd58ecULL},
+         {0x7ae5cc9176bfcULL, 0x3097da34ad791ULL, 0x143ded38d31d4ULL, 0x6f19d1cff0d96ULL, 0x173d8531da551ULL},
+         {0x006a172f978a5ULL, 0x0ae3141f3b8e4ULL, 0x067cdcd1c27e1ULL, 0x6fd5b771f944fULL, 0x472f48110c7e2ULL}},
+        {{0x2cb60a68e2356ULL, 0x6dd39aefc88d3ULL, 0x23fdf245d9271ULL, 0x567f87b63acd7ULL, 0x2f637b3a82ba2ULL},
+         {0x29a2dcfc821f3ULL, 0x006ff45956e19ULL, 0x096dee6ec8590ULL, 0x4c8ba7ff0b091ULL, 0x7525e255774f4ULL},
+         {0x78cd7b9004135ULL, 0x459b0cea2472bULL, 0x712481cd90080ULL, 0x4c4d459d55a6eULL, 0x2151238ca8963ULL}},
+        {{0x6573a40feca74ULL, 0x7897362126d4dULL, 0x4c7bc3c5dfc5cULL, 0x7b08c6b8914b9ULL, 0x3f9265b8163c7ULL},
+         {0x175ee69c2d0b0ULL, 0x1ce6dc535ed2dULL, 0x371aa35119d29ULL, 0x01c620888bf6aULL, 0x749bd9f59d7a9ULL},
+         {0x635b79e5e18d3ULL, 0x724d64b6e9826ULL, 0x62357ccbb1955ULL, 0x38cb7ac76edb5ULL, 0x5c4ed451c4f05ULL}},
+        {{0x0abe55c0bfd7eULL, 0x504d94a555ba6ULL, 0x5ca39784d03caULL, 0x40b06c91b1c1bULL, 0x015b2acd7fcaeULL},
+         {0x5fc8616d19195ULL, 0x1a1d807b44670ULL, 0x4677189073956ULL, 0x3480b73b67dfeULL, 0x0f5ef6914475aULL},
+         {0x452447875b1a8ULL, 0x15a814907a8b0ULL, 0x31c2378865ceeULL, 0x21563adb8a79cULL, 0x00094c90e8a20ULL}},
+        {{0x683093a6a9de2ULL, 0x654b574e87bc8ULL, 0x72b6bb9fc1cc1ULL, 0x34496fc6f2dd7ULL, 0x02db69087989aULL},
+         {0x019ea1e4fcc15ULL, 0x02549f18a7d7cULL, 0x516d8cf895578ULL, 0x1f6e91ff622eeULL, 0x6c65af4d96872ULL},
+         {0x5374bf23437f5ULL, 0x6100674116dcbULL, 0x6a9050a8f63fbULL, 0x7b5b242b0be93ULL, 0x60e59fc781867ULL}},
+        {{0x3c94c418a8105ULL, 0x2d95848d9b3f0ULL, 0x39a9457d9ff82ULL, 0x7a14f978c7092ULL, 0x35ca9f805ac37ULL},
+         {0x666b6452c2da2ULL, 0x729d38ca14977ULL, 0x5bc764b7cde2bULL, 0x55c644446fbf0ULL, 0x72c60e4dfeb3aULL},
+         {0x5e34a297c604fULL, 0x242125590f6b7ULL, 0x702f9f6a9ef4dULL, 0x787e0b6629a06ULL, 0x15447d2e89705ULL}}
+    },
+    {
+        {{0x7af586f040de1ULL, 0x13dc90655e3b9ULL, 0x37969fa7386efULL, 0x7dfc55126432dULL, 0x30e0e3367e3e4ULL},
+         {0x31605445b1c45ULL, 0x7514e39bd5a66ULL, 0x283fddfdb268bULL, 0x1bd9efdd8a869ULL, 0x3453b4510f514ULL},
+         {0x4f33bb567184cULL, 0x7111981bcafbbULL, 0x7a6d7dee9e88aULL, 0x21315497b4c21ULL, 0x17da14b2ffd70ULL}},
+        {{0x0e74c70ef4701ULL, 0x69e12de908fe2ULL, 0x522fefbc7ff0dULL, 0x0461dfa1d49b3ULL, 0x4b0cad9f23105ULL},
+         {0x268f4cc662712ULL, 0x0c3dbcc376124ULL, 0x615b4f6e5dcbdULL, 0x785408e9f751bULL, 0x3c5c674267b11ULL},
+         {0x5faa95ddd69e8ULL, 0x1c915bea2e315ULL, 0x6ef5e5e294fa6ULL, 0x381f6097725ffULL, 0x4d20f795d83c6ULL}},
+        {{0x2dc4f4605dc3aULL, 0x2c8e56473e9faULL, 0x5606bcd67b6e9ULL, 0x177093bf67b8fULL, 0x3f6a89b6fd724ULL},
+         {0x0e70daa9cd225ULL, 0x283870b30d783ULL, 0x167baf7d5b7afULL, 0x76f84ea59f567ULL, 0x53e447a6638c8ULL},
+         {0x785d950d8c940ULL, 0x1247493d0ce81ULL, 0x087350fdc2cd1ULL, 0x0c78a90318643ULL, 0x3dcadcdbc3973ULL}},
+        {{0x573b02ad8fca0ULL, 0x70f0fcf221e9bULL, 0x1cdc0657b9d57ULL, 0x22843872ecaf7ULL, 0x6636a02606201ULL},
+         {0x35d5df549bc76ULL, 0x66aab15f803b2ULL, 0x5c8e41f403264ULL, 0x160beb36a96f2ULL, 0x1f66b7b1ad794ULL},
+         {0x343db7654c568ULL, 0x24449ec5e614dULL, 0x452003c4a7f43ULL, 0x671c5fa1ad1c4ULL, 0x4072b3757ce41ULL}},
+        {{0x6449bd867da50ULL, 0x28d5d4f7e2844ULL, 0x7d6b4171776b8ULL, 0x391013d8bbb9cULL, 0x5b778bc2dfeefULL},
+         {0x149e5bc54ead9ULL, 0x027bc10acb45dULL, 0x34d6d21a458f5ULL, 0x1df80983e34bbULL, 0x59b2a951ee5feULL},
+         {0x4ce75ab77ce58ULL, 0x3d63043e4fba8ULL, 0x050275a15b3dfULL, 0x447513bc8ff47ULL, 0x52cb515274b1dULL}},
+        {{0x6e0454563cc92ULL, 0x22cd326ff4576ULL, 0x55373aacd4926ULL, 0x6faf0cca91749ULL, 0x3f968ee9c0813ULL},
+         {0x1404e4e0a8f41ULL, 0x733eeda771b00ULL, 0x688992abeef96ULL, 0x66b89146b87f2ULL, 0x5a5b59b24548aULL},
+         {0x4df9f10210e17ULL, 0x1069498120bccULL, 0x1c0b7dadf556eULL, 0x2d7da87df7a78ULL, 0x2cad8323fa310ULL}},
+        {{0x6efb27fb31172ULL, 0x4c171a6c09adeULL, 0x6b200e64fe503ULL, 0x566d32a965784ULL, 0x2539a07fa6cbbULL},
+         {0x499df9dbcaf44ULL, 0x4cfbf6394af7bULL, 0x7ad6121027144ULL, 0x192d020cda73bULL, 0x0981ac5cdfe15ULL},
+         {0x7e89500fd4b64ULL, 0x66fbe0930b279ULL, 0x5905d04e999f3ULL, 0x490661d34b7f5ULL, 0x37d9dc295b511ULL}},
+        {{0x1a4c7a9802f13ULL, 0x0ecda408160feULL, 0x06d579da268dcULL, 0x778ab5832acc8ULL, 0x13c7f3a8b2d5bULL},
+         {0x4106e49b7bfdeULL, 0x33e5ebcfe194cULL, 0x7d165ac0f970fULL, 0x1dbcd10859566ULL, 0x19a22c24a65caULL},
+         {0x1e5b176cafa75ULL, 0x7626a6b39abe7ULL, 0x7effe6e1e022bULL, 0x5daf8490d561aULL, 0x241f0386468f2ULL}}
+    },
+    {
+        {{0x57eb0138f883eULL, 0x6bbd24833060dULL, 0x2e178d7ab8418ULL, 0x7350b19a9fe22ULL, 0x6c7a7093b8e32ULL},
+         {0x74d20750db39dULL, 0x67cceab9a594cULL, 0x523355509f159ULL, 0x40f96ad4e8313ULL, 0x7382f918e549cULL},
+         {0x1e6908d3cd2b4ULL, 0x4e68a74b0ebe0ULL, 0x49f9ce98c6dfdULL, 0x5579902288ad4ULL, 0x3b6a693288465ULL}},
+        {{0x239d11b566d9aULL, 0x4c3f4885ebad5ULL, 0x08be4b2b47d83ULL, 0x2eff8324cc1a4ULL, 0x0828f84768bd6ULL},
+         {0x24be8b012edc4ULL, 0x159b1fb3a9c3cULL, 0x5c45634a54166ULL, 0x72940811f3bc8ULL, 0x048dc09cb3185ULL},
+         {0x25b6223715b08ULL, 0x730e66069169eULL, 0x68b1fa41d9b2fULL, 0x50587513637ddULL, 0x78e767ab616c7ULL}},
+        {{0x251e93c5289afULL, 0x69a5a4537ae61ULL, 0x32e051acd1586ULL, 0x14017789e2b09ULL, 0x5ccf570d6116eULL},
+         {0x652f56f86fc45ULL, 0x13d3f4973b261ULL, 0x6b61f49bb4259ULL, 0x0300b7c58f2ecULL, 0x259eb65747ce8ULL},
+         {0x3c7834ba93351ULL, 0x50b894958124bULL, 0x09da4b8dbdf22ULL, 0x2cb963124dfdaULL, 0x178367965d1c7ULL}},
+        {{0x3259ba322d34cULL, 0x7c623683f07e7ULL, 0x6d9cae797d955ULL, 0x0cc8cdd37ca5bULL, 0x5a4c2307ae774ULL},
+         {0x001741ac09fcbULL, 0x09a6964ca1a79ULL, 0x371d0e9f003feULL, 0x0508c617b8980ULL, 0x42038ca27a373ULL},
+         {0x3eeda931481b8ULL, 0x2ded0ecceb6c5ULL, 0x2b1f33f5c320eULL, 0x2b32d09515103ULL, 0x529640819189aULL}},
+        {{0x594754ae8883dULL, 0x24d643a370746ULL, 0x414b0bd8dc42cULL, 0x053c47716c710ULL, 0x18f40659613bcULL},
+         {0x1dc87ed384d94ULL, 0x0b0f93c91c1b9ULL, 0x63b7a414a811aULL, 0x2015b65088ca7ULL, 0x0a12992f74eccULL},
+         {0x305419db3993dULL, 0x0835e8954cb31ULL, 0x63d1d6341175fULL, 0x4b70bc7fcb8cdULL, 0x09b752a13a133ULL}},
+        {{0x1e5139a86b739ULL, 0x473e4463075afULL, 0x1aaada0e5862cULL, 0x7d9ed9867752aULL, 0x2e34d017dbc80ULL},
+         {0x307d9433c5226ULL, 0x49db8cf08ede0ULL, 0x5b9b215f2c353ULL, 0x29f67c8885c77ULL, 0x354473af56158ULL},
+         {0x25c16e0f261b0ULL, 0x01c64d3f57862ULL, 0x6312904c3b226ULL, 0x219780422314eULL, 0x2dcfec081e5e5ULL}},
+        {{0x0d5f6f064fa8fULL, 0x21352de39e297ULL, 0x64ac4f7147604ULL, 0x149e8342f5ea8ULL, 0x407e783f7e7b4ULL},
+         {0x6c718df1a1da2ULL, 0x20f93ff4ab6a1ULL, 0x2374ee0e034f4ULL, 0x12a7f012b3eecULL, 0x2613125aed814ULL},
+         {0x3da7c126eeb28ULL, 0x6a3f5afd8e91eULL, 0x7c2b9160307faULL, 0x2cc0f14bd44bfULL, 0x2142a33bea90cULL}},
+        {{0x231caae991c5dULL, 0x66c93a71505b9ULL, 0x5f1c45f839d6bULL, 0x2cf95bd3e26e9ULL, 0x4aed7442d6271ULL},
+         {0x0dd119c183604ULL, 0x5c170d8cee049ULL, 0x3d2345af08c7bULL, 0x3eef0bfa8da55ULL, 0x1eab0b1e29742ULL},
+         {0x59407e30f221fULL, 0x399571077cb26ULL, 0x70a4d9714a281ULL, 0x57871c787aaf1ULL, 0x56b9bf1b7c520ULL}}
+    },
+    {
+        {{0x31446b221f8b4ULL, 0x4646e996989e0ULL, 0x1a1235fe06ca1ULL, 0x38a672f758799ULL, 0x4f6126641eb87ULL},
+         {0x0543ae6e6e393ULL, 0x4e368697cbb4aULL, 0x0a597b32aad73ULL, 0x150bb00f94617ULL, 0x4a00e1b4825efULL},
+         {0x43a3bacdfdfdfULL, 0x09220392b1c9aULL, 0x0529b44ecc957ULL, 0x1b8bd91771421ULL, 0x27b1d00ce9d54ULL}},
+        {{0x1f7d1012ca724ULL, 0x08d189a3a4b37ULL, 0x38bd1e19243ddULL, 0x25c31241b8922ULL, 0x3eb6e641bfc76ULL},
+         {0x36cbff7c53929ULL, 0x64b7f16c75564ULL, 0x4db126eb5c722ULL, 0x7b288b67eaf39ULL, 0x047ef1cf67893ULL},
+         {0x0250ed8721e6aULL, 0x41d79fb13bc49ULL, 0x2a078956086e3ULL, 0x49b17c5a193e7ULL, 0x77d4040be8a1aULL}},
+        {{0x4fa29587814dbULL, 0x18273e31ab690ULL, 0x366465012c3f2ULL, 0x6dcb86d4c7123ULL, 0x549faa7a44d65ULL},
+         {0x669bdc671cc16ULL, 0x3c5cefc615129ULL, 0x0e00e3349d74dULL, 0x72695e9723589ULL, 0x33db89524895dULL},
+         {0x7cda869959030ULL, 0x7c4f4ce8c101eULL, 0x04399f14f4aa9ULL, 0x2d7963eb9b61cULL, 0x50402e43986e1ULL}},
+        {{0x2b7dc429afeb8ULL, 0x40c114225473bULL, 0x52e8b1d014e8bULL, 0x2a93da7697d17ULL, 0x035887517aa59ULL},
+         {0x4cf71a0dfd3d0ULL, 0x35310283ff9efULL, 0x73795cde2b499ULL, 0x4d3971239960aULL, 0x229fcbbc0e081ULL},
+         {0x51671403c5f67ULL, 0x554f7c669013bULL, 0x14778b5db7f8cULL, 0x693b34e989ae8ULL, 0x29ca3b3dc5546ULL}},
+        {{0x78a8e3a75f0abULL, 0x238d3b2c2ad08ULL, 0x41662faa7dd42ULL, 0x3c42b324a79ecULL, 0x219652cdff5caULL},
+         {0x78b30bd2edfbcULL, 0x2ab1781caa739ULL, 0x09d2629fec2a6ULL, 0x30bb5c2ee0842ULL, 0x217be12349b1fULL},
+         {0x7a3cbb3b4d281ULL, 0x4d4b314af5ff6ULL, 0x07a36222ae2bbULL, 0x1c401e388db1fULL, 0x100830edcc74eULL}},
+        {{0x3f8a5459b2c02ULL, 0x67c5c1049c2e6ULL, 0x41684aa134671ULL, 0x3d04f94265f6bULL, 0x4001ca330e4c6ULL},
+         {0x7178d0205869eULL, 0x350f9d361fbceULL, 0x5fe8c861e4fdfULL, 0x290ec219cfd50ULL, 0x2f95400508ce1ULL},
+         {0x73572d0121dc8ULL, 0x4147239027d2aULL, 0x6ec29f7b115a8ULL, 0x3ce1b353953ebULL, 0x54db224150eb4ULL}},
+        {{0x19a8006b0f2adULL, 0x01e15e19b3fd9ULL, 0x33ebe4d45f301ULL, 0x1012088fa0f27ULL, 0x4b8013255b7d7ULL},
+         {0x19970cbcdab0eULL, 0x0d2918d144e70ULL, 0x6234440d49c6fULL, 0x1b20ed1a5bb13ULL, 0x2c1992a9a580fULL},
+         {0x1a806a95f2d31ULL, 0x1e39ce204f85bULL, 0x769fbd67815caULL, 0x679b61201141fULL, 0x08f12e9c102ccULL}},
+        {{0x61f14e9fb5391ULL, 0x2653e1c25c86fULL, 0x384a01e987ba3ULL, 0x68928923c6564ULL, 0x27b1902f55724ULL},
+         {0x786e47b8ed01fULL, 0x365991dc860d3ULL, 0x1ee622ae04aafULL, 0x397bf91540228ULL, 0x5c40d0f2905b2ULL},
+         {0x42a13690e9836ULL, 0x4cf4ef74f6effULL, 0x783276be26e70ULL, 0x039c87f964e19ULL, 0x240ffa2b2c315ULL}}
+    },
+    {
+        {{0x7dacb2ed7d7d0ULL, 0x2e7ad0b42e0f5ULL, 0x1dee82e34fba1ULL, 0x1acc0e3fd29dcULL, 0x3b8353700f07eULL},
+         {0x1e07b09bfea06ULL, 0x22bfbffb6df20ULL, 0x469ca0b7adf3eULL, 0x4083b938a90ceULL, 0x61ea6f89dedfbULL},
+         {0x237efbee93a0fULL, 0x28bd5bef2b49aULL, 0x2120c5c282affULL, 0x4beb0bfc1809eULL, 0x36d935056ad96ULL}},
+        {{0x465a2a752348fULL, 0x19a51a07b6098ULL, 0x0a69fb3ac8293ULL, 0x711a133e7d944ULL, 0x79539173ea974ULL},
+         {0x146a0cba9167eULL, 0x1c4128e44700fULL, 0x12b3b6d5e8730ULL, 0x39c3e2a58e6feULL, 0x660446017092aULL},
+         {0x20913b36e704aULL, 0x38ce151e9bc64ULL, 0x09fe051004272ULL, 0x109c0f55d0fbcULL, 0x6ef1e90117b17ULL}},
+        {{0x7e784398aefd9ULL, 0x02b825b6d1c21ULL, 0x03f7362a72705ULL, 0x00ba27909c40bULL, 0x2985e446c8284ULL},
+         {0x6313a7d8b5b2bULL, 0x5893d33454f49ULL, 0x45d70710941eaULL, 0x12a0729cda564ULL, 0x67e87f155d9d7ULL},
+         {0x7cbf90ab87bd6ULL, 0x0cbffa69381caULL, 0x700a24a28af19ULL, 0x50326d13955dcULL, 0x31bc24246eed6ULL}},
+        {{0x1ed547520ee7eULL, 0x1f88fdc676c54ULL, 0x6bbaea6c116f4ULL, 0x10e6f624713dcULL, 0x157203604f2e7ULL},
+         {0x468512a49de95ULL, 0x5aea51d5dece3ULL, 0x79082c1848397ULL, 0x129d25e8b14c9ULL, 0x3df243a0515eaULL},
+         {0x366d460a5588fULL, 0x169ffdacadbecULL, 0x72c332dfeb5cbULL, 0x5ec811d803499ULL, 0x5bd9057910e3fULL}},
+        {{0x2bd94d00a104bULL, 0x0c7f102f2cea8ULL, 0x0a69760012c9aULL, 0x60c1c3e1863f9ULL, 0x471794c403f78ULL},
+         {0x113cc55335290ULL, 0x4b5327d0499a1ULL, 0x46864ab325a22ULL, 0x41ffbe5ecdf88ULL, 0x243924989d9e3ULL},
+         {0x24199b01d03c8ULL, 0x75f4c2a9e60bdULL, 0x4b297e5b14e44ULL, 0x266f28147b538ULL, 0x79edf9fd5109aULL}},
+        {{0x1645e00ba5db0ULL, 0x4069e5eaf7540ULL, 0x383712d125c2aULL, 0x5a12adfcbf968ULL, 0x2f19ee69a15c7ULL},
+         {0x6ffdae062c057ULL, 0x7765140b02204ULL, 0x4bf51742570bcULL, 0x62a5396513afcULL, 0x7916af9f03ff8ULL},
+         {0x5dc8aea0bc1dfULL, 0x2bb80003a8f56ULL, 0x3b66030d80344ULL, 0x7e18450883621ULL, 0x3b46f5c9f4904ULL}},
+        {{0x27a2ce9d54af0ULL, 0x3d38cdcb161dfULL, 0x18c75a2553096ULL, 0x66744eb9e1226ULL, 0x6fee9b9d091a9ULL},
+         {0x531e95291eec5ULL, 0x25a5e3897a228ULL, 0x562cb40f7f466ULL, 0x082978a1c0832ULL, 0x5582deb9a8edbULL},
+         {0x0a090bd32064cULL, 0x78c370054ad75ULL, 0x7354d58dd74deULL, 0x210b0b20c62b5ULL, 0x3eb4a196c7c5cULL}},
+        {{0x316ef40d203b7ULL, 0x26e30fa2c90c9ULL, 0x11612582757cfULL, 0x068f8bbfea9bdULL, 0x5b1470134305bULL},
+         {0x309c8b786a817ULL, 0x320de8a45fc14ULL, 0x032ed6d20116cULL, 0x5036e97287c41ULL, 0x62ce3d1e11256ULL},
+         {0x7c44a92b6b2deULL, 0x3f04e6fab5ad5ULL, 0x25d31e5f9dd71ULL, 0x70ae1833ab803ULL, 0x33d3b9b2f1edcULL}}
+    },
+    {
+        {{0x790859a5340acULL, 0x349236971edacULL, 0x5c08fc0a41aa8ULL, 0x25ed034af5b21ULL, 0x01a444f1045cfULL},
+         {0x55ca63d5c0129ULL, 0x3e01fd8758766ULL, 0x16b04f71ad9aeULL, 0x440990350fc0fULL, 0x56f46c574e432ULL},
+         {0x7af7a5a0203afULL, 0x56a9500fe67b1ULL, 0x58de1d215476dULL, 0x5b6f90f69e683ULL, 0x66266c4d744d1ULL}},
+        {{0x7275c75d0c123ULL, 0x7f73e41c8c381ULL, 0x6e472c14bbde0ULL, 0x0a67228f8397dULL, 0x07781c9e658aeULL},
+         {0x47011d36bc16dULL, 0x4534234f0e754ULL, 0x5d8cef28a37bdULL, 0x263ed3863f24aULL, 0x6e435d8423b20ULL},
+         {0x762a85f056cb7ULL, 0x707eefa477408ULL, 0x20c076dcf2205ULL, 0x0e9d742039e28ULL, 0x511546956c2c3ULL}},
+        {{0x55809b329b357ULL, 0x4672fe02a78f2ULL, 0x3139033923930ULL, 0x7ab991462e47fULL, 0x0a497f0112f08ULL},
+         {0x2fcf672c36361ULL, 0x4e3adeaa3349eULL, 0x402e635fa8d1dULL, 0x627cd3534b6aaULL, 0x47af2994cdef0ULL},
+         {0x5a98a7ec02cd7ULL, 0x1e7170dea2e26ULL, 0x1044ec318eed4ULL, 0x6e033992c85a7ULL, 0x3481d247ebac1ULL}},
+        {{0x3db7d486731faULL, 0x6ef9c614fa29fULL, 0x15f78f7646dc3ULL, 0x3426a5c7737a4ULL, 0x5816489eca6a9ULL},
+         {0x689cc71ab9fe3ULL, 0x61811118fdf99ULL, 0x4770c8313557cULL, 0x46588c35efda2ULL, 0x3f23748b568f9ULL},
+         {0x532d779445bb3ULL, 0x7a24c5faba075ULL, 0x77b51d4561b76ULL, 0x7dde1367733e5ULL, 0x30c51df4a9dc2ULL}},
+        {{0x552fdb2b3ba71ULL, 0x20d22998767f9ULL, 0x6571747f6ea40ULL, 0x67b88a5c6a3c0ULL, 0x18b6f321dda36ULL},
+         {0x1dde674e72fd3ULL, 0x47fc012f81b16ULL, 0x69d761bfa8ccdULL, 0x47f3604b1e344ULL, 0x255a569bf1643ULL},
+         {0x7589a097ac921ULL, 0x63269ad5ae5d3ULL, 0x14a5fe2ea6899ULL, 0x4fe678adb49b6ULL, 0x07ae8bf0c30edULL}},
+        {{0x32fd4c216f790ULL, 0x0b75076ef3b54ULL, 0x683cf6c4c6b88ULL, 0x07b5739dad42dULL, 0x2e0a053c77c0cULL},
+         {0x59a20dcf419d0ULL, 0x1a527b8f0ef60ULL, 0x51d9377617820ULL, 0x0cfc6f66687fdULL, 0x2190595886047ULL},
+         {0x0fa096495e42fULL, 0x3ca310f10829eULL, 0x6af31d9051a1eULL, 0x6f1616f317c65ULL, 0x3a3d00507a3faULL}},
+        {{0x292a202f04737ULL, 0x1bc1fa618c0f1ULL, 0x193ea4283bb2dULL, 0x4248c8f34115fULL, 0x29f3ac0f256d4ULL},
+         {0x6ab909083b479ULL, 0x4b3eaa2c4aea6ULL, 0x3fc887933e2d3ULL, 0x72e3768826e72ULL, 0x1a0db23d85608ULL},
+         {0x7ef36c79b638fULL, 0x4c78c0ab9cf1eULL, 0x3ea875a94cf07ULL, 0x79e87bedbadd3ULL, 0x4074faaebdf7cULL}},
+        {{0x2a2164150668aULL, 0x67b2604a5448cULL, 0x502ce45e7eb5dULL, 0x22e629fc869d8ULL, 0x07b7617bed709ULL},
+         {0x04595046d67d0ULL, 0x29275fd1504beULL, 0x5a2f3a0430cebULL, 0x1fda9dfa5aba6ULL, 0x79b5e5fbef39cULL},
+         {0x78da4c8c6a27dULL, 0x09c27484619acULL, 0x650869dd0e91aULL, 0x0aeac78bb2231ULL, 0x5633caebf8148ULL}}
+    },
+    {
+        {{0x44d26354b4042ULL, 0x0f54ed2c5e1bcULL, 0x7884c7d8284a9ULL, 0x5c1c0a3ec4ed4ULL, 0x7acbac3508f19ULL},
+         {0x345456f7e928cULL, 0x1d44674d47289ULL, 0x6cc78528f15c6ULL, 0x5e5e7cc607bebULL, 0x324b02a07e1fcULL},
+         {0x4ac1188e5e9c5ULL, 0x1f16a0c1fc5abULL, 0x636d3a99316c3ULL, 0x72e37c67a83d8ULL, 0x6fde6cfde54e2ULL}},
+        {{0x3783052a27d88ULL, 0x4db02e3e2fa66ULL, 0x21b8f1e162badULL, 0x6333dcd4f92fdULL, 0x37db668ee71f6ULL},
+         {0x6999c6729f87aULL, 0x2e1332f33fba8ULL, 0x1441965e8d6e6ULL, 0x69e55da3e5340ULL, 0x755368b0f24a3ULL},
+         {0x57fb2d7135c56ULL, 0x319190341d9c1ULL, 0x3d78453cbf112ULL, 0x48dd210984a21ULL, 0x7923a7b852792ULL}},
+        {{0x4db74417ee7ebULL, 0x68029d08a68daULL, 0x0f3205a9df5c2ULL, 0x3eb3cbbe9a9e7ULL, 0x407eb0842ac75ULL},
+         {0x3fd4bf0940113ULL, 0x3979162a65980ULL, 0x4db09cfbdb6b6ULL, 0x0dc0c4f203ec3ULL, 0x612baa44e183aULL},
+         {0x72d78beb2e973ULL, 0x2947e680bcdf0ULL, 0x42e159d0e0df2ULL, 0x47aefaf1d7fd9ULL, 0x6427d845f8bdfULL}},
+        {{0x0337fd42c827aULL, 0x4f336a1c227b5ULL, 0x3ebcb9096c461ULL, 0x06b8fb66e348cULL, 0x1b4fe81ffd169ULL},
+         {0x29783a83e08f2ULL, 0x2aac278daa12eULL, 0x142c91af75123ULL, 0x6c2201e74b50dULL, 0x69e4988fe17b6ULL},
+         {0x73663377f26b7ULL, 0x18512edb96146ULL, 0x414b24056e703ULL, 0x447747e61de06ULL, 0x5370c0186df85ULL}},
+        {{0x6602ab02856e3ULL, 0x772a587e8e9f7ULL, 0x60b16535d33c8ULL, 0x603c5d5912438ULL, 0x27e6ff3c9084eULL},
+         {0x36240673437a0ULL, 0x1283f1c58bd4dULL, 0x06e8057c05a94ULL, 0x630abdaa41c99ULL, 0x4975fa362f8c0ULL},
+         {0x7e6e4afca4236ULL, 0x3c8fae731a506ULL, 0x6b17e8b2d6b3dULL, 0x0384cd5835795ULL, 0x56ab2e97a2e0eULL}},
+        {{0x057b8b7d71878ULL, 0x0ddf81600ed09ULL, 0x7f20513a7a588ULL, 0x7cc587772071fULL, 0x5f70d8f6eb3cdULL},
+         {0x5fe9e28eec695ULL, 0x2bc2e53354dabULL, 0x3dbfc843168feULL, 0x5fbe461211b33ULL, 0x09e1801972e52ULL},
+         {0x3dfee2e9bb104ULL, 0x3f448ae2bd176ULL, 0x0475be629c284ULL, 0x3b4807174e73aULL, 0x7eb6ec6ffb275ULL}},
+        {{0x705fd90506831ULL, 0x31ee7dd41f5e0ULL, 0x5107265d82851ULL, 0x4ea7c81169315ULL, 0x5482c75006808ULL},
+         {0x45d9e0a071caaULL, 0x17fad192a1a27ULL, 0x62594d5ae3a57ULL, 0x4a1b1ce03671eULL, 0x135a663873a8cULL},
+         {0x6956cb6545f16ULL, 0x15408c34ae0a3ULL, 0x3764080788148ULL, 0x462c40efa4526ULL, 0x0c199421b8beeULL}},
+        {{0x744c9d1265980ULL, 0x54b2a15bb59e7ULL, 0x4df1194638692ULL, 0x207c7c9ec1d49ULL, 0x4ab1d84747b7dULL},
+         {0x4d01a274134a8ULL, 0x719b20defa285ULL, 0x0690a0dda986fULL, 0x0aee646c79707ULL, 0x5a49e54e19c68ULL},
+         {0x774f9d0f5eb8bULL, 0x6ca0d462e00c2ULL, 0x038e999c9b436ULL, 0x79581a0ac85a3ULL, 0x28683bdecfc67ULL}}
+    },
+    {
+        {{0x0e82f80b4ee27ULL, 0x021932c784f85ULL, 0x42cdc7cd8f116ULL, 0x1e704eb1cd08eULL, 0x63073f58c46a0ULL},
+         {0x325e78041c45fULL, 0x711d8411fc69cULL, 0x25749ffe3bdb0ULL, 0x239b6d26995dcULL, 0x0bb899a1ff6d4ULL},
+         {0x658f123a08d9fULL, 0x48c41b16b56f9ULL, 0x2261c27420fe8ULL, 0x1b323ea27cd30ULL, 0x72d78c838f0a6ULL}},
+        {{0x6510499b6ef26ULL, 0x008c12c32c4ebULL, 0x5bb9705a1c5dfULL, 0x1aa63a5208610ULL, 0x1a5f95c3486d5ULL},
+         {0x4e1d9e0d67552ULL, 0x7d85d527079faULL, 0x2e50f60a2a4baULL, 0x10e976b7fbe33ULL, 0x201907e211524ULL},
+         {0x28323bb32fb8fULL, 0x687e17ea7e014ULL, 0x24c16a116f40aULL, 0x3397c018e54cdULL, 0x4f004ff28cba4ULL}},
+        {{0x447c6e203bb14ULL, 0x247f358302d40ULL, 0x7c9a557dfd617ULL, 0x29a8fcc3bac7bULL, 0x7c5c72d15308cULL},
+         {0x29df5df263b9aULL, 0x38bbf03ae4c84ULL, 0x3e502fba88ccdULL, 0x3da23b85de769ULL, 0x7bfb2d493da7dULL},
+         {0x2f34b7102620dULL, 0x5d26e3abd5cc5ULL, 0x609b41f275f7dULL, 0x2803b66ea6359ULL, 0x49e8c65e5252dULL}},
+        {{0x0a3abe18c9fb5ULL, 0x676622a7fc212ULL, 0x6b7aeadb0f9deULL, 0x491ef29ff4165ULL, 0x12e653508bc5cULL},
+         {0x639261fc18c4aULL, 0x7659e49d539f6ULL, 0x43f7d6804005bULL, 0x6248b1f76eb02ULL, 0x70e124bf5c5caULL},
+         {0x7ce14124c5962ULL, 0x456c10b141a8aULL, 0x6505381227a65ULL, 0x4ea75979ce40fULL, 0x5383562a1a788ULL}},
+        {{0x009412a125b09ULL, 0x5fc3d40bacee8ULL, 0x6d2eb5546a854ULL, 0x741ce9cb0afa0ULL, 0x4d3f01737c970ULL},
+         {0x2d764bc555dabULL, 0x6b071d6a7b6b5ULL, 0x48c05a5ee97f0ULL, 0x6501919a08699ULL, 0x5c5fae3dda35dULL},
+         {0x4bcf30dc64db5ULL, 0x3028580fe95adULL, 0x032b07ae13415ULL, 0x386c552c76816ULL, 0x1ffcbff47ed4dULL}},
+        {{0x053560ca3b5f9ULL, 0x6ef1e3cfdd59cULL, 0x0b46226280080ULL, 0x0a14cc67b8709ULL, 0x4c970ed97e579ULL},
+         {0x79570feeb9fbdULL, 0x693a3b44fabfcULL, 0x5461cbe16b317ULL, 0x260f7525be739ULL, 0x2bc688ffc904fULL},
+         {0x308fc77bd6347ULL, 0x080493654b7eaULL, 0x323525bfcda99ULL, 0x67e251dde46f7ULL, 0x6ca460e8e30c3ULL}},
+        {{0x23f312a0a1843ULL, 0x0215736565193ULL, 0x24dafb200d4e9ULL, 0x5377d49eb82f0ULL, 0x1cf44eceb8ad6ULL},
+         {0x4b71faa366b70ULL, 0x2467659067548ULL, 0x2d0c21cf97f3fULL, 0x2910c55e81811ULL, 0x0c39c2a93805cULL},
+         {0x57a3ef3b32b09ULL, 0x74015e73d267bULL, 0x38269adb78b65ULL, 0x2cae40e067bf7ULL, 0x00be48e4dcea8ULL}},
+        {{0x463846e987114ULL, 0x21b5e34f9a8e1ULL, 0x0328d675b1c82ULL, 0x4fe08e9d19d92ULL, 0x7eccb6a93ec41ULL},
+         {0x0598ae038252bULL, 0x68bc4166a39b6ULL, 0x24caab90814c0ULL, 0x7759b9e21dbcaULL, 0x490cc63d6af42ULL},
+         {0x0b0bc2ec18381ULL, 0x3559864359927ULL, 0x0c11d13e79956ULL, 0x2a06e0805d1c0ULL, 0x61bd3607e874fULL}}
+    },
+    {
+        {{0x34c0c4082c438ULL, 0x639a7bbee5783ULL, 0x0c5a696250143ULL, 0x1c6a82ecc82a6ULL, 0x29357eadcb937ULL},
+         {0x494654daea4a5ULL, 0x210a90b4f4ceaULL, 0x414f5eb60d5f1ULL, 0x44ef65b01b814ULL, 0x04f192fcbf62dULL},
+         {0x3110fe3e58e86ULL, 0x762fcd8770170ULL, 0x716abdc7c45cfULL, 0x1d5cea483984eULL, 0x68fae073a563aULL}},
+        {{0x6d6d32afb87eaULL, 0x39b2406807b19ULL, 0x5af39b974bb7bULL, 0x15d411bcd1dd2ULL, 0x69d0848381817ULL},
+         {0x46d22fe86340eULL, 0x29037957bddbbULL, 0x25dabee48d97cULL, 0x4f9476c7498fbULL, 0x7c075f3f9afe7ULL},
+         {0x17cec6b022cb4ULL, 0x7b0381d6e72b3ULL, 0x2025add4ec3eaULL, 0x1200d1800c0bfULL, 0x06561ca1f5bdfULL}},
+        {{0x185ec39e3d79cULL, 0x067462d640e0bULL, 0x284d0187fd754ULL, 0x103250a166d3fULL, 0x418a2037f833fULL},
+         {0x4502e0f9210cfULL, 0x3f28460a463d6ULL, 0x2a82a6a4b8af9ULL, 0x569353e77f0ffULL, 0x08376284c80deULL},
+         {0x4e733aecb4f36ULL, 0x7f6b8fa90717eULL, 0x5ff5f57cd4c58ULL, 0x6aea8ff4b125aULL, 0x4d0e31bd531f0ULL}},
+        {{0x72c480e608fd9ULL, 0x68422825ce14dULL, 0x39d870ef5bceaULL, 0x2189c78b5ac87ULL, 0x1c73dc087204cULL},
+         {0x0fc5a5dd2e735ULL, 0x13da6340aa04fULL, 0x581dafa0dfa9fULL, 0x21a3563af56d1ULL, 0x170ea96c60205ULL},
+         {0x05cdedc46ca27ULL, 0x484ad9812ca51ULL, 0x1935641174859ULL, 0x2f50af47d08ccULL, 0x2514997de4229ULL}},
+        {{0x6fc78e6cf325dULL, 0x3e9fc46f4e011ULL, 0x7a77bde4d3100ULL, 0x78d9df8020351ULL, 0x5d09d90fd5fa1ULL},
+         {0x55efe12dd1809ULL, 0x5a4559181a25cULL, 0x045f33d91614cULL, 0x59bc4d902eeceULL, 0x431f2feb2fc9eULL},
+         {0x3f4b768101b88ULL, 0x7e9b23bcd297fULL, 0x33c31690fc004ULL, 0x255c06239500bULL, 0x0883f69455a5aULL}},
+        {{0x29ad567d17eb0ULL, 0x0d909865f0b25ULL, 0x16e4b22723ee2ULL, 0x0e7c3121ce360ULL, 0x14e0756988174ULL},
+         {0x2c10ebfc82c03ULL, 0x442881336faf3ULL, 0x0690c3eadb9a8ULL, 0x513f497adbe0bULL, 0x3f9e8c7d92793ULL},
+         {0x7d970e2d42051ULL, 0x499a1c4513003ULL, 0x7584fc4f97724ULL, 0x0163615f820efULL, 0x14d1e169d6feaULL}},
+        {{0x4881818c0150cULL, 0x2f987a678bea3ULL, 0x3dd542f16bb33ULL, 0x2914b028badc3ULL, 0x7cb874f3e5234ULL},
+         {0x350a6a85019b8ULL, 0x3b3681a47da66ULL, 0x0946b75f0303fULL, 0x239fd04527101ULL, 0x096faa4cdb1acULL},
+         {0x2b8eb0a1dbb11ULL, 0x0a268efebd492ULL, 0x6e56dfe50a34fULL, 0x6c64b2cd6b9deULL, 0x5114ea8ac91ddULL}},
+        {{0x0f128994d0e1bULL, 0x4b0bdb0c7c611ULL, 0x67befafbfc3d4ULL, 0x0cabe82f33bc8ULL, 0x0af4ecc09556dULL},
+         {0x47b898be750aaULL, 0x15a7e4b20189fULL, 0x379686bb1d0afULL, 0x062c40db492a7ULL, 0x0349b6d32fe21ULL},
+         {0x49be1dee44802ULL, 0x450f5789b46fcULL, 0x527778d787d54ULL, 0x66c80344cbda8ULL, 0x2962a76d5ce09ULL}}
+    },
+    {
+        {{0x1764a815ba514ULL, 0x1cdfef7459effULL, 0x28d11ed3b40c6ULL, 0x5ca28afd88fa8ULL, 0x708bc3a31cbe6ULL},
+         {0x1c86f8067a487ULL, 0x52c48c019e586ULL, 0x2dc251960e1f3ULL, 0x0e2612f3c9097ULL, 0x58a2f33e9548eULL},
+         {0x7880e3372eadbULL, 0x24487c0b85838ULL, 0x28633d3ea99f0ULL, 0x3ae83e09b198eULL, 0x43b6a83deb17cULL}},
+        {{0x4a5547445467aULL, 0x0b94b79ca54cbULL, 0x06760149da40bULL, 0x715afa93671eaULL, 0x2efd009733532ULL},
+         {0x1bf74fb8d9cbeULL, 0x2c88678b920c6ULL, 0x776ae2102f673ULL, 0x29bab076e8833ULL, 0x6788183fab197ULL},
+         {0x6c8139a227dacULL, 0x2e41fd08b44ccULL, 0x2463ac7871e50ULL, 0x728394707ea86ULL, 0x34c9f4c874e97ULL}},
+        {{0x44fbc3b15287dULL, 0x5b5cdade4905eULL, 0x38b1ac6e5b813ULL, 0x6d222aeaa9b81ULL, 0x0c1ae0f84b708ULL},
+         {0x4bab508d5978bULL, 0x4b18deb278f31ULL, 0x573a104f8c550ULL, 0x473ae4f5c73bdULL, 0x2300ba81eb408ULL},
+         {0x040271b7a058cULL, 0x045f68291df0cULL, 0x190a02f985499ULL, 0x3c8995fd97affULL, 0x3189af92d2640ULL}},
+        {{0x6e65b7b781d31ULL, 0x41ad6e5e0b36cULL, 0x46b485c94e898ULL, 0x5a4e28bf28c66ULL, 0x6a7260404778fULL},
+         {0x38ca4cb52d054ULL, 0x462e650cc46d5ULL, 0x7b86e82633a46ULL, 0x17b81460aee9bULL, 0x6c936ec11d4bcULL},
+         {0x7e80284c15836ULL, 0x1663c9853c873ULL, 0x6a0d2dd320801ULL, 0x7a5e4c97f0419ULL, 0x57fbf4fd920b6ULL}},
+        {{0x04f6b86a07be7ULL, 0x0650812dd1c7eULL, 0x42c3623f7442cULL, 0x0bff20e273c36ULL, 0x1c59ab1ee0de9ULL},
+         {0x7533f4a47c378ULL, 0x230cd19f97047ULL, 0x39434bd7967d8ULL, 0x6705239a606a2ULL, 0x534fbca2ca99eULL},
+         {0x4bb460df4992bULL, 0x62dcbec69465cULL, 0x61bb226160dffULL, 0x6464faed8a460ULL, 0x5ec08c42337cfULL}},
+        {{0x32150bff8bb29ULL, 0x51522491c4f40ULL, 0x5d02cc64806acULL, 0x1a8069793be04ULL, 0x548db968d77f9ULL},
+         {0x7f9ff3bde8380ULL, 0x77d1c49f89ca2ULL, 0x11ef2da502970ULL, 0x5cea4efe3023eULL, 0x346f1f52cf479ULL},
+         {0x7d4bfb37e9da0ULL, 0x19489d525e95bULL, 0x6e5cbda27ee9cULL, 0x3bbbb0e4fae22ULL, 0x58967330f74c4ULL}},
+        {{0x34dcf2938d5e2ULL, 0x7028b5fbc8ab7ULL, 0x37ca71ae8ed79ULL, 0x6aa4dfdbfc7edULL, 0x7c4aaac5b3297ULL},
+         {0x4a399a66ae439ULL, 0x0a46089f793d2ULL, 0x627a9aa0d0820ULL, 0x6c2eb06872f9eULL, 0x175f60dfb9ccdULL},
+         {0x1dc3422581913ULL, 0x168ac147a445cULL, 0x0f45980dd9304ULL, 0x400af969b3382ULL, 0x5d97da1e56cceULL}},
+        {{0x565ecc347efaaULL, 0x43c3a47d0687cULL, 0x072ba9bc518b3ULL, 0x09e2c9c35465fULL, 0x7001f62bf7f96ULL},
+         {0x703930588662fULL, 0x26181578848d9ULL, 0x7d2c3d6100fb7ULL, 0x5a3b9318147a0ULL, 0x56272ad1d743fULL},
+         {0x75457a65689b2ULL, 0x6617cb027e58bULL, 0x22f4ae299b5bdULL, 0x39eadd59cfd66ULL, 0x37da869117e15ULL}}
+    },
+    {
+        {{0x21dd440cdfd5dULL, 0x5f9307e09d316ULL, 0x4528e0ccb98b4ULL, 0x271464f4c6af4ULL, 0x3ddd8fab1b210ULL},
+         {0x08909a0018141ULL, 0x4d17bf67fdf11ULL, 0x4ec2d920a8acdULL, 0x18872f5265969ULL, 0x4bdcbe075691fULL},
+         {0x578e412f2e1c6ULL, 0x7b6c08df61c6aULL, 0x15a02fe0e1a0aULL, 0x73d971cf15460ULL, 0x6a99c74e4d28cULL}},
+        {{0x3e5394389f429ULL, 0x57908b485a5fbULL, 0x6d6f767373cb0ULL, 0x6a2186fefacf2ULL, 0x7d183c4b1eb78ULL},
+         {0x610a1ffd061a3ULL, 0x2df4f4ee9fcb8ULL, 0x4c276503276b6ULL, 0x0daf2ff9b2158ULL, 0x2275abc5f4065ULL},
+         {0x1fe56b2c4f9e2ULL, 0x0884781d9ba00ULL, 0x6d1f1572b6d0aULL, 0x4bd20bf42857dULL, 0x1dfbd7f64b25bULL}},
+        {{0x737c3516b281aULL, 0x2d66972fa05d0ULL, 0x53eda1077ca8cULL, 0x31a9997bd1931ULL, 0x346d917fbad24ULL},
+         {0x0820e115e5c27ULL, 0x43a371cc56c64ULL, 0x0a715103d34cfULL, 0x3610d428de520ULL, 0x7c883b7642982ULL},
+         {0x47ef12626228dULL, 0x2886d7b802fabULL, 0x0d541cf747f68ULL, 0x08a04d77c220aULL, 0x7ff0c934d9ca5ULL}},
+        {{0x7fceb58db90aeULL, 0x443ed858ce460ULL, 0x240c9b1f5071fULL, 0x3f0ac05ee2544ULL, 0x4e55357047345ULL},
+         {0x7ad47a96e7682ULL, 0x10e0c6cec81f5ULL, 0x64b247ea32ddaULL, 0x3ce66a731af71ULL, 0x28a7aa9ba8909ULL},
+         {0x171c1c83cf9f5ULL, 0x0a8ac301b5ff9ULL, 0x7ba6303934934ULL, 0x07d7d8900ddfdULL, 0x52cdc8275c9aeULL}},
+        {{0x1e34b4f857cb9ULL, 0x168d13dbb2ad0ULL, 0x3d860baadc8c1ULL, 0x791d3ee2b0d15ULL, 0x0ca3bbb654edcULL},
+         {0x1da3352eeee81ULL, 0x44b7fbd935c93ULL, 0x590b762e70832ULL, 0x3b2072072d6aeULL, 0x4573002fa2eb2ULL},
+         {0x641aaca4d5decULL, 0x41fc40c917f4bULL, 0x652002de02dbfULL, 0x7bdcc3427dae0ULL, 0x6f0787ab3f270ULL}},
+        {{0x7469d0082563fULL, 0x3f767130d3ae1ULL, 0x18636945db9d5ULL, 0x4fe36faafdbd0ULL, 0x080f632dd3f1eULL},
+         {0x759fef69eb2bfULL, 0x3e49cee8fb56fULL, 0x75c0582ab1196ULL, 0x2227e9861de35ULL, 0x15d0ca555eae3ULL},
+         {0x64ac535db28d6ULL, 0x6e242fe0405d8ULL, 0x596dbf38361c0ULL, 0x7bee54288c697ULL, 0x04d783191c266ULL}},
+        {{0x0c72df98ecbd2ULL, 0x7df8e83f5f358ULL, 0x0252292bae651ULL, 0x648e1b36169aaULL, 0x19536e1faa2c0ULL},
+         {0x01abd6b3a26edULL, 0x6b2008925a216ULL, 0x68178ff23b3c7ULL, 0x188f463408fd5ULL, 0x5a6f1be5cd57cULL},
+         {0x55b4a5ff9ec2dULL, 0x2ae890d87d4e5ULL, 0x4437938678551ULL, 0x33eebe2564f47ULL, 0x1e3177246ec77ULL}},
+        {{0x0e7e12844f77aULL, 0x333289ddaa01dULL, 0x1d2ce01352138ULL, 0x1bdc71d0f7f23ULL, 0x21fbf0423bbbcULL},
+         {0x6854ae6bb18bbULL, 0x334f1c5be5b08ULL, 0x5cc375e22ea4aULL, 0x29c30bf8692c9ULL, 0x63079128cc796ULL},
+         {0x314285e8d8f0eULL, 0x053a9db432cddULL, 0x37d2aecd9dbcaULL, 0x2a418a043aa58ULL, 0x28ebcb9fd70afULL}}
+    },
+    {
+        {{0x0026f9ade5956ULL, 0x1d7cf9a046f19ULL, 0x2580e03ef0ca2ULL, 0x76b78619cb530ULL, 0x4dbca7f65d400ULL},
+         {0x652066c7c18e4ULL, 0x3cb9757735a43ULL, 0x2349c0c275130ULL, 0x3cfd092dd38a7ULL, 0x284b03365b497ULL},
+         {0x2c94254b59b8aULL, 0x08ca018227f99ULL, 0x0ba6f5d4ad5c7ULL, 0x3a41d02f9e86eULL, 0x3558b06f58e37ULL}},
+        {{0x2fca2175d2bfbULL, 0x234194a028454ULL, 0x47599f2fb7b0aULL, 0x3d9642a574223ULL, 0x30bcd78ddb278ULL},
+         {0x766fed64498bfULL, 0x37311cb3f03f6ULL, 0x062ddcffa3029ULL, 0x320197e1ff78fULL, 0x4f5c1b85ae0a8ULL},
+         {0x5b171ddb58178ULL, 0x773e7b2aa40acULL, 0x1c1c66a454458ULL, 0x3b66a2b977186ULL, 0x0ba256350bcb6ULL}},
+        {{0x001893f14417eULL, 0x767148c58a275ULL, 0x1aa38f20abea6ULL, 0x3f1dee5d6e3a9ULL, 0x682d6fd64ffc8ULL},
+         {0x2db8734862346ULL, 0x0b28ec8a4e9aaULL, 0x5e63932cd0d03ULL, 0x510893a65a205ULL, 0x45a85f8569aa9ULL},
+         {0x245ce042e9dbaULL, 0x62e83293214ceULL, 0x611544cc13a23ULL, 0x4bba2bec0140dULL, 0x73a0bf8295d52ULL}},
+        {{0x3c47a5c4be2f8ULL, 0x2010c16ded60bULL, 0x35807bbcf5750ULL, 0x6d30da8cf5f82ULL, 0x6f25d96cd34b7ULL},
+         {0x2ee7e900f7eddULL, 0x49da75212ccc9ULL, 0x4284bc32ad792ULL, 0x589bd5b413268ULL, 0x6bdcd60f55105ULL},
+         {0x2212b3a8e46e9ULL, 0x5c4b5d97c8a4fULL, 0x485b72ecabda0ULL, 0x7b9caeea6eb1dULL, 0x290353dcd52eeULL}},
+        {{0x7a974539f0fceULL, 0x7a02ec2063737ULL, 0x3cceb397c2459ULL, 0x5d87e90e8c759ULL, 0x1d226643a411aULL},
+         {0x0df0333744245ULL, 0x540d7126c183bULL, 0x5981e512b7ed2ULL, 0x0b89e6545f0f2ULL, 0x0fb7e6e62f4f0ULL},
+         {0x008277c0bd65cULL, 0x0384ac0155f80ULL, 0x7140f2b67698bULL, 0x7d1c5a6ab4581ULL, 0x0743051270fddULL}},
+        {{0x64211b0548ca0ULL, 0x7250749bd3feeULL, 0x643059821dbf4ULL, 0x5a07ef2c985faULL, 0x05628f241d697ULL},
+         {0x1ca4e24355aa0ULL, 0x31b12f3ec1417ULL, 0x4db30ae39457fULL, 0x2e23fb42790aaULL, 0x139502b5cab6dULL},
+         {0x065c26a4e7c6bULL, 0x2458db1b097cbULL, 0x7ef7435cefdf8ULL, 0x133a33d0b30dfULL, 0x35c5d464e454eULL}},
+        {{0x55f3ca1516ea8ULL, 0x1cbade55dcdc1ULL, 0x78c98a230af2bULL, 0x053942ee7769fULL, 0x3065084a99e01ULL},
+         {0x1231690dd23d7ULL, 0x2dd5b1477934dULL, 0x5b1288e610df3ULL, 0x52236afd44417ULL, 0x349d731a6b90fULL},
+         {0x6ebb13aaef4a6ULL, 0x68ef1c1038ac8ULL, 0x2fd57bf52909cULL, 0x6da696ca2153eULL, 0x1146f553db04aULL}},
+        {{0x4b357179483c7ULL, 0x1a1b03e63b7ceULL, 0x06ce4ddeb0b8aULL, 0x6df23f3037325ULL, 0x40cb5179cd756ULL},
+         {0x5f3e936e02ec8ULL, 0x3b2ef08ed6455ULL, 0x07763094df12dULL, 0x7ecf47c2e10a0ULL, 0x58b52b799d388ULL},
+         {0x0c03651b66c59ULL, 0x118f3051b2a43ULL, 0x2edb6bcdbe39cULL, 0x74d8553234382ULL, 0x1aa9c8f109a45ULL}}
+    },
+    {
+        {{0x33b651f248116ULL, 0x64d50457b7868ULL, 0x74a75d7991fafULL, 0x66981708beb5cULL, 0x27193ac8b1ac2ULL},
+         {0x4ccc5c1791bf8ULL, 0x43f6dee979609ULL, 0x0c63481ccb3bdULL, 0x1c7e17119dbc2ULL, 0x51edcd8f72934ULL},
+         {0x69d449b71b2a4ULL, 0x5cec889e3d989ULL, 0x26352a7caf50fULL, 0x48f41196e25a5ULL, 0x7b49928c61966ULL}},
+        {{0x07a4eb22f284aULL, 0x2778dc43849d9ULL, 0x55147ecb2d643ULL, 0x7c37520e964c2ULL, 0x0e4651001c0d5ULL},
+         {0x573ee3d73bb58ULL, 0x6ff43ac9be644ULL, 0x3872444fd5161ULL, 0x6ebdff9904c3aULL, 0x7d20902ac4999ULL},
+         {0x53c9ab65b78acULL, 0x214d84b182af3ULL, 0x79f2de83c3d3aULL, 0x255fa6049f46aULL, 0x343066017c79cULL}},
+        {{0x1fd624097426fULL, 0x69595b41bb664ULL, 0x0fb74afcbd2b5ULL, 0x4874003f3cad4ULL, 0x4693c82179273ULL},
+         {0x2d0e77fc33eecULL, 0x616466a333768ULL, 0x66c07f2c4e15bULL, 0x7662d456a41e0ULL, 0x5ee61831692e5ULL},
+         {0x6c02f7f8002b5ULL, 0x62e56d6ebcdd7ULL, 0x2a447a0342c13ULL, 0x22cb11ac6623fULL, 0x0b4dda9daeb46ULL}},
+        {{0x27d8d9873d81fULL, 0x5dfebe6b33cd1ULL, 0x5bbee2846edd9ULL, 0x0ec393c7ddfd0ULL, 0x176f1c512af85ULL},
+         {0x586136fe1a246ULL, 0x3a8c86b8d386cULL, 0x484552ff21eb1ULL, 0x461c4fa77c0eaULL, 0x17ba1b2f38b01ULL},
+         {0x789d3278acf9aULL, 0x79e7dd34601ecULL, 0x5c4c30bd39783ULL, 0x36da2b4f78ed1ULL, 0x0a1066f7f8adaULL}},
+        {{0x28154e9e92c6cULL, 0x7df8cf7cb0959ULL, 0x6c04bf457a85dULL, 0x1da71cb46339aULL, 0x5ac8ee3d9b3b2ULL},
+         {0x24c1a7a3b5509ULL, 0x7b4ee8042d3f7ULL, 0x01c79b05b814bULL, 0x43bb3f36ef064ULL, 0x42ada9b8fb40aULL},
+         {0x73f17bc23d903ULL, 0x2769dd546c54fULL, 0x148f32dd6e067ULL, 0x6b731034f78ecULL, 0x2d112cb08e3a2ULL}},
+        {{0x15e902aecb7cfULL, 0x59b778d1ccc1dULL, 0x4c00b04aed616ULL, 0x72aaedc28f876ULL, 0x4b134ebd57bdbULL},
+         {0x6eee89eb9a2edULL, 0x49e5df9842fb9ULL, 0x4a6ef7a6e79beULL, 0x5559ac5b270d8ULL, 0x46bace538f478ULL},
+         {0x2fcc6b77754d1ULL, 0x4e2d8b16d94f0ULL, 0x06cd809a54827ULL, 0x65355ed7854faULL, 0x07f3e3f69c7b7ULL}},
+        {{0x3e7a3dab85879ULL, 0x61f8fd6b6a953ULL, 0x46ef8eb89f88cULL, 0x0334a8a398167ULL, 0x4020a6c67cc1eULL},
+         {0x4d76405b8d684ULL, 0x1c805ac2e20bcULL, 0x79c100339ee89ULL, 0x6d5b74f458837ULL, 0x7727f3e07cd88ULL},
+         {0x4cfd2939b8ba5ULL, 0x36321f6310af3ULL, 0x4b692758d2ef2ULL, 0x047da7ae82a52ULL, 0x3e48f3f0e603aULL}},
+        {{0x7e487cb48fa59ULL, 0x4b21f6410acc8ULL, 0x69b85b42c4ce8ULL, 0x77795c112727fULL, 0x0cb08b328fab3ULL},
+         {0x63ee653c66ed4ULL, 0x0f29cd35dfceeULL, 0x18a3e6deb5882ULL, 0x79dda30b63c91ULL, 0x4f1a168931fc3ULL},
+         {0x29eb43d200326ULL, 0x3a4278a24d923ULL, 0x0d1bcf164eadfULL, 0x07f0f0dd9d003ULL, 0x3c1b88617e38aULL}}
+    },
+    {
+        {{0x0c0c84b62adc0ULL, 0x29a1aa0777800ULL, 0x7793c3583f439ULL, 0x28614dfee11d9ULL, 0x65b184bb5bc52ULL},
+         {0x2f3b4b4bf82f8ULL, 0x1f7fd2555f052ULL, 0x60a7d4dfe5c59ULL, 0x251948a407e95ULL, 0x430c39c8b0cc8ULL},
+         {0x3bb5d4c4a4338ULL, 0x7125fabfc9502ULL, 0x1933b5a317e30ULL, 0x5a0d766d023f7ULL, 0x2a0d04f1dc0ecULL}},
+        {{0x13e83df5c6265ULL, 0x1a77919472f96ULL, 0x6e78cb25b24eeULL, 0x38798df3af10fULL, 0x753d317541a9fULL},
+         {0x13e365707e422ULL, 0x2591ce5e2a293ULL, 0x496acfcb0c40bULL, 0x38ed492c155caULL, 0x417ce5c87204fULL},
+         {0x542afa866b09dULL, 0x6be21dc2ed790ULL, 0x7f060a5bd6518ULL, 0x4b547fc743e1fULL, 0x09891266a437bULL}},
+        {{0x765a51ad3d206ULL, 0x5d39194e20ef0ULL, 0x0d94dd05df878ULL, 0x71318b70ab1ccULL, 0x3fbb817acec98ULL},
+         {0x5c0101884d403ULL, 0x2f526d1c90bb9ULL, 0x2b1f8f3f6f4c3ULL, 0x0d57cd0aee83dULL, 0x5dedd225c1bb5ULL},
+         {0x0f3c07f8fab44ULL, 0x6bdd4859f1ef6ULL, 0x04bac8b35f87eULL, 0x6caee7fab57c2ULL, 0x14902784a9521ULL}},
+        {{0x0537c516ed224ULL, 0x12bc77431941dULL, 0x3f02d2e169f1bULL, 0x2e1cf1db76ac7ULL, 0x0c2f303b0bc4cULL},
+         {0x5fb6b305bfc35ULL, 0x1622c64d6e016ULL, 0x5c02cec2e843eULL, 0x0197039a8d2f3ULL, 0x2c512af81bb16ULL},
+         {0x2495d919a2285ULL, 0x6fdf5dedbd850ULL, 0x11e8c2596c041ULL, 0x5280c63e70600ULL, 0x3efddb70ea5d3ULL}},
+        {{0x2278c25efbafcULL, 0x474b8e45e94ccULL, 0x57252812f11cfULL, 0x797ddc6218507ULL, 0x64cd6cdfa2d4cULL},
+         {0x1f280e5d94231ULL, 0x7a3402b7f9dc6ULL, 0x35d8bfc793b35ULL, 0x582aee9338e59ULL, 0x154cceadefc99ULL},
+         {0x7fb7c337fbca9ULL, 0x65710c55a2811ULL, 0x7da03e3139f84ULL, 0x117b789ed94c8ULL, 0x7a649dcc1b276ULL}},
+        {{0x1e8b3497068a1ULL, 0x5b9f7db7a3623ULL, 0x4478fce739912ULL, 0x5e0e1bb7890e2ULL, 0x77eee296fd1fcULL},
+         {0x44d4c5ff185b7ULL, 0x5451ac5b7e60fULL, 0x2ec96aea91976ULL, 0x5427f17e7e5afULL, 0x71f39cc09c3d0ULL},
+         {0x573c2ce8e1991ULL, 0x65d007ca21bb2ULL, 0x30b59ecdf25b7ULL, 0x317fd1cffe80dULL, 0x218dedfc90226ULL}},
+        {{0x035f59daf2b22ULL, 0x4160558c2e6c1ULL, 0x366a010d80441ULL, 0x5b6a1bbb2e2b8ULL, 0x483dff4ca1456ULL},
+         {0x6f1a6a4858197ULL, 0x0fa479300f217ULL, 0x6f1fde8684c33ULL, 0x3502947512fb8ULL, 0x7de8f6e44d51aULL},
+         {0x20cddc5a070a1ULL, 0x7ee8c048018ddULL, 0x59999db407f41ULL, 0x280b2c5914084ULL, 0x7e8ddab19622eULL}},
+        {{0x54319ad46f43cULL, 0x3b7deb3887de7ULL, 0x5789081827989ULL, 0x10e1a15d7c88fULL, 0x4a73faac687d9ULL},
+         {0x7ffef0683f9c2ULL, 0x76fe2e6bdb7d2ULL, 0x3023cf6582345ULL, 0x6b97b249d24a5ULL, 0x3076b57801e56ULL},
+         {0x6d5bef40233bbULL, 0x6069afcb5f06aULL, 0x60d104fad1d95ULL, 0x635c6ac52105fULL, 0x18dec12f1fee7ULL}}
+    },
+    {
+        {{0x1df78e3c0f097ULL, 0x22d05ce762082ULL, 0x2654428494d5aULL, 0x179a30034a4e7ULL, 0x754bcc299df12ULL},
+         {0x067d1382f57e1ULL, 0x419ee563f1ac3ULL, 0x5c7184efe1751ULL, 0x6edc37ae4f7d5ULL, 0x638370cef5dc6ULL},
+         {0x7b16eda61bc7fULL, 0x5c90384487ecbULL, 0x588b06c5d06daULL, 0x328dabad8bb88ULL, 0x66f9377b62516ULL}},
+        {{0x53cbc11b02de0ULL, 0x71147ebbeffdbULL, 0x2067361075a21ULL, 0x7644f9019cb68ULL, 0x0a753c675ff50ULL},
+         {0x1b554a75404adULL, 0x4152e5042de18ULL, 0x1d24b15cf6829ULL, 0x50e6c651aea3cULL, 0x0ae78bdd3d2d2ULL},
+         {0x208d432e910e4ULL, 0x207bc2494ef66ULL, 0x02282c9eb5862ULL, 0x12c293a96bb17ULL, 0x5e24442e1ba6bULL}},
+        {{0x2a1c65b4b66d3ULL, 0x2503a6c003e6cULL, 0x20f2ecfe24c2aULL, 0x057f31be1490fULL, 0x526b8fbf5b743ULL},
+         {0x05be8914985a8ULL, 0x37fdccf41fb2aULL, 0x27d00a120d612ULL, 0x5d0c67750841bULL, 0x10ccef4cd76d6ULL},
+         {0x02cba844b3735ULL, 0x2642da5e88e9eULL, 0x1466f2d72b887ULL, 0x23adcc81a372cULL, 0x02cc525be01d2ULL}},
+        {{0x55eaf91475de4ULL, 0x34af7600b636fULL, 0x6e818cbc934b0ULL, 0x58a407066d8e5ULL, 0x42b4a732f3365ULL},
+         {0x7a1a9cdc8666dULL, 0x6b2b75b381475ULL, 0x5526f4cbc6544ULL, 0x5da041761a99fULL, 0x6fd98424e9e46ULL},
+         {0x3bf4ff17d7aeaULL, 0x3ec60e220693bULL, 0x668946ade1db0ULL, 0x61fccaeb069aaULL, 0x1d877c47370a0ULL}},
+        {{0x4a3d15e0cc110ULL, 0x48d275cca517aULL, 0x7717fc53908a2ULL, 0x1ba226243b881ULL, 0x250bd694108f7ULL},
+         {0x6a3fc95d3a8f6ULL, 0x31b64b59c616aULL, 0x7e8c473c59ab0ULL, 0x106881abcdd09ULL, 0x767f820a95fe0ULL},
+         {0x59369a34f53c2ULL, 0x777836f003813ULL, 0x14d68050b06ebULL, 0x5bf1b573faca4ULL, 0x016a6585f0e02ULL}},
+        {{0x7cd0284fd3ffcULL, 0x3927391ebe63fULL, 0x70ff63a371d56ULL, 0x2e847f4e22a74ULL, 0x7230e8aa45495ULL},
+         {0x6d70ebc244ef4ULL, 0x77b3c85f2e313ULL, 0x2951e7d448e1cULL, 0x5cfaa2b6133a5ULL, 0x54781f8515d0eULL},
+         {0x587bcf10ba926ULL, 0x39dba2000413bULL, 0x55cafab7de2f8ULL, 0x3652075f7b8b5ULL, 0x75554b37ccd1cULL}},
+        {{0x4b067f141336eULL, 0x7c78504667d25ULL, 0x76e82b028f2cbULL, 0x6c6930b6337eaULL, 0x06eae3b34c393ULL},
+         {0x75b4f6eccd516ULL, 0x66d39b594dc44ULL, 0x2a8b848cd9ad7ULL, 0x0939c56ecfc60ULL, 0x051d979773d71ULL},
+         {0x664728b0e642cULL, 0x510fdae318cadULL, 0x7d124e5110b08ULL, 0x6c482d526d0b4ULL, 0x777797c743305ULL}},
+        {{0x06755e3cc8d11ULL, 0x0c6f77edd4119ULL, 0x600e08a9be3abULL, 0x63a8d48fd4439ULL, 0x240e13d43fc8dULL},
+         {0x6727b1a355507ULL, 0x097428caca0a8ULL, 0x6a7e7aa07c63aULL, 0x32958f35a619bULL, 0x00e29760353e7ULL},
+         {0x3a729e76ce31eULL, 0x2bd85224131fbULL, 0x1beacccb7d2a7ULL, 0x573eb2265ce88ULL, 0x034ead3c37345ULL}}
+    },
+    {
+        {{0x5dd169f7c93b2ULL, 0x1c92b165684e8ULL, 0x7486cdbbc3b49ULL, 0x61cd258133dd6ULL, 0x2da1412aa4efbULL},
+         {0x171d463eba290ULL, 0x1e281c8a2a91aULL, 0x1f4bfd2096e4bULL, 0x4790d39224363ULL, 0x7c2a74ceff821ULL},
+         {0x517afc55aec75ULL, 0x5aa24a75ef9e9ULL, 0x2c2a45571467aULL, 0x5dd11243f1f54ULL, 0x552ab106f3ab3ULL}},
+        {{0x330e61a0dec10ULL, 0x2f24ebd8dc753ULL, 0x68d992ecb7080ULL, 0x3a3f3591f3638ULL, 0x3a967cdb24c21ULL},
+         {0x3fe8ab831707cULL, 0x311cbe6f2ee16ULL, 0x57955027acab9ULL, 0x51a5180e2a3ebULL, 0x1478c9f4e3c9aULL},
+         {0x4ccf22465803eULL, 0x73f9426edc2d0ULL, 0x2be63998c5dc5ULL, 0x5f69de489669cULL, 0x4a971e966960bULL}},
+        {{0x6781c5f887ea5ULL, 0x57b30e714b90aULL, 0x591754d17aea9ULL, 0x06f2afd485577ULL, 0x0b1ca28f4a374ULL},
+         {0x7ea20fd5e6005ULL, 0x56abb38d7447fULL, 0x4efd32dd864daULL, 0x028c147314cd9ULL, 0x3e72ac2408cbbULL},
+         {0x690fd8bbdd9cfULL, 0x632a23e1b4009ULL, 0x28fa0c8f4d41fULL, 0x46e981aa1efa0ULL, 0x2b4e3d6c87578ULL}},
+        {{0x0373e9d160c82ULL, 0x2ba96543cc11fULL, 0x4f1ae16ef8a86ULL, 0x154c285f0f118ULL, 0x056d0ec371114ULL},
+         {0x514ef22bb14a6ULL, 0x59ff92c12830cULL, 0x7722871aeb00dULL, 0x1ebe86f9bcfd0ULL, 0x46dcd09b4914fULL},
+         {0x2a2f65515f0c8ULL, 0x701e9762af7fdULL, 0x6729c4060de81ULL, 0x1c73cf70fea0bULL, 0x2c01971f28e65ULL}},
+        {{0x5cb691ad8d4e1ULL, 0x5c6cb377c4afbULL, 0x444aacfb3d38bULL, 0x39f84cf89806aULL, 0x29e22e3c004b4ULL},
+         {0x448ac8dd8ab53ULL, 0x0de09a5f62b20ULL, 0x6f860ad31f496ULL, 0x39193d3241affULL, 0x596e211f2a6c6ULL},
+         {0x685702022e1e8ULL, 0x2831e383103b6ULL, 0x441408d6f01bfULL, 0x2ac9ab21d4684ULL, 0x3fcf5872d35f8ULL}},
+        {{0x777fb8fa0f114ULL, 0x08041cea8b29fULL, 0x61133dacf0d3eULL, 0x4ee1b79f3ed49ULL, 0x2aa4837e7ad3eULL},
+         {0x637032611fbbeULL, 0x13a69efe5507cULL, 0x4a287611f2aa5ULL, 0x6ed5d4498094aULL, 0x14588c95510a5ULL},
+         {0x3aaf229eadf0cULL, 0x4b2521c3e4835ULL, 0x3123daabdde92ULL, 0x574204437ec94ULL, 0x17134239f3474ULL}},
+        {{0x7db3ffa89c981ULL, 0x6369bc89d34c8ULL, 0x3e937b71f78d8ULL, 0x70988c4da7e05ULL, 0x086174a0755ffULL},
+         {0x161ef3cee7a97ULL, 0x6016121583208ULL, 0x0a1e09bc945c5ULL, 0x4eda40e3760f5ULL, 0x0e9898e76839eULL},
+         {0x5783fbbf33d84ULL, 0x2825cb34c44f2ULL, 0x730d180b1a9b9ULL, 0x038ba225d9caaULL, 0x68ebd501b7030ULL}},
+        {{0x1667c7c7b05edULL, 0x04257e97749dbULL, 0x14580e2b841f6ULL, 0x47693822e4b37ULL, 0x3aa7a28953c12ULL},
+         {0x23e06f035fc99ULL, 0x36ae4f13f8fdcULL, 0x5f3efb8a2ce3aULL, 0x0c25a15493b94ULL, 0x66e1744fc0bf4ULL},
+         {0x1fddf2298799dULL, 0x36541ffc2bc27ULL, 0x0575dce2946b7ULL, 0x7dbec89a17115ULL, 0x3d6df0fdfe9fbULL}}
+    },
+    {
+        {{0x1b1f2eada140bULL, 0x6bd026250390cULL, 0x14d4ef4c38319ULL, 0x15e68ff443d59ULL, 0x1f7bc9fc22b1cULL},
+         {0x121d515a6d119ULL, 0x6a20af2dc4bd5ULL, 0x6d11c382243eeULL, 0x583f6aea38eb6ULL, 0x75044ad895624ULL},
+         {0x4e5aa62293ca4ULL, 0x5a36cde11c6b7ULL, 0x1798592e98fcfULL, 0x6cc721354d194ULL, 0x3bf6bbe3dc6edULL}},
+        {{0x4cb303ac64da3ULL, 0x6e5fd1690e761ULL, 0x354b61d88d7e8ULL, 0x3f5c3949b9277ULL, 0x51f62b8b59e0dULL},
+         {0x53e4449dc3b56ULL, 0x16720ba9b3f1fULL, 0x6d4027d10e7b4ULL, 0x6f6962d5b0a1cULL, 0x6a0c479609fd5ULL},
+         {0x2cc33bb87a53cULL, 0x152a41d747b82ULL, 0x118d1c0692dd4ULL, 0x23c668ad2cd42ULL, 0x3fbd0eabff302ULL}},
+        {{0x0797d24ce0384ULL, 0x1d4cd20859111ULL, 0x3703695bb2f04ULL, 0x086fb7b02e1a4ULL, 0x250db9a413d8fULL},
+         {0x389201107a833ULL, 0x09db598f1c328ULL, 0x501df2ccb10e8ULL, 0x1d0d508a4c1caULL, 0x679cf3c00f947ULL},
+         {0x594361f8c4608ULL, 0x2014b0c86f843ULL, 0x3e311ef1db20aULL, 0x603664af2e06aULL, 0x1834a1cc0e06fULL}},
+        {{0x1e2ae795a9cd6ULL, 0x1b2854a7a1ca6ULL, 0x6b325dbf07210ULL, 0x0c96175499dccULL, 0x65801067316cbULL},
+         {0x53e495216b2c1ULL, 0x5f112e8d7a667ULL, 0x57ef48d410b08ULL, 0x68db9aeaa8501ULL, 0x1edf320d09295ULL},
+         {0x7d1c9db298cf7ULL, 0x08037032f6089ULL, 0x20cc72c6fcf0fULL, 0x07e3468bf440cULL, 0x7bfaa49364d99ULL}},
+        {{0x08f5b9999d5b2ULL, 0x2d4b4a2c371c7ULL, 0x17172a55696a6ULL, 0x4a8455dbd0398ULL, 0x30748a7e610ceULL},
+         {0x5bc32d8471f73ULL, 0x458b76c5aabd3ULL, 0x485b76c99c8b7ULL, 0x2a2fb3814b594ULL, 0x4155229525172ULL},
+         {0x0ac08d8db2697ULL, 0x0ea1f413cdf25ULL, 0x573f0db179f2cULL, 0x7a023407aa84dULL, 0x3aca54824041fULL}},
+        {{0x28dc5ea7e90b3ULL, 0x634f00b79d45bULL, 0x0ee456c943456ULL, 0x3cc65a5cdbb34ULL, 0x76716b69bbf47ULL},
+         {0x1910f6ae47b2bULL, 0x5c4acbf9f05abULL, 0x6dd033708e0e2ULL, 0x410a2e1d482ceULL, 0x184ee2b6f6501ULL},
+         {0x6dd2a09c9d0edULL, 0x6f3f9920621a9ULL, 0x4cf0a7e361416ULL, 0x4620fb420c252ULL, 0x580b275d9e1c8ULL}},
+        {{0x52c288feacc6eULL, 0x2dacb7419c420ULL, 0x78bc93273da6aULL, 0x6016b85016d5cULL, 0x6ca681504a170ULL},
+         {0x3835e23b5d8e0ULL, 0x557d2ff5db58cULL, 0x4604f8a4d362dULL, 0x6887a4fd81bbeULL, 0x5dd30df06782aULL},
+         {0x1ab63b77a5035ULL, 0x1a2d344345a51ULL, 0x39e54f65eb4d1ULL, 0x667887f1d4572ULL, 0x5994f920c3ae1ULL}},
+        {{0x5b70cb21b9977ULL, 0x67d87a4812edbULL, 0x0187ba8321824ULL, 0x3ac0bd09d18dcULL, 0x35e4293bfaed5ULL},
+         {0x64bc447d958a5ULL, 0x7f049b9568e99ULL, 0x17d7a9ab03a87ULL, 0x40228879541a0ULL, 0x0d2f6843c2e1aULL},
+         {0x255b3cb191eacULL, 0x63de1f621ca0fULL, 0x1800c130822cfULL, 0x4211180d81b42ULL, 0x2f36571bc828fULL}}
+    },
+    {
+        {{0x3f96e363d2aceULL, 0x1543af8336fe8ULL, 0x20f58b69d72a1ULL, 0x234fce0dfbb6eULL, 0x1f577413b22bcULL},
+         {0x6e342af08aeebULL, 0x02e1ee1a739f6ULL, 0x4d91094093ca7ULL, 0x047b6a2341362ULL, 0x1f6128bb4b9b7ULL},
+         {0x7ada5dcd5875aULL, 0x2d47252f509a7ULL, 0x55ed20d6c8ae7ULL, 0x0b810dc93887fULL, 0x09c9a04d3e60fULL}},
+        {{0x227912635c20fULL, 0x0df219698cf69ULL, 0x1a73525d110ebULL, 0x18683b170c1dbULL, 0x1c99d13eb2258ULL},
+         {0x50ad6bda144bcULL, 0x458a7a7da204cULL, 0x5b86a87780e1bULL, 0x2536a8f05caecULL, 0x011d0d7a0c68cULL},
+         {0x459c0566a6b8dULL, 0x6c91aafb15cf7ULL, 0x7b0c24a84938fULL, 0x6a4f2c67ec4ccULL, 0x25bb4ccbe5cacULL}},
+        {{0x5d0f935568321ULL, 0x7c28fa51dfbdeULL, 0x410c0d5694afdULL, 0x562249d9cd49dULL, 0x6ed9dbc477cebULL},
+         {0x5a5c06e7f3786ULL, 0x4c465c7b332b3ULL, 0x170c0c2cf3d92ULL, 0x0d13fa5b6d0c7ULL, 0x372cf577fe294ULL},
+         {0x7880ae7e85413ULL, 0x4b6545fe44ea1ULL, 0x280c55f2a2f08ULL, 0x21df7c0fd8f66ULL, 0x466cba8ee8610ULL}},
+        {{0x71ec8fe5a3a7dULL, 0x16e836304ee33ULL, 0x512d00838b4c8ULL, 0x5de1ccbb76323ULL, 0x2a53cbcc61640ULL},
+         {0x6a604fa108818ULL, 0x220f02feff753ULL, 0x3bc6c71e35b5dULL, 0x3c259942138b4ULL, 0x03ef20b0a7972ULL},
+         {0x3a96769ff9b93ULL, 0x62822d967053eULL, 0x737db92a68b36ULL, 0x78280ee8104c7ULL, 0x51e5cf7ec3bb6ULL}},
+        {{0x7f472194d5ab6ULL, 0x0aeae7ea64319ULL, 0x4a0750d68ac1cULL, 0x076eab50e29c2ULL, 0x59b7319e80cecULL},
+         {0x07b8825cac25eULL, 0x598bbd031c7e3ULL, 0x61a270bcc17c4ULL, 0x529c118a1c893ULL, 0x4a3ec81955dbeULL},
+         {0x473ea757231fcULL, 0x3520825ffb1f1ULL, 0x1234c4abcce1aULL, 0x41752a16929fcULL, 0x3079b3b750079ULL}},
+        {{0x6d9120f526a00ULL, 0x7bea139b5721eULL, 0x0373e7e3dcda9ULL, 0x7af305d789c3dULL, 0x57deeab41b29fULL},
+         {0x180d144154ea2ULL, 0x1c0bf6019fd7fULL, 0x21d229d20fe69ULL, 0x556ca8ca79aecULL, 0x5e3c69946b1deULL},
+         {0x4e49a3e407dc6ULL, 0x5b31ba55c5d00ULL, 0x33cf00f4b08baULL, 0x5d94d205effb9ULL, 0x63c86325668d1ULL}},
+        {{0x758bf723d59b9ULL, 0x052f687a3d560ULL, 0x1f6f0d7d813cfULL, 0x5e495621345bcULL, 0x0f5b84eaeb931ULL},
+         {0x4e45fe06af1d4ULL, 0x0d9c7bfab4856ULL, 0x4fffec03a6c41ULL, 0x4b931f02e70c4ULL, 0x5af140bb2bef5ULL},
+         {0x3b4e2d0ee1832ULL, 0x0d68d4eddee7cULL, 0x4331e17f9d4d1ULL, 0x075763346a862ULL, 0x71bc382a3d617ULL}},
+        {{0x4e3b7ed3ab4abULL, 0x48f730bf0f083ULL, 0x6cc1b1e465b84ULL, 0x3f8b3b9d1c99fULL, 0x456ac86b00f72ULL},
+         {0x6eacc9db46c45ULL, 0x5879a7c673d9fULL, 0x2f4633e2eab90ULL, 0x1cb8887d6f137ULL, 0x5d45e625c416eULL},
+         {0x160fad82260c8ULL, 0x551d5356a98eeULL, 0x07f65153fc8c9ULL, 0x5e3276b2c0e54ULL, 0x4007c7007f35dULL}}
+    },
+    {
+        {{0x43b9d33c5c508ULL, 0x31db2f0b18470ULL, 0x582a0bd65fd42ULL, 0x0a5bc993d5800ULL, 0x2ba22c331eeb8ULL},
+         {0x532d786962488ULL, 0x1b89685ac1af7ULL, 0x74919b11202abULL, 0x039118b9fb583ULL, 0x752800a6c6f88ULL},
+         {0x3809b5bee2560ULL, 0x1f6ae4c4fa4a0ULL, 0x4698e0c4a3927ULL, 0x4c886bb1f8a92ULL, 0x766e1039ebccaULL}},
+        {{0x57d809d3a9484ULL, 0x5aff2cd26d00bULL, 0x2a1bcb46a29a6ULL, 0x6389ef6f0b22eULL, 0x342be7c4a9c4dULL},
+         {0x190fdefcc2c2aULL, 0x1c6847ee1ab0eULL, 0x778151ccf22d8ULL, 0x5ad06e9fb66cdULL, 0x4fca87e1a2acfULL},
+         {0x4349fc5b74281ULL, 0x2855bcdca59beULL, 0x687613dda54e6ULL, 0x4141ff2dba9c7ULL, 0x1ba9a3c201f30ULL}},
+        {{0x0ddda83db5a06ULL, 0x456ec0e4bd7c3ULL, 0x3e73ec7c66320ULL, 0x20f96ab9d7795ULL, 0x5b26c8ef298b2ULL},
+         {0x73c075863fd5fULL, 0x22eef308dff7cULL, 0x64b0552e865acULL, 0x7ac1e9e62f1b9ULL, 0x2fadcf518ad62ULL},
+         {0x551359542473eULL, 0x6449ec41d4dd7ULL, 0x5a1367c518cd6ULL, 0x6bdf4dd32a5d6ULL, 0x1102e19812d15ULL}},
+        {{0x1bbbe0686aab4ULL, 0x099a447de6a54ULL, 0x2f4b650a3ac1cULL, 0x046ccf91253a3ULL, 0x7a2dc81cedfeaULL},
+         {0x328a463e09d3aULL, 0x3a58739d10ea0ULL, 0x7571e3e7849baULL, 0x75df940f8fe2cULL, 0x06490c5e58f58ULL},
+         {0x2791f22162173ULL, 0x27a4113338481ULL, 0x0e30ef251a8d3ULL, 0x1f752891c2f97ULL, 0x591cfaf03b92aULL}},
+        {{0x769d56639ab3bULL, 0x503a635209577ULL, 0x75234e1bdc822ULL, 0x7814fefa94ea0ULL, 0x52e14967b72b2ULL},
+         {0x7b28f13e97acfULL, 0x40785b093b521ULL, 0x4ce8c9aed724aULL, 0x5707871c85f2fULL, 0x491d70be75990ULL},
+         {0x1f7ca578b0e1fULL, 0x7f2c0bfeef461ULL, 0x30df2048e032cULL, 0x794818ed891b1ULL, 0x720a65c244690ULL}},
+        {{0x4ae6df14b2fc8ULL, 0x6ef3640a7b517ULL, 0x6a0033bdaff5fULL, 0x0178ab20d2898ULL, 0x37f3a2e39e112ULL},
+         {0x0132796a272f0ULL, 0x79a29c162e1ffULL, 0x66c3dcd3b7a84ULL, 0x1752e14119a3eULL, 0x52841ee26996dULL},
+         {0x139d51783551aULL, 0x44ee3802b4fe1ULL, 0x72b455cc4b045ULL, 0x731fd16dcd0d9ULL, 0x3adc3afce0994ULL}},
+        {{0x0b8e0b0773452ULL, 0x065198e919742ULL, 0x22a96efe834e7ULL, 0x26eff8d87cd47ULL, 0x797345d2e429fULL},
+         {0x40973f1736bbaULL, 0x7c19bf210ab1cULL, 0x6f589499763b3ULL, 0x67c01cac378c9ULL, 0x2a56b439d9b92ULL},
+         {0x54720e2d972daULL, 0x77867ff28960cULL, 0x10a8e435f3762ULL, 0x2785f7c0f93e9ULL, 0x6245bdc514402ULL}},
+        {{0x75f491017970bULL, 0x6b6e5d081e553ULL, 0x4e0457cb44f9cULL, 0x227016514e61aULL, 0x01b45baf51b4dULL},
+         {0x3d8e7706eb706ULL, 0x268f14e2662edULL, 0x4524ccbaf16bfULL, 0x4cccafe00c3cdULL, 0x545963ba49825ULL},
+         {0x72fdb18f6a0bcULL, 0x14ab0917f742eULL, 0x695d99deef4ccULL, 0x3f6cedc0d0224ULL, 0x4d9a9f5f8b163ULL}}
+    },
+    {
+        {{0x0dcb561e83b96ULL, 0x2bfb54a2dd229ULL, 0x21c4a11748022ULL, 0x2056b6036c1c0ULL, 0x0b09c6fc16cccULL},
+         {0x5fcbba0a43b3fULL, 0x6777b391baab8ULL, 0x43fa6f9b7d6f5ULL, 0x64a3930e00848ULL, 0x4ec63804cf290ULL},
+         {0x540a0b70c0d7bULL, 0x206088e940dd2ULL, 0x1e14e744b79f9ULL, 0x2db2536ac8382ULL, 0x098267551f6cbULL}},
+        {{0x7b2e76ecbde4dULL, 0x09cc4df91d4bbULL, 0x1880985e21911ULL, 0x38c5a9bdae109ULL, 0x02d1414013b0fULL},
+         {0x032f8e62b9e20ULL, 0x4953ee9995343ULL, 0x0e7e546b74e1aULL, 0x0a0ef6a4850d8ULL, 0x64721307c45ccULL},
+         {0x2de9242b10e70ULL, 0x08618a8b96e58ULL, 0x2b367963ee80fULL, 0x77d3f1eb77e0fULL, 0x102988191962aULL}},
+        {{0x0f55e526ae564ULL, 0x18bbb86bb66fdULL, 0x2b344323b7f85ULL, 0x74a694cd7455aULL, 0x1de134a2f4367ULL},
+         {0x02deeb2b90c9cULL, 0x13a3282179feeULL, 0x16a3af67fd230ULL, 0x563b46facc563ULL, 0x484c7a785c97bULL},
+         {0x09145dc8fe121ULL, 0x7d0a1b99ae8eaULL, 0x0285ded40a7a1ULL, 0x2a70422be71e4ULL, 0x5ec7bbf63d522ULL}},
+        {{0x12362cdd0e5fcULL, 0x5f24e3b00b469ULL, 0x4c353a0e80a21ULL, 0x7760b80d81c35ULL, 0x5a9a4371ddf43ULL},
+         {0x73b137c891642ULL, 0x453751aab9f07ULL, 0x017c487bb1604ULL, 0x6b51f2293fd5fULL, 0x7486a1e6abc81ULL},
+         {0x3057691a904c2ULL, 0x0e2c1973b2296ULL, 0x16c55e07545eeULL, 0x3c7882078d90cULL, 0x3cc9a57d8e04fULL}},
+        {{0x32f21eda51cabULL, 0x5958e252bba31ULL, 0x486df56f8b3d8ULL, 0x24fd2b9d1b045ULL, 0x66bba1617be70ULL},
+         {0x78c473ae16c77ULL, 0x0569d52bc7a85ULL, 0x1621f6ee79754ULL, 0x0220aa3eaa5e1ULL, 0x28ba1c482bc80ULL},
+         {0x6cc3f604dc9ccULL, 0x2e735ae6df249ULL, 0x7199c1e662169ULL, 0x4a1915631f846ULL, 0x003b88e82f028ULL}},
+        {{0x1e18b6d93dccdULL, 0x5389d5385feafULL, 0x6e90f12e4c035ULL, 0x60ca0c0c0dbefULL, 0x0ee0246e56f4dULL},
+         {0x0688cd6b3c0a0ULL, 0x7319f948157dfULL, 0x7fb5f0978429dULL, 0x31e8a31821568ULL, 0x00a96c5a6d5caULL},
+         {0x03d7389a32e3eULL, 0x4a50060644e83ULL, 0x7989bdfba9645ULL, 0x419a0a12183b0ULL, 0x7ddd291a8bdb0ULL}},
+        {{0x43377a45f012fULL, 0x4fd5d97a5d840ULL, 0x2fefe3d98d338ULL, 0x32a73ceb0f38dULL, 0x3eac1e7a63acbULL},
+         {0x5f4d7b59dde96ULL, 0x11dac8e420db6ULL, 0x7646c9afe24adULL, 0x5a4bb532dae02ULL, 0x453b4a295926fULL},
+         {0x160caf06072a3ULL, 0x1f343f9af13f8ULL, 0x41cbecf303413ULL, 0x7827c5a1a7442ULL, 0x63cbc2f9bb9b5ULL}},
+        {{0x7b5f42890d7faULL, 0x2eafed51e5c49ULL, 0x178545df4efccULL, 0x2c01065ed2b7bULL, 0x258b5509da2e7ULL},
+         {0x4e05426dbd648ULL, 0x66807b8b024d1ULL, 0x2439100a6b987ULL, 0x3a5f6b19f8cdbULL, 0x604b65f447a4aULL},
+         {0x04999731e9cc9ULL, 0x17ab44311d0f4ULL, 0x6edb0638cbe17ULL, 0x03049d90b70a7ULL, 0x022595026c9a8ULL}}
+    },
+    {
+        {{0x14bf0d402503fULL, 0x2178102b8c7daULL, 0x7665ccea10e23ULL, 0x79054162f8da0ULL, 0x13efdbf157242ULL},
+         {0x6d4d1716954c6ULL, 0x2c9d8af961645ULL, 0x00a94516a1e12ULL, 0x4d42e843399b7ULL, 0x1a5b2f9962565ULL},
+         {0x1a7b57a0946eaULL, 0x60f02564740b4ULL, 0x0659317d34b83ULL, 0x78ceaf380f477ULL, 0x55b1a29ec2e28ULL}},
+        {{0x6ffa1fad38646ULL, 0x0e510589e03deULL, 0x2269c6ae8219fULL, 0x2f6a73d643894ULL, 0x42556e642eceaULL},
+         {0x7d331977664d5ULL, 0x5c5a46dec3d46ULL, 0x17a4330e5b627ULL, 0x063ec9b1ff423ULL, 0x027e51b5efdc1ULL},
+         {0x5d16359e3e882ULL, 0x43641ffe8c57eULL, 0x21c5198aacebeULL, 0x7316cb985f97dULL, 0x6db8aed1efda7ULL}},
+        {{0x2fa113f764766ULL, 0x15c137ee18f0bULL, 0x6ded0e6680947ULL, 0x7089b3443813eULL, 0x1538d6b9e7a34ULL},
+         {0x68f11a58181a6ULL, 0x334f8be67b91cULL, 0x15bafe5132105ULL, 0x6c9862ce81945ULL, 0x1a665ee6dc908ULL},
+         {0x574a2dc855120ULL, 0x6c5440fb0a1cfULL, 0x054806a56b518ULL, 0x395c4f93e6b53ULL, 0x3bdbfc14acb97ULL}},
+        {{0x0eecd60c1694fULL, 0x58102200322d9ULL, 0x2d2a3f73bdbd0ULL, 0x08d9796cc9303ULL, 0x128d51a1ee126ULL},
+         {0x795225aa423b9ULL, 0x7437d9a2bc067ULL, 0x373f02627e882ULL, 0x63cab95ffc712ULL, 0x30ff8c1bee1f7ULL},
+         {0x57d7dabcd8f14ULL, 0x0e36d14e2d68cULL, 0x34125fe8ce99aULL, 0x6965cb0c45cf6ULL, 0x3a4b1b8ae87dcULL}},
+        {{0x4a65835ae5cb3ULL, 0x300ad0152f19aULL, 0x52813b25ccf6cULL, 0x5b7ac4c6d97d8ULL, 0x1569f3e8195aaULL},
+         {0x22e2fc4d12323ULL, 0x1711d27d0d6b2ULL, 0x2686d24655f5cULL, 0x465aa48981132ULL, 0x2b8afdcddee05ULL},
+         {0x02f39e44692c3ULL, 0x05ca43663ca52ULL, 0x3c893e7605750ULL, 0x4e5cd37201995ULL, 0x50adf61c54563ULL}},
+        {{0x568210e97ae82ULL, 0x00bb8d546d450ULL, 0x57e799b6948d1ULL, 0x3778596e9560aULL, 0x66416cce5ae00ULL},
+         {0x2d25083706c13ULL, 0x53a72d9544577ULL, 0x19a896df56975ULL, 0x222f21c36805dULL, 0x4fe17f8863e7dULL},
+         {0x19d81c20be5a2ULL, 0x6ea62008af11eULL, 0x655a726c620acULL, 0x75709167a5f03ULL, 0x55626d3f082cbULL}},
+        {{0x21620cb3d8b26ULL, 0x53a460b2e025bULL, 0x72985a214be79ULL, 0x02fabc2401fadULL, 0x05e0952932264ULL},
+         {0x76ff9017dc366ULL, 0x336a2c8527c0cULL, 0x7f5cf41d60266ULL, 0x748abae9a6078ULL, 0x382f50faf6183ULL},
+         {0x457e70cb70947ULL, 0x0b6e562266655ULL, 0x3c4e8723ab0c8ULL, 0x5df759183c4d7ULL, 0x2887ba3d51e51ULL}},
+        {{0x5a42201220758ULL, 0x3604a60f40d9eULL, 0x6231d20c90a45ULL, 0x1009a39f2b82bULL, 0x653c5e45e7542ULL},
+         {0x5610425630ad0ULL, 0x1af85c580b4cdULL, 0x187ae0530de8eULL, 0x07c53da43ea0cULL, 0x3244ec80a9516ULL},
+         {0x2526a4bf19c48ULL, 0x6a7e93e5e780aULL, 0x6a745dd52b0baULL, 0x06dee82f64a90ULL, 0x3e4e776e32cadULL}}
+    }
+};
+
+}  // namespace ecliptix::security::opaque::crypto::detail
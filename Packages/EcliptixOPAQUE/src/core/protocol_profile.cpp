@@ -0,0 +1,105 @@
+#include "opaque/protocol_profile.h"
+
+#include <algorithm>
+
+namespace ecliptix::security::opaque::profile {
+
+namespace {
+
+const uint8_t* take(const uint8_t* input, size_t length, secure_bytes& field) {
+  field.assign(input, input + length);
+  return input + length;
+}
+
+uint8_t* put(const secure_bytes& field, uint8_t* output) {
+  return std::copy(field.begin(), field.end(), output);
+}
+
+}  // namespace
+
+template <typename Profile>
+Result WireCodec<Profile>::serialize_ke2(const responder::KE2& ke2, uint8_t* output) {
+  if (output == nullptr ||
+      ke2.responder_nonce.size() != NONCE_LENGTH ||
+      ke2.responder_public_key.size() != PUBLIC_KEY_LENGTH ||
+      ke2.credential_response.size() != Layout::CREDENTIAL_RESPONSE_LENGTH ||
+      ke2.responder_mac.size() != Profile::Mac::LENGTH) {
+    return Result::InvalidInput;
+  }
+  uint8_t* cursor = put(ke2.responder_nonce, output + Layout::KE2_NONCE_OFFSET);
+  cursor = put(ke2.responder_public_key, cursor);
+  cursor = put(ke2.credential_response, cursor);
+  put(ke2.responder_mac, cursor);
+  return Result::Success;
+}
+
+template <typename Profile>
+Result WireCodec<Profile>::parse_ke2(const uint8_t* input, responder::KE2& ke2) {
+  if (input == nullptr) {
+    return Result::InvalidInput;
+  }
+  const uint8_t* cursor = take(input + Layout::KE2_NONCE_OFFSET, NONCE_LENGTH, ke2.responder_nonce);
+  cursor = take(cursor, PUBLIC_KEY_LENGTH, ke2.responder_public_key);
+  cursor = take(cursor, Layout::CREDENTIAL_RESPONSE_LENGTH, ke2.credential_response);
+  take(cursor, Profile::Mac::LENGTH, ke2.responder_mac);
+  return Result::Success;
+}
+
+template <typename Profile>
+Result WireCodec<Profile>::split_envelope(const uint8_t* input, Envelope& envelope) {
+  if (input == nullptr) {
+    return Result::InvalidInput;
+  }
+  const uint8_t* cursor = take(input, Profile::ENVELOPE_NONCE_LENGTH, envelope.nonce);
+  cursor = take(cursor, Profile::ENVELOPE_PLAINTEXT_LENGTH, envelope.ciphertext);
+  take(cursor, Profile::ENVELOPE_AUTH_TAG_LENGTH, envelope.auth_tag);
+  return Result::Success;
+}
+
+template <typename Profile>
+Result WireCodec<Profile>::join_envelope(const Envelope& envelope, uint8_t* output) {
+  if (output == nullptr ||
+      envelope.nonce.size() != Profile::ENVELOPE_NONCE_LENGTH ||
+      envelope.ciphertext.size() != Profile::ENVELOPE_PLAINTEXT_LENGTH ||
+      envelope.auth_tag.size() != Profile::ENVELOPE_AUTH_TAG_LENGTH) {
+    return Result::InvalidInput;
+  }
+  uint8_t* cursor = put(envelope.nonce, output);
+  cursor = put(envelope.ciphertext, cursor);
+  put(envelope.auth_tag, cursor);
+  return Result::Success;
+}
+
+template struct WireCodec<LegacyProfile>;
+template struct WireCodec<CurrentProfile>;
+
+Result serialize_ke2_for_credentials(
+    const ResponderCredentials& credentials,
+    const responder::KE2& ke2,
+    uint8_t* output,
+    size_t output_capacity,
+    size_t& written) {
+  written = 0;
+  return dispatch(version_for_envelope_length(credentials.envelope.size()), [&](auto profile) {
+    using Profile = decltype(profile);
+    if (output_capacity < WireLayout<Profile>::KE2_LENGTH) {
+      return Result::InvalidInput;
+    }
+    const Result result = WireCodec<Profile>::serialize_ke2(ke2, output);
+    if (result == Result::Success) {
+      written = WireLayout<Profile>::KE2_LENGTH;
+    }
+    return result;
+  });
+}
+
+Result parse_ke2_any(const uint8_t* input, size_t input_length, responder::KE2& ke2,
+                     ProtocolVersion& version) {
+  return dispatch(version_for_ke2_length(input_length), [&](auto profile) {
+    using Profile = decltype(profile);
+    version = Profile::VERSION;
+    return WireCodec<Profile>::parse_ke2(input, ke2);
+  });
+}
+
+}  // namespace ecliptix::security::opaque::profile
@@ -0,0 +1,440 @@
+#include "opaque/resumption.h"
+
+#include <sodium.h>
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace ecliptix::security::opaque::resumption {
+
+namespace {
+
+using Clock = std::chrono::system_clock;
+
+constexpr std::string_view RESUMPTION_LABEL = "ECLIPTIX-OPAQUE-Resumption";
+constexpr std::string_view BINDER_LABEL = "ECLIPTIX-OPAQUE-ResumeBinder";
+constexpr std::string_view SESSION_LABEL = "ECLIPTIX-OPAQUE-ResumeSession";
+constexpr std::string_view MAC_LABEL = "ECLIPTIX-OPAQUE-ResumeMAC";
+constexpr std::string_view NEXT_SECRET_LABEL = "ECLIPTIX-OPAQUE-ResumeNext";
+
+constexpr size_t KEY_ID_OFFSET = 1;
+constexpr size_t ISSUED_AT_OFFSET = KEY_ID_OFFSET + 4;
+constexpr size_t NONCE_OFFSET = ISSUED_AT_OFFSET + 8;
+constexpr size_t IDENTIFIER_LENGTH_OFFSET = RESUMPTION_SECRET_LENGTH;
+constexpr size_t IDENTIFIER_OFFSET = IDENTIFIER_LENGTH_OFFSET + 1;
+
+static_assert(TICKET_KEY_LENGTH == crypto_aead_xchacha20poly1305_ietf_KEYBYTES);
+static_assert(TICKET_NONCE_LENGTH == crypto_aead_xchacha20poly1305_ietf_NPUBBYTES);
+static_assert(TICKET_TAG_LENGTH == crypto_aead_xchacha20poly1305_ietf_ABYTES);
+static_assert(NONCE_OFFSET + TICKET_NONCE_LENGTH == TICKET_HEADER_LENGTH);
+static_assert(IDENTIFIER_OFFSET + TICKET_MAX_IDENTIFIER_LENGTH == TICKET_PLAINTEXT_LENGTH);
+static_assert(TICKET_MAX_IDENTIFIER_LENGTH <= UINT8_MAX);
+
+void store_le(uint8_t* out, uint64_t value, size_t length) {
+  for (size_t i = 0; i < length; ++i) {
+    out[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+uint64_t load_le(const uint8_t* in, size_t length) {
+  uint64_t value = 0;
+  for (size_t i = 0; i < length; ++i) {
+    value |= static_cast<uint64_t>(in[i]) << (8 * i);
+  }
+  return value;
+}
+
+int64_t unix_seconds(Clock::time_point time) {
+  return std::chrono::duration_cast<std::chrono::seconds>(time.time_since_epoch()).count();
+}
+
+Result expand_label(const uint8_t* prk, std::string_view label, uint8_t* output, size_t output_length) {
+  return crypto::key_derivation_expand(
+      prk, HASH_LENGTH,
+      reinterpret_cast<const uint8_t*>(label.data()), label.size(),
+      output, output_length);
+}
+
+Result compute_binder(const uint8_t* resumption_secret, const uint8_t* ticket_and_nonce, uint8_t* binder) {
+  std::array<uint8_t, MAC_LENGTH> binder_key{};
+  Result result = expand_label(resumption_secret, BINDER_LABEL, binder_key.data(), binder_key.size());
+  if (result == Result::Success) {
+    result = crypto::hmac(binder_key.data(), binder_key.size(),
+                          ticket_and_nonce, TICKET_LENGTH + NONCE_LENGTH, binder);
+  }
+  sodium_memzero(binder_key.data(), binder_key.size());
+  return result;
+}
+
+struct TicketPlaintext {
+  std::array<uint8_t, TICKET_PLAINTEXT_LENGTH> bytes{};
+
+  ~TicketPlaintext() {
+    sodium_memzero(bytes.data(), bytes.size());
+  }
+
+  [[nodiscard]] size_t identifier_length() const {
+    return bytes[IDENTIFIER_LENGTH_OFFSET];
+  }
+};
+
+struct HandshakeKeys {
+  std::array<uint8_t, HASH_LENGTH> session_key{};
+  std::array<uint8_t, MAC_LENGTH> mac_key{};
+  std::array<uint8_t, RESUMPTION_SECRET_LENGTH> next_secret{};
+
+  ~HandshakeKeys() {
+    sodium_memzero(session_key.data(), session_key.size());
+    sodium_memzero(mac_key.data(), mac_key.size());
+    sodium_memzero(next_secret.data(), next_secret.size());
+  }
+};
+
+Result derive_handshake_keys(
+    const uint8_t* resumption_secret,
+    const uint8_t* initiator_nonce,
+    const uint8_t* responder_nonce,
+    HandshakeKeys& keys) {
+  std::array<uint8_t, 2 * NONCE_LENGTH> salt{};
+  std::copy(initiator_nonce, initiator_nonce + NONCE_LENGTH, salt.begin());
+  std::copy(responder_nonce, responder_nonce + NONCE_LENGTH, salt.begin() + NONCE_LENGTH);
+
+  std::array<uint8_t, HASH_LENGTH> prk{};
+  Result result = crypto::key_derivation_extract(
+      salt.data(), salt.size(), resumption_secret, RESUMPTION_SECRET_LENGTH, prk.data());
+  if (result == Result::Success) {
+    result = expand_label(prk.data(), SESSION_LABEL, keys.session_key.data(), keys.session_key.size());
+  }
+  if (result == Result::Success) {
+    result = expand_label(prk.data(), MAC_LABEL, keys.mac_key.data(), keys.mac_key.size());
+  }
+  if (result == Result::Success) {
+    result = expand_label(prk.data(), NEXT_SECRET_LABEL, keys.next_secret.data(), keys.next_secret.size());
+  }
+  sodium_memzero(prk.data(), prk.size());
+  return result;
+}
+
+Result compute_responder_mac(
+    const HandshakeKeys& keys,
+    const uint8_t* request,
+    const uint8_t* responder_nonce,
+    const uint8_t* next_ticket,
+    uint8_t* mac) {
+  secure_bytes transcript;
+  transcript.reserve(TICKET_LENGTH + 2 * NONCE_LENGTH + TICKET_LENGTH);
+  transcript.insert(transcript.end(), request, request + TICKET_LENGTH + NONCE_LENGTH);
+  transcript.insert(transcript.end(), responder_nonce, responder_nonce + NONCE_LENGTH);
+  transcript.insert(transcript.end(), next_ticket, next_ticket + TICKET_LENGTH);
+  return crypto::hmac(keys.mac_key.data(), keys.mac_key.size(), transcript.data(), transcript.size(), mac);
+}
+
+}  // namespace
+
+ResumptionTicket::ResumptionTicket() = default;
+ResumptionTicket::~ResumptionTicket() = default;
+
+ResumptionState::ResumptionState() = default;
+ResumptionState::~ResumptionState() = default;
+
+Result derive_resumption_secret(const secure_bytes& session_key, secure_bytes& resumption_secret) {
+  if (session_key.empty()) {
+    return Result::InvalidInput;
+  }
+
+  std::array<uint8_t, HASH_LENGTH> prk{};
+  Result result = crypto::key_derivation_extract(nullptr, 0, session_key.data(), session_key.size(), prk.data());
+  if (result == Result::Success) {
+    resumption_secret.resize(RESUMPTION_SECRET_LENGTH);
+    result = expand_label(prk.data(), RESUMPTION_LABEL, resumption_secret.data(), resumption_secret.size());
+  }
+  sodium_memzero(prk.data(), prk.size());
+  return result;
+}
+
+Result create_resume_request(const ResumptionTicket& ticket, ResumptionState& state, secure_bytes& request) {
+  if (ticket.ticket.size() != TICKET_LENGTH ||
+      ticket.resumption_secret.size() != RESUMPTION_SECRET_LENGTH) {
+    return Result::InvalidInput;
+  }
+
+  state.current.ticket = ticket.ticket;
+  state.current.resumption_secret = ticket.resumption_secret;
+  state.initiator_nonce.resize(NONCE_LENGTH);
+  if (const Result result = crypto::random_bytes(state.initiator_nonce.data(), NONCE_LENGTH);
+      result != Result::Success) {
+    return result;
+  }
+
+  request.resize(RESUME_REQUEST_LENGTH);
+  std::copy(ticket.ticket.begin(), ticket.ticket.end(), request.begin());
+  std::copy(state.initiator_nonce.begin(), state.initiator_nonce.end(), request.begin() + TICKET_LENGTH);
+  return compute_binder(ticket.resumption_secret.data(), request.data(),
+                        request.data() + TICKET_LENGTH + NONCE_LENGTH);
+}
+
+Result finish_resume(
+    const uint8_t* response,
+    size_t response_length,
+    const ResumptionState& state,
+    ResumptionTicket& next,
+    secure_bytes& session_key) {
+  if (response == nullptr || response_length != RESUME_RESPONSE_LENGTH ||
+      state.current.ticket.size() != TICKET_LENGTH ||
+      state.current.resumption_secret.size() != RESUMPTION_SECRET_LENGTH ||
+      state.initiator_nonce.size() != NONCE_LENGTH) {
+    return Result::InvalidInput;
+  }
+
+  const uint8_t* responder_nonce = response;
+  const uint8_t* responder_mac = response + NONCE_LENGTH;
+  const uint8_t* next_ticket = responder_mac + MAC_LENGTH;
+
+  HandshakeKeys keys;
+  if (const Result result = derive_handshake_keys(
+          state.current.resumption_secret.data(), state.initiator_nonce.data(), responder_nonce, keys);
+      result != Result::Success) {
+    return result;
+  }
+
+  std::array<uint8_t, TICKET_LENGTH + NONCE_LENGTH> request{};
+  std::copy(state.current.ticket.begin(), state.current.ticket.end(), request.begin());
+  std::copy(state.initiator_nonce.begin(), state.initiator_nonce.end(), request.begin() + TICKET_LENGTH);
+
+  std::array<uint8_t, MAC_LENGTH> expected_mac{};
+  if (const Result result = compute_responder_mac(keys, request.data(), responder_nonce, next_ticket,
+                                                  expected_mac.data());
+      result != Result::Success) {
+    return result;
+  }
+  if (sodium_memcmp(expected_mac.data(), responder_mac, MAC_LENGTH) != 0) {
+    return Result::AuthenticationError;
+  }
+
+  next.ticket.assign(next_ticket, next_ticket + TICKET_LENGTH);
+  next.resumption_secret.assign(keys.next_secret.begin(), keys.next_secret.end());
+  session_key.assign(keys.session_key.begin(), keys.session_key.end());
+  return Result::Success;
+}
+
+class TicketIssuer::Impl {
+ public:
+  struct TicketKey {
+    uint32_t id = 0;
+    Clock::time_point created;
+    SecureBuffer material{TICKET_KEY_LENGTH};
+    std::set<std::array<uint8_t, TICKET_NONCE_LENGTH>> redeemed;
+  };
+
+  explicit Impl(const TicketKeyConfig& config) : config_(config) {
+    if (sodium_init() < 0) {
+      throw std::runtime_error("Failed to initialize libsodium");
+    }
+    keys_.emplace_back();
+    generate(keys_.back(), randombytes_random(), Clock::now());
+  }
+
+  void rotate(Clock::time_point now) {
+    std::unique_lock lock(mutex_);
+    rotate_locked(now);
+  }
+
+  void rotate_if_due(Clock::time_point now) {
+    {
+      std::shared_lock lock(mutex_);
+      if (now - keys_.back().created < config_.rotation_interval) {
+        return;
+      }
+    }
+    std::unique_lock lock(mutex_);
+    if (now - keys_.back().created >= config_.rotation_interval) {
+      rotate_locked(now);
+    }
+  }
+
+  Result seal(const TicketPlaintext& plaintext, uint8_t* ticket, Clock::time_point now) const {
+    std::shared_lock lock(mutex_);
+    const TicketKey& key = keys_.back();
+
+    ticket[0] = TICKET_VERSION;
+    store_le(ticket + KEY_ID_OFFSET, key.id, 4);
+    store_le(ticket + ISSUED_AT_OFFSET, static_cast<uint64_t>(unix_seconds(now)), 8);
+    randombytes_buf(ticket + NONCE_OFFSET, TICKET_NONCE_LENGTH);
+
+    unsigned long long ciphertext_length = 0;
+    if (crypto_aead_xchacha20poly1305_ietf_encrypt(
+            ticket + TICKET_HEADER_LENGTH, &ciphertext_length,
+            plaintext.bytes.data(), plaintext.bytes.size(),
+            ticket, NONCE_OFFSET,
+            nullptr, ticket + NONCE_OFFSET, key.material.data()) != 0) {
+      return Result::CryptoError;
+    }
+    return Result::Success;
+  }
+
+  Result open(const uint8_t* ticket, TicketPlaintext& plaintext, Clock::time_point now) const {
+    if (ticket[0] != TICKET_VERSION) {
+      return Result::ValidationError;
+    }
+
+    const auto key_id = static_cast<uint32_t>(load_le(ticket + KEY_ID_OFFSET, 4));
+    const auto issued_at = static_cast<int64_t>(load_le(ticket + ISSUED_AT_OFFSET, 8));
+    const int64_t age = unix_seconds(now) - issued_at;
+    if (age < 0 || age > config_.ticket_lifetime.count()) {
+      return Result::ValidationError;
+    }
+
+    std::shared_lock lock(mutex_);
+    for (const TicketKey& key : keys_) {
+      if (key.id != key_id) {
+        continue;
+      }
+      unsigned long long plaintext_length = 0;
+      if (crypto_aead_xchacha20poly1305_ietf_decrypt(
+              plaintext.bytes.data(), &plaintext_length, nullptr,
+              ticket + TICKET_HEADER_LENGTH, TICKET_LENGTH - TICKET_HEADER_LENGTH,
+              ticket, NONCE_OFFSET,
+              ticket + NONCE_OFFSET, key.material.data()) != 0) {
+        return Result::AuthenticationError;
+      }
+      const size_t identifier_length = plaintext.identifier_length();
+      return identifier_length == 0 || identifier_length > TICKET_MAX_IDENTIFIER_LENGTH
+                 ? Result::ValidationError
+                 : Result::Success;
+    }
+    return Result::ValidationError;
+  }
+
+  // Records the ticket nonce against its key; a second redemption, or a
+  // ticket whose key was retired since it was opened, is refused.
+  Result redeem(const uint8_t* ticket) {
+    const auto key_id = static_cast<uint32_t>(load_le(ticket + KEY_ID_OFFSET, 4));
+    std::array<uint8_t, TICKET_NONCE_LENGTH> nonce{};
+    std::copy_n(ticket + NONCE_OFFSET, nonce.size(), nonce.begin());
+
+    std::unique_lock lock(mutex_);
+    const auto key = std::find_if(keys_.begin(), keys_.end(),
+                                  [key_id](const TicketKey& candidate) { return candidate.id == key_id; });
+    if (key == keys_.end() || !key->redeemed.insert(nonce).second) {
+      return Result::ValidationError;
+    }
+    return Result::Success;
+  }
+
+ private:
+  void rotate_locked(Clock::time_point now) {
+    const auto retention = config_.rotation_interval + config_.ticket_lifetime;
+    std::erase_if(keys_, [&](const TicketKey& key) { return now - key.created > retention; });
+
+    uint32_t id = randombytes_random();
+    while (std::any_of(keys_.begin(), keys_.end(), [id](const TicketKey& key) { return key.id == id; })) {
+      id = randombytes_random();
+    }
+    keys_.emplace_back();
+    generate(keys_.back(), id, now);
+  }
+
+  static void generate(TicketKey& key, uint32_t id, Clock::time_point now) {
+    key.id = id;
+    key.created = now;
+    randombytes_buf(key.material.data(), key.material.size());
+  }
+
+  const TicketKeyConfig config_;
+  mutable std::shared_mutex mutex_;
+  std::vector<TicketKey> keys_;
+};
+
+TicketIssuer::TicketIssuer(const TicketKeyConfig& config)
+    : impl_(std::make_unique<Impl>(config)) {}
+
+TicketIssuer::~TicketIssuer() = default;
+
+void TicketIssuer::rotate() {
+  impl_->rotate(Clock::now());
+}
+
+Result TicketIssuer::issue_ticket(
+    const secure_bytes& credential_identifier,
+    const secure_bytes& resumption_secret,
+    secure_bytes& ticket) {
+  if (credential_identifier.empty() || credential_identifier.size() > TICKET_MAX_IDENTIFIER_LENGTH ||
+      resumption_secret.size() != RESUMPTION_SECRET_LENGTH) {
+    return Result::InvalidInput;
+  }
+
+  TicketPlaintext plaintext;
+  std::copy(resumption_secret.begin(), resumption_secret.end(), plaintext.bytes.begin());
+  plaintext.bytes[IDENTIFIER_LENGTH_OFFSET] = static_cast<uint8_t>(credential_identifier.size());
+  std::copy(credential_identifier.begin(), credential_identifier.end(),
+            plaintext.bytes.begin() + IDENTIFIER_OFFSET);
+
+  const auto now = Clock::now();
+  impl_->rotate_if_due(now);
+  ticket.resize(TICKET_LENGTH);
+  return impl_->seal(plaintext, ticket.data(), now);
+}
+
+Result TicketIssuer::resume(
+    const uint8_t* request,
+    size_t request_length,
+    secure_bytes& response,
+    secure_bytes& session_key,
+    secure_bytes& credential_identifier) {
+  if (request == nullptr || request_length != RESUME_REQUEST_LENGTH) {
+    return Result::InvalidInput;
+  }
+
+  const auto now = Clock::now();
+  TicketPlaintext plaintext;
+  std::array<uint8_t, MAC_LENGTH> binder{};
+  Result result = impl_->open(request, plaintext, now);
+  if (result == Result::Success) {
+    result = compute_binder(plaintext.bytes.data(), request, binder.data());
+  }
+  if (result == Result::Success &&
+      sodium_memcmp(binder.data(), request + TICKET_LENGTH + NONCE_LENGTH, MAC_LENGTH) != 0) {
+    result = Result::AuthenticationError;
+  }
+  if (result == Result::Success) {
+    result = impl_->redeem(request);
+  }
+
+  HandshakeKeys keys;
+  response.resize(RESUME_RESPONSE_LENGTH);
+  uint8_t* responder_nonce = response.data();
+  uint8_t* responder_mac = responder_nonce + NONCE_LENGTH;
+  uint8_t* next_ticket = responder_mac + MAC_LENGTH;
+  if (result == Result::Success) {
+    result = crypto::random_bytes(responder_nonce, NONCE_LENGTH);
+  }
+  if (result == Result::Success) {
+    result = derive_handshake_keys(plaintext.bytes.data(), request + TICKET_LENGTH, responder_nonce, keys);
+  }
+
+  if (result == Result::Success) {
+    std::copy(keys.next_secret.begin(), keys.next_secret.end(), plaintext.bytes.begin());
+    impl_->rotate_if_due(now);
+    result = impl_->seal(plaintext, next_ticket, now);
+  }
+  if (result == Result::Success) {
+    result = compute_responder_mac(keys, request, responder_nonce, next_ticket, responder_mac);
+  }
+  if (result != Result::Success) {
+    response.clear();
+    return result;
+  }
+
+  session_key.assign(keys.session_key.begin(), keys.session_key.end());
+  const auto identifier = plaintext.bytes.begin() + IDENTIFIER_OFFSET;
+  credential_identifier.assign(identifier, identifier + plaintext.identifier_length());
+  return Result::Success;
+}
+
+}  // namespace ecliptix::security::opaque::resumption
@@ -0,0 +1,177 @@
+#pragma once
+#include <sodium.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace ecliptix::security::opaque::detail {
+
+using CacheDigest = std::array<uint8_t, 32>;
+
+struct CacheDigestHash {
+  size_t operator()(const CacheDigest& digest) const noexcept {
+    size_t value = 0;
+    for (size_t i = 0; i < sizeof(size_t); ++i) {
+      value = (value << 8) | digest[i];
+    }
+    return value;
+  }
+};
+
+// Sharded LRU of fixed-size secret values keyed by a 32-byte digest.
+// Values live in sodium_malloc'd slabs (guard pages, mlock) and are wiped
+// when evicted or cleared.
+template <size_t ValueLength>
+class SecureLruCache {
+ public:
+  SecureLruCache(size_t capacity, size_t shard_count)
+      : shard_count_(std::max<size_t>(1, shard_count)),
+        shard_capacity_(static_cast<uint32_t>(std::max<size_t>(1, (capacity + shard_count_ - 1) / shard_count_))),
+        shards_(std::make_unique<Shard[]>(shard_count_)) {
+    if (sodium_init() < 0) {
+      throw std::runtime_error("Failed to initialize libsodium");
+    }
+    for (size_t i = 0; i < shard_count_; ++i) {
+      Shard& shard = shards_[i];
+      shard.values = static_cast<uint8_t*>(sodium_malloc(size_t{shard_capacity_} * ValueLength));
+      if (shard.values == nullptr) {
+        throw std::bad_alloc();
+      }
+      shard.digests.resize(shard_capacity_);
+      shard.prev.resize(shard_capacity_, NIL);
+      shard.next.resize(shard_capacity_, NIL);
+      shard.index.reserve(shard_capacity_);
+    }
+  }
+
+  SecureLruCache(const SecureLruCache&) = delete;
+  SecureLruCache& operator=(const SecureLruCache&) = delete;
+
+  [[nodiscard]] bool lookup(const CacheDigest& digest, uint8_t* value) {
+    Shard& shard = shard_for(digest);
+    std::lock_guard lock(shard.mutex);
+    const auto found = shard.index.find(digest);
+    if (found == shard.index.end()) {
+      return false;
+    }
+    touch(shard, found->second);
+    std::copy_n(shard.values + size_t{found->second} * ValueLength, ValueLength, value);
+    return true;
+  }
+
+  void insert(const CacheDigest& digest, const uint8_t* value) {
+    Shard& shard = shard_for(digest);
+    std::lock_guard lock(shard.mutex);
+    if (const auto found = shard.index.find(digest); found != shard.index.end()) {
+      touch(shard, found->second);
+      return;
+    }
+
+    uint32_t slot;
+    if (shard.size < shard_capacity_) {
+      slot = shard.size++;
+    } else {
+      slot = shard.tail;
+      unlink(shard, slot);
+      shard.index.erase(shard.digests[slot]);
+      evictions_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::copy_n(value, ValueLength, shard.values + size_t{slot} * ValueLength);
+    shard.digests[slot] = digest;
+    shard.index.emplace(digest, slot);
+    push_front(shard, slot);
+  }
+
+  void clear() {
+    for (size_t i = 0; i < shard_count_; ++i) {
+      Shard& shard = shards_[i];
+      std::lock_guard lock(shard.mutex);
+      sodium_memzero(shard.values, size_t{shard_capacity_} * ValueLength);
+      shard.index.clear();
+      shard.head = NIL;
+      shard.tail = NIL;
+      shard.size = 0;
+    }
+  }
+
+  [[nodiscard]] size_t size() const {
+    size_t total = 0;
+    for (size_t i = 0; i < shard_count_; ++i) {
+      std::lock_guard lock(shards_[i].mutex);
+      total += shards_[i].size;
+    }
+    return total;
+  }
+
+  [[nodiscard]] uint64_t evictions() const {
+    return evictions_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  static constexpr uint32_t NIL = UINT32_MAX;
+
+  struct Shard {
+    std::mutex mutex;
+    uint8_t* values = nullptr;
+    std::vector<CacheDigest> digests;
+    std::vector<uint32_t> prev;
+    std::vector<uint32_t> next;
+    std::unordered_map<CacheDigest, uint32_t, CacheDigestHash> index;
+    uint32_t head = NIL;
+    uint32_t tail = NIL;
+    uint32_t size = 0;
+
+    ~Shard() {
+      if (values != nullptr) {
+        sodium_free(values);
+      }
+    }
+  };
+
+  Shard& shard_for(const CacheDigest& digest) const {
+    size_t value = 0;
+    for (size_t i = sizeof(size_t); i < 2 * sizeof(size_t); ++i) {
+      value = (value << 8) | digest[i];
+    }
+    return shards_[value % shard_count_];
+  }
+
+  static void touch(Shard& shard, uint32_t slot) {
+    if (shard.head != slot) {
+      unlink(shard, slot);
+      push_front(shard, slot);
+    }
+  }
+
+  static void unlink(Shard& shard, uint32_t slot) {
+    const uint32_t prev = shard.prev[slot];
+    const uint32_t next = shard.next[slot];
+    (prev == NIL ? shard.head : shard.next[prev]) = next;
+    (next == NIL ? shard.tail : shard.prev[next]) = prev;
+    shard.prev[slot] = NIL;
+    shard.next[slot] = NIL;
+  }
+
+  static void push_front(Shard& shard, uint32_t slot) {
+    shard.prev[slot] = NIL;
+    shard.next[slot] = shard.head;
+    (shard.head == NIL ? shard.tail : shard.prev[shard.head]) = slot;
+    shard.head = slot;
+  }
+
+  const size_t shard_count_;
+  const uint32_t shard_capacity_;
+  std::unique_ptr<Shard[]> shards_;
+  std::atomic<uint64_t> evictions_{0};
+};
+
+}  // namespace ecliptix::security::opaque::detail
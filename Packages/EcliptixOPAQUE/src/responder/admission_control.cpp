@@ -0,0 +1,264 @@
+#include "opaque/admission_control.h"
+
+#include <sodium.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace ecliptix::security::opaque::responder {
+
+namespace {
+
+using SteadyClock = std::chrono::steady_clock;
+
+constexpr unsigned TIME_BITS = 40;
+constexpr uint64_t TIME_MASK = (uint64_t{1} << TIME_BITS) - 1;
+constexpr double TOKEN_SCALE = 256.0;
+constexpr uint64_t ONE_TOKEN = 256;
+constexpr uint64_t MAX_USED = (uint64_t{1} << (64 - TIME_BITS)) - 1;
+constexpr size_t MAX_DEPTH = 16;
+
+class BucketTable {
+ public:
+  BucketTable(size_t width, size_t depth, double rate_per_second, double burst)
+      : width_(std::max<size_t>(1, width)),
+        depth_(std::clamp<size_t>(depth, 1, MAX_DEPTH)),
+        rate_per_ms_(std::max(0.0, rate_per_second) * TOKEN_SCALE / 1000.0),
+        capacity_(std::clamp<uint64_t>(static_cast<uint64_t>(std::max(1.0, burst) * TOKEN_SCALE), ONE_TOKEN, MAX_USED)),
+        cells_(width_ * depth_) {
+    if (sodium_init() < 0) {
+      throw std::runtime_error("Failed to initialize libsodium");
+    }
+    crypto_shorthash_keygen(hash_key_.data());
+  }
+
+  void locate(const uint8_t* key, size_t key_length, std::array<size_t, MAX_DEPTH>& cells) const {
+    std::array<uint8_t, crypto_shorthash_BYTES> digest{};
+    crypto_shorthash(digest.data(), key, key_length, hash_key_.data());
+    uint64_t hash = 0;
+    for (size_t i = 0; i < digest.size(); ++i) {
+      hash |= static_cast<uint64_t>(digest[i]) << (8 * i);
+    }
+    const uint64_t h1 = hash & 0xffffffffu;
+    const uint64_t h2 = (hash >> 32) | 1;
+    for (size_t row = 0; row < depth_; ++row) {
+      cells[row] = row * width_ + static_cast<size_t>((h1 + row * h2) % width_);
+    }
+  }
+
+  // Tokens left in the key's quietest cell; only used for the retry hint.
+  double available(const std::array<size_t, MAX_DEPTH>& cells, uint64_t now_ms) const {
+    uint64_t least_used = MAX_USED;
+    for (size_t row = 0; row < depth_; ++row) {
+      least_used = std::min(least_used, refill(cells_[cells[row]].load(std::memory_order_relaxed), now_ms));
+    }
+    return tokens_left(least_used);
+  }
+
+  // Count-min estimate with conservative update: the key has used as much
+  // as its least used cell, and taking a token raises every cell below
+  // that estimate plus one token to exactly that, leaving fuller cells
+  // alone. Each raise is a CAS against the word read for the estimate;
+  // if any cell moved in between, the estimate is taken again, so two
+  // callers cannot both spend the same token. Raises made before a lost
+  // race stay in place and only err towards denying. `debits` records
+  // what each cell was raised by, for refund. On failure `available`
+  // holds the tokens left in the quietest cell.
+  bool try_consume(const std::array<size_t, MAX_DEPTH>& cells, uint64_t now_ms, double& available,
+                   std::array<uint64_t, MAX_DEPTH>& debits) {
+    std::array<uint64_t, MAX_DEPTH> words{};
+    std::array<uint64_t, MAX_DEPTH> used{};
+    for (;;) {
+      uint64_t least_used = MAX_USED;
+      for (size_t row = 0; row < depth_; ++row) {
+        words[row] = cells_[cells[row]].load(std::memory_order_relaxed);
+        used[row] = refill(words[row], now_ms);
+        least_used = std::min(least_used, used[row]);
+      }
+      if (capacity_ - std::min(least_used, capacity_) < ONE_TOKEN) {
+        available = tokens_left(least_used);
+        return false;
+      }
+
+      const uint64_t target = least_used + ONE_TOKEN;
+      debits.fill(0);
+      bool raced = false;
+      for (size_t row = 0; row < depth_ && !raced; ++row) {
+        if (used[row] >= target) {
+          continue;
+        }
+        raced = !cells_[cells[row]].compare_exchange_strong(words[row], pack(target, words[row], now_ms),
+                                                            std::memory_order_relaxed);
+        if (!raced) {
+          debits[row] = target - used[row];
+        }
+      }
+      if (!raced) {
+        return true;
+      }
+    }
+  }
+
+  void refund(const std::array<size_t, MAX_DEPTH>& cells, const std::array<uint64_t, MAX_DEPTH>& debits,
+              uint64_t now_ms) {
+    for (size_t row = 0; row < depth_; ++row) {
+      if (debits[row] == 0) {
+        continue;
+      }
+      std::atomic<uint64_t>& cell = cells_[cells[row]];
+      uint64_t word = cell.load(std::memory_order_relaxed);
+      uint64_t updated;
+      do {
+        const uint64_t used = refill(word, now_ms);
+        updated = pack(used - std::min(used, debits[row]), word, now_ms);
+      } while (!cell.compare_exchange_weak(word, updated, std::memory_order_relaxed));
+    }
+  }
+
+  std::chrono::milliseconds wait_for_token(double available_tokens) const {
+    if (rate_per_ms_ <= 0) {
+      return std::chrono::milliseconds::max();
+    }
+    const double missing = (1.0 - available_tokens) * TOKEN_SCALE;
+    return std::chrono::milliseconds(static_cast<int64_t>(std::ceil(missing / rate_per_ms_)));
+  }
+
+ private:
+  // Never moves a cell's refill time backwards, so a caller with an older
+  // clock reading cannot credit the same interval twice.
+  static uint64_t pack(uint64_t used, uint64_t word, uint64_t now_ms) {
+    return (used << TIME_BITS) | std::max(word & TIME_MASK, now_ms & TIME_MASK);
+  }
+
+  double tokens_left(uint64_t used) const {
+    return static_cast<double>(capacity_ - std::min(used, capacity_)) / TOKEN_SCALE;
+  }
+
+  uint64_t refill(uint64_t word, uint64_t now_ms) const {
+    const uint64_t used = word >> TIME_BITS;
+    const uint64_t last_ms = word & TIME_MASK;
+    if (used == 0 || now_ms <= last_ms) {
+      return used;
+    }
+    const double refilled = static_cast<double>(now_ms - last_ms) * rate_per_ms_;
+    return refilled >= static_cast<double>(used) ? 0 : used - static_cast<uint64_t>(refilled);
+  }
+
+  const size_t width_;
+  const size_t depth_;
+  const double rate_per_ms_;
+  const uint64_t capacity_;
+  std::vector<std::atomic<uint64_t>> cells_;
+  std::array<uint8_t, crypto_shorthash_KEYBYTES> hash_key_{};
+};
+
+}  // namespace
+
+class AdmissionController::Impl {
+ public:
+  explicit Impl(const AdmissionConfig& config)
+      : max_defer_(config.max_defer),
+        epoch_(SteadyClock::now()),
+        identities_(config.width, config.depth, config.identity_rate_per_second, config.identity_burst),
+        sources_(config.width, config.depth, config.source_rate_per_second, config.source_burst) {}
+
+  AdmissionResult admit(const uint8_t* identifier, size_t identifier_length,
+                        const uint8_t* source, size_t source_length, SteadyClock::time_point now) {
+    if (identifier == nullptr || identifier_length == 0 || (source == nullptr && source_length != 0)) {
+      rejected_.fetch_add(1, std::memory_order_relaxed);
+      return AdmissionResult{};
+    }
+
+    const uint64_t now_ms = now <= epoch_
+        ? 0
+        : static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(now - epoch_).count());
+
+    std::array<size_t, MAX_DEPTH> identity_cells{};
+    identities_.locate(identifier, identifier_length, identity_cells);
+    std::array<size_t, MAX_DEPTH> source_cells{};
+    if (source_length != 0) {
+      sources_.locate(source, source_length, source_cells);
+    }
+
+    double identity_tokens = 1.0;
+    double source_tokens = 1.0;
+    std::array<uint64_t, MAX_DEPTH> identity_debits{};
+    std::array<uint64_t, MAX_DEPTH> source_debits{};
+    const bool identity_admitted = identities_.try_consume(identity_cells, now_ms, identity_tokens, identity_debits);
+    if (identity_admitted && source_length != 0 &&
+        !sources_.try_consume(source_cells, now_ms, source_tokens, source_debits)) {
+      identities_.refund(identity_cells, identity_debits, now_ms);
+    } else if (!identity_admitted && source_length != 0) {
+      source_tokens = sources_.available(source_cells, now_ms);
+    }
+
+    if (identity_admitted && source_tokens >= 1.0) {
+      accepted_.fetch_add(1, std::memory_order_relaxed);
+      return AdmissionResult{AdmissionDecision::Accept, std::chrono::milliseconds(0)};
+    }
+
+    std::chrono::milliseconds retry_after(0);
+    if (!identity_admitted) {
+      retry_after = std::max(retry_after, identities_.wait_for_token(identity_tokens));
+    }
+    if (source_tokens < 1.0) {
+      retry_after = std::max(retry_after, sources_.wait_for_token(source_tokens));
+    }
+
+    if (retry_after <= max_defer_) {
+      deferred_.fetch_add(1, std::memory_order_relaxed);
+      return AdmissionResult{AdmissionDecision::Defer, retry_after};
+    }
+    rejected_.fetch_add(1, std::memory_order_relaxed);
+    return AdmissionResult{AdmissionDecision::Reject, retry_after};
+  }
+
+  AdmissionStats stats() const {
+    AdmissionStats stats;
+    stats.accepted = accepted_.load(std::memory_order_relaxed);
+    stats.deferred = deferred_.load(std::memory_order_relaxed);
+    stats.rejected = rejected_.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+ private:
+  const std::chrono::milliseconds max_defer_;
+  const SteadyClock::time_point epoch_;
+  BucketTable identities_;
+  BucketTable sources_;
+  std::atomic<uint64_t> accepted_{0};
+  std::atomic<uint64_t> deferred_{0};
+  std::atomic<uint64_t> rejected_{0};
+};
+
+AdmissionController::AdmissionController(const AdmissionConfig& config)
+    : impl_(std::make_unique<Impl>(config)) {}
+
+AdmissionController::~AdmissionController() = default;
+
+AdmissionResult AdmissionController::admit(
+    const uint8_t* credential_identifier,
+    size_t identifier_length,
+    const uint8_t* source,
+    size_t source_length) {
+  return impl_->admit(credential_identifier, identifier_length, source, source_length, SteadyClock::now());
+}
+
+AdmissionResult AdmissionController::admit(
+    const uint8_t* credential_identifier,
+    size_t identifier_length,
+    const uint8_t* source,
+    size_t source_length,
+    std::chrono::steady_clock::time_point now) {
+  return impl_->admit(credential_identifier, identifier_length, source, source_length, now);
+}
+
+AdmissionStats AdmissionController::get_stats() const {
+  return impl_->stats();
+}
+
+}  // namespace ecliptix::security::opaque::responder
@@ -0,0 +1,155 @@
+#include "opaque/fake_credentials.h"
+
+#include <sodium.h>
+
+#include <array>
+#include <atomic>
+#include <stdexcept>
+#include <string_view>
+
+#include "core/secure_lru_cache.h"
+
+namespace ecliptix::security::opaque::responder {
+
+namespace {
+
+constexpr std::string_view ENVELOPE_LABEL = "FakeEnvelope";
+constexpr std::string_view MASKING_KEY_LABEL = "FakeMaskingKey";
+constexpr std::string_view KEY_SEED_LABEL = "FakeInitiatorKeySeed";
+constexpr std::string_view CACHE_INDEX_LABEL = "FakeRecordCacheIndex";
+
+constexpr size_t ENVELOPE_OFFSET = 0;
+constexpr size_t MASKING_KEY_OFFSET = ENVELOPE_OFFSET + ENVELOPE_LENGTH;
+constexpr size_t PUBLIC_KEY_OFFSET = MASKING_KEY_OFFSET + MASKING_KEY_LENGTH;
+constexpr size_t RECORD_LENGTH = PUBLIC_KEY_OFFSET + PUBLIC_KEY_LENGTH;
+
+Result expand_labeled(
+    const uint8_t* seed,
+    const uint8_t* identifier,
+    size_t identifier_length,
+    std::string_view label,
+    uint8_t* output,
+    size_t output_length) {
+  secure_bytes info(identifier, identifier + identifier_length);
+  info.insert(info.end(), label.begin(), label.end());
+  return crypto::key_derivation_expand(seed, FAKE_RECORD_SEED_LENGTH, info.data(), info.size(),
+                                       output, output_length);
+}
+
+}  // namespace
+
+class FakeCredentialGenerator::Impl {
+ public:
+  Impl(const uint8_t* fake_record_seed, size_t seed_length, const FakeCredentialConfig& config)
+      : seed_(FAKE_RECORD_SEED_LENGTH),
+        index_key_(std::tuple_size_v<detail::CacheDigest>),
+        cache_(config.capacity, config.shard_count) {
+    if (fake_record_seed == nullptr || seed_length != FAKE_RECORD_SEED_LENGTH) {
+      throw std::invalid_argument("Fake record seed must be FAKE_RECORD_SEED_LENGTH bytes");
+    }
+    std::copy(fake_record_seed, fake_record_seed + seed_length, seed_.data());
+    if (crypto::key_derivation_expand(
+            seed_.data(), seed_.size(),
+            reinterpret_cast<const uint8_t*>(CACHE_INDEX_LABEL.data()), CACHE_INDEX_LABEL.size(),
+            index_key_.data(), index_key_.size()) != Result::Success) {
+      throw std::runtime_error("Failed to derive fake record cache index key");
+    }
+  }
+
+  Result generate(const uint8_t* identifier, size_t identifier_length, ResponderCredentials& credentials) {
+    if (identifier == nullptr || identifier_length == 0) {
+      return Result::InvalidInput;
+    }
+
+    detail::CacheDigest digest{};
+    crypto_generichash(digest.data(), digest.size(), identifier, identifier_length,
+                       index_key_.data(), index_key_.size());
+
+    std::array<uint8_t, RECORD_LENGTH> record{};
+    Result result = Result::Success;
+    if (cache_.lookup(digest, record.data())) {
+      cache_hits_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      result = derive(identifier, identifier_length, record.data());
+      if (result == Result::Success) {
+        generated_.fetch_add(1, std::memory_order_relaxed);
+        cache_.insert(digest, record.data());
+      }
+    }
+
+    if (result == Result::Success) {
+      credentials.envelope.assign(record.begin() + ENVELOPE_OFFSET, record.begin() + MASKING_KEY_OFFSET);
+      credentials.masking_key.assign(record.begin() + MASKING_KEY_OFFSET, record.begin() + PUBLIC_KEY_OFFSET);
+      credentials.initiator_public_key.assign(record.begin() + PUBLIC_KEY_OFFSET, record.end());
+    }
+    sodium_memzero(record.data(), record.size());
+    return result;
+  }
+
+  void clear() {
+    cache_.clear();
+  }
+
+  FakeCredentialStats stats() const {
+    FakeCredentialStats stats;
+    stats.generated = generated_.load(std::memory_order_relaxed);
+    stats.cache_hits = cache_hits_.load(std::memory_order_relaxed);
+    stats.size = cache_.size();
+    return stats;
+  }
+
+ private:
+  Result derive(const uint8_t* identifier, size_t identifier_length, uint8_t* record) const {
+    std::array<uint8_t, OPRF_SEED_LENGTH> key_seed{};
+    std::array<uint8_t, PRIVATE_KEY_LENGTH> private_key{};
+
+    Result result = expand_labeled(seed_.data(), identifier, identifier_length, ENVELOPE_LABEL,
+                                   record + ENVELOPE_OFFSET, ENVELOPE_LENGTH);
+    if (result == Result::Success) {
+      result = expand_labeled(seed_.data(), identifier, identifier_length, MASKING_KEY_LABEL,
+                              record + MASKING_KEY_OFFSET, MASKING_KEY_LENGTH);
+    }
+    if (result == Result::Success) {
+      result = expand_labeled(seed_.data(), identifier, identifier_length, KEY_SEED_LABEL,
+                              key_seed.data(), key_seed.size());
+    }
+    if (result == Result::Success) {
+      result = crypto::derive_key_pair(key_seed.data(), private_key.data(), record + PUBLIC_KEY_OFFSET);
+    }
+
+    sodium_memzero(key_seed.data(), key_seed.size());
+    sodium_memzero(private_key.data(), private_key.size());
+    return result;
+  }
+
+  SecureBuffer seed_;
+  SecureBuffer index_key_;
+  detail::SecureLruCache<RECORD_LENGTH> cache_;
+  std::atomic<uint64_t> generated_{0};
+  std::atomic<uint64_t> cache_hits_{0};
+};
+
+FakeCredentialGenerator::FakeCredentialGenerator(
+    const uint8_t* fake_record_seed,
+    size_t seed_length,
+    const FakeCredentialConfig& config)
+    : impl_(std::make_unique<Impl>(fake_record_seed, seed_length, config)) {}
+
+FakeCredentialGenerator::~FakeCredentialGenerator() = default;
+
+Result FakeCredentialGenerator::generate(
+    const uint8_t* credential_identifier,
+    size_t identifier_length,
+    ResponderCredentials& credentials) {
+  return impl_->generate(credential_identifier, identifier_length, credentials);
+}
+
+void FakeCredentialGenerator::clear() {
+  impl_->clear();
+}
+
+FakeCredentialStats FakeCredentialGenerator::get_stats() const {
+  return impl_->stats();
+}
+
+}  // namespace ecliptix::security::opaque::responder
@@ -0,0 +1,195 @@
+#include "opaque/oprf_keys.h"
+
+#include <sodium.h>
+
+#include <array>
+#include <atomic>
+#include <stdexcept>
+#include <string_view>
+
+#include "core/secure_lru_cache.h"
+
+namespace ecliptix::security::opaque {
+
+namespace {
+
+constexpr std::string_view OPRF_KEY_LABEL = "OprfKey";
+constexpr std::string_view DERIVE_KEY_PAIR_LABEL = "OPAQUE-DeriveKeyPair";
+constexpr std::string_view CACHE_INDEX_LABEL = "OprfKeyCacheIndex";
+constexpr size_t SCALAR_LENGTH = crypto_core_ristretto255_SCALARBYTES;
+constexpr size_t WIDE_SCALAR_LENGTH = crypto_core_ristretto255_NONREDUCEDSCALARBYTES;
+constexpr size_t DIGEST_LENGTH = std::tuple_size_v<detail::CacheDigest>;
+
+static_assert(SCALAR_LENGTH == PRIVATE_KEY_LENGTH);
+
+Result expand(const uint8_t* prk, size_t prk_length, const uint8_t* info, size_t info_length,
+              uint8_t* output, size_t output_length) {
+  return crypto::key_derivation_expand(prk, prk_length, info, info_length, output, output_length);
+}
+
+}  // namespace
+
+namespace oblivious_prf {
+
+Result derive_key(
+    const uint8_t* oprf_seed,
+    size_t seed_length,
+    const uint8_t* credential_identifier,
+    size_t identifier_length,
+    uint8_t* oprf_private_key) {
+  if (oprf_seed == nullptr || seed_length != OPRF_SEED_LENGTH || credential_identifier == nullptr ||
+      identifier_length == 0 || oprf_private_key == nullptr) {
+    return Result::InvalidInput;
+  }
+
+  secure_bytes info(credential_identifier, credential_identifier + identifier_length);
+  info.insert(info.end(), OPRF_KEY_LABEL.begin(), OPRF_KEY_LABEL.end());
+
+  std::array<uint8_t, OPRF_SEED_LENGTH> key_seed{};
+  Result result = expand(oprf_seed, seed_length, info.data(), info.size(), key_seed.data(), key_seed.size());
+
+  std::array<uint8_t, DERIVE_KEY_PAIR_LABEL.size() + 1> derive_info{};
+  std::copy(DERIVE_KEY_PAIR_LABEL.begin(), DERIVE_KEY_PAIR_LABEL.end(), derive_info.begin());
+  std::array<uint8_t, WIDE_SCALAR_LENGTH> wide{};
+  bool derived = false;
+  for (uint32_t counter = 0; result == Result::Success && !derived && counter <= UINT8_MAX; ++counter) {
+    derive_info.back() = static_cast<uint8_t>(counter);
+    result = expand(key_seed.data(), key_seed.size(), derive_info.data(), derive_info.size(),
+                    wide.data(), wide.size());
+    if (result == Result::Success) {
+      crypto_core_ristretto255_scalar_reduce(oprf_private_key, wide.data());
+      derived = sodium_is_zero(oprf_private_key, SCALAR_LENGTH) == 0;
+    }
+  }
+
+  sodium_memzero(key_seed.data(), key_seed.size());
+  sodium_memzero(wide.data(), wide.size());
+  if (result == Result::Success && !derived) {
+    result = Result::CryptoError;
+  }
+  if (result != Result::Success) {
+    sodium_memzero(oprf_private_key, SCALAR_LENGTH);
+  }
+  return result;
+}
+
+}  // namespace oblivious_prf
+
+namespace responder {
+
+class OprfKeyDeriver::Impl {
+ public:
+  Impl(const uint8_t* oprf_seed, size_t seed_length, const OprfKeyCacheConfig& config)
+      : seed_(OPRF_SEED_LENGTH),
+        index_key_(DIGEST_LENGTH),
+        cache_(config.capacity, config.shard_count) {
+    if (sodium_init() < 0) {
+      throw std::runtime_error("Failed to initialize libsodium");
+    }
+    if (oprf_seed == nullptr || seed_length != OPRF_SEED_LENGTH) {
+      throw std::invalid_argument("OPRF seed must be OPRF_SEED_LENGTH bytes");
+    }
+    std::copy(oprf_seed, oprf_seed + seed_length, seed_.data());
+    if (expand(seed_.data(), seed_.size(),
+               reinterpret_cast<const uint8_t*>(CACHE_INDEX_LABEL.data()), CACHE_INDEX_LABEL.size(),
+               index_key_.data(), index_key_.size()) != Result::Success) {
+      throw std::runtime_error("Failed to derive OPRF cache index key");
+    }
+  }
+
+  Result derive(const uint8_t* identifier, size_t identifier_length, uint8_t* scalar) {
+    if (identifier == nullptr || identifier_length == 0 || scalar == nullptr) {
+      return Result::InvalidInput;
+    }
+
+    detail::CacheDigest digest{};
+    crypto_generichash(digest.data(), digest.size(), identifier, identifier_length,
+                       index_key_.data(), index_key_.size());
+
+    if (cache_.lookup(digest, scalar)) {
+      hits_.fetch_add(1, std::memory_order_relaxed);
+      return Result::Success;
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+
+    if (const Result result = oblivious_prf::derive_key(seed_.data(), seed_.size(), identifier,
+                                                        identifier_length, scalar);
+        result != Result::Success) {
+      return result;
+    }
+
+    cache_.insert(digest, scalar);
+    return Result::Success;
+  }
+
+  void clear() {
+    cache_.clear();
+  }
+
+  OprfKeyCacheStats stats() const {
+    OprfKeyCacheStats stats;
+    stats.hits = hits_.load(std::memory_order_relaxed);
+    stats.misses = misses_.load(std::memory_order_relaxed);
+    stats.evictions = cache_.evictions();
+    stats.size = cache_.size();
+    return stats;
+  }
+
+ private:
+  SecureBuffer seed_;
+  SecureBuffer index_key_;
+  detail::SecureLruCache<SCALAR_LENGTH> cache_;
+  std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> misses_{0};
+};
+
+OprfKeyDeriver::OprfKeyDeriver(const uint8_t* oprf_seed, size_t seed_length, const OprfKeyCacheConfig& config)
+    : impl_(std::make_unique<Impl>(oprf_seed, seed_length, config)) {}
+
+OprfKeyDeriver::~OprfKeyDeriver() = default;
+
+Result OprfKeyDeriver::derive_key(
+    const uint8_t* credential_identifier,
+    size_t identifier_length,
+    uint8_t* oprf_private_key) {
+  return impl_->derive(credential_identifier, identifier_length, oprf_private_key);
+}
+
+Result OprfKeyDeriver::evaluate(
+    const uint8_t* credential_identifier,
+    size_t identifier_length,
+    const uint8_t* blinded_element,
+    uint8_t* evaluated_element) {
+  std::array<uint8_t, PRIVATE_KEY_LENGTH> oprf_key{};
+  Result result = impl_->derive(credential_identifier, identifier_length, oprf_key.data());
+  if (result == Result::Success) {
+    result = oblivious_prf::evaluate(blinded_element, oprf_key.data(), evaluated_element);
+  }
+  sodium_memzero(oprf_key.data(), oprf_key.size());
+  return result;
+}
+
+Result OprfKeyDeriver::precompute(const std::vector<secure_bytes>& credential_identifiers) {
+  std::array<uint8_t, PRIVATE_KEY_LENGTH> scratch{};
+  Result result = Result::Success;
+  for (const secure_bytes& identifier : credential_identifiers) {
+    result = impl_->derive(identifier.data(), identifier.size(), scratch.data());
+    if (result != Result::Success) {
+      break;
+    }
+  }
+  sodium_memzero(scratch.data(), scratch.size());
+  return result;
+}
+
+void OprfKeyDeriver::clear() {
+  impl_->clear();
+}
+
+OprfKeyCacheStats OprfKeyDeriver::get_stats() const {
+  return impl_->stats();
+}
+
+}  // namespace responder
+
+}  // namespace ecliptix::security::opaque
@@ -0,0 +1,204 @@
+#include "opaque/replay_filter.h"
+
+#include <sodium.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace ecliptix::security::opaque::responder {
+
+namespace {
+
+using SteadyClock = std::chrono::steady_clock;
+
+constexpr size_t WORD_BITS = 64;
+constexpr size_t MIN_BITS = 1024;
+constexpr size_t MAX_HASH_COUNT = 16;
+
+struct BloomSizing {
+  size_t bits;
+  size_t hash_count;
+};
+
+BloomSizing size_filter(size_t expected, double false_positive_rate) {
+  const double n = static_cast<double>(std::max<size_t>(1, expected));
+  const double p = std::clamp(false_positive_rate, 1e-12, 0.5);
+  const double ln2 = std::log(2.0);
+  const double optimal_bits = std::ceil(-n * std::log(p) / (ln2 * ln2));
+  const size_t bits = std::max(MIN_BITS, static_cast<size_t>(optimal_bits));
+  const size_t rounded = (bits + WORD_BITS - 1) / WORD_BITS * WORD_BITS;
+  const double optimal_hashes = std::round(static_cast<double>(rounded) / n * ln2);
+  return {rounded, std::clamp<size_t>(static_cast<size_t>(optimal_hashes), 1, MAX_HASH_COUNT)};
+}
+
+class BloomGeneration {
+ public:
+  explicit BloomGeneration(size_t bits) : words_(bits / WORD_BITS) {}
+
+  bool contains(const std::array<size_t, MAX_HASH_COUNT>& positions, size_t count) const {
+    for (size_t i = 0; i < count; ++i) {
+      const uint64_t mask = uint64_t{1} << (positions[i] % WORD_BITS);
+      if ((words_[positions[i] / WORD_BITS].load(std::memory_order_relaxed) & mask) == 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Sets every bit and reports whether this call was the one that set at
+  // least one of them. Concurrent inserts of the same key split the clear
+  // bits between them, so both can see a newly set bit.
+  bool insert(const std::array<size_t, MAX_HASH_COUNT>& positions, size_t count) {
+    bool newly_set = false;
+    for (size_t i = 0; i < count; ++i) {
+      const uint64_t mask = uint64_t{1} << (positions[i] % WORD_BITS);
+      const uint64_t previous = words_[positions[i] / WORD_BITS].fetch_or(mask, std::memory_order_relaxed);
+      newly_set |= (previous & mask) == 0;
+    }
+    return newly_set;
+  }
+
+  void clear() {
+    for (std::atomic<uint64_t>& word : words_) {
+      word.store(0, std::memory_order_relaxed);
+    }
+  }
+
+ private:
+  std::vector<std::atomic<uint64_t>> words_;
+};
+
+}  // namespace
+
+class ReplayFilter::Impl {
+ public:
+  explicit Impl(const ReplayFilterConfig& config)
+      : sizing_(size_filter(config.expected_messages_per_window, config.false_positive_rate)),
+        window_(std::max(config.window, std::chrono::seconds(1))),
+        generations_{BloomGeneration(sizing_.bits), BloomGeneration(sizing_.bits)},
+        generation_started_(SteadyClock::now()) {
+    if (sodium_init() < 0) {
+      throw std::runtime_error("Failed to initialize libsodium");
+    }
+    crypto_generichash_keygen(hash_key_.data());
+  }
+
+  Result check_and_record(const uint8_t* ke1_data, size_t ke1_length, SteadyClock::time_point now) {
+    if (ke1_data == nullptr || ke1_length != KE1_LENGTH) {
+      return Result::InvalidInput;
+    }
+    checked_.fetch_add(1, std::memory_order_relaxed);
+
+    std::array<size_t, MAX_HASH_COUNT> positions{};
+    locate(ke1_data + KE1_NONCE_OFFSET, positions);
+
+    rotate_if_due(now);
+
+    std::shared_lock lock(mutex_);
+    const bool seen_before = generations_[1 - current_].contains(positions, sizing_.hash_count);
+    const bool newly_set = generations_[current_].insert(positions, sizing_.hash_count);
+    if (seen_before || !newly_set) {
+      replays_.fetch_add(1, std::memory_order_relaxed);
+      return Result::ValidationError;
+    }
+    return Result::Success;
+  }
+
+  void clear() {
+    std::unique_lock lock(mutex_);
+    generations_[0].clear();
+    generations_[1].clear();
+    generation_started_ = SteadyClock::now();
+  }
+
+  ReplayFilterStats stats() const {
+    ReplayFilterStats stats;
+    stats.checked = checked_.load(std::memory_order_relaxed);
+    stats.replays = replays_.load(std::memory_order_relaxed);
+    stats.rotations = rotations_.load(std::memory_order_relaxed);
+    stats.bits_per_generation = sizing_.bits;
+    stats.hash_count = sizing_.hash_count;
+    return stats;
+  }
+
+ private:
+  void locate(const uint8_t* replay_key, std::array<size_t, MAX_HASH_COUNT>& positions) const {
+    std::array<uint8_t, 16> digest{};
+    crypto_generichash(digest.data(), digest.size(), replay_key, KE1_REPLAY_KEY_LENGTH,
+                       hash_key_.data(), hash_key_.size());
+    uint64_t h1 = 0;
+    uint64_t h2 = 0;
+    for (size_t i = 0; i < 8; ++i) {
+      h1 |= static_cast<uint64_t>(digest[i]) << (8 * i);
+      h2 |= static_cast<uint64_t>(digest[8 + i]) << (8 * i);
+    }
+    h2 |= 1;
+    for (size_t i = 0; i < sizing_.hash_count; ++i) {
+      positions[i] = static_cast<size_t>((h1 + i * h2) % sizing_.bits);
+    }
+  }
+
+  void rotate_if_due(SteadyClock::time_point now) {
+    {
+      std::shared_lock lock(mutex_);
+      if (now - generation_started_ < window_) {
+        return;
+      }
+    }
+    std::unique_lock lock(mutex_);
+    const auto elapsed = now - generation_started_;
+    if (elapsed < window_) {
+      return;
+    }
+    current_ = 1 - current_;
+    generations_[current_].clear();
+    if (elapsed >= 2 * window_) {
+      generations_[1 - current_].clear();
+    }
+    generation_started_ = now;
+    rotations_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  const BloomSizing sizing_;
+  const SteadyClock::duration window_;
+  mutable std::shared_mutex mutex_;
+  std::array<BloomGeneration, 2> generations_;
+  size_t current_ = 0;
+  SteadyClock::time_point generation_started_;
+  std::array<uint8_t, crypto_generichash_KEYBYTES> hash_key_{};
+  std::atomic<uint64_t> checked_{0};
+  std::atomic<uint64_t> replays_{0};
+  std::atomic<uint64_t> rotations_{0};
+};
+
+ReplayFilter::ReplayFilter(const ReplayFilterConfig& config)
+    : impl_(std::make_unique<Impl>(config)) {}
+
+ReplayFilter::~ReplayFilter() = default;
+
+Result ReplayFilter::check_and_record(const uint8_t* ke1_data, size_t ke1_length) {
+  return impl_->check_and_record(ke1_data, ke1_length, SteadyClock::now());
+}
+
+Result ReplayFilter::check_and_record(
+    const uint8_t* ke1_data,
+    size_t ke1_length,
+    std::chrono::steady_clock::time_point now) {
+  return impl_->check_and_record(ke1_data, ke1_length, now);
+}
+
+void ReplayFilter::clear() {
+  impl_->clear();
+}
+
+ReplayFilterStats ReplayFilter::get_stats() const {
+  return impl_->stats();
+}
+
+}  // namespace ecliptix::security::opaque::responder
@@ -0,0 +1,242 @@
+#include "opaque/responder_async.h"
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace ecliptix::security::opaque::responder {
+
+namespace {
+
+struct PendingCredentials {
+  std::mutex mutex;
+  bool ready = false;
+  CredentialLookup lookup = CredentialLookup::Failed;
+  ResponderCredentials credentials;
+  std::coroutine_handle<> waiter;
+};
+
+class CredentialAwaiter {
+ public:
+  explicit CredentialAwaiter(std::shared_ptr<PendingCredentials> pending) : pending_(std::move(pending)) {}
+
+  bool await_ready() {
+    std::lock_guard lock(pending_->mutex);
+    return pending_->ready;
+  }
+
+  bool await_suspend(std::coroutine_handle<> handle) {
+    std::lock_guard lock(pending_->mutex);
+    if (pending_->ready) {
+      return false;
+    }
+    pending_->waiter = handle;
+    return true;
+  }
+
+  std::pair<CredentialLookup, ResponderCredentials> await_resume() {
+    std::lock_guard lock(pending_->mutex);
+    return {pending_->lookup, std::move(pending_->credentials)};
+  }
+
+ private:
+  std::shared_ptr<PendingCredentials> pending_;
+};
+
+std::shared_ptr<PendingCredentials> start_fetch(CredentialFetcher& fetcher, const secure_bytes& identifier) {
+  auto pending = std::make_shared<PendingCredentials>();
+  fetcher.fetch(identifier, [pending](CredentialLookup lookup, ResponderCredentials credentials) {
+    std::coroutine_handle<> waiter;
+    {
+      std::lock_guard lock(pending->mutex);
+      pending->lookup = lookup;
+      pending->credentials = std::move(credentials);
+      pending->ready = true;
+      waiter = std::exchange(pending->waiter, {});
+    }
+    if (waiter) {
+      waiter.resume();
+    }
+  });
+  return pending;
+}
+
+struct DetachedTask {
+  struct promise_type {
+    DetachedTask get_return_object() noexcept { return {}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept { std::terminate(); }
+  };
+};
+
+DetachedTask drive(Task<Result> task, std::function<void(Result, std::exception_ptr)> done) {
+  try {
+    const Result result = co_await task;
+    done(result, nullptr);
+  } catch (...) {
+    done(Result::CryptoError, std::current_exception());
+  }
+}
+
+}  // namespace
+
+class ThreadPoolExecutor::Impl {
+ public:
+  explicit Impl(size_t thread_count) {
+    const size_t count = std::max<size_t>(1, thread_count);
+    threads_.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+      threads_.emplace_back([this] { run(); });
+    }
+  }
+
+  ~Impl() {
+    {
+      std::lock_guard lock(mutex_);
+      stopping_ = true;
+    }
+    ready_.notify_all();
+    for (std::thread& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  void post(std::function<void()> work) {
+    {
+      std::lock_guard lock(mutex_);
+      queue_.push_back(std::move(work));
+    }
+    ready_.notify_one();
+  }
+
+ private:
+  void run() {
+    for (;;) {
+      std::function<void()> work;
+      {
+        std::unique_lock lock(mutex_);
+        ready_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+        if (queue_.empty()) {
+          return;
+        }
+        work = std::move(queue_.front());
+        queue_.pop_front();
+      }
+      work();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  std::deque<std::function<void()>> queue_;
+  std::vector<std::thread> threads_;
+  bool stopping_ = false;
+};
+
+ThreadPoolExecutor::ThreadPoolExecutor(size_t thread_count)
+    : impl_(std::make_unique<Impl>(thread_count)) {}
+
+ThreadPoolExecutor::~ThreadPoolExecutor() = default;
+
+void ThreadPoolExecutor::post(std::function<void()> work) {
+  impl_->post(std::move(work));
+}
+
+InMemoryCredentialFetcher::InMemoryCredentialFetcher(Executor& executor) : executor_(executor) {}
+
+void InMemoryCredentialFetcher::store(const secure_bytes& credential_identifier,
+                                      const ResponderCredentials& credentials) {
+  std::lock_guard lock(mutex_);
+  records_[std::string(credential_identifier.begin(), credential_identifier.end())] = credentials;
+}
+
+void InMemoryCredentialFetcher::fetch(const secure_bytes& credential_identifier, CredentialCallback done) {
+  CredentialLookup lookup = CredentialLookup::NotFound;
+  ResponderCredentials credentials;
+  {
+    std::lock_guard lock(mutex_);
+    const auto found = records_.find(std::string(credential_identifier.begin(), credential_identifier.end()));
+    if (found != records_.end()) {
+      lookup = CredentialLookup::Found;
+      credentials = found->second;
+    }
+  }
+  executor_.post([done = std::move(done), lookup, credentials = std::move(credentials)]() mutable {
+    done(lookup, std::move(credentials));
+  });
+}
+
+Task<Result> generate_ke2_async(
+    const OpaqueResponder& responder,
+    Executor& executor,
+    CredentialFetcher& fetcher,
+    secure_bytes credential_identifier,
+    secure_bytes ke1,
+    KE2& ke2,
+    ResponderState& state,
+    AsyncResponderOptions options) {
+  if (credential_identifier.empty() || ke1.size() != KE1_LENGTH) {
+    co_return Result::InvalidInput;
+  }
+
+  auto pending = start_fetch(fetcher, credential_identifier);
+
+  co_await executor.schedule();
+
+  // Built for every identifier, not only unknown ones, so the work done
+  // before KE2 does not depend on whether the user exists.
+  ResponderCredentials fallback;
+  if (options.fake_credentials != nullptr) {
+    if (const Result result = options.fake_credentials->generate(
+            credential_identifier.data(), credential_identifier.size(), fallback);
+        result != Result::Success) {
+      co_return result;
+    }
+  }
+
+  auto [lookup, credentials] = co_await CredentialAwaiter(std::move(pending));
+
+  switch (lookup) {
+    case CredentialLookup::Found:
+      break;
+    case CredentialLookup::NotFound:
+      if (options.fake_credentials == nullptr) {
+        co_return Result::AuthenticationError;
+      }
+      credentials = std::move(fallback);
+      break;
+    case CredentialLookup::Failed:
+      co_return Result::ValidationError;
+  }
+
+  co_await executor.schedule();
+
+  co_return responder.generate_ke2(ke1.data(), ke1.size(), credentials, ke2, state);
+}
+
+Result sync_wait(Task<Result> task) {
+  std::mutex mutex;
+  std::condition_variable finished;
+  bool done = false;
+  Result result = Result::CryptoError;
+  std::exception_ptr exception;
+
+  drive(std::move(task), [&](Result task_result, std::exception_ptr task_exception) {
+    std::lock_guard lock(mutex);
+    result = task_result;
+    exception = task_exception;
+    done = true;
+    finished.notify_one();
+  });
+
+  std::unique_lock lock(mutex);
+  finished.wait(lock, [&] { return done; });
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+  return result;
+}
+
+}  // namespace ecliptix::security::opaque::responder
@@ -0,0 +1,314 @@
+#include "opaque/responder_cookie.h"
+
+#include <sodium.h>
+
+#include <array>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <stdexcept>
+#include <utility>
+
+namespace ecliptix::security::opaque::responder {
+
+namespace {
+
+using Clock = std::chrono::system_clock;
+
+constexpr size_t AUTHENTICATED_HEADER_LENGTH = 1 + 4 + 8;
+constexpr size_t KEY_ID_OFFSET = 1;
+constexpr size_t ISSUED_AT_OFFSET = KEY_ID_OFFSET + 4;
+constexpr size_t NONCE_OFFSET = AUTHENTICATED_HEADER_LENGTH;
+
+static_assert(STATE_COOKIE_KEY_LENGTH == crypto_aead_xchacha20poly1305_ietf_KEYBYTES);
+static_assert(STATE_COOKIE_NONCE_LENGTH == crypto_aead_xchacha20poly1305_ietf_NPUBBYTES);
+static_assert(STATE_COOKIE_TAG_LENGTH == crypto_aead_xchacha20poly1305_ietf_ABYTES);
+static_assert(NONCE_OFFSET + STATE_COOKIE_NONCE_LENGTH == STATE_COOKIE_HEADER_LENGTH);
+
+void store_le(uint8_t* out, uint64_t value, size_t length) {
+  for (size_t i = 0; i < length; ++i) {
+    out[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+uint64_t load_le(const uint8_t* in, size_t length) {
+  uint64_t value = 0;
+  for (size_t i = 0; i < length; ++i) {
+    value |= static_cast<uint64_t>(in[i]) << (8 * i);
+  }
+  return value;
+}
+
+int64_t unix_seconds(Clock::time_point time) {
+  return std::chrono::duration_cast<std::chrono::seconds>(time.time_since_epoch()).count();
+}
+
+Result build_associated_data(
+    const uint8_t* header,
+    const uint8_t* context,
+    size_t context_length,
+    secure_bytes& associated_data) {
+  if (context == nullptr && context_length != 0) {
+    return Result::InvalidInput;
+  }
+  associated_data.assign(header, header + AUTHENTICATED_HEADER_LENGTH);
+  if (context_length != 0) {
+    associated_data.insert(associated_data.end(), context, context + context_length);
+  }
+  return Result::Success;
+}
+
+}  // namespace
+
+class StateCookieKeyRing::Impl {
+ public:
+  struct CookieKey {
+    uint32_t id = 0;
+    Clock::time_point created;
+    SecureBuffer material{STATE_COOKIE_KEY_LENGTH};
+  };
+
+  explicit Impl(const StateCookieConfig& config) : config_(config) {
+    if (sodium_init() < 0) {
+      throw std::runtime_error("Failed to initialize libsodium");
+    }
+    generate(current_, Clock::now());
+  }
+
+  void rotate(Clock::time_point now) {
+    std::unique_lock lock(mutex_);
+    rotate_locked(now);
+  }
+
+  void rotate_if_due(Clock::time_point now) {
+    {
+      std::shared_lock lock(mutex_);
+      if (now - current_.created < config_.rotation_interval) {
+        return;
+      }
+    }
+    std::unique_lock lock(mutex_);
+    if (now - current_.created >= config_.rotation_interval) {
+      rotate_locked(now);
+    }
+  }
+
+  // Spent cookies are ordered by issue time so that the ones open() would
+  // reject as too old can be dropped from the front.
+  Result redeem(const uint8_t* cookie, Clock::time_point now) {
+    SpentCookie spent{static_cast<int64_t>(load_le(cookie + ISSUED_AT_OFFSET, 8)), {}};
+    std::copy_n(cookie + NONCE_OFFSET, spent.second.size(), spent.second.begin());
+
+    const int64_t oldest_accepted = unix_seconds(now) - config_.max_age.count();
+    std::lock_guard lock(spent_mutex_);
+    spent_.erase(spent_.begin(), spent_.lower_bound(SpentCookie{oldest_accepted, {}}));
+    return spent_.insert(spent).second ? Result::Success : Result::ValidationError;
+  }
+
+  const CookieKey* find(uint32_t id) const {
+    if (current_.id == id) {
+      return &current_;
+    }
+    if (has_previous_ && previous_.id == id) {
+      return &previous_;
+    }
+    return nullptr;
+  }
+
+  const StateCookieConfig config_;
+  mutable std::shared_mutex mutex_;
+  CookieKey current_;
+  CookieKey previous_;
+  bool has_previous_ = false;
+
+ private:
+  using SpentCookie = std::pair<int64_t, std::array<uint8_t, STATE_COOKIE_NONCE_LENGTH>>;
+
+  std::mutex spent_mutex_;
+  std::set<SpentCookie> spent_;
+
+  void rotate_locked(Clock::time_point now) {
+    std::swap(previous_, current_);
+    has_previous_ = true;
+    generate(current_, now);
+    while (current_.id == previous_.id) {
+      current_.id = randombytes_random();
+    }
+  }
+
+  static void generate(CookieKey& key, Clock::time_point now) {
+    key.id = randombytes_random();
+    key.created = now;
+    randombytes_buf(key.material.data(), key.material.size());
+  }
+};
+
+StateCookieKeyRing::StateCookieKeyRing(const StateCookieConfig& config)
+    : impl_(std::make_unique<Impl>(config)) {}
+
+StateCookieKeyRing::~StateCookieKeyRing() = default;
+
+void StateCookieKeyRing::rotate() {
+  impl_->rotate(Clock::now());
+}
+
+Result StateCookieKeyRing::seal(
+    const ResponderState& state,
+    const uint8_t* context,
+    size_t context_length,
+    secure_bytes& cookie) {
+  if (state.session_key.size() != HASH_LENGTH ||
+      state.expected_initiator_mac.size() != MAC_LENGTH) {
+    return Result::InvalidInput;
+  }
+
+  const auto now = Clock::now();
+  impl_->rotate_if_due(now);
+
+  cookie.assign(STATE_COOKIE_LENGTH, 0);
+  uint8_t* header = cookie.data();
+  header[0] = STATE_COOKIE_VERSION;
+  store_le(header + ISSUED_AT_OFFSET, static_cast<uint64_t>(unix_seconds(now)), 8);
+  randombytes_buf(header + NONCE_OFFSET, STATE_COOKIE_NONCE_LENGTH);
+
+  std::array<uint8_t, STATE_COOKIE_PAYLOAD_LENGTH> payload{};
+  std::copy(state.session_key.begin(), state.session_key.end(), payload.begin());
+  std::copy(state.expected_initiator_mac.begin(), state.expected_initiator_mac.end(),
+            payload.begin() + HASH_LENGTH);
+
+  std::shared_lock lock(impl_->mutex_);
+  store_le(header + KEY_ID_OFFSET, impl_->current_.id, 4);
+
+  secure_bytes associated_data;
+  Result result = build_associated_data(header, context, context_length, associated_data);
+  if (result == Result::Success) {
+    unsigned long long ciphertext_length = 0;
+    if (crypto_aead_xchacha20poly1305_ietf_encrypt(
+            cookie.data() + STATE_COOKIE_HEADER_LENGTH, &ciphertext_length,
+            payload.data(), payload.size(),
+            associated_data.data(), associated_data.size(),
+            nullptr, header + NONCE_OFFSET, impl_->current_.material.data()) != 0) {
+      result = Result::CryptoError;
+    }
+  }
+
+  sodium_memzero(payload.data(), payload.size());
+  if (result != Result::Success) {
+    cookie.clear();
+  }
+  return result;
+}
+
+Result StateCookieKeyRing::open(
+    const uint8_t* cookie,
+    size_t cookie_length,
+    const uint8_t* context,
+    size_t context_length,
+    ResponderState& state) const {
+  if (cookie == nullptr || cookie_length != STATE_COOKIE_LENGTH) {
+    return Result::InvalidInput;
+  }
+  if (cookie[0] != STATE_COOKIE_VERSION) {
+    return Result::ValidationError;
+  }
+
+  const auto key_id = static_cast<uint32_t>(load_le(cookie + KEY_ID_OFFSET, 4));
+  const auto issued_at = static_cast<int64_t>(load_le(cookie + ISSUED_AT_OFFSET, 8));
+  const int64_t now = unix_seconds(Clock::now());
+  if (issued_at > now + impl_->config_.clock_skew.count() ||
+      now - issued_at > impl_->config_.max_age.count()) {
+    return Result::ValidationError;
+  }
+
+  secure_bytes associated_data;
+  if (const Result result = build_associated_data(cookie, context, context_length, associated_data);
+      result != Result::Success) {
+    return result;
+  }
+
+  std::array<uint8_t, STATE_COOKIE_PAYLOAD_LENGTH> payload{};
+  {
+    std::shared_lock lock(impl_->mutex_);
+    const Impl::CookieKey* key = impl_->find(key_id);
+    if (key == nullptr) {
+      return Result::ValidationError;
+    }
+    unsigned long long payload_length = 0;
+    if (crypto_aead_xchacha20poly1305_ietf_decrypt(
+            payload.data(), &payload_length, nullptr,
+            cookie + STATE_COOKIE_HEADER_LENGTH, cookie_length - STATE_COOKIE_HEADER_LENGTH,
+            associated_data.data(), associated_data.size(),
+            cookie + NONCE_OFFSET, key->material.data()) != 0) {
+      return Result::AuthenticationError;
+    }
+  }
+
+  state.session_key.assign(payload.begin(), payload.begin() + HASH_LENGTH);
+  state.expected_initiator_mac.assign(payload.begin() + HASH_LENGTH, payload.end());
+  sodium_memzero(payload.data(), payload.size());
+  return Result::Success;
+}
+
+Result StateCookieKeyRing::redeem(const uint8_t* cookie, size_t cookie_length) {
+  if (cookie == nullptr || cookie_length != STATE_COOKIE_LENGTH) {
+    return Result::InvalidInput;
+  }
+  return impl_->redeem(cookie, Clock::now());
+}
+
+StatelessResponder::StatelessResponder(
+    const ResponderKeyPair& responder_keypair,
+    const StateCookieConfig& config)
+    : responder_(responder_keypair), key_ring_(config) {}
+
+StatelessResponder::~StatelessResponder() = default;
+
+Result StatelessResponder::generate_ke2(
+    const uint8_t* ke1_data,
+    size_t ke1_length,
+    const ResponderCredentials& credentials,
+    KE2& ke2,
+    secure_bytes& cookie,
+    const uint8_t* context,
+    size_t context_length) {
+  ResponderState state;
+  if (const Result result = responder_.generate_ke2(ke1_data, ke1_length, credentials, ke2, state);
+      result != Result::Success) {
+    return result;
+  }
+  return key_ring_.seal(state, context, context_length, cookie);
+}
+
+Result StatelessResponder::responder_finish(
+    const uint8_t* ke3_data,
+    size_t ke3_length,
+    const uint8_t* cookie,
+    size_t cookie_length,
+    secure_bytes& session_key,
+    const uint8_t* context,
+    size_t context_length) {
+  ResponderState state;
+  if (const Result result = key_ring_.open(cookie, cookie_length, context, context_length, state);
+      result != Result::Success) {
+    return result;
+  }
+  Result result = OpaqueResponder::responder_finish(ke3_data, ke3_length, state, session_key);
+  if (result == Result::Success) {
+    result = key_ring_.redeem(cookie, cookie_length);
+  }
+  if (result != Result::Success) {
+    sodium_memzero(session_key.data(), session_key.size());
+    session_key.clear();
+  }
+  return result;
+}
+
+const secure_bytes& StatelessResponder::get_public_key() const {
+  return responder_.get_public_key();
+}
+
+void StatelessResponder::rotate_cookie_key() {
+  key_ring_.rotate();
+}
+
+}  // namespace ecliptix::security::opaque::responder
@@ -7,24 +7,40 @@ import Foundation
 public final class RSAEncryptionService {
 
     private let certificatePinningClient: CertificatePinningClient
+    private let loadKeys: () -> Result<Void, CertificatePinningError>
     private var isInitialized: Bool = false
 
     /// Creates RSA encryption service
     /// - Parameter certificatePinningClient: Certificate pinning client for RSA operations
-    public init(certificatePinningClient: CertificatePinningClient) {
+    public convenience init(certificatePinningClient: CertificatePinningClient) {
+        self.init(certificatePinningClient: certificatePinningClient, loadKeys: certificatePinningClient.initialize)
+    }
+
+    init(
+        certificatePinningClient: CertificatePinningClient,
+        loadKeys: @escaping () -> Result<Void, CertificatePinningError>
+    ) {
         self.certificatePinningClient = certificatePinningClient
+        self.loadKeys = loadKeys
+    }
+
+    /// Starts loading the native keys in the background so that a later `initialize()` finds them ready
+    /// - Note: Call early (e.g. at launch) to keep key loading off the cold-start path; does not
+    ///   report the load result
+    public func warmUp() {
+        certificatePinningClient.warmUp()
     }
 
     /// Initializes the RSA encryption service
     /// - Returns: Result indicating success or failure
+    /// - Note: Waits for the native keys to finish loading (immediately if `warmUp()` already
+    ///   finished) and succeeds only once they are usable
     public func initialize() -> Result<Void, ServiceFailure> {
         guard !isInitialized else {
             return .success(())
         }
 
-        let initResult = certificatePinningClient.initialize()
-
-        switch initResult {
+        switch loadKeys() {
         case .success:
             isInitialized = true
             Log.info("[RSAEncryption] [OK] Service initialized")
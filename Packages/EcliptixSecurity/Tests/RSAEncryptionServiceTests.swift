@@ -0,0 +1,57 @@
+import EcliptixCertificatePinning
+import XCTest
+
+@testable import EcliptixSecurity
+@testable import EcliptixCore
+
+final class RSAEncryptionServiceTests: XCTestCase {
+    func testInitializeFailsWhenKeysFailToLoad() {
+        let service = makeService { .failure(.initializationFailed("keys unavailable")) }
+
+        guard case .failure(.secureStoreEncryptionFailed(let message)) = service.initialize() else {
+            return XCTFail("initialize must report the key load failure")
+        }
+        XCTAssertTrue(message.contains("keys unavailable"))
+
+        XCTAssertEqual(
+            service.encryptPublicKeyExchange(data: Data([0x01])),
+            .failure(.secureStoreEncryptionFailed("RSA encryption service not initialized")))
+    }
+    func testInitializeSucceedsOnlyAfterKeysLoad() {
+        var attempts = 0
+        let service = makeService {
+            attempts += 1
+            return attempts == 1 ? .failure(.initializationFailed("not ready")) : .success(())
+        }
+
+        XCTAssertFalse(isSuccess(service.initialize()))
+        XCTAssertTrue(isSuccess(service.initialize()))
+        XCTAssertTrue(isSuccess(service.initialize()))
+        XCTAssertEqual(attempts, 2)
+    }
+    func testCleanupRequiresKeysToLoadAgain() {
+        var attempts = 0
+        let service = makeService {
+            attempts += 1
+            return .success(())
+        }
+
+        XCTAssertTrue(isSuccess(service.initialize()))
+        service.cleanup()
+        XCTAssertTrue(isSuccess(service.initialize()))
+        XCTAssertEqual(attempts, 2)
+    }
+
+    private func makeService(
+        loadKeys: @escaping () -> Result<Void, CertificatePinningError>
+    ) -> RSAEncryptionService {
+        RSAEncryptionService(certificatePinningClient: CertificatePinningClient(), loadKeys: loadKeys)
+    }
+
+    private func isSuccess(_ result: Result<Void, ServiceFailure>) -> Bool {
+        if case .success = result {
+            return true
+        }
+        return false
+    }
+}
@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+"""Generates the fixed-base table for the pinned OPAQUE server public key.
+
+Reads SERVER_PUBLIC_KEY from hardcoded_keys.h, decodes it as a ristretto255
+point and writes Packages/EcliptixOPAQUE/src/core/pinned_key_table.h with
+(j + 1) * 256^i * P for i in [0, 32), j in [0, 8) in the (y+x, y-x, 2dxy)
+precomputed form, as radix-2^51 limbs. Re-run whenever the pinned key changes.
+"""
+
+import re
+import sys
+from pathlib import Path
+
+PROJECT_ROOT = Path(__file__).resolve().parent.parent
+PACKAGE_DIR = PROJECT_ROOT / "Packages" / "EcliptixOPAQUE"
+KEYS_HEADER = PACKAGE_DIR / "include" / "opaque" / "hardcoded_keys.h"
+OUTPUT_HEADER = PACKAGE_DIR / "src" / "core" / "pinned_key_table.h"
+
+P = 2**255 - 19
+D = (-121665 * pow(121666, P - 2, P)) % P
+SQRT_M1 = pow(2, (P - 1) // 4, P)
+LIMB_MASK = (1 << 51) - 1
+
+
+def is_negative(value):
+    return (value % P) & 1
+
+
+def ct_abs(value):
+    value %= P
+    return P - value if is_negative(value) else value
+
+
+def sqrt_ratio_m1(u, v):
+    r = (u * pow(v, 3, P) * pow(u * pow(v, 7, P), (P - 5) // 8, P)) % P
+    check = (v * r * r) % P
+    correct = check == u % P
+    flipped = check == (-u) % P
+    flipped_i = check == (-u * SQRT_M1) % P
+    if flipped or flipped_i:
+        r = (r * SQRT_M1) % P
+    return correct or flipped, ct_abs(r)
+
+
+def ristretto_decode(encoded):
+    s = int.from_bytes(encoded, "little")
+    if s >= P or is_negative(s):
+        raise ValueError("non-canonical ristretto255 encoding")
+    ss = (s * s) % P
+    u1 = (1 - ss) % P
+    u2 = (1 + ss) % P
+    u2_sqr = (u2 * u2) % P
+    v = (-(D * u1 * u1) - u2_sqr) % P
+    was_square, invsqrt = sqrt_ratio_m1(1, (v * u2_sqr) % P)
+    den_x = (invsqrt * u2) % P
+    den_y = (invsqrt * den_x * v) % P
+    x = ct_abs(2 * s * den_x)
+    y = (u1 * den_y) % P
+    if not was_square or is_negative(x * y) or y == 0:
+        raise ValueError("invalid ristretto255 point")
+    return x, y
+
+
+def edwards_add(a, b):
+    x1, y1 = a
+    x2, y2 = b
+    dxy = (D * x1 * x2 * y1 * y2) % P
+    x3 = ((x1 * y2 + y1 * x2) * pow(1 + dxy, P - 2, P)) % P
+    y3 = ((y1 * y2 + x1 * x2) * pow(1 - dxy, P - 2, P)) % P
+    return x3, y3
+
+
+def limbs(value):
+    value %= P
+    return [(value >> (51 * i)) & LIMB_MASK for i in range(5)]
+
+
+def format_fe(value):
+    return "{" + ", ".join(f"0x{limb:013x}ULL" for limb in limbs(value)) + "}"
+
+
+def read_pinned_key():
+    text = KEYS_HEADER.read_text()
+    match = re.search(r"SERVER_PUBLIC_KEY\[32\]\s*=\s*\{([^}]*)\}", text)
+    if match is None:
+        sys.exit(f"SERVER_PUBLIC_KEY not found in {KEYS_HEADER}")
+    key = bytes(int(byte, 16) for byte in re.findall(r"0x[0-9a-fA-F]{2}", match.group(1)))
+    if len(key) != 32:
+        sys.exit("SERVER_PUBLIC_KEY must be 32 bytes")
+    return key
+
+
+def main():
+    key = read_pinned_key()
+    point = ristretto_decode(key)
+
+    rows = []
+    row_base = point
+    for _ in range(32):
+        entries = []
+        multiple = row_base
+        for _ in range(8):
+            x, y = multiple
+            entries.append(
+                "        {" + format_fe(y + x) + ",\n"
+                "         " + format_fe(y - x) + ",\n"
+                "         " + format_fe(2 * D * x * y) + "}"
+            )
+            multiple = edwards_add(multiple, row_base)
+        rows.append("    {\n" + ",\n".join(entries) + "\n    }")
+        for _ in range(8):
+            row_base = edwards_add(row_base, row_base)
+
+    key_bytes = ", ".join(f"0x{byte:02x}" for byte in key)
+    OUTPUT_HEADER.write_text(
+        "#pragma once\n"
+        "// Generated by scripts/generate_pinned_key_table.py from\n"
+        "// include/opaque/hardcoded_keys.h. Do not edit.\n"
+        "#include <cstdint>\n"
+        "\n"
+        "namespace ecliptix::security::opaque::crypto::detail {\n"
+        "\n"
+        f"constexpr uint8_t PINNED_TABLE_KEY[32] = {{{key_bytes}}};\n"
+        "\n"
+        "struct PinnedPrecomp {\n"
+        "  uint64_t yplusx[5];\n"
+        "  uint64_t yminusx[5];\n"
+        "  uint64_t xy2d[5];\n"
+        "};\n"
+        "\n"
+        "constexpr PinnedPrecomp PINNED_KEY_TABLE[32][8] = {\n"
+        + ",\n".join(rows)
+        + "\n};\n"
+        "\n"
+        "}  // namespace ecliptix::security::opaque::crypto::detail\n"
+    )
+    print(f"Wrote {OUTPUT_HEADER.relative_to(PROJECT_ROOT)}")
+
+
+if __name__ == "__main__":
+    main()